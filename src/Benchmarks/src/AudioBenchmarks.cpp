@@ -0,0 +1,79 @@
+#include "Benchmark.hpp"
+
+#include "Nexus-Core/Audio/AudioMixer.hpp"
+
+namespace Nexus::Benchmarks
+{
+	/// @brief Generates a clip containing a second of noise
+	Ref<Audio::AudioClip> GenerateNoiseClip(uint32_t channelCount, uint32_t sampleRate, uint32_t seed)
+	{
+		std::mt19937						  generator(seed);
+		std::uniform_real_distribution<float> noise(-1.0f, 1.0f);
+
+		Ref<Audio::AudioClip> clip = CreateRef<Audio::AudioClip>();
+		clip->ChannelCount		   = channelCount;
+		clip->SampleRate		   = sampleRate;
+		clip->Samples.resize((size_t)sampleRate * channelCount);
+
+		for (float &sample : clip->Samples) { sample = noise(generator); }
+
+		return clip;
+	}
+
+	void RunAudioBenchmarks()
+	{
+		std::cout << "\nAudio mixing\n";
+
+		const uint32_t sampleRate = 48000;
+		const uint32_t blockSize  = 512;
+
+		// clips at the output rate take the direct path, 44.1kHz clips and pitched voices have to be resampled
+		std::vector<Ref<Audio::AudioClip>> clips = {GenerateNoiseClip(1, sampleRate, 1),
+													GenerateNoiseClip(2, sampleRate, 2),
+													GenerateNoiseClip(1, 44100, 3),
+													GenerateNoiseClip(2, 44100, 4)};
+
+		for (uint32_t voiceCount : {32, 64, 128, 256})
+		{
+			for (bool resampled : {false, true})
+			{
+				Audio::AudioMixerDescription description = {};
+				description.MaxVoices					 = voiceCount;
+				description.BlockSize					 = blockSize;
+				Audio::AudioMixer mixer(description, CreateScope<Audio::NullAudioOutput>(sampleRate, blockSize));
+
+				for (uint32_t i = 0; i < voiceCount; i++)
+				{
+					Audio::VoiceDescription voice = {};
+					voice.Gain					  = 1.0f / voiceCount;
+					voice.Pan					  = (float)i / voiceCount * 2.0f - 1.0f;
+					voice.Looping				  = true;
+
+					if (resampled)
+					{
+						mixer.Play(clips[2 + i % 2], voice);
+					}
+					else
+					{
+						mixer.Play(clips[i % 2], voice);
+					}
+				}
+
+				std::vector<float> output(blockSize * 2);
+				BenchmarkResult	   result = Measure("Mix " + std::to_string(voiceCount) + " voices" + (resampled ? " (resampled)" : ""),
+												200,
+												[&]()
+												{
+													mixer.Mix(output);
+													DoNotOptimize(output);
+												});
+
+				// the proportion of the block's playback time that was spent mixing it
+				double blockMs		  = 1000.0 * blockSize / sampleRate;
+				result.AdditionalInfo = std::to_string(blockSize) + " frames, " + std::to_string(result.GetAverageMs() / blockMs * 100.0) +
+										"% of real time";
+				Report(result);
+			}
+		}
+	}
+}	 // namespace Nexus::Benchmarks
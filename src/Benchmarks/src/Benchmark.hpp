@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Benchmarks
+{
+	/// @brief The timings collected from running a benchmark a number of times
+	struct BenchmarkResult
+	{
+		std::string Name		  = {};
+		uint32_t	Iterations	  = 0;
+		double		TotalMs		  = 0.0;
+		double		MinMs		  = 0.0;
+		double		MaxMs		  = 0.0;
+		std::string AdditionalInfo = {};
+
+		double GetAverageMs() const
+		{
+			return Iterations > 0 ? TotalMs / Iterations : 0.0;
+		}
+	};
+
+	/// @brief Runs a function a number of times and records how long each run took
+	/// @tparam Func A callable taking no arguments
+	/// @param name The name to report the benchmark under
+	/// @param iterations The number of times to run the function
+	/// @param func The function to time
+	/// @return The collected timings
+	template<typename Func>
+	inline BenchmarkResult Measure(const std::string &name, uint32_t iterations, Func &&func)
+	{
+		BenchmarkResult result = {};
+		result.Name			   = name;
+		result.Iterations	   = iterations;
+		result.MinMs		   = std::numeric_limits<double>::max();
+
+		for (uint32_t i = 0; i < iterations; i++)
+		{
+			auto start = std::chrono::steady_clock::now();
+			func();
+			auto end = std::chrono::steady_clock::now();
+
+			double elapsed = std::chrono::duration<double, std::milli>(end - start).count();
+			result.TotalMs += elapsed;
+			result.MinMs = std::min(result.MinMs, elapsed);
+			result.MaxMs = std::max(result.MaxMs, elapsed);
+		}
+
+		return result;
+	}
+
+	inline void Report(const BenchmarkResult &result)
+	{
+		std::cout << std::left << std::setw(56) << result.Name << std::right << " avg " << std::setw(10) << std::fixed << std::setprecision(4)
+				  << result.GetAverageMs() << " ms, min " << std::setw(10) << result.MinMs << " ms, max " << std::setw(10) << result.MaxMs
+				  << " ms";
+
+		if (!result.AdditionalInfo.empty())
+		{
+			std::cout << "  (" << result.AdditionalInfo << ")";
+		}
+
+		std::cout << "\n";
+	}
+
+	/// @brief Prevents the compiler from optimising away a value that is only computed to be timed
+	template<typename T>
+	inline void DoNotOptimize(const T &value)
+	{
+		volatile const void *sink = &value;
+		(void)sink;
+	}
+
+	void RunPolygonBenchmarks();
+	void RunAudioBenchmarks();
+	void RunECSBenchmarks();
+	void RunTransformBenchmarks();
+	void RunSceneBenchmarks();
+	void RunCullingBenchmarks();
+	void RunProfilerBenchmarks();
+	void RunInstancingBenchmarks();
+	void RunSplineBenchmarks();
+	void RunImageBenchmarks();
+}	 // namespace Nexus::Benchmarks
@@ -0,0 +1,141 @@
+#include "Benchmark.hpp"
+
+#include "Nexus-Core/Renderer/BoundingVolumeHierarchy.hpp"
+
+namespace Nexus::Benchmarks
+{
+	/// @brief Scatters unit cubes with random rotations and scales across a large flat area, similar to an open world scene
+	std::vector<glm::mat4> GenerateInstanceTransforms(size_t count, uint32_t seed)
+	{
+		std::mt19937						  generator(seed);
+		std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+
+		std::vector<glm::mat4> transforms(count);
+		for (glm::mat4 &transform : transforms)
+		{
+			glm::vec3 position = glm::vec3(value(generator) * 1000.0f, value(generator) * 20.0f, value(generator) * 1000.0f);
+			glm::quat rotation = glm::normalize(glm::quat(value(generator), value(generator), value(generator), value(generator)));
+			glm::vec3 scale	   = glm::vec3(2.0f + value(generator));
+			transform		   = glm::translate(glm::mat4(1.0f), position) * glm::mat4_cast(rotation) * glm::scale(glm::mat4(1.0f), scale);
+		}
+
+		return transforms;
+	}
+
+	std::string DescribeDrawReduction(size_t visible, size_t total)
+	{
+		double			   reduction = 100.0 * (1.0 - (double)visible / (double)total);
+		std::ostringstream stream;
+		stream << visible << " of " << total << " draws recorded, " << std::fixed << std::setprecision(1) << reduction << "% culled";
+		return stream.str();
+	}
+
+	void RunCullingBenchmarks()
+	{
+		std::cout << "\nCulling\n";
+
+		const size_t		   instanceCount = 100000;
+		std::vector<glm::mat4> transforms	 = GenerateInstanceTransforms(instanceCount, 3);
+		Graphics::BoundingBox  meshBounds	 = {.Min = glm::vec3(-0.5f), .Max = glm::vec3(0.5f)};
+
+		std::vector<Graphics::BoundingBox> worldBounds(instanceCount);
+		for (size_t i = 0; i < instanceCount; i++) { worldBounds[i] = meshBounds.Transform(transforms[i]); }
+
+		glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+		glm::mat4 view		 = glm::lookAt(glm::vec3(0.0f, 10.0f, 0.0f), glm::vec3(0.0f, 10.0f, 1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+		Graphics::Frustum frustum(projection * view);
+
+		// testing every box is what the renderer would have to do without a hierarchy
+		{
+			size_t			visible = 0;
+			BenchmarkResult result	= Measure("Cull " + std::to_string(instanceCount) + " instances (every box)",
+											  50,
+											  [&]()
+											  {
+												  visible = 0;
+												  for (const Graphics::BoundingBox &bounds : worldBounds)
+												  {
+													  visible += frustum.Intersects(bounds) ? 1 : 0;
+												  }
+												  DoNotOptimize(visible);
+											  });
+
+			result.AdditionalInfo = DescribeDrawReduction(visible, instanceCount);
+			Report(result);
+		}
+
+		Graphics::BoundingVolumeHierarchy hierarchy;
+		std::vector<uint32_t>			  proxies(instanceCount);
+
+		{
+			BenchmarkResult result = Measure("Insert " + std::to_string(instanceCount) + " instances into BVH",
+											 5,
+											 [&]()
+											 {
+												 hierarchy.Clear();
+												 for (size_t i = 0; i < instanceCount; i++)
+												 {
+													 proxies[i] = hierarchy.Insert(worldBounds[i], (uint32_t)i);
+												 }
+											 });
+
+			result.AdditionalInfo = "height " + std::to_string(hierarchy.GetHeight());
+			Report(result);
+		}
+
+		// matches the renderer, which tests the exact bounds of each instance whose enlarged box was found by the hierarchy
+		{
+			std::vector<uint32_t> candidates;
+			size_t				  visible = 0;
+			BenchmarkResult		  result  = Measure("Cull " + std::to_string(instanceCount) + " instances (BVH)",
+													50,
+													[&]()
+													{
+														candidates.clear();
+														hierarchy.Query(frustum, candidates);
+
+														visible = 0;
+														for (uint32_t index : candidates)
+														{
+															visible += frustum.Intersects(worldBounds[index]) ? 1 : 0;
+														}
+														DoNotOptimize(visible);
+													});
+
+			result.AdditionalInfo = DescribeDrawReduction(visible, instanceCount);
+			Report(result);
+		}
+
+		// movements smaller than the margin stay inside the enlarged boxes, larger ones reinsert the leaf
+		std::mt19937						  generator(4);
+		std::uniform_int_distribution<size_t> pick(0, instanceCount - 1);
+		const size_t						  moveCount = instanceCount / 10;
+
+		for (float distance : {0.01f, 5.0f})
+		{
+			size_t		reinserted = 0;
+			std::string name	   = std::string(distance < 0.1f ? "Refit BVH after small movements of " : "Refit BVH after large movements of ") +
+									 std::to_string(moveCount) + " instances";
+
+			BenchmarkResult result = Measure(name,
+											 20,
+											 [&]()
+											 {
+												 reinserted = 0;
+												 for (size_t i = 0; i < moveCount; i++)
+												 {
+													 size_t	   index  = pick(generator);
+													 glm::vec3 offset = glm::vec3(distance, 0.0f, (i % 2 == 0) ? distance : -distance);
+
+													 worldBounds[index].Min += offset;
+													 worldBounds[index].Max += offset;
+													 reinserted += hierarchy.Move(proxies[index], worldBounds[index]) ? 1 : 0;
+												 }
+											 });
+
+			result.AdditionalInfo = std::to_string(reinserted) + " of " + std::to_string(moveCount) + " leaves reinserted";
+			Report(result);
+		}
+	}
+}	 // namespace Nexus::Benchmarks
@@ -0,0 +1,125 @@
+#include "Benchmark.hpp"
+
+#include "Nexus-Core/ECS/Registry.hpp"
+
+namespace Nexus::Benchmarks
+{
+	/// @brief A component that records which entity it belongs to, so that data ending up on the wrong entity can be detected
+	struct ChurnComponent
+	{
+		uint64_t Owner = 0;
+		uint64_t Value = 0;
+	};
+
+	/// @brief Repeatedly removes a random component and adds a replacement, returning the number of components that no longer match
+	/// the value that was last written to them
+	size_t RunArrayChurn(ECS::ComponentArray<ChurnComponent> &components,
+						 std::vector<ECS::ComponentHandle>	 &handles,
+						 std::vector<uint64_t>				 &expected,
+						 std::mt19937						 &generator,
+						 size_t								  cycles)
+	{
+		std::uniform_int_distribution<size_t> pick(0, handles.size() - 1);
+
+		for (size_t cycle = 0; cycle < cycles; cycle++)
+		{
+			size_t owner = pick(generator);
+			components.RemoveComponent(handles[owner]);
+
+			expected[owner] = generator();
+			handles[owner]	= components.AddComponent(ChurnComponent {.Owner = owner, .Value = expected[owner]});
+		}
+
+		size_t mismatches = 0;
+		for (size_t owner = 0; owner < handles.size(); owner++)
+		{
+			ChurnComponent *component = components.GetComponent(handles[owner]);
+			if (!component || component->Owner != owner || component->Value != expected[owner])
+			{
+				mismatches++;
+			}
+		}
+
+		return mismatches;
+	}
+
+	void RunECSBenchmarks()
+	{
+		std::cout << "\nECS component churn\n";
+
+		const size_t entityCount = 10000;
+
+		// the component array on its own, this is the cost of the swap and pop removal and slot reuse
+		{
+			const size_t cycles = 5000000;
+
+			ECS::ComponentArray<ChurnComponent> components;
+			std::vector<ECS::ComponentHandle>	handles(entityCount);
+			std::vector<uint64_t>				expected(entityCount);
+			std::mt19937						generator(1);
+
+			for (size_t owner = 0; owner < entityCount; owner++)
+			{
+				handles[owner] = components.AddComponent(ChurnComponent {.Owner = owner, .Value = expected[owner]});
+			}
+
+			size_t			mismatches = 0;
+			BenchmarkResult result	   = Measure("ComponentArray remove/add " + std::to_string(cycles) + " cycles",
+											 5,
+											 [&]() { mismatches += RunArrayChurn(components, handles, expected, generator, cycles); });
+
+			result.AdditionalInfo = std::to_string(result.GetAverageMs() * 1000000.0 / cycles) + " ns per cycle, " +
+									(mismatches == 0 ? "integrity ok" : std::to_string(mismatches) + " mismatched components");
+			Report(result);
+		}
+
+		// the same churn through the registry, which also has to maintain each entity's list of components
+		{
+			const size_t cycles = 1000000;
+
+			ECS::Registry		  registry;
+			std::vector<GUID>	  entities;
+			std::vector<uint64_t> expected(entityCount);
+			std::mt19937		  generator(2);
+
+			for (size_t owner = 0; owner < entityCount; owner++)
+			{
+				entities.push_back(GUID((uint64_t)owner + 1));
+				registry.AddComponent<ChurnComponent>(entities.back(), ChurnComponent {.Owner = owner, .Value = expected[owner]});
+			}
+
+			std::uniform_int_distribution<size_t> pick(0, entityCount - 1);
+			const char							 *typeName = typeid(ChurnComponent).name();
+
+			BenchmarkResult result = Measure("Registry remove/add " + std::to_string(cycles) + " cycles",
+											 5,
+											 [&]()
+											 {
+												 for (size_t cycle = 0; cycle < cycles; cycle++)
+												 {
+													 size_t				  owner		 = pick(generator);
+													 ECS::ComponentHandle handle	 = registry.GetAllComponents(entities[owner])[0].handle;
+													 registry.RemoveComponent(entities[owner], typeName, handle);
+
+													 expected[owner] = generator();
+													 registry.AddComponent<ChurnComponent>(entities[owner],
+																						   ChurnComponent {.Owner = owner, .Value = expected[owner]});
+												 }
+											 });
+
+			size_t mismatches = 0;
+			for (size_t owner = 0; owner < entityCount; owner++)
+			{
+				ChurnComponent *component = registry.GetComponent<ChurnComponent>(entities[owner]);
+				if (!component || component->Owner != owner || component->Value != expected[owner])
+				{
+					mismatches++;
+				}
+			}
+
+			result.AdditionalInfo = std::to_string(result.GetAverageMs() * 1000000.0 / cycles) + " ns per cycle, " +
+									(mismatches == 0 ? "integrity ok" : std::to_string(mismatches) + " mismatched components");
+			Report(result);
+		}
+	}
+}	 // namespace Nexus::Benchmarks
@@ -0,0 +1,127 @@
+#include "Benchmark.hpp"
+
+#include "Nexus-Core/Graphics/PixelConversion.hpp"
+
+namespace Nexus::Benchmarks
+{
+	/// @brief The previous approach, which swapped each byte of each channel of each pixel with the matching byte in the opposite row
+	void FlipPixelsPerByte(uint8_t *pixels, uint32_t width, uint32_t height, uint32_t bytesPerPixel)
+	{
+		for (uint32_t j = 0; j < height / 2; ++j)
+		{
+			for (uint32_t i = 0; i < width; ++i)
+			{
+				for (uint32_t b = 0; b < bytesPerPixel; ++b)
+				{
+					std::swap(pixels[j * width * bytesPerPixel + i * bytesPerPixel + b],
+							  pixels[(height - 1 - j) * width * bytesPerPixel + i * bytesPerPixel + b]);
+				}
+			}
+		}
+	}
+
+	void RunImageBenchmarks()
+	{
+		std::cout << "\nImages\n";
+
+		// a 2048x2048 texture, similar to a material map loaded from disk
+		const uint32_t		  size		 = 2048;
+		const size_t		  pixelCount = (size_t)size * size;
+		std::vector<uint8_t>  pixels(pixelCount * 4);
+		std::vector<uint8_t>  output(pixelCount * 4);
+		std::vector<float>	  linear(pixelCount * 4);
+		std::vector<uint16_t> halves(pixelCount * 4);
+
+		std::mt19937						  generator(4);
+		std::uniform_int_distribution<int>	  byte(0, 255);
+		std::uniform_real_distribution<float> value(0.0f, 1.0f);
+		for (uint8_t &pixel : pixels) { pixel = (uint8_t)byte(generator); }
+		for (float &channel : linear) { channel = value(generator); }
+
+		std::string name = std::to_string(size) + "x" + std::to_string(size);
+
+		{
+			BenchmarkResult result = Measure("Flip " + name + " RGBA8 (per byte)",
+											 20,
+											 [&]()
+											 {
+												 FlipPixelsPerByte(pixels.data(), size, size, 4);
+												 DoNotOptimize(pixels);
+											 });
+			Report(result);
+		}
+
+		{
+			BenchmarkResult result = Measure("Flip " + name + " RGBA8 (row swap)",
+											 20,
+											 [&]()
+											 {
+												 Graphics::FlipRows(pixels.data(), (size_t)size * 4, size);
+												 DoNotOptimize(pixels);
+											 });
+			Report(result);
+		}
+
+		// the previous conversion of embedded BGRA textures, one pixel at a time
+		{
+			BenchmarkResult result = Measure("Swap red and blue of " + name + " (per pixel)",
+											 20,
+											 [&]()
+											 {
+												 for (size_t i = 0; i < pixelCount; i++)
+												 {
+													 output[i * 4 + 0] = pixels[i * 4 + 2];
+													 output[i * 4 + 1] = pixels[i * 4 + 1];
+													 output[i * 4 + 2] = pixels[i * 4 + 0];
+													 output[i * 4 + 3] = pixels[i * 4 + 3];
+												 }
+												 DoNotOptimize(output);
+											 });
+			Report(result);
+		}
+
+		{
+			BenchmarkResult result = Measure("Swap red and blue of " + name + " (batched)",
+											 20,
+											 [&]()
+											 {
+												 Graphics::SwapRedAndBlue(pixels.data(), output.data(), pixelCount);
+												 DoNotOptimize(output);
+											 });
+			Report(result);
+		}
+
+		{
+			BenchmarkResult result = Measure("Premultiply alpha of " + name,
+											 20,
+											 [&]()
+											 {
+												 Graphics::PremultiplyAlpha(pixels.data(), output.data(), pixelCount);
+												 DoNotOptimize(output);
+											 });
+			Report(result);
+		}
+
+		{
+			BenchmarkResult result = Measure("Encode " + name + " linear RGBA32F as sRGB",
+											 20,
+											 [&]()
+											 {
+												 Graphics::ConvertLinearToSRGB(linear.data(), output.data(), pixelCount);
+												 DoNotOptimize(output);
+											 });
+			Report(result);
+		}
+
+		{
+			BenchmarkResult result = Measure("Convert " + name + " RGBA32F to RGBA16F",
+											 20,
+											 [&]()
+											 {
+												 Graphics::ConvertFloatToHalf(linear, halves.data());
+												 DoNotOptimize(halves);
+											 });
+			Report(result);
+		}
+	}
+}	 // namespace Nexus::Benchmarks
@@ -0,0 +1,137 @@
+#include "Benchmark.hpp"
+
+#include "Nexus-Core/Renderer/Renderer3D.hpp"
+
+namespace Nexus::Benchmarks
+{
+	/// @brief Records the commands that Renderer3D records to draw a mesh, without any GPU resources behind them
+	void RecordMeshDraw(Graphics::CommandList &commandList, const Graphics::MeshLodRange &lod, uint32_t firstInstance, uint32_t instanceCount)
+	{
+		commandList.SetResourceSet(nullptr);
+		commandList.SetVertexBuffer({}, 0);
+		commandList.SetIndexBuffer({});
+
+		Graphics::DrawIndexedDescription drawDesc = {};
+		drawDesc.IndexStart						  = lod.IndexStart;
+		drawDesc.IndexCount						  = lod.IndexCount;
+		drawDesc.InstanceStart					  = firstInstance;
+		drawDesc.InstanceCount					  = instanceCount;
+		commandList.DrawIndexed(drawDesc);
+	}
+
+	Graphics::ModelInstanceData CreateModelInstanceData(const Graphics::MeshInstance &instance)
+	{
+		std::pair<uint32_t, uint32_t> splitId = instance.Guid.Split();
+		return {.Transform = instance.Transform, .Guid1 = splitId.first, .Guid2 = splitId.second};
+	}
+
+	/// @brief The previous approach, writing the uniforms of each mesh of each model and recording a draw for it
+	void RecordDrawPerMesh(Graphics::CommandList					 &commandList,
+						   const std::vector<Graphics::MeshInstance> &instances,
+						   const std::vector<uint32_t>				 &visible)
+	{
+		commandList.Begin();
+		commandList.SetPipeline(nullptr);
+
+		for (uint32_t index : visible)
+		{
+			const Graphics::MeshInstance &instance = instances[index];
+			Graphics::ModelInstanceData	  uniforms = CreateModelInstanceData(instance);
+			DoNotOptimize(uniforms);
+
+			RecordMeshDraw(commandList, instance.Mesh->GetLods()[instance.Lod], 0, 1);
+		}
+
+		commandList.End();
+	}
+
+	/// @brief Matches the renderer, which groups the visible meshes into batches and writes every transform into one instance buffer
+	void RecordInstancedBatches(Graphics::CommandList					  &commandList,
+								const std::vector<Graphics::MeshInstance> &instances,
+								std::vector<uint32_t>					  &visible,
+								std::vector<Graphics::MeshDrawBatch>	  &batches,
+								std::vector<Graphics::ModelInstanceData>  &instanceData)
+	{
+		Graphics::BuildMeshDrawBatches(instances, visible, batches);
+
+		instanceData.resize(visible.size());
+		for (size_t i = 0; i < visible.size(); i++) { instanceData[i] = CreateModelInstanceData(instances[visible[i]]); }
+		DoNotOptimize(instanceData);
+
+		commandList.Begin();
+		commandList.SetPipeline(nullptr);
+		commandList.SetVertexBuffer({}, 1);
+
+		for (const Graphics::MeshDrawBatch &batch : batches)
+		{
+			RecordMeshDraw(commandList, batch.Mesh->GetLods()[batch.Lod], batch.FirstInstance, batch.InstanceCount);
+		}
+
+		commandList.End();
+	}
+
+	std::string DescribeCommands(size_t commands, size_t draws, size_t uploads)
+	{
+		std::ostringstream stream;
+		stream << commands << " commands, " << draws << " draws, " << uploads << " buffer uploads";
+		return stream.str();
+	}
+
+	void RunInstancingBenchmarks()
+	{
+		std::cout << "\nInstancing\n";
+
+		// copies of a model made of a few meshes with three levels of detail each, similar to an imported prop scattered over a scene
+		const size_t						modelCount = 10000;
+		const size_t						meshCount  = 3;
+		std::vector<Graphics::MeshLodRange> lods	   = {{.IndexStart = 0, .IndexCount = 3000, .Error = 0.0f},
+														  {.IndexStart = 3000, .IndexCount = 1500, .Error = 0.01f},
+														  {.IndexStart = 4500, .IndexCount = 750, .Error = 0.1f}};
+
+		std::vector<Ref<Graphics::Mesh>> meshes = {};
+		for (size_t i = 0; i < meshCount; i++)
+		{
+			meshes.push_back(CreateRef<Graphics::Mesh>(nullptr, nullptr, Graphics::Material {}, "Mesh", Graphics::BoundingBox {}, lods));
+		}
+
+		std::mt19937							generator(5);
+		std::uniform_int_distribution<uint32_t> pickLod(0, (uint32_t)lods.size() - 1);
+		std::vector<Graphics::MeshInstance>		instances = {};
+		std::vector<uint32_t>					visible	  = {};
+		for (size_t model = 0; model < modelCount; model++)
+		{
+			glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3((float)(model % 100), 0.0f, (float)(model / 100)));
+			uint32_t  lod		= pickLod(generator);
+
+			for (const Ref<Graphics::Mesh> &mesh : meshes)
+			{
+				visible.push_back((uint32_t)instances.size());
+				instances.push_back({.Mesh = mesh, .Transform = transform, .Lod = lod});
+			}
+		}
+
+		Graphics::CommandList commandList({.DebugName = "Instancing", .AutomaticBarrierTransitions = false});
+
+		{
+			BenchmarkResult result = Measure("Record " + std::to_string(modelCount) + " models (draw per mesh)",
+											 20,
+											 [&]() { RecordDrawPerMesh(commandList, instances, visible); });
+
+			result.AdditionalInfo = DescribeCommands(commandList.GetCommandData().size(), visible.size(), visible.size());
+			Report(result);
+		}
+
+		{
+			std::vector<Graphics::MeshDrawBatch>	 batches;
+			std::vector<Graphics::ModelInstanceData> instanceData;
+
+			BenchmarkResult result = Measure("Record " + std::to_string(modelCount) + " models (instanced batches)",
+											 20,
+											 [&]() { RecordInstancedBatches(commandList, instances, visible, batches, instanceData); });
+
+			// each batch writes the uniforms of its mesh, and every transform is written to the instance buffer at once
+			result.AdditionalInfo = DescribeCommands(commandList.GetCommandData().size(), batches.size(), batches.size() + 1);
+			Report(result);
+		}
+	}
+}	 // namespace Nexus::Benchmarks
@@ -0,0 +1,78 @@
+#include "Benchmark.hpp"
+
+#include "Nexus-Core/Utils/Utils.hpp"
+
+namespace Nexus::Benchmarks
+{
+	/// @brief Generates a concave polygon that is star-shaped around the origin. Every vertex is placed at a strictly increasing angle
+	/// with a positive radius, so the outline is simple however the noise moves the vertices and the triangulator never takes the path
+	/// that it uses for self-intersecting input.
+	std::vector<glm::vec2> GenerateStarPolygon(size_t vertexCount, uint32_t seed)
+	{
+		std::mt19937						  generator(seed);
+		std::uniform_real_distribution<float> noise(-1.0f, 1.0f);
+
+		std::vector<glm::vec2> polygon;
+		polygon.reserve(vertexCount);
+
+		double step = glm::two_pi<double>() / (double)vertexCount;
+		for (size_t i = 0; i < vertexCount; i++)
+		{
+			// the angular noise stays within a quarter of the spacing between vertices, which keeps the angles in order
+			double angle  = step * ((double)i + 0.25 * noise(generator));
+			double radius = 100.0 + 20.0 * std::sin(angle * 7.0) + noise(generator);
+			polygon.push_back({(float)(radius * std::cos(angle)), (float)(radius * std::sin(angle))});
+		}
+
+		return polygon;
+	}
+
+	void RunPolygonBenchmarks()
+	{
+		std::cout << "Polygon triangulation\n";
+
+		for (size_t vertexCount : {10, 100, 1'000, 10'000, 100'000})
+		{
+			std::vector<glm::vec2> polygon = GenerateStarPolygon(vertexCount, 1234);
+			std::vector<uint32_t>  indices;
+			bool				   success = true;
+
+			uint32_t		iterations = vertexCount >= 100'000 ? 5 : 50;
+			BenchmarkResult result	   = Measure("Triangulate " + std::to_string(vertexCount) + " vertices",
+											 iterations,
+											 [&]()
+											 {
+												 indices.clear();
+												 success &= Nexus::Utils::Triangulate(polygon, indices);
+												 DoNotOptimize(indices);
+											 });
+
+			result.AdditionalInfo = std::to_string(indices.size() / 3) + " triangles" + (success ? "" : ", FAILED");
+			Report(result);
+		}
+
+		std::cout << "\nPolygon clipping\n";
+
+		std::vector<glm::vec2> clip = {{-50.0f, -50.0f}, {50.0f, -50.0f}, {50.0f, 50.0f}, {-50.0f, 50.0f}};
+
+		for (size_t vertexCount : {10, 100, 1'000, 10'000, 100'000})
+		{
+			std::vector<glm::vec2> subject = GenerateStarPolygon(vertexCount, 1234);
+			std::vector<glm::vec2> output;
+			std::vector<glm::vec2> scratch;
+
+			BenchmarkResult result = Measure("SutherlandHodgman " + std::to_string(vertexCount) + " vertices",
+											 50,
+											 [&]()
+											 {
+												 Nexus::Utils::SutherlandHodgman(subject, clip, output, scratch);
+												 DoNotOptimize(output);
+											 });
+
+			result.AdditionalInfo = std::to_string(output.size()) + " output vertices";
+			Report(result);
+		}
+
+		std::cout << "\n";
+	}
+}	 // namespace Nexus::Benchmarks
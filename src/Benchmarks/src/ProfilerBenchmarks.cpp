@@ -0,0 +1,62 @@
+#include "Benchmark.hpp"
+
+#include "Nexus-Core/Timings/Profiler.hpp"
+#include "Nexus-Core/Timings/Timer.hpp"
+
+namespace Nexus::Benchmarks
+{
+	std::string DescribeScopeCost(const BenchmarkResult &result, size_t scopeCount)
+	{
+		std::ostringstream stream;
+		stream << std::fixed << std::setprecision(1) << result.GetAverageMs() * 1'000'000.0 / scopeCount << " ns per scope";
+		return stream.str();
+	}
+
+	void RunProfilerBenchmarks()
+	{
+		std::cout << "\nProfiler\n";
+
+		const size_t scopeCount = 10000;
+
+		// the previous approach, building a name for every scope and storing it in a single shared vector
+		{
+			std::vector<Timings::ProfileResult> results;
+			std::vector<std::string>			names;
+
+			BenchmarkResult result = Measure("Record " + std::to_string(scopeCount) + " scopes (ProfilingTimer)",
+											 50,
+											 [&]()
+											 {
+												 for (size_t i = 0; i < scopeCount; i++)
+												 {
+													 Timings::ProfilingTimer timer("Scope");
+													 timer.OnStop.Bind(
+														 [&](TimeSpan time)
+														 {
+															 names.push_back(timer.GenerateName());
+															 results.push_back(Timings::ProfileResult {.Name = names.back().c_str(), .Time = time});
+														 });
+												 }
+												 names.clear();
+												 results.clear();
+											 });
+			result.AdditionalInfo = DescribeScopeCost(result, scopeCount);
+			Report(result);
+		}
+
+		{
+			Timings::Profiler &profiler = Timings::Profiler::Get();
+
+			BenchmarkResult result = Measure("Record " + std::to_string(scopeCount) + " scopes (per-thread ring buffer)",
+											 50,
+											 [&]()
+											 {
+												 for (size_t i = 0; i < scopeCount; i++) { Timings::ProfileScope scope("Scope"); }
+												 profiler.Flush();
+												 profiler.Reset();
+											 });
+			result.AdditionalInfo = DescribeScopeCost(result, scopeCount);
+			Report(result);
+		}
+	}
+}	 // namespace Nexus::Benchmarks
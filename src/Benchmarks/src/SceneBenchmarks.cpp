@@ -0,0 +1,188 @@
+#include "Benchmark.hpp"
+
+#include "Nexus-Core/Runtime/BinaryScene.hpp"
+
+namespace Nexus::Benchmarks
+{
+	/// @brief A trivially copyable component, which is blitted when loading a binary scene
+	struct ScenePhysicsComponent
+	{
+		glm::vec3 Velocity = {};
+		float	  Mass	   = 1.0f;
+
+		friend std::ostream &operator<<(std::ostream &os, const ScenePhysicsComponent &component)
+		{
+			return os << component.Velocity.x << " " << component.Velocity.y << " " << component.Velocity.z << " " << component.Mass;
+		}
+
+		friend std::istream &operator>>(std::istream &is, ScenePhysicsComponent &component)
+		{
+			return is >> component.Velocity.x >> component.Velocity.y >> component.Velocity.z >> component.Mass;
+		}
+	};
+
+	/// @brief A component containing a string, which is decoded using its stream operators when loading a binary scene
+	struct SceneLabelComponent
+	{
+		std::string Label = {};
+
+		friend std::ostream &operator<<(std::ostream &os, const SceneLabelComponent &component)
+		{
+			return os << std::quoted(component.Label);
+		}
+
+		friend std::istream &operator>>(std::istream &is, SceneLabelComponent &component)
+		{
+			return is >> std::quoted(component.Label);
+		}
+	};
+}	 // namespace Nexus::Benchmarks
+
+namespace YAML
+{
+	template<>
+	struct convert<Nexus::Benchmarks::ScenePhysicsComponent>
+	{
+		static Node encode(const Nexus::Benchmarks::ScenePhysicsComponent &rhs)
+		{
+			Node node;
+			node["X"]	 = rhs.Velocity.x;
+			node["Y"]	 = rhs.Velocity.y;
+			node["Z"]	 = rhs.Velocity.z;
+			node["Mass"] = rhs.Mass;
+			return node;
+		}
+
+		static bool decode(const Node &node, Nexus::Benchmarks::ScenePhysicsComponent &rhs)
+		{
+			rhs.Velocity = glm::vec3(node["X"].as<float>(), node["Y"].as<float>(), node["Z"].as<float>());
+			rhs.Mass	 = node["Mass"].as<float>();
+			return true;
+		}
+	};
+
+	template<>
+	struct convert<Nexus::Benchmarks::SceneLabelComponent>
+	{
+		static Node encode(const Nexus::Benchmarks::SceneLabelComponent &rhs)
+		{
+			Node node;
+			node["Label"] = rhs.Label;
+			return node;
+		}
+
+		static bool decode(const Node &node, Nexus::Benchmarks::SceneLabelComponent &rhs)
+		{
+			rhs.Label = node["Label"].as<std::string>();
+			return true;
+		}
+	};
+}	 // namespace YAML
+
+namespace Nexus::Benchmarks
+{
+	/// @brief Writes a scene in the same layout as Scene::Serialize
+	void WriteYamlScene(const std::string &filepath, ECS::Registry &registry, const std::map<std::string, ECS::ComponentStorage> &components)
+	{
+		YAML::Emitter out;
+		out << YAML::BeginMap;
+		out << YAML::Key << "Scene" << YAML::Value << "Benchmark";
+		out << YAML::Key << "Environment" << YAML::Value << YAML::BeginMap;
+		out << YAML::Key << "ClearColour" << YAML::Value << YAML::Flow << YAML::BeginSeq << 0.0f << 0.0f << 0.0f << 1.0f << YAML::EndSeq;
+		out << YAML::Key << "Cubemap" << YAML::Value << "";
+		out << YAML::EndMap;
+
+		out << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
+		for (const Entity &entity : registry.GetEntities())
+		{
+			out << YAML::BeginMap;
+			out << YAML::Key << "Entity" << YAML::Value << entity.ID.Value;
+			out << YAML::Key << "Name" << YAML::Value << entity.Name;
+			out << YAML::Key << "Components" << YAML::Value << YAML::BeginSeq;
+			for (const ECS::ComponentPtr &component : registry.GetAllComponents(entity.ID))
+			{
+				const ECS::ComponentStorage &storage = components.at(component.typeName);
+
+				out << YAML::BeginMap;
+				out << YAML::Key << "Name" << YAML::Value << storage.DisplayName;
+				out << YAML::Key << "HierarchyIndex" << YAML::Value << component.entityComponentIndex;
+				out << YAML::Key << "Data" << YAML::Value << storage.YamlSerializer(registry.GetRawComponent(component));
+				out << YAML::EndMap;
+			}
+			out << YAML::EndSeq;
+			out << YAML::EndMap;
+		}
+		out << YAML::EndSeq;
+		out << YAML::EndMap;
+
+		std::ofstream(filepath) << out.c_str();
+	}
+
+	void RunSceneBenchmarks()
+	{
+		std::cout << "\nScene loading\n";
+
+		ECS::ComponentRegistry &componentRegistry = ECS::ComponentRegistry::GetRegistry();
+		componentRegistry.RegisterComponent<ScenePhysicsComponent>("Physics", {});
+		componentRegistry.RegisterComponent<SceneLabelComponent>("Label", {});
+		const std::map<std::string, ECS::ComponentStorage> &components = componentRegistry.GetRegisteredComponents();
+
+		const size_t entityCount = 20000;
+
+		ECS::Registry source;
+		for (size_t i = 0; i < entityCount; i++)
+		{
+			GUID guid((uint64_t)i + 1);
+			source.AddEntity(Entity(guid, "Entity " + std::to_string(i)));
+			source.AddComponent<ScenePhysicsComponent>(guid, ScenePhysicsComponent {.Velocity = glm::vec3((float)i), .Mass = 2.0f});
+
+			if (i % 4 == 0)
+			{
+				source.AddComponent<SceneLabelComponent>(guid, SceneLabelComponent {.Label = "Label " + std::to_string(i)});
+			}
+		}
+
+		std::filesystem::path directory		 = std::filesystem::temp_directory_path();
+		std::string			  yamlFilepath	 = (directory / "NexusBenchmarkScene.scene").string();
+		std::string			  binaryFilepath = (directory / "NexusBenchmarkScene.scenebin").string();
+
+		WriteYamlScene(yamlFilepath, source, components);
+		BinaryScene::ConvertYamlToBinary(yamlFilepath, binaryFilepath, components);
+
+		std::string sizes = std::to_string(std::filesystem::file_size(yamlFilepath) / 1024) + " KiB YAML, " +
+							std::to_string(std::filesystem::file_size(binaryFilepath) / 1024) + " KiB binary";
+
+		{
+			size_t			loadedEntities = 0;
+			BenchmarkResult result		   = Measure("Load " + std::to_string(entityCount) + " entities (YAML)",
+												 5,
+												 [&]()
+												 {
+													 ECS::Registry registry;
+													 BinaryScene::ReadYaml(yamlFilepath, registry, components);
+													 loadedEntities = registry.GetEntities().size();
+												 });
+
+			result.AdditionalInfo = std::to_string(loadedEntities) + " entities, " + sizes;
+			Report(result);
+		}
+
+		{
+			size_t			loadedEntities = 0;
+			BenchmarkResult result		   = Measure("Load " + std::to_string(entityCount) + " entities (binary)",
+												 5,
+												 [&]()
+												 {
+													 ECS::Registry registry;
+													 BinaryScene::Read(binaryFilepath, registry, components);
+													 loadedEntities = registry.GetEntities().size();
+												 });
+
+			result.AdditionalInfo = std::to_string(loadedEntities) + " entities, " + sizes;
+			Report(result);
+		}
+
+		std::filesystem::remove(yamlFilepath);
+		std::filesystem::remove(binaryFilepath);
+	}
+}	 // namespace Nexus::Benchmarks
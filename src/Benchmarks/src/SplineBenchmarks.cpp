@@ -0,0 +1,123 @@
+#include "Benchmark.hpp"
+
+#include "Nexus-Core/Graphics/CatmullRom.hpp"
+
+namespace Nexus::Benchmarks
+{
+	/// @brief The previous approach, which blended the four surrounding points with the uniform Catmull-Rom weights for every point
+	Point2D<float> EvaluateCatmullRomWeights(const std::vector<Point2D<float>> &points, float t)
+	{
+		size_t p1 = (size_t)t + 1;
+		size_t p0 = p1 - 1;
+		size_t p2 = p1 + 1;
+		size_t p3 = p1 + 2;
+		t		  = t - (float)(size_t)t;
+
+		float q1 = -t * t * t + 2.0f * t * t - t;
+		float q2 = 3.0f * t * t * t - 5.0f * t * t + 2.0f;
+		float q3 = -3.0f * t * t * t + 4.0f * t * t + t;
+		float q4 = t * t * t - t * t;
+
+		return {0.5f * (points[p0].X * q1 + points[p1].X * q2 + points[p2].X * q3 + points[p3].X * q4),
+				0.5f * (points[p0].Y * q1 + points[p1].Y * q2 + points[p2].Y * q3 + points[p3].Y * q4)};
+	}
+
+	void RunSplineBenchmarks()
+	{
+		std::cout << "\nSplines\n";
+
+		// a long path through random points, sampled at random parameters like particles spread along it
+		const size_t						  pointCount	 = 1000;
+		const size_t						  parameterCount = 1000000;
+		std::mt19937						  generator(7);
+		std::uniform_real_distribution<float> value(-100.0f, 100.0f);
+
+		std::vector<Point2D<float>> points2D = {};
+		std::vector<Point3D<float>> points3D = {};
+		for (size_t i = 0; i < pointCount; i++)
+		{
+			points2D.push_back({value(generator), value(generator)});
+			points3D.push_back({value(generator), value(generator), value(generator)});
+		}
+
+		Graphics::CatmullRom<float> spline2D;
+		spline2D.SetPoints(points2D);
+
+		Graphics::CatmullRom<float, 3> spline3D;
+		spline3D.SetParameterization(Graphics::CatmullRomParameterization::Centripetal);
+		spline3D.SetPoints(points3D);
+
+		std::uniform_real_distribution<float> parameter(0.0f, (float)spline2D.GetNumberOfSegments() - 0.001f);
+		std::vector<float>					  parameters(parameterCount);
+		for (float &t : parameters) { t = parameter(generator); }
+
+		std::vector<Point2D<float>> output2D(parameterCount);
+		std::vector<Point3D<float>> output3D(parameterCount);
+		std::string					name = std::to_string(parameterCount) + " points";
+
+		{
+			BenchmarkResult result = Measure("Evaluate " + name + " (weights per point)",
+											 20,
+											 [&]()
+											 {
+												 for (size_t i = 0; i < parameterCount; i++)
+												 {
+													 output2D[i] = EvaluateCatmullRomWeights(points2D, parameters[i]);
+												 }
+												 DoNotOptimize(output2D);
+											 });
+			Report(result);
+		}
+
+		{
+			BenchmarkResult result = Measure("Evaluate " + name + " (polynomial per point)",
+											 20,
+											 [&]()
+											 {
+												 for (size_t i = 0; i < parameterCount; i++) { output2D[i] = spline2D.GetPoint(parameters[i]); }
+												 DoNotOptimize(output2D);
+											 });
+			Report(result);
+		}
+
+		{
+			BenchmarkResult result = Measure("Evaluate " + name + " (batched)",
+											 20,
+											 [&]()
+											 {
+												 spline2D.EvaluatePoints(parameters, output2D);
+												 DoNotOptimize(output2D);
+											 });
+			Report(result);
+		}
+
+		{
+			BenchmarkResult result = Measure("Evaluate " + name + " in 3D (batched)",
+											 20,
+											 [&]()
+											 {
+												 spline3D.EvaluatePoints(parameters, output3D);
+												 DoNotOptimize(output3D);
+											 });
+			Report(result);
+		}
+
+		// moving along the spline at a constant speed, which searches the arc length table for each distance
+		const size_t distanceCount = 100000;
+		float		 step		   = spline3D.GetLength() / (float)distanceCount;
+
+		{
+			BenchmarkResult result = Measure("Find " + std::to_string(distanceCount) + " points at distances along the spline",
+											 20,
+											 [&]()
+											 {
+												 for (size_t i = 0; i < distanceCount; i++)
+												 {
+													 output3D[i] = spline3D.GetPointAtDistance((float)i * step);
+												 }
+												 DoNotOptimize(output3D);
+											 });
+			Report(result);
+		}
+	}
+}	 // namespace Nexus::Benchmarks
@@ -0,0 +1,92 @@
+#include "Benchmark.hpp"
+
+#include "Nexus-Core/ECS/TransformHierarchy.hpp"
+
+namespace Nexus::Benchmarks
+{
+	/// @brief Generates transforms with random positions, rotations and scales
+	std::vector<ECS::LocalTransform> GenerateTransforms(size_t count, uint32_t seed)
+	{
+		std::mt19937						  generator(seed);
+		std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+
+		std::vector<ECS::LocalTransform> transforms(count);
+		for (ECS::LocalTransform &transform : transforms)
+		{
+			transform.Position = glm::vec3(value(generator), value(generator), value(generator)) * 100.0f;
+			transform.Rotation = glm::normalize(glm::quat(value(generator), value(generator), value(generator), value(generator)));
+			transform.Scale	   = glm::vec3(1.0f + value(generator) * 0.5f);
+		}
+
+		return transforms;
+	}
+
+	void RunTransformBenchmarks()
+	{
+		std::cout << "\nTransforms\n";
+
+		const size_t					 transformCount = 10000;
+		std::vector<ECS::LocalTransform> transforms		= GenerateTransforms(transformCount, 1);
+		std::vector<glm::mat4>			 matrices(transformCount);
+
+		// the previous approach, building the matrix from separate translate, rotate and scale matrices
+		{
+			BenchmarkResult result = Measure("Compose " + std::to_string(transformCount) + " transforms (glm)",
+											 200,
+											 [&]()
+											 {
+												 for (size_t i = 0; i < transformCount; i++)
+												 {
+													 matrices[i] = glm::translate(glm::mat4(1.0f), transforms[i].Position) *
+																   glm::mat4_cast(transforms[i].Rotation) *
+																   glm::scale(glm::mat4(1.0f), transforms[i].Scale);
+												 }
+												 DoNotOptimize(matrices);
+											 });
+			Report(result);
+		}
+
+		{
+			BenchmarkResult result = Measure("Compose " + std::to_string(transformCount) + " transforms (batched)",
+											 200,
+											 [&]()
+											 {
+												 ECS::ComposeTransforms(transforms, matrices.data());
+												 DoNotOptimize(matrices);
+											 });
+			Report(result);
+		}
+
+		// a forest of small hierarchies, similar to a scene of characters with a few levels of attachments each
+		ECS::TransformHierarchy				  hierarchy;
+		std::vector<ECS::TransformNode>		  nodes;
+		std::uniform_int_distribution<size_t> pick(0, transformCount - 1);
+		std::mt19937						  generator(2);
+
+		for (size_t i = 0; i < transformCount; i++)
+		{
+			ECS::TransformNode parent = (i % 10 == 0) ? ECS::TransformNode {} : nodes[i - 1 - (i % 3 == 0 ? 1 : 0)];
+			nodes.push_back(hierarchy.Create(transforms[i], parent));
+		}
+		hierarchy.Update();
+
+		for (size_t dirtyCount : {(size_t)0, transformCount / 100, transformCount / 10, transformCount})
+		{
+			size_t			recomputed = 0;
+			BenchmarkResult result	   = Measure("Update hierarchy with " + std::to_string(dirtyCount) + " changed nodes",
+											 200,
+											 [&]()
+											 {
+												 for (size_t i = 0; i < dirtyCount; i++)
+												 {
+													 size_t index = dirtyCount == transformCount ? i : pick(generator);
+													 hierarchy.SetLocalPosition(nodes[index], transforms[index].Position);
+												 }
+												 recomputed = hierarchy.Update();
+											 });
+
+			result.AdditionalInfo = std::to_string(recomputed) + " of " + std::to_string(transformCount) + " world matrices recomputed";
+			Report(result);
+		}
+	}
+}	 // namespace Nexus::Benchmarks
@@ -0,0 +1,19 @@
+#include "Benchmark.hpp"
+
+int main()
+{
+	std::cout << "Running Nexus benchmarks\n\n";
+
+	Nexus::Benchmarks::RunPolygonBenchmarks();
+	Nexus::Benchmarks::RunAudioBenchmarks();
+	Nexus::Benchmarks::RunECSBenchmarks();
+	Nexus::Benchmarks::RunTransformBenchmarks();
+	Nexus::Benchmarks::RunSceneBenchmarks();
+	Nexus::Benchmarks::RunCullingBenchmarks();
+	Nexus::Benchmarks::RunProfilerBenchmarks();
+	Nexus::Benchmarks::RunInstancingBenchmarks();
+	Nexus::Benchmarks::RunSplineBenchmarks();
+	Nexus::Benchmarks::RunImageBenchmarks();
+
+	return 0;
+}
@@ -37,7 +37,7 @@ namespace Demos
 		{
 			m_CommandList = m_CommandQueue->CreateCommandList();
 			Nexus::Graphics::MeshFactory factory(m_GraphicsDevice, m_CommandQueue);
-			m_Model = factory.CreateFrom3DModelFile(Nexus::FileSystem::GetFilePathAbsolute("resources/demo/models/The Boss/The Boss.dae"));
+			m_Model = factory.CreateFrom3DModelFile(Nexus::FileSystem::GetFilePathAbsolute("resources/demo/models/The Boss/The Boss.dae"), false);
 
 			Nexus::Graphics::DeviceBufferDescription cameraUniformBufferDesc = {};
 			cameraUniformBufferDesc.Access									 = Nexus::Graphics::BufferMemoryAccess::Upload;
@@ -135,13 +135,14 @@ namespace Demos
 				indexBufferView.BufferFormat					 = Nexus::Graphics::IndexFormat::UInt32;
 				m_CommandList->SetIndexBuffer(indexBufferView);
 
-				auto indexCount = mesh->GetIndexBuffer()->GetCount();
+				// the index buffer also contains the coarser levels of detail, so only the first level is drawn
+				const Nexus::Graphics::MeshLodRange &lod = mesh->GetLods()[0];
 
 				Nexus::Graphics::DrawIndexedDescription drawDesc = {};
 				drawDesc.VertexStart							 = 0;
-				drawDesc.IndexStart								 = 0;
+				drawDesc.IndexStart								 = lod.IndexStart;
 				drawDesc.InstanceStart							 = 0;
-				drawDesc.IndexCount								 = indexCount;
+				drawDesc.IndexCount								 = lod.IndexCount;
 				drawDesc.InstanceCount							 = 1;
 				m_CommandList->DrawIndexed(drawDesc);
 			}
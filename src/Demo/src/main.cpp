@@ -225,6 +225,7 @@ class DemoApplication : public Nexus::Application
 		NX_PROFILE_FUNCTION();
 		if (ImGui::CollapsingHeader("Performance"))
 		{
+			Nexus::Timings::Profiler::Get().Flush();
 			const auto &results = Nexus::Timings::Profiler::Get().GetResults();
 			for (const auto &profileResult : results)
 			{
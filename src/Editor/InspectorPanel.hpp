@@ -12,9 +12,9 @@ struct ComponentToAdd
 
 struct ComponentToRemove
 {
-	Nexus::GUID EntityID	   = {};
-	const char *TypeName	   = {};
-	size_t		ComponentIndex = {};
+	Nexus::GUID					EntityID = {};
+	const char				   *TypeName = {};
+	Nexus::ECS::ComponentHandle Handle	 = {};
 };
 
 class InspectorPanel : public Panel
@@ -80,9 +80,7 @@ class InspectorPanel : public Panel
 
 					if (ImGui::Button("Remove"))
 					{
-						ComponentToRemove componentToRemove {.EntityID		 = entity->ID,
-															 .TypeName		 = component.typeName,
-															 .ComponentIndex = component.componentIndex};
+						ComponentToRemove componentToRemove {.EntityID = entity->ID, .TypeName = component.typeName, .Handle = component.handle};
 						m_ComponentsToRemove.push_back(componentToRemove);
 					}
 					ImGui::Separator();
@@ -111,7 +109,7 @@ class InspectorPanel : public Panel
 
 		for (const auto &component : m_ComponentsToRemove)
 		{
-			scene->Registry.RemoveComponent(component.EntityID, component.TypeName, component.ComponentIndex);
+			scene->Registry.RemoveComponent(component.EntityID, component.TypeName, component.Handle);
 		}
 
 		for (auto &component : m_ComponentsToAdd) { component.createFunc(scene->Registry, *component.entity); }
@@ -6,6 +6,7 @@
 #include "Graphics/GraphicsDevice.hpp"
 #include "Graphics/IGraphicsAPI.hpp"
 #include "IWindow.hpp"
+#include "Renderer/RenderThread.hpp"
 
 #ifdef __EMSCRIPTEN__
 	#include <emscripten.h>
@@ -60,6 +61,25 @@ namespace Nexus
 
 		virtual void Tick(Nexus::TimeSpan time) {};
 
+		/// @brief A virtual method that is called on the main thread when the application uses a render thread, in place of Render(). This
+		/// should copy the data that rendering needs out of the application's state rather than referencing it, as the main thread
+		/// continues to update while the packet is being rendered. Applications that use a render thread must override this and
+		/// RenderFramePacket(), the default throws as Render() cannot safely run alongside Update().
+		/// @param time The elapsed time since the last frame was extracted
+		/// @return The packet to hand over to the render thread
+		virtual std::unique_ptr<Graphics::FramePacket> ExtractFramePacket(Nexus::TimeSpan time)
+		{
+			throw std::runtime_error("Applications that use a render thread must override ExtractFramePacket() and RenderFramePacket()");
+		}
+
+		/// @brief A virtual method that is called on the render thread to record and submit the work for a packet returned by
+		/// ExtractFramePacket(). This must only read the packet and resources that the main thread does not modify, the default throws.
+		/// @param packet The packet to render
+		virtual void RenderFramePacket(const Graphics::FramePacket &packet)
+		{
+			throw std::runtime_error("Applications that use a render thread must override ExtractFramePacket() and RenderFramePacket()");
+		}
+
 		/// @brief A pure virtual method that is called once the application is
 		/// closing
 		virtual void Unload() = 0;
@@ -127,6 +147,11 @@ namespace Nexus
 		/// @return A pointer to an audio device
 		Audio::AudioDevice *GetAudioDevice();
 
+		/// @brief A method that blocks until the render thread has finished every frame that has been handed to it, this should be called
+		/// before destroying or recreating resources that the render thread may be using. This returns immediately if the application does
+		/// not use a render thread.
+		void WaitForRenderThread();
+
 		bool IsRunning();
 
 		void Stop();
@@ -157,5 +182,8 @@ namespace Nexus
 		Clock m_Clock {};
 
 		bool m_Running = true;
+
+		/// @brief The thread that renders frame packets, this is only created if the specification requests it
+		std::unique_ptr<Graphics::RenderThread> m_RenderThread = nullptr;
 	};
 }	 // namespace Nexus
\ No newline at end of file
@@ -105,6 +105,14 @@ namespace Nexus
 		/// @brief Controls how the application will call Render(), Update() and Tick(), if true they will only be called following user input
 		bool EventDriven = false;
 
+		/// @brief Whether Render() is moved to a dedicated render thread. Update() and Tick() keep running on the main thread and
+		/// Application::ExtractFramePacket() is called there in place of Render(), the packet is then rendered by
+		/// Application::RenderFramePacket() on the render thread. Both of these have to be overridden when this is enabled.
+		bool UseRenderThread = false;
+
+		/// @brief The number of extracted frames that can wait for the render thread while another frame is being rendered
+		uint32_t MaxQueuedFrames = 1;
+
 		/// @brief The organization associated with the application, used for selecting a storage location
 		const char *Organization = "Nexus";
 
@@ -17,6 +17,23 @@ namespace Nexus::Processors
 		std::vector<Graphics::Material> materials = {};
 	};
 
+	/// @brief A material as it is described in a model file, with its textures decoded but not yet uploaded to the GPU
+	struct MaterialSourceData
+	{
+		glm::vec4		DiffuseColour  = {1, 1, 1, 1};
+		glm::vec4		SpecularColour = {1, 1, 1, 1};
+		Graphics::Image DiffuseImage   = {};
+		Graphics::Image NormalImage	   = {};
+		Graphics::Image SpecularImage  = {};
+	};
+
+	/// @brief A model that has been read from a file without using the graphics device
+	struct ModelSourceData
+	{
+		std::vector<Graphics::MeshData> meshes	  = {};
+		std::vector<MaterialSourceData> materials = {};
+	};
+
 	class NX_API AssimpProcessor : public IProcessor
 	{
 	  public:
@@ -24,7 +41,33 @@ namespace Nexus::Processors
 		{
 		}
 		ModelImportData		 LoadModel(const std::string &filepath, Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue);
-		Ref<Graphics::Model> Import(const std::string &filepath, Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue);
+
+		/// @brief Imports a model and decodes its textures without using the graphics device, so that this can run on a worker thread
+		/// @param filepath The filepath to load the model from
+		/// @return The meshes and materials of the model, this is empty if the model could not be imported
+		ModelSourceData ReadModel(const std::string &filepath);
+
+		/// @brief Uploads a model that was read by ReadModel to the GPU
+		/// @param source The model to upload
+		/// @param quantizeVertices Whether the vertices are compressed into VertexQuantizedPositionTexCoordNormalColourTangent, otherwise
+		/// they are uploaded as VertexPositionTexCoordNormalColourTangentBitangent
+		/// @return The model
+		static Ref<Graphics::Model> CreateModel(const ModelSourceData		&source,
+												Graphics::GraphicsDevice	*device,
+												Ref<Graphics::ICommandQueue> commandQueue,
+												bool						 quantizeVertices = true);
+
+		/// @brief Uploads the textures of materials that were read by ReadModel to the GPU
+		/// @param materials The materials to upload
+		/// @return The materials
+		static std::vector<Graphics::Material> CreateMaterials(const std::vector<MaterialSourceData> &materials,
+															   Graphics::GraphicsDevice				 *device,
+															   Ref<Graphics::ICommandQueue>			  commandQueue);
+
+		Ref<Graphics::Model> Import(const std::string			&filepath,
+									Graphics::GraphicsDevice	*device,
+									Ref<Graphics::ICommandQueue> commandQueue,
+									bool						 quantizeVertices = true);
 		GUID				 Process(const std::string			 &filepath,
 									 Graphics::GraphicsDevice	 *device,
 									 Ref<Graphics::ICommandQueue> commandQueue,
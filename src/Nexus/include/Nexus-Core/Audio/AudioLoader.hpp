@@ -1,6 +1,7 @@
 #pragma once
 
 #include "AudioDevice.hpp"
+#include "AudioMixer.hpp"
 
 namespace Nexus::Audio
 {
@@ -19,5 +20,11 @@ namespace Nexus::Audio
 		/// @param device The audio device to use to create the audio buffer
 		/// @return A created audio buffer containing the data loaded from the file
 		static Ref<AudioBuffer> LoadMp3File(const std::string &filepath, AudioDevice *device);
+
+		/// @brief A method that decodes an audio file into a clip that can be played by an AudioMixer, surround files are reduced to their
+		/// first two channels
+		/// @param filepath The path to the file to load, any format supported by libnyquist can be used
+		/// @return A created clip containing the decoded samples
+		static Ref<AudioClip> LoadAudioClip(const std::string &filepath);
 	};
 };	  // namespace Nexus::Audio
\ No newline at end of file
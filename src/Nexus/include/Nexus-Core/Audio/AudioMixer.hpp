@@ -0,0 +1,179 @@
+#pragma once
+
+#include "AudioMixerOutput.hpp"
+#include "Nexus-Core/Types.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Audio
+{
+	/// @brief A block of decoded floating point samples that can be played by an AudioMixer
+	struct AudioClip
+	{
+		/// @brief The interleaved samples of the clip
+		std::vector<float> Samples = {};
+
+		/// @brief The number of interleaved channels, either one or two
+		uint32_t ChannelCount = 1;
+
+		/// @brief The sample rate of the clip in hertz
+		uint32_t SampleRate = 48000;
+
+		/// @brief Returns the number of frames stored in the clip
+		/// @return The number of frames
+		size_t GetFrameCount() const
+		{
+			return ChannelCount > 0 ? Samples.size() / ChannelCount : 0;
+		}
+	};
+
+	/// @brief A handle to a voice that is playing in an AudioMixer, handles become invalid once the voice finishes or is stolen by
+	/// another sound, after which any calls using them are ignored
+	struct VoiceHandle
+	{
+		/// @brief The slot in the mixer's voice pool
+		uint32_t Index = UINT32_MAX;
+
+		/// @brief The generation of the slot at the time that the voice was started
+		uint32_t Generation = 0;
+
+		/// @brief Returns whether the handle was returned from a successful call to AudioMixer::Play
+		/// @return Whether the handle refers to a voice
+		bool IsValid() const
+		{
+			return Index != UINT32_MAX;
+		}
+	};
+
+	/// @brief A structure describing how a voice should be played
+	struct VoiceDescription
+	{
+		/// @brief The bus that the voice is mixed into
+		uint32_t Bus = 0;
+
+		/// @brief The gain applied to the voice
+		float Gain = 1.0f;
+
+		/// @brief The stereo position of the voice, from -1 (left) to 1 (right)
+		float Pan = 0.0f;
+
+		/// @brief The playback rate of the voice, values other than 1 also change the pitch
+		float Pitch = 1.0f;
+
+		/// @brief When the voice pool is full, a new voice replaces the playing voice with the lowest priority, as long as that priority is
+		/// not higher than its own
+		int32_t Priority = 0;
+
+		/// @brief Whether the voice restarts from the beginning once it reaches the end of the clip
+		bool Looping = false;
+	};
+
+	/// @brief A structure describing how an audio mixer should be created
+	struct AudioMixerDescription
+	{
+		/// @brief The maximum number of voices that can be played at the same time
+		uint32_t MaxVoices = 64;
+
+		/// @brief The number of buses that voices can be mixed into, bus 0 is the master bus and its gain is applied to all other buses
+		uint32_t BusCount = 4;
+
+		/// @brief The maximum number of frames that are mixed at once, larger blocks are split up
+		uint32_t BlockSize = 512;
+	};
+
+	/// @brief A class that mixes a fixed pool of voices in software and passes the result to an AudioMixerOutput, all methods must be
+	/// called from the same thread
+	class NX_API AudioMixer
+	{
+	  public:
+		/// @brief Creates a new audio mixer
+		/// @param description The properties to use when creating the mixer
+		/// @param output The output that receives the mixed samples, this determines the sample rate of the mixer
+		AudioMixer(const AudioMixerDescription &description, Scope<AudioMixerOutput> output);
+
+		/// @brief Starts playing a clip
+		/// @param clip The clip to play, the mixer keeps a reference to it until the voice finishes
+		/// @param description The properties of the voice
+		/// @return A handle to the voice, this is invalid if every voice is in use by sounds of a higher priority
+		VoiceHandle Play(Ref<AudioClip> clip, const VoiceDescription &description = {});
+
+		/// @brief Stops a voice and returns it to the pool
+		/// @param handle The voice to stop
+		void Stop(VoiceHandle handle);
+
+		/// @brief Stops every voice that is playing
+		void StopAll();
+
+		/// @brief Returns whether a voice is still playing
+		/// @param handle The voice to check
+		/// @return Whether the voice is playing
+		bool IsPlaying(VoiceHandle handle) const;
+
+		/// @brief Sets the gain of a voice that is playing
+		/// @param handle The voice to modify
+		/// @param gain The new gain
+		void SetGain(VoiceHandle handle, float gain);
+
+		/// @brief Sets the stereo position of a voice that is playing
+		/// @param handle The voice to modify
+		/// @param pan The new position, from -1 (left) to 1 (right)
+		void SetPan(VoiceHandle handle, float pan);
+
+		/// @brief Sets the playback rate of a voice that is playing
+		/// @param handle The voice to modify
+		/// @param pitch The new playback rate
+		void SetPitch(VoiceHandle handle, float pitch);
+
+		/// @brief Sets the gain of a bus
+		/// @param bus The index of the bus
+		/// @param gain The new gain
+		void SetBusGain(uint32_t bus, float gain);
+
+		/// @brief Returns the gain of a bus
+		/// @param bus The index of the bus
+		/// @return The gain of the bus
+		float GetBusGain(uint32_t bus) const;
+
+		/// @brief Returns the number of voices that are currently playing
+		/// @return The number of active voices
+		uint32_t GetActiveVoiceCount() const;
+
+		/// @brief Mixes as many frames as the output requests and submits them, this should be called regularly (e.g. once per frame)
+		void Update();
+
+		/// @brief Mixes the next block of frames without passing them to the output
+		/// @param output Storage for interleaved stereo samples, the number of frames mixed is output.size() / 2
+		void Mix(std::span<float> output);
+
+		/// @brief Returns the output that the mixer submits samples to
+		/// @return The output
+		AudioMixerOutput *GetOutput() const;
+
+	  private:
+		struct Voice
+		{
+			Ref<AudioClip>	 Clip		 = nullptr;
+			VoiceDescription Description = {};
+			double			 Position	 = 0.0;
+			uint64_t		 StartOrder	 = 0;
+			uint32_t		 Generation	 = 0;
+			bool			 Active		 = false;
+		};
+
+		Voice *GetVoice(VoiceHandle handle);
+		void   ReleaseVoice(uint32_t index);
+
+		/// @brief Adds a voice to the mix, returning false once the voice has played to the end
+		bool MixVoice(Voice &voice, std::span<float> output);
+
+	  private:
+		AudioMixerDescription	m_Description	   = {};
+		Scope<AudioMixerOutput> m_Output		   = nullptr;
+		std::vector<Voice>		m_Voices		   = {};
+		std::vector<uint32_t>	m_FreeVoices	   = {};
+		std::vector<float>		m_BusGains		   = {};
+		std::vector<float>		m_ResampleScratch  = {};
+		std::vector<float>		m_MixBuffer		   = {};
+		uint64_t				m_NextStartOrder   = 0;
+		uint32_t				m_ActiveVoiceCount = 0;
+	};
+}	 // namespace Nexus::Audio
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "AudioBuffer.hpp"
+#include "AudioDevice.hpp"
+#include "AudioSource.hpp"
+#include "Nexus-Core/Types.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Audio
+{
+	/// @brief A pure virtual class representing the destination of the interleaved stereo samples produced by an AudioMixer
+	class NX_API AudioMixerOutput
+	{
+	  public:
+		/// @brief A virtual destructor to allow resources to be cleaned up
+		virtual ~AudioMixerOutput() = default;
+
+		/// @brief A method that returns the sample rate that the output expects to receive
+		/// @return The sample rate in hertz
+		virtual uint32_t GetSampleRate() const = 0;
+
+		/// @brief A method that returns how many frames the output is able to accept before it would need to block
+		/// @return The number of frames that should be submitted
+		virtual size_t GetFramesRequested() = 0;
+
+		/// @brief A method that passes a block of mixed samples to the output
+		/// @param samples Interleaved stereo floating point samples
+		virtual void Submit(std::span<const float> samples) = 0;
+	};
+
+	/// @brief An output that discards the samples it receives, this allows the mixer to run in environments without any audio hardware
+	class NX_API NullAudioOutput : public AudioMixerOutput
+	{
+	  public:
+		/// @brief Creates a new null output
+		/// @param sampleRate The sample rate to report to the mixer
+		/// @param framesPerUpdate The number of frames that are requested each time the mixer is updated
+		NullAudioOutput(uint32_t sampleRate, uint32_t framesPerUpdate);
+
+		uint32_t GetSampleRate() const final;
+		size_t	 GetFramesRequested() final;
+		void	 Submit(std::span<const float> samples) final;
+
+		/// @brief Returns the total number of frames that have been submitted to the output
+		/// @return The number of frames
+		size_t GetFramesSubmitted() const;
+
+	  private:
+		uint32_t m_SampleRate	   = 0;
+		uint32_t m_FramesPerUpdate = 0;
+		size_t	 m_FramesSubmitted = 0;
+	};
+
+	/// @brief An output that records the samples it receives to a 16 bit PCM WAV file
+	class NX_API WavFileAudioOutput : public AudioMixerOutput
+	{
+	  public:
+		/// @brief Creates a new WAV file output, any existing file at the path is overwritten
+		/// @param filepath The path of the file to write
+		/// @param sampleRate The sample rate to record at
+		/// @param framesPerUpdate The number of frames that are requested each time the mixer is updated
+		WavFileAudioOutput(const std::string &filepath, uint32_t sampleRate, uint32_t framesPerUpdate);
+
+		/// @brief Writes the final sizes into the file's header and closes it
+		~WavFileAudioOutput();
+
+		uint32_t GetSampleRate() const final;
+		size_t	 GetFramesRequested() final;
+		void	 Submit(std::span<const float> samples) final;
+
+	  private:
+		void WriteHeader();
+
+	  private:
+		std::ofstream		 m_File;
+		std::vector<int16_t> m_ConvertedSamples = {};
+		uint32_t			 m_SampleRate		= 0;
+		uint32_t			 m_FramesPerUpdate	= 0;
+		size_t				 m_FramesWritten	= 0;
+		uint32_t			 m_DitherSeed		= 1;
+	};
+
+	/// @brief An output that plays the samples it receives through an AudioDevice, blocks of samples are cycled through a small ring of
+	/// buffers that are queued on a single audio source
+	class NX_API AudioDeviceOutput : public AudioMixerOutput
+	{
+	  public:
+		/// @brief Creates a new device output
+		/// @param device The audio device to play the mixed audio through
+		/// @param sampleRate The sample rate to mix at
+		/// @param bufferCount The number of buffers that are cycled through the source's queue
+		/// @param framesPerBuffer The number of frames stored in each buffer, this determines the latency of the output
+		AudioDeviceOutput(AudioDevice *device, uint32_t sampleRate, uint32_t bufferCount = 3, uint32_t framesPerBuffer = 1024);
+
+		/// @brief Stops the source and releases the buffers
+		~AudioDeviceOutput();
+
+		uint32_t GetSampleRate() const final;
+		size_t	 GetFramesRequested() final;
+		void	 Submit(std::span<const float> samples) final;
+
+		/// @brief Returns the source that the mixed audio is played through
+		/// @return The audio source
+		Ref<AudioSource> GetSource() const;
+
+	  private:
+		void ReclaimProcessedBuffers();
+
+	  private:
+		AudioDevice					 *m_Device			= nullptr;
+		Ref<AudioSource>			  m_Source			= nullptr;
+		std::vector<Ref<AudioBuffer>> m_FreeBuffers		= {};
+		std::deque<Ref<AudioBuffer>>  m_QueuedBuffers	= {};
+		std::vector<float>			  m_PendingSamples	= {};
+		uint32_t					  m_SampleRate		= 0;
+		uint32_t					  m_FramesPerBuffer = 0;
+	};
+}	 // namespace Nexus::Audio
@@ -0,0 +1,156 @@
+#pragma once
+
+#include "AudioBuffer.hpp"
+#include "AudioDevice.hpp"
+#include "AudioSource.hpp"
+#include "AudioTypes.hpp"
+#include "Nexus-Core/Types.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Audio
+{
+	/// @brief A pure virtual class that decodes an audio file incrementally, one block of frames at a time
+	class NX_API AudioStreamDecoder
+	{
+	  public:
+		/// @brief A virtual destructor to allow resources to be cleaned up
+		virtual ~AudioStreamDecoder() = default;
+
+		/// @brief A method that prepares the decoder to produce data, formats that are decoded in full are decoded here so this should be
+		/// called from the thread that reads the frames. Calling it again has no effect.
+		virtual void Open() = 0;
+
+		/// @brief A method that returns the number of interleaved channels produced by the decoder, this is at most two and is only valid
+		/// once Open has been called
+		/// @return The number of channels
+		virtual uint32_t GetChannelCount() const = 0;
+
+		/// @brief A method that returns the sample rate of the decoded data, this is only valid once Open has been called
+		/// @return The sample rate in hertz
+		virtual uint32_t GetSampleRate() const = 0;
+
+		/// @brief A method that decodes the next block of interleaved frames, the decoder is opened first if it has not been already
+		/// @param output A pointer to storage for at least frameCount * GetChannelCount() samples
+		/// @param frameCount The maximum number of frames to decode
+		/// @return The number of frames that were decoded, less than frameCount once the end of the file has been reached
+		virtual size_t ReadFrames(float *output, size_t frameCount) = 0;
+
+		/// @brief A method that moves the decoder back to the start of the file
+		virtual void Rewind() = 0;
+
+		/// @brief A method that creates a decoder for a file, WAV files are read from disk as they are played, other formats are decoded
+		/// in full when the decoder is opened
+		/// @param filepath The path to the file to decode
+		/// @return The decoder that has been created
+		static Scope<AudioStreamDecoder> Create(const std::string &filepath);
+	};
+
+	/// @brief A structure describing how an audio stream should be created
+	struct AudioStreamDescription
+	{
+		/// @brief The path to the audio file to stream
+		std::string Filepath = {};
+
+		/// @brief The number of buffers that are cycled through the source's queue
+		uint32_t BufferCount = 4;
+
+		/// @brief The number of frames that are decoded into each buffer
+		uint32_t FramesPerBuffer = 8192;
+
+		/// @brief Whether the stream should restart from the beginning once the end of the file has been reached
+		bool Looping = false;
+	};
+
+	/// @brief A class that plays an audio file without loading it into memory all at once, blocks of the file are decoded on a background
+	/// thread and cycled through a small ring of audio buffers that are queued on an audio source
+	class NX_API AudioStream
+	{
+	  public:
+		/// @brief Creates a new audio stream
+		/// @param description The properties to use when creating the stream
+		/// @param device The audio device used to create the source and buffers
+		AudioStream(const AudioStreamDescription &description, AudioDevice *device);
+
+		/// @brief Stops the stream and waits for the decoding thread to exit
+		~AudioStream();
+
+		AudioStream(const AudioStream &)			= delete;
+		AudioStream &operator=(const AudioStream &) = delete;
+
+		/// @brief Starts or resumes playback of the stream
+		void Play();
+
+		/// @brief Pauses the stream, the decoding thread continues to fill any free buffers
+		void Pause();
+
+		/// @brief Stops the stream and rewinds it to the beginning
+		void Stop();
+
+		/// @brief A method that must be called regularly (e.g. once per frame) from the thread that owns the audio device, it returns
+		/// buffers that have finished playing to the decoder and queues any newly decoded buffers
+		void Update();
+
+		/// @brief Sets whether the stream restarts from the beginning once the end of the file has been reached
+		/// @param looping Whether the stream should loop
+		void SetIsLooping(bool looping);
+
+		/// @brief Returns whether the stream restarts from the beginning once the end of the file has been reached
+		/// @return Whether the stream loops
+		bool GetIsLooping() const;
+
+		/// @brief Returns whether the stream is currently playing or paused, a stream that has played to the end is no longer playing
+		/// @return Whether the stream is playing
+		bool IsPlaying() const;
+
+		/// @brief Returns the source that the stream's buffers are queued on, this can be used to set the gain, position etc.
+		/// @return The audio source
+		Ref<AudioSource> GetSource() const;
+
+	  private:
+		/// @brief The current owner of each block of decoded samples
+		enum class ChunkState
+		{
+			Free,
+			Decoding,
+			Ready,
+			Queued
+		};
+
+		struct StreamChunk
+		{
+			std::vector<float> Samples		= {};
+			size_t			   FrameCount	= 0;
+			bool			   EndOfStream	= false;
+			ChunkState		   State		= ChunkState::Free;
+			Ref<AudioBuffer>   Buffer		= nullptr;
+		};
+
+		void StartDecoding();
+		void StopDecoding();
+		void DecodeThreadMain();
+		bool DecodeNextChunk();
+		void QueueReadyChunks();
+		void ResetChunks();
+
+	  private:
+		AudioStreamDescription		 m_Description = {};
+		AudioDevice					*m_Device	   = nullptr;
+		Ref<AudioSource>			 m_Source	   = nullptr;
+		Scope<AudioStreamDecoder>	 m_Decoder	   = nullptr;
+		std::vector<StreamChunk>	 m_Chunks	   = {};
+		std::deque<uint32_t>		 m_QueuedChunks = {};
+
+		std::thread				m_DecodeThread;
+		mutable std::mutex		m_Mutex;
+		std::condition_variable m_ChunkFreed;
+		std::atomic<bool>		m_ExitRequested = false;
+		std::atomic<bool>		m_Looping		= false;
+
+		uint32_t m_NextDecodeChunk = 0;
+		uint32_t m_NextQueueChunk  = 0;
+		bool	 m_DecoderFinished = false;
+		bool	 m_AllQueued	   = false;
+		bool	 m_Playing		   = false;
+		bool	 m_Paused		   = false;
+	};
+}	 // namespace Nexus::Audio
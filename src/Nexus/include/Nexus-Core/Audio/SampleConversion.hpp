@@ -0,0 +1,74 @@
+#pragma once
+
+#include "AudioTypes.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Audio
+{
+	/// @brief An enum class representing the noise that is added to samples before they are reduced to a lower bit depth
+	enum class DitherMode
+	{
+		/// @brief Samples are rounded to the nearest value, this is exact for data that was originally stored at the target bit depth
+		None,
+
+		/// @brief Triangular noise of +/- 1 LSB is added before rounding, which decorrelates the quantisation error from the signal
+		Triangular
+	};
+
+	/// @brief A method that returns the number of bytes used to store a single sample of a channel in a format
+	/// @param format The format to query
+	/// @return The number of bytes per sample
+	NX_API uint32_t GetAudioFormatBytesPerSample(AudioFormat format);
+
+	/// @brief A method that returns the number of interleaved channels in a format
+	/// @param format The format to query
+	/// @return The number of channels
+	NX_API uint32_t GetAudioFormatChannelCount(AudioFormat format);
+
+	/// @brief Converts normalised floating point samples to signed 16 bit integers, values outside of [-1, 1] are clamped
+	/// @param input The samples to convert
+	/// @param output Storage for input.size() samples
+	/// @param dither The dither to apply when rounding
+	/// @param seed The seed of the dither noise, the same seed always produces the same output
+	NX_API void ConvertFloatToInt16(std::span<const float> input, int16_t *output, DitherMode dither = DitherMode::None, uint32_t seed = 1);
+
+	/// @brief Converts normalised floating point samples to unsigned 8 bit integers centred on 128, as used by 8 bit WAV and OpenAL data
+	/// @param input The samples to convert
+	/// @param output Storage for input.size() samples
+	/// @param dither The dither to apply when rounding
+	/// @param seed The seed of the dither noise, the same seed always produces the same output
+	NX_API void ConvertFloatToUInt8(std::span<const float> input, uint8_t *output, DitherMode dither = DitherMode::None, uint32_t seed = 1);
+
+	/// @brief Interleaves separate channel buffers into a single buffer of frames
+	/// @param channels An array of channelCount pointers, each pointing to frameCount samples
+	/// @param channelCount The number of channels to interleave
+	/// @param frameCount The number of samples in each channel
+	/// @param output Storage for frameCount * channelCount samples
+	NX_API void InterleaveChannels(const float *const *channels, uint32_t channelCount, size_t frameCount, float *output);
+
+	/// @brief Adds a block of mono samples to an interleaved stereo accumulator, applying a separate gain to each output channel
+	/// @param input The mono samples to mix
+	/// @param accumulator Interleaved stereo storage for at least input.size() frames
+	/// @param leftGain The gain applied to the left channel
+	/// @param rightGain The gain applied to the right channel
+	NX_API void MixMonoToStereo(std::span<const float> input, float *accumulator, float leftGain, float rightGain);
+
+	/// @brief Adds a block of interleaved stereo samples to an interleaved stereo accumulator, applying a separate gain to each channel
+	/// @param input The interleaved stereo samples to mix
+	/// @param accumulator Interleaved stereo storage for at least input.size() samples
+	/// @param leftGain The gain applied to the left channel
+	/// @param rightGain The gain applied to the right channel
+	NX_API void MixStereoToStereo(std::span<const float> input, float *accumulator, float leftGain, float rightGain);
+
+	/// @brief Multiplies a block of samples by a constant gain
+	/// @param samples The samples to scale in place
+	/// @param gain The gain to apply
+	NX_API void ApplyGain(std::span<float> samples, float gain);
+
+	/// @brief Converts interleaved floating point samples into the sample layout of an audio format
+	/// @param input The samples to convert
+	/// @param format The format to convert to, the channel count of the format must match the interleaving of input
+	/// @param dither The dither to apply if the format has a lower bit depth than the source data
+	/// @return A buffer containing the converted samples
+	NX_API std::vector<uint8_t> ConvertSamples(std::span<const float> input, AudioFormat format, DitherMode dither);
+}	 // namespace Nexus::Audio
@@ -16,6 +16,12 @@ namespace Nexus
 	// forward declaration
 	class Project;
 	struct Entity;
+
+	namespace Graphics
+	{
+		class GraphicsDevice;
+		class ICommandQueue;
+	}	 // namespace Graphics
 }	 // namespace Nexus
 
 namespace Nexus::ECS
@@ -30,9 +36,22 @@ namespace Nexus::ECS
 	using CreateComponentFunc	 = std::function<void(Registry &registry, const Entity &entity)>;
 	using RenderComponentFunc	 = std::function<void(void *data, Nexus::Ref<Nexus::Project> project)>;
 	using StringSerializerFunc	 = std::function<std::string(void *obj)>;
-	using StringDeserializerFunc = std::function<void(GUID guid, Registry &registry, const std::string &data, size_t entityHierarchyIndex)>;
+	using StringDeserializerFunc = std::function<void *(GUID guid, Registry &registry, const std::string &data, size_t entityHierarchyIndex)>;
 	using YamlSerializerFunc	 = std::function<YAML::Node(void *obj)>;
-	using YamlDeserializerFunc	 = std::function<void(GUID guid, Registry &registry, const YAML::Node &node, size_t entityHierarchyIndex)>;
+	using YamlDeserializerFunc	 = std::function<void *(GUID guid, Registry &registry, const YAML::Node &node, size_t entityHierarchyIndex)>;
+	using BinarySerializerFunc	 = std::function<void(void *obj, std::vector<std::byte> &output)>;
+	using BinaryDeserializerFunc = std::function<Scope<IComponentArray>(std::span<const std::byte> data, size_t count)>;
+	using LoadResourcesFunc		 = std::function<void(void *obj, Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue)>;
+
+	/// @brief Specialise this for components that reference files whose GPU resources have to be created once the component has been
+	/// deserialized, components are decoded without a graphics device so that scenes can be read on worker threads
+	template<typename T>
+	struct ComponentResourceLoader
+	{
+		static void Load(T &component, Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue)
+		{
+		}
+	};
 
 	struct ComponentStorage
 	{
@@ -43,6 +62,24 @@ namespace Nexus::ECS
 		CreateComponentFunc	   CreationFunction	  = {};
 		RenderComponentFunc	   RenderFunc		  = {};
 		std::string			   DisplayName		  = {};
+
+		/// @brief Appends a component to a binary scene chunk, trivially copyable components are written as their raw bytes and other
+		/// components are written using their stream operators
+		BinarySerializerFunc BinarySerializer = {};
+
+		/// @brief Creates an array of components from a binary scene chunk, this does not access any registry so that chunks can be
+		/// decoded in parallel
+		BinaryDeserializerFunc BinaryDeserializer = {};
+
+		/// @brief Creates the GPU resources of a deserialized component. Scenes create them for all of their components while they load, so
+		/// this only needs to be called after deserializing a single component from a string or YAML.
+		LoadResourcesFunc LoadResources = {};
+
+		/// @brief Whether the component is stored as its raw bytes in binary scenes
+		bool IsBlittable = false;
+
+		/// @brief The size of the component type in bytes, used to validate blitted chunks
+		uint32_t ComponentSize = 0;
 	};
 
 	class NX_API ComponentRegistry
@@ -68,12 +105,13 @@ namespace Nexus::ECS
 				oss << *actualObj;
 				return oss.str();
 			};
-			storage.StringDeserializer = [](GUID guid, Registry &registry, const std::string &data, size_t entityHierarchyIndex)
+			storage.StringDeserializer = [](GUID guid, Registry &registry, const std::string &data, size_t entityHierarchyIndex) -> void *
 			{
 				T				   obj {};
 				std::istringstream iss(data);
 				iss >> obj;
-				registry.AddComponent(guid, obj, entityHierarchyIndex);
+				ComponentHandle handle = registry.AddComponent(guid, std::move(obj), entityHierarchyIndex);
+				return registry.GetComponent<T>(handle);
 			};
 			storage.YamlSerializer = [](void *obj) -> YAML::Node
 			{
@@ -81,14 +119,85 @@ namespace Nexus::ECS
 				YAML::Node node = YAML::convert<T>::encode(*actualObj);
 				return node;
 			};
-			storage.YamlDeserializer = [](GUID guid, Registry &registry, const YAML::Node &node, size_t entityHierarchyIndex)
+			storage.YamlDeserializer = [](GUID guid, Registry &registry, const YAML::Node &node, size_t entityHierarchyIndex) -> void *
 			{
-				T obj = node.as<T>();
-				registry.AddComponent(guid, obj, entityHierarchyIndex);
+				T				obj	   = node.as<T>();
+				ComponentHandle handle = registry.AddComponent(guid, std::move(obj), entityHierarchyIndex);
+				return registry.GetComponent<T>(handle);
 			};
 			storage.CreationFunction = [](Registry &registry, const Entity &entity) { registry.AddComponent<T>(entity.ID, T {}); };
 			storage.DisplayName		 = displayName;
 			storage.RenderFunc		 = renderFunc;
+			storage.LoadResources	 = [](void *obj, Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue)
+			{
+				ComponentResourceLoader<T>::Load(*static_cast<T *>(obj), device, commandQueue);
+			};
+
+			storage.IsBlittable	  = std::is_trivially_copyable_v<T>;
+			storage.ComponentSize = (uint32_t)sizeof(T);
+
+			storage.BinarySerializer = [](void *obj, std::vector<std::byte> &output)
+			{
+				if constexpr (std::is_trivially_copyable_v<T>)
+				{
+					const std::byte *bytes = static_cast<const std::byte *>(obj);
+					output.insert(output.end(), bytes, bytes + sizeof(T));
+				}
+				else
+				{
+					std::ostringstream oss;
+					oss << *static_cast<T *>(obj);
+					std::string text = oss.str();
+
+					uint32_t		 length		 = (uint32_t)text.size();
+					const std::byte *lengthBytes = reinterpret_cast<const std::byte *>(&length);
+					const std::byte *textBytes	 = reinterpret_cast<const std::byte *>(text.data());
+					output.insert(output.end(), lengthBytes, lengthBytes + sizeof(length));
+					output.insert(output.end(), textBytes, textBytes + text.size());
+				}
+			};
+			storage.BinaryDeserializer = [](std::span<const std::byte> data, size_t count) -> Scope<IComponentArray>
+			{
+				Scope<ComponentArray<T>> components = CreateScope<ComponentArray<T>>();
+
+				if constexpr (std::is_trivially_copyable_v<T>)
+				{
+					if (data.size() != count * sizeof(T))
+					{
+						throw std::runtime_error("A binary component chunk does not match the size of the component type");
+					}
+
+					// the bytes are copied straight from the file into the component storage
+					components->BlitComponents(data.data(), count);
+				}
+				else
+				{
+					size_t offset = 0;
+					for (size_t i = 0; i < count; i++)
+					{
+						uint32_t length = 0;
+						if (offset + sizeof(length) > data.size())
+						{
+							throw std::runtime_error("A binary component chunk is truncated");
+						}
+						std::memcpy(&length, data.data() + offset, sizeof(length));
+						offset += sizeof(length);
+
+						if (offset + length > data.size())
+						{
+							throw std::runtime_error("A binary component chunk is truncated");
+						}
+
+						T				   obj {};
+						std::istringstream iss(std::string(reinterpret_cast<const char *>(data.data() + offset), length));
+						iss >> obj;
+						components->AddComponent(obj);
+						offset += length;
+					}
+				}
+
+				return components;
+			};
 
 			m_RegisteredComponents[typeName] = storage;
 		}
@@ -15,6 +15,7 @@
 #include "Nexus-Core/Platform.hpp"
 
 #include "ComponentRegistry.hpp"
+#include "TransformHierarchy.hpp"
 
 namespace Nexus
 {
@@ -24,29 +25,32 @@ namespace Nexus
 		glm::vec3 Rotation = glm::vec3(0.0f, 0.0f, 0.0f);
 		glm::vec3 Scale	   = glm::vec3(1.0f, 1.0f, 1.0f);
 
-		inline glm::mat4 CreateTransformation()
-		{
-			glm::mat4 transformation(1.0f);
+		/// @brief The ID of the entity that this transform is relative to, or zero if the transform is in world space
+		uint64_t Parent = 0;
 
-			// apply translation
-			transformation = glm::translate(transformation, Position);
-
-			// apply rotation
-			transformation = glm::rotate(transformation, glm::radians(Rotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
-			transformation = glm::rotate(transformation, glm::radians(Rotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
-			transformation = glm::rotate(transformation, glm::radians(Rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
+		/// @brief Converts the euler angles of the transform to a quaternion, applying the rotations around X, then Y, then Z in the order
+		/// that the transform has always used
+		inline ECS::LocalTransform ToLocalTransform() const
+		{
+			glm::quat rotation = glm::angleAxis(glm::radians(Rotation.x), glm::vec3(1.0f, 0.0f, 0.0f)) *
+								 glm::angleAxis(glm::radians(Rotation.y), glm::vec3(0.0f, 1.0f, 0.0f)) *
+								 glm::angleAxis(glm::radians(Rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
 
-			// apply scale
-			transformation = glm::scale(transformation, Scale);
+			return ECS::LocalTransform {.Position = Position, .Rotation = rotation, .Scale = Scale};
+		}
 
-			return transformation;
+		inline glm::mat4 CreateTransformation()
+		{
+			// building the matrix directly from a quaternion avoids the four matrix multiplications of separate translate, rotate and scale calls
+			return ECS::ComposeTransform(ToLocalTransform());
 		}
 
 		friend std::ostream &operator<<(std::ostream &os, const Transform &transform)
 		{
 			os << transform.Position.x << " " << transform.Position.y << " " << transform.Position.z << " ";
 			os << transform.Rotation.x << " " << transform.Rotation.y << " " << transform.Rotation.z << " ";
-			os << transform.Scale.x << " " << transform.Scale.y << " " << transform.Scale.z;
+			os << transform.Scale.x << " " << transform.Scale.y << " " << transform.Scale.z << " ";
+			os << transform.Parent;
 			return os;
 		}
 
@@ -56,6 +60,9 @@ namespace Nexus
 			is >> transform.Rotation.x >> transform.Rotation.y >> transform.Rotation.z;
 			is >> transform.Scale.x >> transform.Scale.y >> transform.Scale.z;
 
+			// transforms that were written before they could have a parent end after the scale, which leaves the parent at zero
+			is >> transform.Parent;
+
 			return is;
 		}
 
@@ -72,6 +79,7 @@ namespace Nexus
 							  ImGui::DragFloat3("Position", glm::value_ptr(transform->Position));
 							  ImGui::DragFloat3("Rotation", glm::value_ptr(transform->Rotation));
 							  ImGui::DragFloat3("Scale", glm::value_ptr(transform->Scale));
+							  ImGui::InputScalar("Parent", ImGuiDataType_U64, &transform->Parent);
 						  });
 
 	struct ModelRenderer
@@ -80,12 +88,17 @@ namespace Nexus
 		Nexus::Ref<Nexus::Graphics::Model> Model	= {};
 
 		inline void LoadModel()
+		{
+			LoadModel(Nexus::GetApplication()->GetGraphicsDevice(), nullptr);
+		}
+
+		inline void LoadModel(Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue)
 		{
 			if (!FilePath.empty())
 			{
 				if (std::filesystem::exists(FilePath))
 				{
-					Graphics::MeshFactory factory(Nexus::GetApplication()->GetGraphicsDevice(), nullptr);
+					Graphics::MeshFactory factory(device, commandQueue);
 					Model = factory.CreateFrom3DModelFile(FilePath);
 				}
 			}
@@ -93,18 +106,28 @@ namespace Nexus
 
 		friend std::ostream &operator<<(std::ostream &os, const ModelRenderer &modelRenderer)
 		{
-			os << modelRenderer.FilePath;
+			os << std::quoted(modelRenderer.FilePath);
 			return os;
 		}
 
+		// std::quoted reads up to the next whitespace when the text does not start with a quote, so paths that were written unquoted
+		// before paths were quoted are still read, as long as they do not contain spaces
 		friend std::istream &operator>>(std::istream &is, ModelRenderer &modelRenderer)
 		{
-			is >> modelRenderer.FilePath;
-			modelRenderer.LoadModel();
+			is >> std::quoted(modelRenderer.FilePath);
 			return is;
 		}
 	};
 
+	template<>
+	struct ECS::ComponentResourceLoader<ModelRenderer>
+	{
+		static void Load(ModelRenderer &component, Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue)
+		{
+			component.LoadModel(device, commandQueue);
+		}
+	};
+
 	NX_REGISTER_COMPONENT(ModelRenderer,
 
 						  [](void *data, Nexus::Ref<Nexus::Project> project)
@@ -168,13 +191,13 @@ namespace Nexus
 
 		friend std::ostream &operator<<(std::ostream &os, const NativeScriptComponent &component)
 		{
-			os << component.ScriptName;
+			os << std::quoted(component.ScriptName);
 			return os;
 		}
 
 		friend std::istream &operator>>(std::istream &is, NativeScriptComponent &component)
 		{
-			is >> component.ScriptName;
+			is >> std::quoted(component.ScriptName);
 			return is;
 		}
 	};
@@ -225,30 +248,44 @@ namespace Nexus
 
 		friend std::ostream &operator<<(std::ostream &os, const SpriteRendererComponent &component)
 		{
-			os << component.TexturePath;
+			os << std::quoted(component.TexturePath) << " ";
 			os << component.SpriteColour.r << " " << component.SpriteColour.g << " " << component.SpriteColour.b << " " << component.SpriteColour.a;
-			os << component.Tiling;
+			os << " " << component.Tiling;
 			return os;
 		}
 
+		// sprites written before paths were quoted had no separators after the path or the colour, so they could not be read back then either
 		friend std::istream &operator>>(std::istream &is, SpriteRendererComponent &component)
 		{
-			is >> component.TexturePath;
+			is >> std::quoted(component.TexturePath);
 			is >> component.SpriteColour.r >> component.SpriteColour.g >> component.SpriteColour.b >> component.SpriteColour.a;
 			is >> component.Tiling;
 			return is;
 		}
 
 		inline void LoadTexture()
+		{
+			LoadTexture(Nexus::GetApplication()->GetGraphicsDevice(), nullptr);
+		}
+
+		inline void LoadTexture(Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue)
 		{
 			if (!TexturePath.empty())
 			{
-				Nexus::Graphics::GraphicsDevice *device = Nexus::GetApplication()->GetGraphicsDevice();
-				SpriteTexture							= device->CreateTexture2D(nullptr, TexturePath, true, false);
+				SpriteTexture = device->CreateTexture2D(commandQueue, TexturePath, true, false);
 			}
 		}
 	};
 
+	template<>
+	struct ECS::ComponentResourceLoader<SpriteRendererComponent>
+	{
+		static void Load(SpriteRendererComponent &component, Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue)
+		{
+			component.LoadTexture(device, commandQueue);
+		}
+	};
+
 	NX_REGISTER_COMPONENT(SpriteRendererComponent,
 
 						  [&](void *data, Nexus::Ref<Nexus::Project> project)
@@ -305,6 +342,7 @@ namespace YAML
 			node["Scale"]["X"]	  = rhs.Scale.x;
 			node["Scale"]["Y"]	  = rhs.Scale.y;
 			node["Scale"]["Z"]	  = rhs.Scale.z;
+			node["Parent"]		  = rhs.Parent;
 			return node;
 		}
 
@@ -325,6 +363,11 @@ namespace YAML
 			rhs.Scale.y	   = node["Scale"]["Y"].as<float>();
 			rhs.Scale.z	   = node["Scale"]["Z"].as<float>();
 
+			if (node["Parent"])
+			{
+				rhs.Parent = node["Parent"].as<uint64_t>();
+			}
+
 			return true;
 		}
 	};
@@ -347,7 +390,6 @@ namespace YAML
 			}
 
 			rhs.FilePath = node["Filepath"].as<std::string>();
-			rhs.LoadModel();
 			return true;
 		}
 	};
@@ -403,8 +445,6 @@ namespace YAML
 			rhs.SpriteColour.a = node["Colour"]["a"].as<float>();
 
 			rhs.Tiling = node["Tiling"].as<float>();
-
-			rhs.LoadTexture();
 			return true;
 		}
 	};
@@ -1,21 +1,35 @@
 #pragma once
 
 #include "Nexus-Core/Runtime/Entity.hpp"
+#include "Nexus-Core/Types.hpp"
 #include "Nexus-Core/nxpch.hpp"
 
 namespace Nexus::ECS
 {
+	/// @brief A handle to a component stored in a ComponentArray, the handle stays valid while other components are added and removed and
+	/// becomes invalid once the component it refers to is removed
+	struct ComponentHandle
+	{
+		/// @brief The slot in the array's handle table
+		uint32_t Index = UINT32_MAX;
+
+		/// @brief The generation of the slot at the time that the component was added
+		uint32_t Generation = 0;
+
+		bool operator==(const ComponentHandle &other) const = default;
+	};
+
 	struct ComponentPtr
 	{
-		const char *typeName			 = nullptr;
-		size_t		componentIndex		 = 0;
-		size_t		entityComponentIndex = 0;
+		const char	   *typeName			 = nullptr;
+		ComponentHandle handle				 = {};
+		size_t			entityComponentIndex = 0;
 	};
 
 	struct ComponentPositionData
 	{
-		// the position within the array of each type of component
-		size_t componentIndex = 0;
+		// the handle to the component within the array of each type of component
+		ComponentHandle handle = {};
 
 		// the position within the hierarchy of the entity
 		size_t entityComponentIndex = 0;
@@ -28,27 +42,64 @@ namespace Nexus::ECS
 		{
 		}
 
-		virtual size_t		GetComponentCount()			  = 0;
-		virtual void	   *GetRawComponent(size_t index) = 0;
-		virtual void		RemoveComponent(size_t index) = 0;
-		virtual const char *GetTypeName()				  = 0;
+		virtual size_t		GetComponentCount()						= 0;
+		virtual void	   *GetRawComponent(ComponentHandle handle) = 0;
+		virtual bool		RemoveComponent(ComponentHandle handle) = 0;
+		virtual const char *GetTypeName()							= 0;
+
+		/// @brief Returns the handle of the component at a position in the packed storage
+		virtual ComponentHandle GetHandle(size_t index) = 0;
+
+		/// @brief Moves every component out of another array of the same type, the new handles are appended to handles in the same order
+		virtual void Append(IComponentArray &other, std::vector<ComponentHandle> &handles) = 0;
 	};
 
+	/// @brief Stores every component of a single type contiguously, components are accessed through generation-checked handles so that
+	/// removing a component is O(1) and does not invalidate the handles of any other component
 	template<typename T>
 	class NX_API ComponentArray : public IComponentArray
 	{
 	  public:
 		virtual ~ComponentArray();
-		size_t		GetComponentCount() final;
-		void	   *GetRawComponent(size_t index) final;
-		void		RemoveComponent(size_t index) final;
-		const char *GetTypeName() final;
-		void		AddComponent(const T &component);
-		T		   *GetComponent(size_t index);
-		bool		IsValidComponent(size_t index);
+		size_t			GetComponentCount() final;
+		void		   *GetRawComponent(ComponentHandle handle) final;
+		bool			RemoveComponent(ComponentHandle handle) final;
+		const char	   *GetTypeName() final;
+		ComponentHandle GetHandle(size_t index) final;
+		void			Append(IComponentArray &other, std::vector<ComponentHandle> &handles) final;
+		ComponentHandle AddComponent(T component);
+		T			   *GetComponent(ComponentHandle handle);
+		bool			IsValidComponent(ComponentHandle handle) const;
+
+		/// @brief Adds components by copying their bytes directly into the array, this is only available for trivially copyable types
+		/// @param data The components to copy, this does not need to be aligned
+		/// @param count The number of components to copy
+		void BlitComponents(const std::byte *data, size_t count);
+
+		/// @brief Returns every component in the array, the order changes when components are removed
+		/// @return A span over the stored components
+		std::span<T> GetComponents();
+
+	  private:
+		struct Slot
+		{
+			uint32_t DenseIndex = 0;
+			uint32_t Generation = 0;
+			bool	 Occupied	= false;
+		};
 
 	  private:
+		/// @brief The components, packed together with no gaps
 		std::vector<T> m_Components = {};
+
+		/// @brief The slot in m_Slots that owns each component in m_Components
+		std::vector<uint32_t> m_DenseToSlot = {};
+
+		/// @brief Maps the index stored in a handle to the component's position in m_Components
+		std::vector<Slot> m_Slots = {};
+
+		/// @brief Slots that can be reused by new components
+		std::vector<uint32_t> m_FreeSlots = {};
 	};
 
 	template<typename... Args>
@@ -180,39 +231,33 @@ namespace Nexus::ECS
 		}
 
 		template<typename T>
-		void AddComponent(GUID guid, T component, size_t entityHierarchyPosition)
+		ComponentHandle AddComponent(GUID guid, T component, size_t entityHierarchyPosition)
 		{
 			const char		  *typeName	  = typeid(T).name();
 			ComponentArray<T> *components = GetComponentArray<T>();
-			size_t			   position	  = components->GetComponentCount();
-
-			ComponentPositionData componentPosition = {.componentIndex = position, .entityComponentIndex = entityHierarchyPosition};
-			components->AddComponent(component);
+			ComponentHandle	   handle	  = components->AddComponent(std::move(component));
 
+			ComponentPositionData componentPosition = {.handle = handle, .entityComponentIndex = entityHierarchyPosition};
 			m_ComponentIds[guid][typeName].push_back(componentPosition);
+			return handle;
 		}
 
 		template<typename T>
 		void AddComponent(GUID guid, T component)
 		{
-			size_t entityIndex		= 0;
-			auto   storedComponents = m_ComponentIds[guid];
-			for (auto &[name, components] : storedComponents) { entityIndex += components.size(); }
-			AddComponent<T>(guid, component, entityIndex);
+			size_t entityIndex = 0;
+			for (const auto &[name, components] : m_ComponentIds[guid])
+			{
+				for (const ComponentPositionData &position : components) { entityIndex = std::max(entityIndex, position.entityComponentIndex + 1); }
+			}
+			AddComponent<T>(guid, std::move(component), entityIndex);
 		}
 
 		template<typename T>
-		T *GetComponent(size_t index)
+		T *GetComponent(ComponentHandle handle)
 		{
-			const char		  *typeName	  = typeid(T).name();
 			ComponentArray<T> *components = GetComponentArray<T>();
-
-			if (index > components->GetComponentCount())
-			{
-				return nullptr;
-			}
-
-			return components->GetComponent(index);
+			return components->GetComponent(handle);
 		}
 
 		template<typename T>
@@ -225,50 +270,107 @@ namespace Nexus::ECS
 			}
 
 			const std::vector<Nexus::ECS::ComponentPositionData> &componentIndices = m_ComponentIds[id][typeName];
-			if (componentIndices.empty() || componentIndices.size() < index)
+			if (index >= componentIndices.size())
 			{
 				return nullptr;
 			}
 
 			ComponentArray<T> *componentArray = GetComponentArray<T>();
-			return componentArray->GetComponent(componentIndices[index].componentIndex);
+			return componentArray->GetComponent(componentIndices[index].handle);
 		}
 
-		void *GetRawComponent(const std::string &typeName, size_t index)
+		/// @brief Adds a whole array of components at once, e.g. when loading a scene, if the registry does not have any components of the
+		/// type yet then the array is used as it is without copying the components
+		/// @param typeName The type name of the components, as returned by IComponentArray::GetTypeName
+		/// @param components The components to add
+		/// @param owners The entity that owns each component, in the same order as the components were added to the array
+		/// @param hierarchyIndices The position of each component within its entity
+		void AddComponentArray(const std::string	  &typeName,
+							   Scope<IComponentArray>  components,
+							   std::span<const GUID>   owners,
+							   std::span<const size_t> hierarchyIndices)
+		{
+			if (owners.size() != components->GetComponentCount() || hierarchyIndices.size() != owners.size())
+			{
+				throw std::runtime_error("Every component must have an owner and a hierarchy index");
+			}
+
+			if (typeName != components->GetTypeName())
+			{
+				throw std::runtime_error("The components do not match the type name " + typeName);
+			}
+
+			std::vector<ComponentHandle> handles;
+			handles.reserve(owners.size());
+
+			Scope<IComponentArray> &existing = m_Components[typeName];
+			if (!existing)
+			{
+				existing = std::move(components);
+				for (size_t i = 0; i < owners.size(); i++) { handles.push_back(existing->GetHandle(i)); }
+			}
+			else
+			{
+				existing->Append(*components, handles);
+			}
+
+			for (size_t i = 0; i < owners.size(); i++)
+			{
+				ComponentPositionData position = {.handle = handles[i], .entityComponentIndex = hierarchyIndices[i]};
+				m_ComponentIds[owners[i]][typeName].push_back(position);
+			}
+		}
+
+		void *GetRawComponent(const std::string &typeName, ComponentHandle handle)
 		{
 			IComponentArray *components = GetBaseComponentArray(typeName.c_str());
-			return components->GetRawComponent(index);
+			if (!components)
+			{
+				return nullptr;
+			}
+
+			return components->GetRawComponent(handle);
 		}
 
 		void *GetRawComponent(ComponentPtr component)
 		{
-			return GetRawComponent(component.typeName, component.componentIndex);
+			return GetRawComponent(component.typeName, component.handle);
 		}
 
-		void RemoveComponent(GUID guid, const std::string name, size_t index)
+		void RemoveComponent(GUID guid, const std::string name, ComponentHandle handle)
 		{
-			IComponentArray *components = GetBaseComponentArray(name.c_str());
-			if (!components)
+			auto entity = m_ComponentIds.find(guid);
+			if (entity == m_ComponentIds.end())
 			{
 				return;
 			}
 
-			components->RemoveComponent(index);
-
-			std::vector<ComponentPositionData> &ids = m_ComponentIds[guid][name.c_str()];
+			auto ids = entity->second.find(name);
+			if (ids == entity->second.end())
+			{
+				return;
+			}
 
-			size_t removeIndex = 0;
-			for (const auto &[position, entityIndex] : ids)
+			// only components owned by the entity can be removed through it
+			auto position = std::find_if(ids->second.begin(),
+										 ids->second.end(),
+										 [&](const ComponentPositionData &data) { return data.handle == handle; });
+			if (position == ids->second.end())
 			{
-				if (position == index)
-				{
-					break;
-				}
+				return;
+			}
 
-				removeIndex++;
+			IComponentArray *components = GetBaseComponentArray(name);
+			if (components)
+			{
+				components->RemoveComponent(handle);
 			}
 
-			ids.erase(ids.begin() + removeIndex);
+			ids->second.erase(position);
+			if (ids->second.empty())
+			{
+				entity->second.erase(ids);
+			}
 		}
 
 		template<typename T>
@@ -281,9 +383,9 @@ namespace Nexus::ECS
 			{
 				ComponentArray<T> *c = GetComponentArray<T>();
 
-				if (c->IsValidComponent(entityComponents[0]))
+				if (c->IsValidComponent(entityComponents[0].handle))
 				{
-					return c->GetComponent(entityComponents[0]);
+					return c->GetComponent(entityComponents[0].handle);
 				}
 			}
 
@@ -294,31 +396,28 @@ namespace Nexus::ECS
 		{
 			std::vector<ComponentPtr> returnComponents;
 
-			for (const auto &[id, entityComponents] : m_ComponentIds)
+			auto entityComponents = m_ComponentIds.find(guid);
+			if (entityComponents == m_ComponentIds.end())
 			{
-				if (id != guid)
+				return returnComponents;
+			}
+
+			for (const auto &[name, components] : entityComponents->second)
+			{
+				IComponentArray *componentArray = GetBaseComponentArray(name);
+
+				if (!componentArray)
 				{
 					continue;
 				}
 
-				for (const auto &[name, components] : entityComponents)
+				for (const auto &componentIndex : components)
 				{
-					IComponentArray *componentArray = GetBaseComponentArray(name);
-
-					if (!componentArray)
-					{
-						continue;
-						;
-					}
-
-					for (const auto &componentIndex : components)
-					{
-						ComponentPtr ptr		 = {};
-						ptr.componentIndex		 = componentIndex.componentIndex;
-						ptr.entityComponentIndex = componentIndex.entityComponentIndex;
-						ptr.typeName			 = componentArray->GetTypeName();
-						returnComponents.push_back(ptr);
-					}
+					ComponentPtr ptr		 = {};
+					ptr.handle				 = componentIndex.handle;
+					ptr.entityComponentIndex = componentIndex.entityComponentIndex;
+					ptr.typeName			 = componentArray->GetTypeName();
+					returnComponents.push_back(ptr);
 				}
 			}
 
@@ -342,7 +441,7 @@ namespace Nexus::ECS
 			ComponentArray<T> *components = GetComponentArray<T>();
 			for (const Nexus::ECS::ComponentPositionData &componentData : entityComponents)
 			{
-				T *casted = components->GetComponent(componentData.componentIndex);
+				T *casted = components->GetComponent(componentData.handle);
 				returnComponents.push_back(casted);
 			}
 
@@ -416,25 +515,25 @@ namespace Nexus::ECS
 		template<typename T>
 		ComponentArray<T> *GetComponentArray()
 		{
-			const std::type_info &typeInfo = typeid(T);
-			if (m_Components.find(typeInfo.name()) == m_Components.end())
+			const std::type_info   &typeInfo   = typeid(T);
+			Scope<IComponentArray> &components = m_Components[typeInfo.name()];
+			if (!components)
 			{
-				m_Components[typeInfo.name()] = new ComponentArray<T>();
+				components = CreateScope<ComponentArray<T>>();
 			}
 
-			IComponentArray *components = m_Components[typeInfo.name()];
-
-			return (ComponentArray<T> *)components;
+			return (ComponentArray<T> *)components.get();
 		}
 
 		IComponentArray *GetBaseComponentArray(const std::string &typeName)
 		{
-			if (m_Components.find(typeName) == m_Components.end())
+			auto it = m_Components.find(typeName);
+			if (it == m_Components.end())
 			{
 				return nullptr;
 			}
 
-			return m_Components[typeName];
+			return it->second.get();
 		}
 
 	  private:
@@ -442,7 +541,7 @@ namespace Nexus::ECS
 		std::vector<Entity> m_Entities = {};
 
 		// vector of components of each type
-		std::map<std::string, IComponentArray *> m_Components = {};
+		std::map<std::string, Scope<IComponentArray>> m_Components = {};
 
 		// map of entity ownership
 		std::map<GUID, std::map<std::string, std::vector<ComponentPositionData>>> m_ComponentIds = {};
@@ -14,15 +14,40 @@ namespace Nexus::ECS
 	}
 
 	template<typename T>
-	void *ComponentArray<T>::GetRawComponent(size_t index)
+	void *ComponentArray<T>::GetRawComponent(ComponentHandle handle)
 	{
-		return &m_Components[index];
+		return GetComponent(handle);
 	}
 
 	template<typename T>
-	void ComponentArray<T>::RemoveComponent(size_t index)
+	bool ComponentArray<T>::RemoveComponent(ComponentHandle handle)
 	{
-		m_Components.erase(m_Components.begin() + index);
+		if (!IsValidComponent(handle))
+		{
+			return false;
+		}
+
+		Slot	&slot	   = m_Slots[handle.Index];
+		uint32_t removed   = slot.DenseIndex;
+		uint32_t lastIndex = (uint32_t)m_Components.size() - 1;
+
+		// the last component is moved into the gap, so only the slot that owns it needs to be updated
+		if (removed != lastIndex)
+		{
+			m_Components[removed]					   = std::move(m_Components[lastIndex]);
+			m_DenseToSlot[removed]					   = m_DenseToSlot[lastIndex];
+			m_Slots[m_DenseToSlot[removed]].DenseIndex = removed;
+		}
+
+		m_Components.pop_back();
+		m_DenseToSlot.pop_back();
+
+		// incrementing the generation invalidates every handle that still refers to the removed component
+		slot.Occupied = false;
+		slot.Generation++;
+		m_FreeSlots.push_back(handle.Index);
+
+		return true;
 	}
 
 	template<typename T>
@@ -33,25 +58,109 @@ namespace Nexus::ECS
 	}
 
 	template<typename T>
-	void ComponentArray<T>::AddComponent(const T &component)
+	ComponentHandle ComponentArray<T>::GetHandle(size_t index)
 	{
-		m_Components.push_back(component);
+		uint32_t slot = m_DenseToSlot[index];
+		return ComponentHandle {.Index = slot, .Generation = m_Slots[slot].Generation};
 	}
 
 	template<typename T>
-	T *ComponentArray<T>::GetComponent(size_t index)
+	void ComponentArray<T>::Append(IComponentArray &other, std::vector<ComponentHandle> &handles)
 	{
-		return &m_Components[index];
+		// type names are what the registry keys its arrays by, so they identify the component type without needing RTTI on the array
+		if (std::string_view(other.GetTypeName()) != GetTypeName())
+		{
+			throw std::runtime_error(std::string("Cannot append components of type ") + other.GetTypeName() + " to an array of " + GetTypeName());
+		}
+
+		ComponentArray<T> &source = static_cast<ComponentArray<T> &>(other);
+
+		m_Components.reserve(m_Components.size() + source.m_Components.size());
+		for (T &component : source.m_Components) { handles.push_back(AddComponent(std::move(component))); }
+
+		source.m_Components.clear();
+		source.m_DenseToSlot.clear();
+		source.m_Slots.clear();
+		source.m_FreeSlots.clear();
 	}
 
 	template<typename T>
-	bool ComponentArray<T>::IsValidComponent(size_t index)
+	void ComponentArray<T>::BlitComponents(const std::byte *data, size_t count)
 	{
-		if (index > m_Components.size() || index == 0)
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			size_t first = m_Components.size();
+			m_Components.resize(first + count);
+			std::memcpy(static_cast<void *>(m_Components.data() + first), data, count * sizeof(T));
+
+			m_DenseToSlot.reserve(first + count);
+			m_Slots.reserve(m_Slots.size() + count);
+
+			// blitted components always get new slots so that they occupy consecutive handles
+			for (size_t i = 0; i < count; i++)
+			{
+				uint32_t slot = (uint32_t)m_Slots.size();
+				m_Slots.push_back(Slot {.DenseIndex = (uint32_t)(first + i), .Generation = 0, .Occupied = true});
+				m_DenseToSlot.push_back(slot);
+			}
+		}
+		else
+		{
+			throw std::runtime_error("Only trivially copyable components can be blitted");
+		}
+	}
+
+	template<typename T>
+	ComponentHandle ComponentArray<T>::AddComponent(T component)
+	{
+		uint32_t index = 0;
+		if (!m_FreeSlots.empty())
+		{
+			index = m_FreeSlots.back();
+			m_FreeSlots.pop_back();
+		}
+		else
+		{
+			index = (uint32_t)m_Slots.size();
+			m_Slots.emplace_back();
+		}
+
+		Slot &slot		= m_Slots[index];
+		slot.DenseIndex = (uint32_t)m_Components.size();
+		slot.Occupied	= true;
+
+		m_Components.push_back(std::move(component));
+		m_DenseToSlot.push_back(index);
+
+		return ComponentHandle {.Index = index, .Generation = slot.Generation};
+	}
+
+	template<typename T>
+	T *ComponentArray<T>::GetComponent(ComponentHandle handle)
+	{
+		if (!IsValidComponent(handle))
+		{
+			return nullptr;
+		}
+
+		return &m_Components[m_Slots[handle.Index].DenseIndex];
+	}
+
+	template<typename T>
+	bool ComponentArray<T>::IsValidComponent(ComponentHandle handle) const
+	{
+		if (handle.Index >= m_Slots.size())
 		{
 			return false;
 		}
 
-		return true;
+		const Slot &slot = m_Slots[handle.Index];
+		return slot.Occupied && slot.Generation == handle.Generation;
+	}
+
+	template<typename T>
+	std::span<T> ComponentArray<T>::GetComponents()
+	{
+		return m_Components;
 	}
-}	 // namespace Nexus::ECS
\ No newline at end of file
+}	 // namespace Nexus::ECS
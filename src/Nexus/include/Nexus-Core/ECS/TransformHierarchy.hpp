@@ -0,0 +1,209 @@
+#pragma once
+
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::ECS
+{
+	/// @brief A translation, rotation and scale relative to a node's parent
+	struct LocalTransform
+	{
+		glm::vec3 Position = glm::vec3(0.0f, 0.0f, 0.0f);
+		glm::quat Rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+		glm::vec3 Scale	   = glm::vec3(1.0f, 1.0f, 1.0f);
+	};
+
+	/// @brief A handle to a node in a TransformHierarchy, the handle stays valid while other nodes are added, removed or reparented and
+	/// becomes invalid once the node it refers to is destroyed
+	struct TransformNode
+	{
+		/// @brief The slot in the hierarchy's handle table
+		uint32_t Index = UINT32_MAX;
+
+		/// @brief The generation of the slot at the time that the node was created
+		uint32_t Generation = 0;
+
+		/// @brief Returns whether the handle was returned from TransformHierarchy::Create
+		/// @return Whether the handle refers to a node
+		bool IsValid() const
+		{
+			return Index != UINT32_MAX;
+		}
+
+		bool operator==(const TransformNode &other) const = default;
+	};
+
+	/// @brief Builds a matrix that scales, then rotates, then translates
+	/// @param transform The transform to convert, the rotation must be normalised
+	/// @return The matrix
+	NX_API glm::mat4 ComposeTransform(const LocalTransform &transform);
+
+	/// @brief Builds the matrices of many transforms at once, this is vectorised on platforms that support it
+	/// @param transforms The transforms to convert, the rotations must be normalised
+	/// @param output Storage for transforms.size() matrices
+	NX_API void ComposeTransforms(std::span<const LocalTransform> transforms, glm::mat4 *output);
+
+	/// @brief A parent-child hierarchy of transforms that caches each node's local and world matrices. Nodes are stored in depth-first
+	/// order so that a parent is always processed before its children, and Update only recomputes the subtrees below nodes that changed.
+	/// Creating, destroying and reparenting nodes only relinks them in constant time (or in time proportional to the depth or the size of
+	/// the destroyed subtree), the depth-first order is then restored in a single pass by the next call to Update.
+	class NX_API TransformHierarchy
+	{
+	  public:
+		/// @brief Creates a new node, a node that is given a parent is placed after the parent's existing children
+		/// @param transform The initial transform of the node, relative to its parent
+		/// @param parent The parent of the node, or an invalid handle to create a root node
+		/// @return A handle to the node
+		TransformNode Create(const LocalTransform &transform = {}, TransformNode parent = {});
+
+		/// @brief Destroys a node along with all of its descendants
+		/// @param node The node to destroy
+		void Destroy(TransformNode node);
+
+		/// @brief Moves a node and its descendants below a different parent, the node's local transform is kept
+		/// @param node The node to move
+		/// @param parent The new parent, or an invalid handle to make the node a root
+		void SetParent(TransformNode node, TransformNode parent);
+
+		/// @brief Returns the parent of a node
+		/// @param node The node to query
+		/// @return The parent, or an invalid handle if the node is a root
+		TransformNode GetParent(TransformNode node) const;
+
+		/// @brief Returns whether a node is the same as another node or one of its descendants, which is the case in which making the
+		/// other node a child of the first would create a cycle
+		/// @param node The node to check
+		/// @param ancestor The node that may be above it
+		/// @return Whether node is ancestor or lies below it
+		bool IsDescendant(TransformNode node, TransformNode ancestor) const;
+
+		/// @brief Returns whether a handle refers to a node that has not been destroyed
+		/// @param node The handle to check
+		/// @return Whether the node exists
+		bool IsAlive(TransformNode node) const;
+
+		/// @brief Returns the number of nodes in the hierarchy
+		/// @return The number of nodes
+		size_t GetNodeCount() const;
+
+		/// @brief Returns the transform of a node relative to its parent
+		/// @param node The node to query
+		/// @return The local transform
+		const LocalTransform &GetLocalTransform(TransformNode node) const;
+
+		/// @brief Replaces the transform of a node, the node and its descendants are recomputed on the next call to Update
+		/// @param node The node to modify
+		/// @param transform The new transform, relative to the node's parent
+		void SetLocalTransform(TransformNode node, const LocalTransform &transform);
+
+		/// @brief Sets the position of a node relative to its parent
+		/// @param node The node to modify
+		/// @param position The new position
+		void SetLocalPosition(TransformNode node, const glm::vec3 &position);
+
+		/// @brief Sets the rotation of a node relative to its parent
+		/// @param node The node to modify
+		/// @param rotation The new rotation, this must be normalised
+		void SetLocalRotation(TransformNode node, const glm::quat &rotation);
+
+		/// @brief Sets the scale of a node relative to its parent
+		/// @param node The node to modify
+		/// @param scale The new scale
+		void SetLocalScale(TransformNode node, const glm::vec3 &scale);
+
+		/// @brief Returns the matrix built from a node's local transform, as of the last call to Update
+		/// @param node The node to query
+		/// @return The local matrix
+		const glm::mat4 &GetLocalMatrix(TransformNode node) const;
+
+		/// @brief Returns the matrix that transforms from a node's space to world space, as of the last call to Update
+		/// @param node The node to query
+		/// @return The world matrix
+		const glm::mat4 &GetWorldMatrix(TransformNode node) const;
+
+		/// @brief Recomputes the matrices of every node that has changed, along with the world matrices of their descendants
+		/// @return The number of world matrices that were recomputed
+		size_t Update();
+
+	  private:
+		static constexpr uint32_t c_NoParent = UINT32_MAX;
+		static constexpr uint32_t c_NoSlot	 = UINT32_MAX;
+
+		struct Node
+		{
+			/// @brief The depth-first position of the parent, or c_NoParent for a root. This and the subtree size are only kept up to date
+			/// while the layout is not dirty.
+			uint32_t Parent = 0;
+
+			/// @brief The number of nodes in the subtree starting at this node, including itself
+			uint32_t SubtreeSize = 1;
+
+			/// @brief The slot in m_Slots that refers to this node
+			uint32_t SlotIndex = 0;
+
+			/// @brief Whether the local matrix needs to be rebuilt
+			bool LocalDirty = false;
+
+			/// @brief Whether the world matrices of this node and its descendants need to be rebuilt
+			bool WorldDirty = false;
+		};
+
+		/// @brief The handle table entry of a node, which also links the node to its parent and siblings by their slots so that the
+		/// structure of the hierarchy does not depend on where the nodes are stored
+		struct Slot
+		{
+			uint32_t Order		 = 0;
+			uint32_t Generation	 = 0;
+			uint32_t Parent		 = c_NoSlot;
+			uint32_t FirstChild	 = c_NoSlot;
+			uint32_t LastChild	 = c_NoSlot;
+			uint32_t PrevSibling = c_NoSlot;
+			uint32_t NextSibling = c_NoSlot;
+			bool	 Occupied	 = false;
+		};
+
+		uint32_t GetOrder(TransformNode node) const;
+		void	 MarkDirty(uint32_t order, bool local);
+
+		/// @brief Adds a slot as the last child of a parent, or as the last root if the parent is c_NoSlot
+		void Link(uint32_t slotIndex, uint32_t parentSlot);
+
+		/// @brief Removes a slot from the children of its parent, or from the roots
+		void Unlink(uint32_t slotIndex);
+
+		/// @brief Stores the nodes in depth-first order again by walking the links from each root, dropping destroyed nodes
+		void RebuildLayout();
+
+	  private:
+		/// @brief The per-node data, all of these are stored in depth-first order unless the layout is dirty
+		std::vector<Node>			m_Nodes			= {};
+		std::vector<LocalTransform> m_Locals		= {};
+		std::vector<glm::mat4>		m_LocalMatrices = {};
+		std::vector<glm::mat4>		m_WorldMatrices = {};
+
+		/// @brief The storage that the layout is rebuilt into, kept between rebuilds to avoid reallocating
+		std::vector<Node>			m_LayoutNodes		  = {};
+		std::vector<LocalTransform> m_LayoutLocals		  = {};
+		std::vector<glm::mat4>		m_LayoutLocalMatrices = {};
+		std::vector<glm::mat4>		m_LayoutWorldMatrices = {};
+
+		/// @brief Whether nodes have been added, destroyed or moved in a way that breaks the depth-first order since the last update
+		bool m_LayoutDirty = false;
+
+		/// @brief The number of nodes that have not been destroyed, m_Nodes also holds destroyed nodes until the layout is rebuilt
+		size_t m_NodeCount = 0;
+
+		/// @brief The slots of the first and last root nodes, the roots are linked to each other as siblings
+		uint32_t m_FirstRoot = c_NoSlot;
+		uint32_t m_LastRoot	 = c_NoSlot;
+
+		/// @brief Maps the index stored in a handle to the node's depth-first position
+		std::vector<Slot>	  m_Slots	  = {};
+		std::vector<uint32_t> m_FreeSlots = {};
+
+		/// @brief The slots of nodes that have changed since the last update
+		std::vector<uint32_t> m_DirtySlots = {};
+
+		/// @brief The depth-first positions of the dirty nodes, kept between updates to avoid reallocating
+		std::vector<uint32_t> m_DirtyOrders = {};
+	};
+}	 // namespace Nexus::ECS
@@ -0,0 +1,182 @@
+#pragma once
+
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus
+{
+	template<typename Signature>
+	class Delegate;
+
+	/// @brief A trait used to detect std::function so that an empty function can be turned into an empty delegate
+	template<typename T>
+	struct IsStdFunction : std::false_type
+	{
+	};
+
+	template<typename Signature>
+	struct IsStdFunction<std::function<Signature>> : std::true_type
+	{
+	};
+
+	/// @brief A type-erased callable similar to std::function, callables that fit within the inline buffer (e.g. lambdas capturing a few
+	/// pointers) are stored without any heap allocation
+	/// @tparam Return The type returned by the callable
+	/// @tparam Args The parameters passed to the callable
+	template<typename Return, typename... Args>
+	class Delegate<Return(Args...)>
+	{
+	  public:
+		/// @brief The number of bytes available to store a callable inline
+		static constexpr size_t InlineSize = 48;
+
+		Delegate() = default;
+
+		/// @brief Creates a delegate from any callable that can be invoked with Args
+		/// @tparam Func The type of the callable
+		/// @param func The callable to store
+		template<typename Func>
+			requires(!std::is_same_v<std::decay_t<Func>, Delegate> && std::is_invocable_r_v<Return, std::decay_t<Func> &, Args...>)
+		Delegate(Func &&func)
+		{
+			using Callable = std::decay_t<Func>;
+
+			if constexpr (std::is_pointer_v<Callable> || std::is_member_pointer_v<Callable> || IsStdFunction<Callable>::value)
+			{
+				// an empty std::function or null function pointer results in an empty delegate
+				if (func == nullptr)
+				{
+					return;
+				}
+			}
+
+			if constexpr (IsStoredInline<Callable>())
+			{
+				new (m_Storage) Callable(std::forward<Func>(func));
+			}
+			else
+			{
+				*reinterpret_cast<Callable **>(m_Storage) = new Callable(std::forward<Func>(func));
+			}
+
+			m_Operations = &c_Operations<Callable>;
+		}
+
+		Delegate(const Delegate &)			  = delete;
+		Delegate &operator=(const Delegate &) = delete;
+
+		Delegate(Delegate &&other) noexcept
+		{
+			MoveFrom(other);
+		}
+
+		Delegate &operator=(Delegate &&other) noexcept
+		{
+			if (this != &other)
+			{
+				Reset();
+				MoveFrom(other);
+			}
+			return *this;
+		}
+
+		~Delegate()
+		{
+			Reset();
+		}
+
+		/// @brief Calls the stored callable, the delegate must not be empty
+		/// @param args The arguments to pass to the callable
+		/// @return The value returned by the callable
+		Return operator()(Args... args) const
+		{
+			return m_Operations->Invoke(const_cast<std::byte *>(m_Storage), std::forward<Args>(args)...);
+		}
+
+		/// @brief Returns whether the delegate contains a callable
+		explicit operator bool() const
+		{
+			return m_Operations != nullptr;
+		}
+
+		/// @brief Destroys the stored callable, leaving the delegate empty
+		void Reset()
+		{
+			if (m_Operations)
+			{
+				m_Operations->Destroy(m_Storage);
+				m_Operations = nullptr;
+			}
+		}
+
+	  private:
+		struct Operations
+		{
+			Return (*Invoke)(std::byte *storage, Args &&...args);
+			void (*Move)(std::byte *destination, std::byte *source);
+			void (*Destroy)(std::byte *storage);
+		};
+
+		template<typename Callable>
+		static constexpr bool IsStoredInline()
+		{
+			return sizeof(Callable) <= InlineSize && alignof(Callable) <= alignof(std::max_align_t) &&
+				   std::is_nothrow_move_constructible_v<Callable>;
+		}
+
+		template<typename Callable>
+		static Callable *GetCallable(std::byte *storage)
+		{
+			if constexpr (IsStoredInline<Callable>())
+			{
+				return std::launder(reinterpret_cast<Callable *>(storage));
+			}
+			else
+			{
+				return *reinterpret_cast<Callable **>(storage);
+			}
+		}
+
+		template<typename Callable>
+		static constexpr Operations c_Operations = {
+			[](std::byte *storage, Args &&...args) -> Return { return std::invoke(*GetCallable<Callable>(storage), std::forward<Args>(args)...); },
+			[](std::byte *destination, std::byte *source)
+			{
+				if constexpr (IsStoredInline<Callable>())
+				{
+					Callable *callable = GetCallable<Callable>(source);
+					new (destination) Callable(std::move(*callable));
+					callable->~Callable();
+				}
+				else
+				{
+					// heap allocated callables only need their pointer to be transferred
+					*reinterpret_cast<Callable **>(destination) = *reinterpret_cast<Callable **>(source);
+				}
+			},
+			[](std::byte *storage)
+			{
+				if constexpr (IsStoredInline<Callable>())
+				{
+					GetCallable<Callable>(storage)->~Callable();
+				}
+				else
+				{
+					delete GetCallable<Callable>(storage);
+				}
+			}};
+
+		void MoveFrom(Delegate &other)
+		{
+			if (other.m_Operations)
+			{
+				other.m_Operations->Move(m_Storage, other.m_Storage);
+				m_Operations	   = other.m_Operations;
+				other.m_Operations = nullptr;
+			}
+		}
+
+	  private:
+		alignas(std::max_align_t) std::byte m_Storage[InlineSize];
+		const Operations *m_Operations = nullptr;
+	};
+}	 // namespace Nexus
@@ -2,41 +2,110 @@
 
 #include "Nexus-Core/nxpch.hpp"
 
+#include "Delegate.hpp"
 #include "Nexus-Core/Utils/Utils.hpp"
 
 namespace Nexus
 {
+	/// @brief An identifier returned when binding a function to an EventHandler, the lower 32 bits store the slot that the function occupies
+	/// and the upper 32 bits store a counter that is incremented for every bind, so an ID is never reused while the handler exists
 	using EventID = uint64_t;
 
-	/// @brief A class that is used to call a group of functions when an event
-	/// occurs
+	/// @brief A class that is used to call a group of functions when an event occurs. Binding, unbinding and invoking must happen on a
+	/// single thread, but functions may bind or unbind (including themselves) while the event is being invoked. Other threads can use
+	/// Enqueue to defer an invocation until DispatchQueued is called. Dispatched events are returned to a fixed size pool that Enqueue
+	/// takes from without locking, so queuing only allocates while more events are waiting than the pool has ever held.
 	/// @tparam Args The parameters to use when invoking the event functions
 	template<typename... Args>
 	class EventHandler
 	{
-		using EventFunction = std::function<void(Args...)>;
+		using EventFunction = Delegate<void(Args...)>;
 
 		struct BoundEvent
 		{
-			EventID		  ID   = {};
-			EventFunction Func = {};
+			EventID		  ID	= {};
+			EventFunction Func	= {};
+			bool		  Alive = true;
 		};
 
+		struct QueuedEvent
+		{
+			std::tuple<std::decay_t<Args>...> Arguments = {};
+			QueuedEvent						*Next	  = nullptr;
+		};
+
+		/// @brief A slot in the pool of queued events, the sequence records whether the slot is waiting to be filled or taken
+		struct PooledEvent
+		{
+			std::atomic<size_t> Sequence = 0;
+			QueuedEvent		   *Event	 = nullptr;
+		};
+
+		static constexpr uint32_t c_InvalidIndex = UINT32_MAX;
+
+		/// @brief The number of dispatched events that are kept to be reused by Enqueue, this must be a power of two
+		static constexpr size_t c_EventPoolCapacity = 64;
+
 	  public:
-		/// @brief A method that calls the functions using a templated parameter
+		EventHandler()
+		{
+			for (size_t i = 0; i < c_EventPoolCapacity; i++) { m_EventPool[i].Sequence.store(i, std::memory_order_relaxed); }
+		}
+
+		EventHandler(const EventHandler &)			  = delete;
+		EventHandler &operator=(const EventHandler &) = delete;
+
+		~EventHandler()
+		{
+			DiscardQueued();
+
+			while (QueuedEvent *event = TakePooledEvent()) { delete event; }
+		}
+
+		/// @brief A method that calls the functions using a templated parameter, functions that are bound during the call will not be
+		/// called until the next invocation
 		/// @param param The payload to use for the functions
 		void Invoke(Args... param)
 		{
-			for (const auto &[id, delegate] : m_EventFunctions) { delegate(param...); }
+			m_DispatchDepth++;
+
+			// the deque never moves existing elements when appending, so a function can safely bind new functions while it is running
+			size_t count = m_EventFunctions.size();
+			for (size_t i = 0; i < count; i++)
+			{
+				BoundEvent &event = m_EventFunctions[i];
+				if (event.Alive)
+				{
+					event.Func(param...);
+				}
+			}
+
+			m_DispatchDepth--;
+			CompactIfNeeded();
 		}
 
 		/// @brief A method to bind a new function to the event handler
 		/// @param function The function to bind to the event handler
+		/// @return An ID that can be used to unbind the function
 		EventID Bind(EventFunction function)
 		{
-			EventID	   id = Utils::GetCurrentTimeAsInt();
-			BoundEvent event {.ID = id, .Func = function};
-			m_EventFunctions.push_back(event);
+			uint32_t slot = 0;
+			if (!m_FreeSlots.empty())
+			{
+				slot = m_FreeSlots.back();
+				m_FreeSlots.pop_back();
+			}
+			else
+			{
+				slot = (uint32_t)m_Slots.size();
+				m_Slots.push_back(c_InvalidIndex);
+			}
+
+			EventID id	  = ((EventID)m_NextSerial++ << 32) | slot;
+			m_Slots[slot] = (uint32_t)m_EventFunctions.size();
+			m_EventFunctions.push_back(BoundEvent {.ID = id, .Func = std::move(function), .Alive = true});
+			m_LiveCount++;
+
 			return id;
 		}
 
@@ -44,14 +113,25 @@ namespace Nexus
 		/// @param id The ID of the function to unbind from the event handler
 		void Unbind(EventID id)
 		{
-			for (size_t i = 0; i < m_EventFunctions.size(); i++)
+			uint32_t slot = (uint32_t)(id & 0xFFFFFFFF);
+			if (slot >= m_Slots.size() || m_Slots[slot] == c_InvalidIndex)
 			{
-				if (m_EventFunctions[i].ID == id)
-				{
-					m_EventFunctions.erase(m_EventFunctions.begin() + i);
-					i--;
-				}
+				return;
+			}
+
+			BoundEvent &event = m_EventFunctions[m_Slots[slot]];
+			if (event.ID != id || !event.Alive)
+			{
+				return;
 			}
+
+			// the function may be the one currently running, so it is only destroyed once the handler is compacted
+			event.Alive	  = false;
+			m_Slots[slot] = c_InvalidIndex;
+			m_FreeSlots.push_back(slot);
+			m_LiveCount--;
+
+			CompactIfNeeded();
 		}
 
 		/// @brief A method that returns the amount of delegates bound to the event
@@ -59,17 +139,206 @@ namespace Nexus
 		/// @return The amount of delegates bound to the event handler
 		int GetDelegateCount()
 		{
-			return m_EventFunctions.size();
+			return (int)m_LiveCount;
 		}
 
+		/// @brief A method that unbinds every function from the event handler
 		void Clear()
 		{
-			m_EventFunctions.clear();
+			for (BoundEvent &event : m_EventFunctions)
+			{
+				if (event.Alive)
+				{
+					event.Alive = false;
+					m_FreeSlots.push_back((uint32_t)(event.ID & 0xFFFFFFFF));
+					m_Slots[(uint32_t)(event.ID & 0xFFFFFFFF)] = c_InvalidIndex;
+				}
+			}
+
+			m_LiveCount = 0;
+			CompactIfNeeded();
+		}
+
+		/// @brief A method that stores a copy of the arguments so that the event can be invoked later by DispatchQueued, this can be called
+		/// from any thread
+		/// @param param The payload to use for the functions
+		void Enqueue(Args... param)
+		{
+			QueuedEvent *event = TakePooledEvent();
+			if (!event)
+			{
+				event = new QueuedEvent();
+			}
+
+			event->Arguments = std::tuple<std::decay_t<Args>...>(param...);
+			event->Next		 = m_QueuedEvents.load(std::memory_order_relaxed);
+
+			while (!m_QueuedEvents.compare_exchange_weak(event->Next, event, std::memory_order_release, std::memory_order_relaxed)) {}
+		}
+
+		/// @brief A method that invokes the event once for every call to Enqueue since the last dispatch, in the order that they were queued
+		/// @return The number of queued events that were dispatched
+		size_t DispatchQueued()
+		{
+			// the whole list is taken at once, so producers can keep pushing while it is processed
+			QueuedEvent *event = m_QueuedEvents.exchange(nullptr, std::memory_order_acquire);
+
+			// the list is built by pushing to the front, so reverse it to dispatch in submission order
+			QueuedEvent *ordered = nullptr;
+			while (event)
+			{
+				QueuedEvent *next = event->Next;
+				event->Next		  = ordered;
+				ordered			  = event;
+				event			  = next;
+			}
+
+			size_t dispatched = 0;
+			while (ordered)
+			{
+				std::apply([this](auto &...args) { Invoke(args...); }, ordered->Arguments);
+
+				QueuedEvent *next = ordered->Next;
+				if (!ReturnPooledEvent(ordered))
+				{
+					delete ordered;
+				}
+
+				ordered = next;
+				dispatched++;
+			}
+
+			return dispatched;
+		}
+
+		/// @brief A method that returns the number of dispatched events that are waiting to be reused by Enqueue
+		size_t GetPooledEventCount() const
+		{
+			return m_PoolTail.load(std::memory_order_relaxed) - m_PoolHead.load(std::memory_order_relaxed);
 		}
 
 	  private:
-		/// @brief A vector containing the bound delegates to call
-		std::vector<BoundEvent> m_EventFunctions;
+		void CompactIfNeeded()
+		{
+			// removing dead functions is deferred while invoking and batched so that unbinding stays O(1)
+			size_t deadCount = m_EventFunctions.size() - m_LiveCount;
+			if (m_DispatchDepth > 0 || deadCount == 0 || deadCount * 2 < m_EventFunctions.size())
+			{
+				return;
+			}
+
+			size_t write = 0;
+			for (size_t read = 0; read < m_EventFunctions.size(); read++)
+			{
+				if (!m_EventFunctions[read].Alive)
+				{
+					continue;
+				}
+
+				if (write != read)
+				{
+					m_EventFunctions[write] = std::move(m_EventFunctions[read]);
+				}
+
+				m_Slots[(uint32_t)(m_EventFunctions[write].ID & 0xFFFFFFFF)] = (uint32_t)write;
+				write++;
+			}
+
+			m_EventFunctions.resize(write);
+		}
+
+		/// @brief Takes an event from the pool, returning nullptr if the pool is empty
+		QueuedEvent *TakePooledEvent()
+		{
+			// a bounded queue where each slot's sequence tells a thread whether the slot has been filled for the position it claimed, so
+			// concurrent producers never need a lock and a slot can be reused without the ABA problem of a lock-free stack
+			size_t position = m_PoolHead.load(std::memory_order_relaxed);
+			while (true)
+			{
+				PooledEvent &slot	  = m_EventPool[position & (c_EventPoolCapacity - 1)];
+				intptr_t	 distance = (intptr_t)slot.Sequence.load(std::memory_order_acquire) - (intptr_t)(position + 1);
+
+				if (distance < 0)
+				{
+					return nullptr;
+				}
+
+				if (distance > 0)
+				{
+					position = m_PoolHead.load(std::memory_order_relaxed);
+					continue;
+				}
+
+				if (m_PoolHead.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					QueuedEvent *event = slot.Event;
+					slot.Sequence.store(position + c_EventPoolCapacity, std::memory_order_release);
+					return event;
+				}
+			}
+		}
+
+		/// @brief Returns an event to the pool, returning false if the pool is already full
+		bool ReturnPooledEvent(QueuedEvent *event)
+		{
+			size_t position = m_PoolTail.load(std::memory_order_relaxed);
+			while (true)
+			{
+				PooledEvent &slot	  = m_EventPool[position & (c_EventPoolCapacity - 1)];
+				intptr_t	 distance = (intptr_t)slot.Sequence.load(std::memory_order_acquire) - (intptr_t)position;
+
+				if (distance < 0)
+				{
+					return false;
+				}
+
+				if (distance > 0)
+				{
+					position = m_PoolTail.load(std::memory_order_relaxed);
+					continue;
+				}
+
+				if (m_PoolTail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					slot.Event = event;
+					slot.Sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+		}
+
+		void DiscardQueued()
+		{
+			QueuedEvent *event = m_QueuedEvents.exchange(nullptr, std::memory_order_acquire);
+			while (event)
+			{
+				QueuedEvent *next = event->Next;
+				delete event;
+				event = next;
+			}
+		}
+
+	  private:
+		/// @brief The bound delegates in the order that they were bound, unbound delegates remain until the handler is compacted
+		std::deque<BoundEvent> m_EventFunctions;
+
+		/// @brief Maps the slot stored in an EventID to the delegate's position in m_EventFunctions
+		std::vector<uint32_t> m_Slots;
+
+		/// @brief Slots that can be reused by new bindings
+		std::vector<uint32_t> m_FreeSlots;
+
+		/// @brief Events that have been queued from any thread and are waiting to be dispatched
+		std::atomic<QueuedEvent *> m_QueuedEvents = nullptr;
+
+		/// @brief Dispatched events that can be reused, m_PoolHead is the next slot to take from and m_PoolTail the next slot to fill
+		std::array<PooledEvent, c_EventPoolCapacity> m_EventPool = {};
+		std::atomic<size_t>							 m_PoolHead	 = 0;
+		std::atomic<size_t>							 m_PoolTail	 = 0;
+
+		uint32_t m_NextSerial	 = 1;
+		size_t	 m_LiveCount	 = 0;
+		uint32_t m_DispatchDepth = 0;
 	};
 
 	template<typename... Args>
@@ -77,16 +346,43 @@ namespace Nexus
 	{
 	  public:
 		ScopedEvent() = default;
-		ScopedEvent(EventHandler<Args...> *eventHandler, std::function<void(Args...)> func) : m_EventHandler(eventHandler)
+		ScopedEvent(EventHandler<Args...> *eventHandler, Delegate<void(Args...)> func) : m_EventHandler(eventHandler)
+		{
+			m_BoundEvent = eventHandler->Bind(std::move(func));
+		}
+
+		ScopedEvent(const ScopedEvent &)			= delete;
+		ScopedEvent &operator=(const ScopedEvent &) = delete;
+
+		ScopedEvent(ScopedEvent &&other) noexcept
+			: m_EventHandler(std::exchange(other.m_EventHandler, nullptr)),
+			  m_BoundEvent(std::exchange(other.m_BoundEvent, 0))
 		{
-			m_BoundEvent = eventHandler->Bind(func);
+		}
+
+		ScopedEvent &operator=(ScopedEvent &&other) noexcept
+		{
+			if (this != &other)
+			{
+				Reset();
+				m_EventHandler = std::exchange(other.m_EventHandler, nullptr);
+				m_BoundEvent   = std::exchange(other.m_BoundEvent, 0);
+			}
+			return *this;
 		}
 
 		~ScopedEvent()
+		{
+			Reset();
+		}
+
+		/// @brief Unbinds the function from the event handler early
+		void Reset()
 		{
 			if (m_EventHandler)
 			{
 				m_EventHandler->Unbind(m_BoundEvent);
+				m_EventHandler = nullptr;
 			}
 		}
 
@@ -94,4 +390,4 @@ namespace Nexus
 		EventHandler<Args...> *m_EventHandler = nullptr;
 		EventID				   m_BoundEvent	  = 0;
 	};
-}	 // namespace Nexus
\ No newline at end of file
+}	 // namespace Nexus
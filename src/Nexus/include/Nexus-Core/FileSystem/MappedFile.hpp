@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::FileSystem
+{
+	/// @brief A read-only view of a file that is mapped into memory, pages are loaded by the operating system as they are accessed so the
+	/// contents can be used in place without being copied into a separate buffer
+	class NX_API MappedFile
+	{
+	  public:
+		/// @brief Maps a file into memory, throwing if the file cannot be opened
+		/// @param filepath An absolute path to the file to map
+		explicit MappedFile(const std::string &filepath);
+		~MappedFile();
+
+		MappedFile(const MappedFile &)			  = delete;
+		MappedFile &operator=(const MappedFile &) = delete;
+
+		/// @brief Returns the contents of the file, this remains valid until the MappedFile is destroyed
+		/// @return A span over the bytes of the file
+		std::span<const std::byte> GetData() const;
+
+	  private:
+		const std::byte *m_Data = nullptr;
+		size_t			 m_Size = 0;
+
+		/// @brief The native handles that are needed to unmap the file
+		void *m_FileHandle	  = nullptr;
+		void *m_MappingHandle = nullptr;
+	};
+}	 // namespace Nexus::FileSystem
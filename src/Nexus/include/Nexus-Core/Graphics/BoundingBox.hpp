@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Graphics
+{
+	/// @brief An axis aligned bounding box, a default constructed box is empty and becomes valid once a point has been added to it
+	struct BoundingBox
+	{
+		glm::vec3 Min = glm::vec3(std::numeric_limits<float>::max());
+		glm::vec3 Max = glm::vec3(std::numeric_limits<float>::lowest());
+
+		/// @brief Returns whether the box contains any points
+		bool IsValid() const
+		{
+			return Min.x <= Max.x && Min.y <= Max.y && Min.z <= Max.z;
+		}
+
+		/// @brief Grows the box to include a point
+		void Expand(const glm::vec3 &point)
+		{
+			Min = glm::min(Min, point);
+			Max = glm::max(Max, point);
+		}
+
+		/// @brief Grows the box to include another box
+		void Expand(const BoundingBox &other)
+		{
+			Min = glm::min(Min, other.Min);
+			Max = glm::max(Max, other.Max);
+		}
+
+		/// @brief Returns whether another box lies entirely inside this one
+		bool Contains(const BoundingBox &other) const
+		{
+			return Min.x <= other.Min.x && Min.y <= other.Min.y && Min.z <= other.Min.z && Max.x >= other.Max.x && Max.y >= other.Max.y &&
+				   Max.z >= other.Max.z;
+		}
+
+		/// @brief Returns whether two boxes overlap
+		bool Overlaps(const BoundingBox &other) const
+		{
+			return Min.x <= other.Max.x && Min.y <= other.Max.y && Min.z <= other.Max.z && Max.x >= other.Min.x && Max.y >= other.Min.y &&
+				   Max.z >= other.Min.z;
+		}
+
+		glm::vec3 GetCentre() const
+		{
+			return (Min + Max) * 0.5f;
+		}
+
+		/// @brief Returns half of the size of the box along each axis
+		glm::vec3 GetExtents() const
+		{
+			return (Max - Min) * 0.5f;
+		}
+
+		/// @brief Returns the surface area of the box, this is used as the cost of a node when building a bounding volume hierarchy
+		float GetSurfaceArea() const
+		{
+			glm::vec3 size = Max - Min;
+			return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+		}
+
+		/// @brief Returns a box that has been moved outwards by the same distance on every side
+		BoundingBox Inflate(float margin) const
+		{
+			return BoundingBox {.Min = Min - glm::vec3(margin), .Max = Max + glm::vec3(margin)};
+		}
+
+		/// @brief Returns the axis aligned box that encloses this box after it has been transformed
+		/// @param matrix The matrix to transform the box by
+		/// @return The transformed box, which may be larger than the original if the matrix contains a rotation
+		BoundingBox Transform(const glm::mat4 &matrix) const
+		{
+			glm::vec3 centre  = GetCentre();
+			glm::vec3 extents = GetExtents();
+
+			// projecting the extents onto each axis avoids transforming all eight corners
+			glm::vec3 newCentre	 = glm::vec3(matrix[3][0], matrix[3][1], matrix[3][2]);
+			glm::vec3 newExtents = glm::vec3(0.0f);
+			for (int column = 0; column < 3; column++)
+			{
+				for (int row = 0; row < 3; row++)
+				{
+					newCentre[row] += matrix[column][row] * centre[column];
+					newExtents[row] += std::abs(matrix[column][row]) * extents[column];
+				}
+			}
+
+			return BoundingBox {.Min = newCentre - newExtents, .Max = newCentre + newExtents};
+		}
+
+		/// @brief Returns the smallest box that contains both boxes
+		static BoundingBox Merge(const BoundingBox &a, const BoundingBox &b)
+		{
+			return BoundingBox {.Min = glm::min(a.Min, b.Min), .Max = glm::max(a.Max, b.Max)};
+		}
+	};
+}	 // namespace Nexus::Graphics
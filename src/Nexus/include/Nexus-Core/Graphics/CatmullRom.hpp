@@ -5,50 +5,144 @@
 
 namespace Nexus::Graphics
 {
-	template<typename T>
+	/// @brief How the spacing of the knots of a Catmull-Rom spline is chosen from the distances between its points
+	enum class CatmullRomParameterization
+	{
+		/// @brief Every knot is one apart, this is the classic Catmull-Rom spline and overshoots when points are unevenly spaced
+		Uniform,
+
+		/// @brief Knots are spaced by the square root of the distance between points, which never forms cusps or self intersections
+		/// within a segment
+		Centripetal,
+
+		/// @brief Knots are spaced by the distance between points, which follows the points most tightly
+		Chordal
+	};
+
+	/// @brief Evaluates cubic segments for a batch of parameters, four parameters at a time on platforms that support it
+	/// @param coefficients The coefficients of each segment, stored as four values per dimension from the constant term to the cubic term
+	/// @param dimensions The number of dimensions of each point
+	/// @param derivative Which derivative to evaluate, zero for the position and up to two
+	/// @param parameters The parameters to evaluate, the integer part selects the segment and they are clamped to the range of the segments
+	/// (a NaN parameter evaluates the start of the first segment)
+	/// @param output Storage for parameters.size() points of dimensions values each
+	NX_API void EvaluateCubicSegments(std::span<const float> coefficients,
+									  uint32_t				 dimensions,
+									  uint32_t				 derivative,
+									  std::span<const float> parameters,
+									  float					*output);
+
+	/// @brief A spline that passes through each of its points, with a segment between each pair of points that has a point either side of it
+	/// @tparam T The type of the values of the points
+	/// @tparam Dimensions The number of dimensions of the points, either 2 or 3
+	template<typename T, size_t Dimensions = 2>
 	class CatmullRom
 	{
+		static_assert(Dimensions == 2 || Dimensions == 3, "Catmull-Rom splines can only be created with 2 or 3 dimensions");
+
 	  public:
+		using PointType = std::conditional_t<Dimensions == 2, Point2D<T>, Point3D<T>>;
+
+		/// @brief The number of samples that the arc length table stores for each segment
+		static constexpr uint32_t c_ArcLengthSamplesPerSegment = 16;
+
 		CatmullRom() = default;
 
-		Point2D<T> GetPoint(T t) const
+		/// @brief Returns a point on the spline
+		/// @param t The parameter of the point, the integer part selects the segment and the fractional part is the position within it
+		PointType GetPoint(T t) const
 		{
-			size_t p0, p1, p2, p3;
+			return Evaluate(t, 0);
+		}
 
-			if (!m_Looped)
-			{
-				p1 = (size_t)t + 1;
-				p2 = p1 + 1;
-				p3 = p2 + 1;
-				p0 = p1 - 1;
-			}
-			else
+		/// @brief Returns the first derivative of the spline with respect to the parameter, which is the tangent of the spline
+		PointType GetDerivative(T t) const
+		{
+			return Evaluate(t, 1);
+		}
+
+		/// @brief Returns the second derivative of the spline with respect to the parameter, which is used to build a frame along the spline
+		PointType GetSecondDerivative(T t) const
+		{
+			return Evaluate(t, 2);
+		}
+
+		/// @brief Evaluates many points of the spline at once, which is vectorised for splines of floats
+		/// @param parameters The parameters of the points
+		/// @param points Storage for parameters.size() points
+		void EvaluatePoints(std::span<const T> parameters, std::span<PointType> points) const
+		{
+			EvaluateBatch(parameters, points, 0);
+		}
+
+		/// @brief Evaluates the first derivative of the spline at many parameters at once
+		/// @param parameters The parameters of the derivatives
+		/// @param derivatives Storage for parameters.size() derivatives
+		void EvaluateDerivatives(std::span<const T> parameters, std::span<PointType> derivatives) const
+		{
+			EvaluateBatch(parameters, derivatives, 1);
+		}
+
+		/// @brief Returns the length of the whole spline
+		T GetLength() const
+		{
+			return m_ArcLengths.empty() ? T(0) : m_ArcLengths.back();
+		}
+
+		/// @brief Finds the parameter that is a distance along the spline, which moves along the spline at a constant speed as the distance
+		/// increases. The table of arc lengths is searched in logarithmic time and the result is refined with Newton's method.
+		/// @param distance The distance from the start of the spline, this is clamped to the length of the spline
+		/// @return The parameter at the distance
+		T GetParameterAtDistance(T distance) const
+		{
+			if (m_ArcLengths.size() < 2)
 			{
-				p1 = (size_t)t;
-				p2 = (p1 + 1) % m_Points.size();
-				p3 = (p2 + 1) % m_Points.size();
-				p0 = p1 >= 1 ? p1 - 1 : m_Points.size() - 1;
+				return T(0);
 			}
 
-			t = t - (size_t)t;
+			distance = std::clamp(distance, T(0), GetLength());
 
-			T tt  = t * t;
-			T ttt = tt * t;
+			size_t sample = std::upper_bound(m_ArcLengths.begin(), m_ArcLengths.end(), distance) - m_ArcLengths.begin();
+			sample		  = std::clamp<size_t>(sample, 1, m_ArcLengths.size() - 1) - 1;
 
-			T q1 = -ttt + 2 * tt - t;
-			T q2 = 3 * ttt - 5 * tt + 2;
-			T q3 = -3 * ttt + 4 * tt + t;
-			T q4 = ttt - tt;
+			// the parameters within the sample are relative to the start of its segment
+			size_t segment		= sample / c_ArcLengthSamplesPerSegment;
+			T	   start		= (T)(sample % c_ArcLengthSamplesPerSegment) / (T)c_ArcLengthSamplesPerSegment;
+			T	   end			= start + T(1) / (T)c_ArcLengthSamplesPerSegment;
+			T	   sampleLength = m_ArcLengths[sample + 1] - m_ArcLengths[sample];
+			T	   remaining	= distance - m_ArcLengths[sample];
+			T	   t			= sampleLength > T(0) ? start + (end - start) * (remaining / sampleLength) : start;
 
-			T tx = (m_Points[p0].X * q1 + m_Points[p1].X * q2 + m_Points[p2].X * q3 + m_Points[p3].X * q4) / 2;
-			T ty = (m_Points[p0].Y * q1 + m_Points[p1].Y * q2 + m_Points[p2].Y * q3 + m_Points[p3].Y * q4) / 2;
+			for (uint32_t iteration = 0; iteration < 2; iteration++)
+			{
+				T speed = GetSpeed(segment, t);
+				if (speed <= T(0))
+				{
+					break;
+				}
+
+				t = std::clamp(t - (IntegrateSpeed(segment, start, t) - remaining) / speed, start, end);
+			}
+
+			return (T)segment + t;
+		}
 
-			return {tx, ty};
+		/// @brief Returns the point that is a distance along the spline
+		PointType GetPointAtDistance(T distance) const
+		{
+			return GetPoint(GetParameterAtDistance(distance));
+		}
+
+		/// @brief Returns the number of segments of the spline, which is the largest parameter that can be evaluated
+		size_t GetNumberOfSegments() const
+		{
+			return m_Coefficients.size() / c_CoefficientsPerSegment;
 		}
 
 		void SetLooped(bool looped)
 		{
 			m_Looped = looped;
+			Rebuild();
 		}
 
 		bool IsLooped() const
@@ -56,12 +150,24 @@ namespace Nexus::Graphics
 			return m_Looped;
 		}
 
-		void SetPoints(const std::vector<Point2D<T>> &points)
+		void SetParameterization(CatmullRomParameterization parameterization)
+		{
+			m_Parameterization = parameterization;
+			Rebuild();
+		}
+
+		CatmullRomParameterization GetParameterization() const
+		{
+			return m_Parameterization;
+		}
+
+		void SetPoints(const std::vector<PointType> &points)
 		{
 			m_Points = points;
+			Rebuild();
 		}
 
-		const std::vector<Point2D<T>> &GetPoints() const
+		const std::vector<PointType> &GetPoints() const
 		{
 			return m_Points;
 		}
@@ -72,7 +178,193 @@ namespace Nexus::Graphics
 		}
 
 	  private:
-		std::vector<Point2D<T>> m_Points;
-		bool					m_Looped = false;
+		using Vector = std::array<T, Dimensions>;
+
+		static constexpr size_t c_CoefficientsPerSegment = Dimensions * 4;
+
+		static Vector ToVector(const PointType &point)
+		{
+			if constexpr (Dimensions == 2)
+			{
+				return {point.X, point.Y};
+			}
+			else
+			{
+				return {point.X, point.Y, point.Z};
+			}
+		}
+
+		static PointType ToPoint(const Vector &vector)
+		{
+			if constexpr (Dimensions == 2)
+			{
+				return PointType(vector[0], vector[1]);
+			}
+			else
+			{
+				return PointType(vector[0], vector[1], vector[2]);
+			}
+		}
+
+		static T GetKnotSpacing(const Vector &a, const Vector &b, CatmullRomParameterization parameterization)
+		{
+			if (parameterization == CatmullRomParameterization::Uniform)
+			{
+				return T(1);
+			}
+
+			T lengthSquared = T(0);
+			for (size_t i = 0; i < Dimensions; i++) { lengthSquared += (b[i] - a[i]) * (b[i] - a[i]); }
+
+			// repeated points would divide by zero, so they are treated as being one apart
+			T spacing = parameterization == CatmullRomParameterization::Centripetal ? std::pow(lengthSquared, T(0.25)) : std::sqrt(lengthSquared);
+			return spacing > std::numeric_limits<T>::epsilon() ? spacing : T(1);
+		}
+
+		/// @brief Converts every segment into the coefficients of a cubic polynomial and measures the length of the spline
+		void Rebuild()
+		{
+			m_Coefficients.clear();
+			m_ArcLengths.clear();
+
+			size_t pointCount	= m_Points.size();
+			size_t segmentCount = m_Looped ? (pointCount >= 2 ? pointCount : 0) : (pointCount >= 4 ? pointCount - 3 : 0);
+			m_Coefficients.reserve(segmentCount * c_CoefficientsPerSegment);
+
+			for (size_t segment = 0; segment < segmentCount; segment++)
+			{
+				size_t i0 = m_Looped ? (segment + pointCount - 1) % pointCount : segment;
+				size_t i1 = (i0 + 1) % pointCount;
+				size_t i2 = (i0 + 2) % pointCount;
+				size_t i3 = (i0 + 3) % pointCount;
+
+				Vector p0 = ToVector(m_Points[i0]), p1 = ToVector(m_Points[i1]), p2 = ToVector(m_Points[i2]), p3 = ToVector(m_Points[i3]);
+				T	   d01 = GetKnotSpacing(p0, p1, m_Parameterization);
+				T	   d12 = GetKnotSpacing(p1, p2, m_Parameterization);
+				T	   d23 = GetKnotSpacing(p2, p3, m_Parameterization);
+
+				// the tangents of the non-uniform spline scaled to a segment that runs from zero to one, with uniform spacing these are
+				// half of the distance between the neighbouring points
+				for (size_t i = 0; i < Dimensions; i++)
+				{
+					T m1 = p2[i] - p1[i] + d12 * ((p1[i] - p0[i]) / d01 - (p2[i] - p0[i]) / (d01 + d12));
+					T m2 = p2[i] - p1[i] + d12 * ((p3[i] - p2[i]) / d23 - (p3[i] - p1[i]) / (d12 + d23));
+
+					m_Coefficients.push_back(p1[i]);
+					m_Coefficients.push_back(m1);
+					m_Coefficients.push_back(T(3) * (p2[i] - p1[i]) - T(2) * m1 - m2);
+					m_Coefficients.push_back(T(2) * (p1[i] - p2[i]) + m1 + m2);
+				}
+			}
+
+			if (segmentCount == 0)
+			{
+				return;
+			}
+
+			m_ArcLengths.reserve(segmentCount * c_ArcLengthSamplesPerSegment + 1);
+			m_ArcLengths.push_back(T(0));
+			for (size_t segment = 0; segment < segmentCount; segment++)
+			{
+				for (uint32_t sample = 0; sample < c_ArcLengthSamplesPerSegment; sample++)
+				{
+					T start = (T)sample / (T)c_ArcLengthSamplesPerSegment;
+					T end	= (T)(sample + 1) / (T)c_ArcLengthSamplesPerSegment;
+					m_ArcLengths.push_back(m_ArcLengths.back() + IntegrateSpeed(segment, start, end));
+				}
+			}
+		}
+
+		/// @brief Evaluates a segment's polynomial or one of its derivatives with Horner's method
+		Vector EvaluateSegment(size_t segment, T u, uint32_t derivative) const
+		{
+			const T *coefficients = m_Coefficients.data() + segment * c_CoefficientsPerSegment;
+
+			Vector result = {};
+			for (size_t i = 0; i < Dimensions; i++, coefficients += 4)
+			{
+				const T *c = coefficients;
+				switch (derivative)
+				{
+					case 0: result[i] = ((c[3] * u + c[2]) * u + c[1]) * u + c[0]; break;
+					case 1: result[i] = (T(3) * c[3] * u + T(2) * c[2]) * u + c[1]; break;
+					default: result[i] = T(6) * c[3] * u + T(2) * c[2]; break;
+				}
+			}
+
+			return result;
+		}
+
+		PointType Evaluate(T t, uint32_t derivative) const
+		{
+			size_t segmentCount = GetNumberOfSegments();
+			if (segmentCount == 0)
+			{
+				return m_Points.empty() || derivative > 0 ? PointType() : m_Points.front();
+			}
+
+			// std::max returns its first argument when the comparison fails, so a NaN parameter becomes zero rather than being converted
+			t			   = std::min(std::max(T(0), t), (T)segmentCount);
+			size_t segment = std::min((size_t)t, segmentCount - 1);
+			return ToPoint(EvaluateSegment(segment, t - (T)segment, derivative));
+		}
+
+		void EvaluateBatch(std::span<const T> parameters, std::span<PointType> output, uint32_t derivative) const
+		{
+			if (output.size() < parameters.size())
+			{
+				throw std::runtime_error("Attempting to evaluate a spline into storage that is smaller than the number of parameters");
+			}
+
+			if constexpr (std::is_same_v<T, float>)
+			{
+				if (GetNumberOfSegments() > 0)
+				{
+					static_assert(sizeof(PointType) == Dimensions * sizeof(float), "Points must be tightly packed to be written by the batch");
+					EvaluateCubicSegments(m_Coefficients, Dimensions, derivative, parameters, &output[0].X);
+					return;
+				}
+			}
+
+			for (size_t i = 0; i < parameters.size(); i++) { output[i] = Evaluate(parameters[i], derivative); }
+		}
+
+		/// @brief Returns the length of the derivative within a segment, the parameter is relative to the start of the segment
+		T GetSpeed(size_t segment, T t) const
+		{
+			Vector derivative	 = EvaluateSegment(segment, t, 1);
+			T	   lengthSquared = T(0);
+			for (T value : derivative) { lengthSquared += value * value; }
+			return std::sqrt(lengthSquared);
+		}
+
+		/// @brief Approximates the arc length of a segment between two parameters relative to the start of the segment with five point
+		/// Gauss-Legendre quadrature. The speed is the square root of a polynomial rather than a polynomial itself, so the result is not
+		/// exact, but between two neighbouring samples the speed is smooth enough that the error is far below the sample spacing
+		T IntegrateSpeed(size_t segment, T start, T end) const
+		{
+			static constexpr T nodes[5]	  = {T(0), T(-0.5384693101056831), T(0.5384693101056831), T(-0.9061798459386640), T(0.9061798459386640)};
+			static constexpr T weights[5] = {T(0.5688888888888889),
+											 T(0.4786286704993665),
+											 T(0.4786286704993665),
+											 T(0.2369268850561891),
+											 T(0.2369268850561891)};
+
+			T halfWidth = (end - start) / T(2);
+			T centre	= (start + end) / T(2);
+			T length	= T(0);
+			for (size_t i = 0; i < 5; i++) { length += weights[i] * GetSpeed(segment, centre + halfWidth * nodes[i]); }
+			return length * halfWidth;
+		}
+
+		std::vector<PointType>	   m_Points			  = {};
+		bool					   m_Looped			  = false;
+		CatmullRomParameterization m_Parameterization = CatmullRomParameterization::Uniform;
+
+		/// @brief The cubic polynomial of each segment, stored as four coefficients per dimension from the constant term to the cubic term
+		std::vector<T> m_Coefficients = {};
+
+		/// @brief The distance along the spline at evenly spaced parameters, c_ArcLengthSamplesPerSegment for each segment
+		std::vector<T> m_ArcLengths = {};
 	};
 }	 // namespace Nexus::Graphics
@@ -54,6 +54,10 @@ namespace Nexus::Graphics
 		virtual GraphicsDevice				  *GetGraphicsDevice()																			  = 0;
 		virtual bool						   WaitForIdle()																				  = 0;
 
+		/// @brief Submits command lists with a fence owned by the current frame, so that resources used by them can be reused or
+		/// released once the frame tracker has waited for the frame instead of waiting for the queue to become idle
+		void SubmitCommandListsForFrame(Ref<CommandList> *commandLists, uint32_t numCommandLists);
+
 		/// @brief A pure virtual method that creates a new command list
 		/// @return A pointer to a command list
 		virtual Ref<CommandList> CreateCommandList(const CommandListDescription &spec = {}) = 0;
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Nexus-Core/Graphics/Fence.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Graphics
+{
+	class GraphicsDevice;
+
+	/// @brief Keeps track of the work submitted during each of the frames that the GPU may still be processing. Submissions made during a
+	/// frame signal fences owned by that frame, and beginning a frame waits only for the fences of the frame that last used the same slot,
+	/// so the CPU can record up to the number of frames in flight ahead of the GPU instead of waiting for the device to become idle.
+	///
+	/// Nothing is released until a frame begins, so BeginFrame must be called once per frame by whatever drives rendering. Application
+	/// does this before each rendered frame, tools, tests and headless code that submit work without an application must call it
+	/// themselves, for example after each batch of submissions, or call Flush once they are done.
+	class NX_API FrameTracker
+	{
+	  public:
+		static constexpr uint32_t c_DefaultFramesInFlight = 2;
+
+		/// @brief The number of fences that a single frame may acquire before the tracker assumes that BeginFrame is never being called
+		static constexpr uint32_t c_MaxFencesPerFrame = 1024;
+
+		/// @brief Creates a tracker that begins in the first frame
+		/// @param device The device used to create and wait for fences, this can be null if no fences are acquired
+		/// @param framesInFlight The number of frames that can be recorded before the CPU waits for the GPU
+		explicit FrameTracker(GraphicsDevice *device, uint32_t framesInFlight = c_DefaultFramesInFlight);
+
+		/// @brief Moves to the next frame, waiting for the GPU to finish the frame that last used the same slot and then releasing the
+		/// fences and resources that were retained during that frame
+		void BeginFrame();
+
+		/// @brief Returns a fence that should be signalled by a submission made during the current frame, this asserts if the frame already
+		/// holds c_MaxFencesPerFrame fences, as that means that frames are not being begun
+		Ref<Fence> AcquireFence();
+
+		/// @brief Keeps a resource alive until the GPU has finished every submission made during the current frame
+		void DeferDeletion(std::shared_ptr<void> resource);
+
+		/// @brief Waits for every frame in flight and releases everything that was retained, this is used before the device is destroyed
+		void Flush();
+
+		/// @brief Returns the slot of the current frame, in the range [0, GetFramesInFlight())
+		uint32_t GetFrameIndex() const;
+
+		/// @brief Returns the number of frames that have begun since the tracker was created
+		uint64_t GetFrameNumber() const;
+
+		uint32_t GetFramesInFlight() const;
+
+	  private:
+		struct Frame
+		{
+			std::vector<Ref<Fence>>			   Fences	 = {};
+			std::vector<std::shared_ptr<void>> Deletions = {};
+		};
+
+		/// @brief Waits for the fences of a frame and returns the resources that it retained, the caller must hold the mutex
+		std::vector<std::shared_ptr<void>> RetireFrame(Frame &frame);
+
+	  private:
+		GraphicsDevice		   *m_Device	  = nullptr;
+		std::vector<Frame>		m_Frames	  = {};
+		std::vector<Ref<Fence>> m_FreeFences  = {};
+		uint64_t				m_FrameNumber = 0;
+		mutable std::mutex		m_Mutex;
+	};
+
+	/// @brief Holds one copy of a resource for each frame in flight, so that the copy written by the CPU is never one that the GPU may
+	/// still be reading
+	template<typename T>
+	class PerFrame
+	{
+	  public:
+		PerFrame() = default;
+
+		/// @brief Creates a copy of the resource for each frame
+		/// @param count The number of frames in flight
+		/// @param create Called once for each frame with the index of the frame
+		PerFrame(uint32_t count, const std::function<T(uint32_t)> &create)
+		{
+			m_Items.reserve(count);
+			for (uint32_t i = 0; i < count; i++) { m_Items.push_back(create(i)); }
+		}
+
+		T &Get(const FrameTracker &tracker)
+		{
+			return m_Items[tracker.GetFrameIndex() % m_Items.size()];
+		}
+
+		const T &Get(const FrameTracker &tracker) const
+		{
+			return m_Items[tracker.GetFrameIndex() % m_Items.size()];
+		}
+
+		T &operator[](size_t index)
+		{
+			return m_Items[index];
+		}
+
+		size_t GetCount() const
+		{
+			return m_Items.size();
+		}
+
+	  private:
+		std::vector<T> m_Items = {};
+	};
+}	 // namespace Nexus::Graphics
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Nexus-Core/Graphics/BoundingBox.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Graphics
+{
+	/// @brief The result of testing a bounding box against a frustum
+	enum class FrustumTest
+	{
+		Outside,
+		Intersecting,
+		Inside
+	};
+
+	/// @brief A view frustum described by six planes that face inwards, used to skip objects that cannot be seen by a camera
+	class NX_API Frustum
+	{
+	  public:
+		/// @brief Creates a frustum that contains everything
+		Frustum() = default;
+
+		/// @brief Extracts the planes of a frustum from a camera's combined matrix
+		/// @param viewProjection The projection matrix multiplied by the view matrix
+		explicit Frustum(const glm::mat4 &viewProjection);
+
+		/// @brief Returns a plane of the frustum, in the order left, right, bottom, top, near, far
+		/// @param index The index of the plane
+		/// @return The normal of the plane in xyz and its distance from the origin in w
+		glm::vec4 GetPlane(size_t index) const;
+
+		/// @brief Tests a box against all of the planes of the frustum at once, this is vectorised on platforms that support it
+		/// @param box The box to test
+		/// @return Whether the box is outside, partially inside or entirely inside the frustum
+		FrustumTest Test(const BoundingBox &box) const;
+
+		/// @brief Returns whether any part of a box may be inside the frustum
+		bool Intersects(const BoundingBox &box) const
+		{
+			return Test(box) != FrustumTest::Outside;
+		}
+
+	  private:
+		/// @brief The planes are stored as separate components so that four planes can be tested at once, the last two planes always pass
+		/// so that the six planes fill two groups of four
+		alignas(16) float m_PlaneX[8] = {};
+		alignas(16) float m_PlaneY[8] = {};
+		alignas(16) float m_PlaneZ[8] = {};
+		alignas(16) float m_PlaneW[8] = {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+	};
+}	 // namespace Nexus::Graphics
@@ -7,9 +7,11 @@
 #include "CommandQueue.hpp"
 #include "DeviceBuffer.hpp"
 #include "Fence.hpp"
+#include "FrameTracker.hpp"
 #include "Framebuffer.hpp"
 #include "GraphicsCapabilities.hpp"
 #include "IPhysicalDevice.hpp"
+#include "Image.hpp"
 #include "IndirectDrawArguments.hpp"
 #include "Nexus-Core/Graphics/ShaderGenerator.hpp"
 #include "Nexus-Core/IWindow.hpp"
@@ -21,6 +23,7 @@
 #include "ShaderModule.hpp"
 #include "Swapchain.hpp"
 #include "Texture.hpp"
+#include "TextureReadback.hpp"
 #include "TimingQuery.hpp"
 #include "Viewport.hpp"
 
@@ -68,6 +71,11 @@ namespace Nexus::Graphics
 		/// @return A pointer to a texture
 		Ref<Texture> CreateTexture2D(Ref<ICommandQueue> commandQueue, const std::string &filepath, bool generateMips, bool srgb = false);
 
+		/// @brief A method that creates a new texture from an image that has already been decoded, e.g. by Image::FromFile on another thread
+		/// @param image The image to upload, this must be in an R8_G8_B8_A8 format if mips are generated
+		/// @return A pointer to a texture
+		Ref<Texture> CreateTexture2D(Ref<ICommandQueue> commandQueue, const Image &image, bool generateMips);
+
 		virtual Ref<Framebuffer> CreateFramebuffer(const FramebufferSpecification &spec) = 0;
 
 		/// @brief A pure virtual method that creates a new resource set from a given
@@ -97,6 +105,12 @@ namespace Nexus::Graphics
 
 		virtual void WaitForIdle() = 0;
 
+		/// @brief Returns the tracker used to keep per-frame resources alive until the GPU has finished with the frames that use them
+		FrameTracker &GetFrameTracker();
+
+		/// @brief Returns the pool of readback buffers used by ReadFromTextureAsync()
+		ReadbackBufferPool &GetReadbackBufferPool();
+
 		/// @brief A pure virtual method that returns a value that can be used to
 		/// standardise UV coordinates across backends
 		/// @return A float representing the correction
@@ -150,6 +164,18 @@ namespace Nexus::Graphics
 										  uint32_t			 width,
 										  uint32_t			 height);
 
+		/// @brief Records a copy of a region of a texture into a pooled readback buffer and submits it without waiting, the returned readback
+		/// can be polled with IsReady() on later frames so that reading a texture back does not stall the CPU on the GPU
+		Ref<TextureReadback> ReadFromTextureAsync(Ref<Texture>		 texture,
+												  Ref<ICommandQueue> commandQueue,
+												  uint32_t			 arrayLayer,
+												  uint32_t			 mipLevel,
+												  uint32_t			 x,
+												  uint32_t			 y,
+												  uint32_t			 z,
+												  uint32_t			 width,
+												  uint32_t			 height);
+
 		virtual bool							 Validate()				   = 0;
 		virtual std::shared_ptr<IPhysicalDevice> GetPhysicalDevice() const = 0;
 
@@ -167,6 +193,8 @@ namespace Nexus::Graphics
 		Ref<ShaderModule>		  TryLoadCachedShader(const std::string &source, const std::string &name, ShaderStage stage, ShaderLanguage language);
 
 	  protected:
-		Ref<CommandList> m_ImmediateCommandList = nullptr;
+		Ref<CommandList>   m_ImmediateCommandList = nullptr;
+		FrameTracker	   m_FrameTracker		  = FrameTracker(this);
+		ReadbackBufferPool m_ReadbackBufferPool	  = ReadbackBufferPool(this);
 	};
 }	 // namespace Nexus::Graphics
\ No newline at end of file
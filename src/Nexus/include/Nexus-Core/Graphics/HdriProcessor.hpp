@@ -1,23 +1,67 @@
 #pragma once
 
+#include "Nexus-Core/Graphics/Image.hpp"
 #include "Nexus-Core/Graphics/Texture.hpp"
 #include "Nexus-Core/Types.hpp"
 #include "Nexus-Core/nxpch.hpp"
 
 namespace Nexus::Graphics
 {
+	// forward declarations
+	class CommandList;
+	class DeviceBuffer;
+	class Framebuffer;
+	class GraphicsPipeline;
+	class Mesh;
+	class ResourceSet;
+	class Sampler;
+
 	class NX_API HdriProcessor
 	{
 	  public:
 		HdriProcessor() = delete;
 		HdriProcessor(const std::string &filepath, GraphicsDevice *device, Nexus::Ref<Nexus::Graphics::ICommandQueue> commandQueue);
+
+		/// @brief Creates a processor from an equirectangular image that has already been decoded
+		/// @param image An image in PixelFormat::R32_G32_B32_A32_Float, as returned by LoadImage
+		HdriProcessor(const Image &image, GraphicsDevice *device, Nexus::Ref<Nexus::Graphics::ICommandQueue> commandQueue);
+
 		~HdriProcessor() = default;
 		Ref<Texture> Generate(uint32_t size);
 		Ref<Texture> GetLoadedTexture() const;
 
+		/// @brief Prepares to render the cubemap one face at a time with GenerateNextFace, so that the work can be spread across frames
+		/// @param size The width and height of each face of the cubemap
+		void BeginGenerate(uint32_t size);
+
+		/// @brief Renders the next face of the cubemap started by BeginGenerate
+		/// @return Whether every face has been rendered
+		bool GenerateNextFace();
+
+		/// @brief Returns the cubemap being rendered by BeginGenerate and GenerateNextFace
+		/// @return The cubemap
+		Ref<Texture> GetCubemap() const;
+
+		/// @brief Decodes an HDRI image from a file, this does not use the graphics device so it can be called from any thread
+		/// @param filepath The filepath to load the image from
+		/// @return The decoded image
+		static Image LoadImage(const std::string &filepath);
+
 	  private:
 		void GetDirection(uint32_t faceIndex, float &yaw, float &pitch, bool yUp);
 
+		/// @brief The resources used while the faces of the cubemap are being rendered
+		struct GenerationState
+		{
+			uint32_t			  Size			  = 0;
+			uint32_t			  NextFace		  = 0;
+			Ref<Framebuffer>	  FaceFramebuffer = nullptr;
+			Ref<Texture>		  Cubemap		  = nullptr;
+			Ref<GraphicsPipeline> Pipeline		  = nullptr;
+			Ref<Sampler>		  FaceSampler	  = nullptr;
+			Ref<Mesh>			  Cube			  = nullptr;
+		};
+
 	  private:
 		GraphicsDevice *m_Device = nullptr;
 		int32_t			m_Width	 = 0;
@@ -25,5 +69,7 @@ namespace Nexus::Graphics
 
 		Nexus::Ref<Nexus::Graphics::Texture>	   m_HdriImage	  = nullptr;
 		Nexus::Ref<Nexus::Graphics::ICommandQueue> m_CommandQueue = nullptr;
+
+		GenerationState m_Generation = {};
 	};
 }	 // namespace Nexus::Graphics
\ No newline at end of file
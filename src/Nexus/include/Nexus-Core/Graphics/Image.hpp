@@ -18,6 +18,28 @@ namespace Nexus::Graphics
 
 		void FlipVertically();
 
+		/// @brief Decodes an image file into memory, this does not use the graphics device so it can be called from any thread
+		/// @param filepath The filepath to load the image from
+		/// @param format The format to convert the pixels to, either PixelFormat::R8_G8_B8_A8_UNorm (or its sRGB equivalent) or
+		/// PixelFormat::R32_G32_B32_A32_Float
+		/// @param flipVertically Whether to flip the image so that the first row of pixels is the bottom of the image
+		/// @return The decoded image, this is empty if the file could not be loaded
+		static Image FromFile(const std::string &filepath, PixelFormat format, bool flipVertically = true);
+
+		/// @brief Decodes an image that has already been read into memory, e.g. a texture embedded in a model
+		/// @param data The encoded image
+		/// @param size The size of the encoded image in bytes
+		/// @param format The format to convert the pixels to, as with FromFile
+		/// @param flipVertically Whether to flip the image so that the first row of pixels is the bottom of the image
+		/// @return The decoded image, this is empty if the data could not be decoded
+		static Image FromMemory(const void *data, size_t size, PixelFormat format, bool flipVertically = true);
+
+		/// @brief Returns whether the image contains any pixels
+		bool IsEmpty() const
+		{
+			return Pixels.empty();
+		}
+
 		static Image FromTexture(GraphicsDevice	   *device,
 								 Ref<ICommandQueue> commandQueue,
 								 Ref<Texture>		texture,
@@ -7,6 +7,8 @@
 
 namespace Nexus::Graphics
 {
+	class StreamedTexture;
+
 	struct Material
 	{
 		Ref<Texture>   DiffuseTexture  = nullptr;
@@ -14,5 +16,11 @@ namespace Nexus::Graphics
 		Ref<Texture>   NormalTexture   = nullptr;
 		Ref<Texture>   SpecularTexture = nullptr;
 		glm::vec4	   SpecularColour  = {};
+
+		/// @brief Textures that are loaded by a TextureStreamer, these are drawn instead of the textures above once their first mips have
+		/// loaded and the renderer reports how large they appear on screen so that their finer mips are loaded when they are needed
+		Ref<StreamedTexture> StreamedDiffuseTexture	 = nullptr;
+		Ref<StreamedTexture> StreamedNormalTexture	 = nullptr;
+		Ref<StreamedTexture> StreamedSpecularTexture = nullptr;
 	};
 }	 // namespace Nexus::Graphics
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Nexus-Core/Graphics/BoundingBox.hpp"
 #include "Nexus-Core/Graphics/DeviceBuffer.hpp"
 #include "Nexus-Core/Types.hpp"
 #include "Nexus-Core/Vertex.hpp"
@@ -8,6 +9,27 @@
 
 namespace Nexus::Graphics
 {
+	/// @brief A range of a mesh's index buffer that draws the mesh at one level of detail
+	struct MeshLodRange
+	{
+		uint32_t IndexStart = 0;
+		uint32_t IndexCount = 0;
+
+		/// @brief An estimate of the largest distance between this level and the full detail mesh, in model space
+		float Error = 0.0f;
+	};
+
+	/// @brief Controls how the level of detail that a mesh is drawn with is chosen
+	struct LodSelectionSettings
+	{
+		/// @brief The largest error in pixels that a level of detail is allowed to have on screen
+		float MaxScreenSpaceError = 1.0f;
+
+		/// @brief A coarser level is only switched to once its error is this fraction below the allowed error, so that meshes near the
+		/// boundary between two levels do not switch back and forth every frame
+		float Hysteresis = 0.25f;
+	};
+
 	/// @brief A class representing a mesh containing a vertex buffer and an index
 	/// buffer
 	class Mesh
@@ -20,12 +42,26 @@ namespace Nexus::Graphics
 		/// @param vertexBuffer A set of vertices to use for the mesh
 		/// @param indexBuffer A set of indices to use for the mesh
 		/// @param name A string representing the name of the mesh
-		Mesh(Ref<DeviceBuffer> vertexBuffer, Ref<DeviceBuffer> indexBuffer, const Material &material, const std::string &name = "Mesh")
+		/// @param bounds The box enclosing the vertices of the mesh, a mesh without valid bounds is never culled
+		/// @param lods The ranges of the index buffer that draw each level of detail ordered from the most detailed, if this is empty the
+		/// whole index buffer is the only level
+		Mesh(Ref<DeviceBuffer>		   vertexBuffer,
+			 Ref<DeviceBuffer>		   indexBuffer,
+			 const Material			  &material,
+			 const std::string		  &name	  = "Mesh",
+			 const BoundingBox		  &bounds = {},
+			 std::vector<MeshLodRange> lods	  = {})
 			: m_VertexBuffer(vertexBuffer),
 			  m_IndexBuffer(indexBuffer),
 			  m_Material(material),
-			  m_Name(name)
+			  m_Name(name),
+			  m_Bounds(bounds),
+			  m_Lods(std::move(lods))
 		{
+			if (m_Lods.empty() && m_IndexBuffer)
+			{
+				m_Lods.push_back(MeshLodRange {.IndexStart = 0, .IndexCount = m_IndexBuffer->GetCount(), .Error = 0.0f});
+			}
 		}
 
 		virtual ~Mesh()
@@ -61,6 +97,59 @@ namespace Nexus::Graphics
 			return m_Name;
 		}
 
+		/// @brief Returns the box enclosing the vertices of the mesh in model space
+		const BoundingBox &GetBounds() const
+		{
+			return m_Bounds;
+		}
+
+		/// @brief Marks the vertex buffer as containing VertexQuantizedPositionTexCoordNormalColourTangent vertices
+		/// @param dequantization The ranges that the vertices were encoded in, these are passed to the shader to decode them
+		void SetVertexDequantization(const VertexDequantization &dequantization)
+		{
+			m_VertexDequantization = dequantization;
+		}
+
+		/// @brief Returns the ranges that the mesh's vertices were encoded in, or nothing if the vertices are not quantized
+		const std::optional<VertexDequantization> &GetVertexDequantization() const
+		{
+			return m_VertexDequantization;
+		}
+
+		/// @brief Returns the levels of detail of the mesh, ordered from the most detailed
+		const std::vector<MeshLodRange> &GetLods() const
+		{
+			return m_Lods;
+		}
+
+		/// @brief Chooses the coarsest level of detail whose error is small enough on screen
+		/// @param pixelsPerUnit The number of pixels that one unit in model space covers at the mesh's closest point to the camera
+		/// @param currentLod The level that the mesh was drawn with last frame
+		/// @param settings The error allowed on screen
+		/// @return The index of the level to draw the mesh with
+		uint32_t SelectLod(float pixelsPerUnit, uint32_t currentLod, const LodSelectionSettings &settings) const
+		{
+			uint32_t selected = 0;
+			for (uint32_t i = 1; i < (uint32_t)m_Lods.size(); i++)
+			{
+				float allowedError = settings.MaxScreenSpaceError;
+				if (i > currentLod)
+				{
+					allowedError *= 1.0f - settings.Hysteresis;
+				}
+
+				// the levels get coarser in order, so once one is too coarse every later one is as well
+				if (m_Lods[i].Error * pixelsPerUnit > allowedError)
+				{
+					break;
+				}
+
+				selected = i;
+			}
+
+			return selected;
+		}
+
 	  private:
 		/// @brief A reference counted pointer to a vertex buffer
 		Ref<DeviceBuffer> m_VertexBuffer = nullptr;
@@ -71,5 +160,11 @@ namespace Nexus::Graphics
 		Material m_Material = {};
 
 		std::string m_Name;
+
+		BoundingBox m_Bounds = {};
+
+		std::vector<MeshLodRange> m_Lods = {};
+
+		std::optional<VertexDequantization> m_VertexDequantization = {};
 	};
 }	 // namespace Nexus::Graphics
@@ -36,8 +36,9 @@ namespace Nexus::Graphics
 
 		/// @brief A method that returns a mesh representing a 3D model stored on disk
 		/// @param filepath The filepath to load a model from
+		/// @param quantizeVertices Whether the model's vertices are compressed into VertexQuantizedPositionTexCoordNormalColourTangent
 		/// @return A mesh representing the model
-		Ref<Model> CreateFrom3DModelFile(const std::string &filepath);
+		Ref<Model> CreateFrom3DModelFile(const std::string &filepath, bool quantizeVertices = true);
 
 	  private:
 		/// @brief A pointer to a graphics device to use to create the vertex buffer
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Graphics
+{
+	struct MeshData;
+
+	/// @brief Measurements of how efficiently the GPU can process an indexed mesh
+	struct MeshStatistics
+	{
+		/// @brief The average number of post-transform cache misses per triangle, between 0.5 for an ideal mesh and 3 (lower is better)
+		float ACMR = 0.0f;
+
+		/// @brief The average number of times that each referenced vertex is transformed, 1 is ideal
+		float ATVR = 0.0f;
+
+		/// @brief The number of bytes of vertex data fetched from memory divided by the size of the referenced vertices, 1 is ideal
+		float OverfetchRatio = 0.0f;
+	};
+
+	/// @brief The result of running OptimizeMesh
+	struct MeshOptimizationReport
+	{
+		MeshStatistics Before		  = {};
+		MeshStatistics After		  = {};
+		size_t		   VerticesBefore = 0;
+		size_t		   VerticesAfter  = 0;
+	};
+
+	/// @brief Functions that reorder the vertices and triangles of an indexed triangle list so that the GPU can draw it faster, without
+	/// changing how it looks
+	namespace MeshOptimizer
+	{
+		/// @brief The size of the FIFO post-transform cache that is simulated by default, this is a reasonable estimate for modern GPUs
+		inline constexpr uint32_t c_DefaultVertexCacheSize = 16;
+
+		/// @brief The amount that overdraw optimization is allowed to increase the ACMR by default
+		inline constexpr float c_DefaultOverdrawThreshold = 1.05f;
+
+		/// @brief Simulates the post-transform vertex cache and the vertex fetch cache while drawing a mesh
+		/// @param mesh The mesh to analyze
+		/// @param cacheSize The number of entries in the simulated post-transform cache
+		/// @return The statistics of the mesh
+		NX_API MeshStatistics AnalyzeMesh(const MeshData &mesh, uint32_t cacheSize = c_DefaultVertexCacheSize);
+
+		/// @brief Merges vertices whose attributes are identical and updates the indices to match
+		/// @param mesh The mesh to update
+		/// @return The number of vertices that were removed
+		NX_API size_t DeduplicateVertices(MeshData &mesh);
+
+		/// @brief Reorders the triangles so that vertices are reused while they are still in the post-transform cache, using Tipsify
+		/// @param mesh The mesh to update
+		/// @param cacheSize The number of entries in the post-transform cache being optimized for
+		NX_API void OptimizeVertexCache(MeshData &mesh, uint32_t cacheSize = c_DefaultVertexCacheSize);
+
+		/// @brief Splits a mesh whose triangles have already been ordered by OptimizeVertexCache into clusters and sorts the clusters so that
+		/// those facing outwards are drawn first, which reduces overdraw when the mesh is drawn with a depth test
+		/// @param mesh The mesh to update
+		/// @param threshold The factor that the ACMR of each cluster is allowed to exceed the ACMR of the mesh by, larger values create
+		/// more clusters
+		/// @param cacheSize The number of entries in the post-transform cache being optimized for
+		NX_API void OptimizeOverdraw(MeshData &mesh, float threshold = c_DefaultOverdrawThreshold, uint32_t cacheSize = c_DefaultVertexCacheSize);
+
+		/// @brief Reorders the vertices in the order that the triangles first use them and removes any that are not used, so that vertex
+		/// data is read from memory sequentially
+		/// @param mesh The mesh to update
+		NX_API void OptimizeVertexFetch(MeshData &mesh);
+
+		/// @brief Runs deduplication, vertex cache, overdraw and vertex fetch optimization on a mesh in that order
+		/// @param mesh The mesh to update
+		/// @return The statistics of the mesh before and after it was optimized
+		NX_API MeshOptimizationReport OptimizeMesh(MeshData &mesh);
+	}	 // namespace MeshOptimizer
+}	 // namespace Nexus::Graphics
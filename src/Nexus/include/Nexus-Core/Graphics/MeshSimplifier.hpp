@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Graphics
+{
+	struct MeshData;
+	struct MeshLod;
+
+	/// @brief Functions that create simplified versions of an indexed triangle list by collapsing its edges, which are used as levels of
+	/// detail for meshes that cover a small part of the screen
+	namespace MeshSimplifier
+	{
+		/// @brief The number of levels of detail that are created by default, not including the full detail mesh
+		inline constexpr uint32_t c_DefaultLodCount = 4;
+
+		/// @brief The fraction of the triangles of each level of detail that the next level keeps by default
+		inline constexpr float c_DefaultLodReduction = 0.5f;
+
+		/// @brief Simplifies a mesh by repeatedly collapsing the edge whose collapse moves the surface the least, measured with quadric
+		/// error metrics. Each collapse moves a vertex onto one of its neighbours, so the simplified mesh uses the original vertices. Vertices
+		/// on the border of the mesh, and vertices that are split into several with the same position (e.g. at a seam in the texture
+		/// coordinates), are never moved so that the mesh does not shrink or tear. The result only depends on the mesh.
+		/// @param mesh The mesh to simplify
+		/// @param targetIndexCount The number of indices to stop at, the result can have more if no more edges can be collapsed
+		/// @param maxError The largest error that a collapse is allowed to have, in model space
+		/// @return The indices of the simplified mesh and its error
+		NX_API MeshLod Simplify(const MeshData &mesh, size_t targetIndexCount, float maxError = std::numeric_limits<float>::max());
+
+		/// @brief Replaces the levels of detail of a mesh with progressively simpler versions of it, stopping early once a level does not
+		/// remove enough triangles to be worth drawing
+		/// @param mesh The mesh to create the levels of detail for
+		/// @param maxLodCount The largest number of levels to create
+		/// @param reduction The fraction of the triangles of each level that the next level keeps
+		/// @param maxError The largest error that any level is allowed to have, in model space
+		NX_API void GenerateLods(MeshData &mesh,
+								 uint32_t  maxLodCount = c_DefaultLodCount,
+								 float	   reduction   = c_DefaultLodReduction,
+								 float	   maxError	   = std::numeric_limits<float>::max());
+	}	 // namespace MeshSimplifier
+}	 // namespace Nexus::Graphics
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Nexus-Core/Graphics/Frustum.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Graphics
+{
+	struct MeshData;
+
+	/// @brief A small group of a mesh's triangles that a single mesh shader workgroup draws, laid out to be uploaded to a storage buffer
+	struct Meshlet
+	{
+		/// @brief The index of the meshlet's first entry in MeshletData::VertexIndices
+		uint32_t VertexOffset = 0;
+
+		/// @brief The index of the meshlet's first entry in MeshletData::Triangles
+		uint32_t TriangleOffset = 0;
+
+		uint32_t VertexCount   = 0;
+		uint32_t TriangleCount = 0;
+	};
+
+	/// @brief The bounds of a meshlet that are used to skip it before its triangles are processed, laid out to be uploaded to a storage buffer
+	struct MeshletBounds
+	{
+		/// @brief The centre of the sphere enclosing the meshlet in xyz and its radius in w
+		glm::vec4 Sphere = {0.0f, 0.0f, 0.0f, 0.0f};
+
+		/// @brief The average direction that the meshlet's triangles face in xyz and the sine of the angle of the cone around it that contains
+		/// every triangle's normal in w. A cutoff of one means that the meshlet faces too many directions to ever be backfacing.
+		glm::vec4 Cone = {0.0f, 0.0f, 0.0f, 1.0f};
+
+		/// @brief The point that the normal cone starts at, every triangle is in front of it
+		glm::vec4 ConeApex = {0.0f, 0.0f, 0.0f, 0.0f};
+	};
+
+	/// @brief The meshlets of a mesh and the buffers that they index into
+	struct MeshletData
+	{
+		std::vector<Meshlet>	   Meshlets = {};
+		std::vector<MeshletBounds> Bounds	= {};
+
+		/// @brief The indices into the mesh's vertices that each meshlet uses
+		std::vector<uint32_t> VertexIndices = {};
+
+		/// @brief The triangles of each meshlet as indices into the meshlet's vertices, with the three 8 bit indices packed into the lowest 24
+		/// bits of each value
+		std::vector<uint32_t> Triangles = {};
+	};
+
+	/// @brief Functions that split a mesh into meshlets for the mesh shader pipeline and cull them
+	namespace MeshletBuilder
+	{
+		/// @brief The largest number of vertices in a meshlet by default
+		inline constexpr uint32_t c_DefaultMaxVertices = 64;
+
+		/// @brief The largest number of triangles in a meshlet by default, this is a multiple of four slightly below 128 so that the packed
+		/// triangles of a full meshlet fit in the output arrays of a workgroup of 128 threads
+		inline constexpr uint32_t c_DefaultMaxTriangles = 124;
+
+		/// @brief Splits a mesh into meshlets, growing each meshlet with the neighbouring triangle that adds the fewest new vertices and that
+		/// faces the most similar direction, so that meshlets reuse vertices and have tight normal cones
+		/// @param mesh The mesh to split, this should already be optimized for the vertex cache so that its triangles are close together
+		/// @param maxVertices The largest number of vertices in a meshlet, at most 256 so that they can be indexed with 8 bits
+		/// @param maxTriangles The largest number of triangles in a meshlet
+		/// @return The meshlets and their bounds
+		NX_API MeshletData BuildMeshlets(const MeshData &mesh,
+										 uint32_t		 maxVertices  = c_DefaultMaxVertices,
+										 uint32_t		 maxTriangles = c_DefaultMaxTriangles);
+
+		/// @brief Unpacks a triangle from MeshletData::Triangles
+		/// @param packed The packed triangle
+		/// @return The indices of the triangle's corners into the meshlet's vertices
+		inline std::array<uint32_t, 3> UnpackTriangle(uint32_t packed)
+		{
+			return {packed & 0xFF, (packed >> 8) & 0xFF, (packed >> 16) & 0xFF};
+		}
+
+		/// @brief Returns whether every triangle of a meshlet faces away from the camera, triangles are front facing when they are counter
+		/// clockwise
+		/// @param bounds The bounds of the meshlet
+		/// @param cameraPosition The position of the camera in the same space as the meshlet
+		NX_API bool IsBackfacing(const MeshletBounds &bounds, const glm::vec3 &cameraPosition);
+
+		/// @brief Returns whether a meshlet may be visible, testing its sphere against the frustum and its normal cone against the camera
+		/// @param bounds The bounds of the meshlet
+		/// @param frustum The frustum of the camera in the same space as the meshlet
+		/// @param cameraPosition The position of the camera in the same space as the meshlet
+		NX_API bool IsVisible(const MeshletBounds &bounds, const Frustum &frustum, const glm::vec3 &cameraPosition);
+	}	 // namespace MeshletBuilder
+}	 // namespace Nexus::Graphics
@@ -5,12 +5,26 @@
 
 namespace Nexus::Graphics
 {
+	/// @brief A simplified version of a mesh that uses a subset of the mesh's vertices
+	struct MeshLod
+	{
+		/// @brief The triangles of the simplified mesh, as indices into the vertices of the full detail mesh
+		std::vector<uint32_t> Indices = {};
+
+		/// @brief An estimate of the largest distance between the simplified mesh and the full detail mesh, in model space
+		float Error = 0.0f;
+	};
+
 	struct MeshData
 	{
 		std::string																  name			= "";
 		uint32_t																  materialIndex = 0;
 		std::vector<Graphics::VertexPositionTexCoordNormalColourTangentBitangent> vertices		= {};
 		std::vector<uint32_t>													  indices		= {};
+		BoundingBox																  bounds		= {};
+
+		/// @brief Progressively simpler versions of the mesh, ordered from the most detailed
+		std::vector<MeshLod> lods = {};
 	};
 
 	class Model
@@ -29,6 +43,14 @@ namespace Nexus::Graphics
 			return m_Meshes;
 		}
 
+		/// @brief Returns the box enclosing every mesh of the model in model space
+		BoundingBox GetBounds() const
+		{
+			BoundingBox bounds = {};
+			for (const Ref<Mesh> &mesh : m_Meshes) { bounds.Expand(mesh->GetBounds()); }
+			return bounds;
+		}
+
 	  private:
 		std::vector<Ref<Mesh>> m_Meshes;
 	};
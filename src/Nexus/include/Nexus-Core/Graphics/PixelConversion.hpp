@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Graphics
+{
+	/// @brief Swaps the rows of an image in place so that the first row becomes the last
+	/// @param pixels The pixels of the image
+	/// @param rowPitch The number of bytes in each row
+	/// @param height The number of rows in the image
+	NX_API void FlipRows(void *pixels, size_t rowPitch, uint32_t height);
+
+	/// @brief Swaps the red and blue channels of 8 bit four channel pixels, converting RGBA to BGRA and back
+	/// @param input The pixels to convert
+	/// @param output Storage for pixelCount pixels, this can be the same as input
+	/// @param pixelCount The number of pixels to convert
+	NX_API void SwapRedAndBlue(const uint8_t *input, uint8_t *output, size_t pixelCount);
+
+	/// @brief Expands 8 bit three channel pixels to four channels
+	/// @param input The RGB pixels to convert
+	/// @param output Storage for pixelCount RGBA pixels, this must not overlap input
+	/// @param pixelCount The number of pixels to convert
+	/// @param alpha The alpha that is given to every pixel
+	NX_API void ExpandRGBToRGBA(const uint8_t *input, uint8_t *output, size_t pixelCount, uint8_t alpha = 255);
+
+	/// @brief Multiplies the colour channels of 8 bit RGBA pixels by their alpha, rounding to the nearest value
+	/// @param input The pixels to convert
+	/// @param output Storage for pixelCount pixels, this can be the same as input
+	/// @param pixelCount The number of pixels to convert
+	NX_API void PremultiplyAlpha(const uint8_t *input, uint8_t *output, size_t pixelCount);
+
+	/// @brief Decodes 8 bit sRGB encoded RGBA pixels into linear floating point RGBA pixels, alpha is always stored linearly
+	/// @param input The pixels to convert
+	/// @param output Storage for pixelCount * 4 values
+	/// @param pixelCount The number of pixels to convert
+	NX_API void ConvertSRGBToLinear(const uint8_t *input, float *output, size_t pixelCount);
+
+	/// @brief Encodes linear floating point RGBA pixels as 8 bit sRGB RGBA pixels, values are clamped to [0, 1] and alpha is stored linearly
+	/// @param input The pixels to convert, pixelCount * 4 values
+	/// @param output Storage for pixelCount pixels
+	/// @param pixelCount The number of pixels to convert
+	NX_API void ConvertLinearToSRGB(const float *input, uint8_t *output, size_t pixelCount);
+
+	/// @brief Converts 32 bit floats to 16 bit floats, rounding to the nearest value with ties to even. Values too large for a half become
+	/// infinity and every NaN becomes a quiet NaN.
+	/// @param input The values to convert
+	/// @param output Storage for input.size() values
+	NX_API void ConvertFloatToHalf(std::span<const float> input, uint16_t *output);
+
+	/// @brief Converts 16 bit floats to 32 bit floats, which is exact for every value
+	/// @param input The values to convert
+	/// @param output Storage for input.size() values
+	NX_API void ConvertHalfToFloat(std::span<const uint16_t> input, float *output);
+}	 // namespace Nexus::Graphics
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Nexus-Core/Graphics/CommandList.hpp"
+#include "Nexus-Core/Graphics/DeviceBuffer.hpp"
+#include "Nexus-Core/Graphics/Fence.hpp"
+#include "Nexus-Core/Graphics/Image.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Graphics
+{
+	class GraphicsDevice;
+
+	/// @brief Keeps the readback buffers that texture readbacks copy into, so that reading a texture every frame reuses the same few buffers
+	/// instead of creating a buffer and a fence for each read. A buffer is only reused once the fence of the copy into it has been signalled,
+	/// so a readback can be released before the GPU has finished with it.
+	class NX_API ReadbackBufferPool
+	{
+	  public:
+		/// @brief The resources used by a single readback, which are returned to the pool together
+		struct Allocation
+		{
+			Ref<DeviceBuffer> Buffer = nullptr;
+
+			/// @brief The fence signalled by the submission that copies into the buffer
+			Ref<Fence> Fence = nullptr;
+
+			/// @brief The command list that records the copy, which is kept alive until the copy has completed
+			Ref<CommandList> CommandList = nullptr;
+
+			/// @brief The number of allocations that the pool had handed out when this was released, used to find buffers that are no
+			/// longer being reused
+			uint64_t ReleasedAt = 0;
+		};
+
+		/// @brief The number of allocations that a released buffer can sit unused for before the pool destroys it
+		static constexpr uint64_t c_MaxIdleAcquisitions = 64;
+
+		explicit ReadbackBufferPool(GraphicsDevice *device);
+
+		/// @brief Returns the smallest released buffer that can hold a number of bytes and whose copy has completed, or creates a new one
+		/// if there is none. New buffers are rounded up to a power of two so that reads of slightly different sizes can share them. Released
+		/// buffers that have not been reused for c_MaxIdleAcquisitions allocations are destroyed, so a burst of large reads does not keep
+		/// its buffers for the lifetime of the device.
+		/// @param size The number of bytes that will be copied into the buffer
+		/// @return A buffer and an unsignalled fence, the caller records the command list
+		Allocation Acquire(size_t size);
+
+		/// @brief Returns an allocation to the pool, it is not reused until its fence has been signalled
+		void Release(Allocation allocation);
+
+		/// @brief Waits until the copy into an allocation's buffer has completed
+		void Wait(const Allocation &allocation);
+
+		/// @brief Destroys every released allocation whose copy has completed, without waiting for the others
+		void Trim();
+
+		/// @brief Waits for every released allocation and destroys them, this is used before the device is destroyed
+		void Flush();
+
+		/// @brief Returns the number of buffers that the pool has created, including those that are in use
+		size_t GetBufferCount() const;
+
+	  private:
+		/// @brief Destroys the released allocations whose copies have completed and that match a predicate, the caller must hold the mutex
+		void RemoveReleased(const std::function<bool(const Allocation &)> &predicate);
+
+	  private:
+		GraphicsDevice		   *m_Device	   = nullptr;
+		std::vector<Allocation> m_Released	   = {};
+		size_t					m_BufferCount  = 0;
+		uint64_t				m_Acquisitions = 0;
+		mutable std::mutex		m_Mutex;
+	};
+
+	/// @brief A texture read that was submitted without waiting for it, the pixels become available once the GPU has reached the copy,
+	/// which is usually a frame or two later. This can be polled each frame so that continuous captures never stall rendering.
+	class NX_API TextureReadback
+	{
+	  public:
+		TextureReadback(ReadbackBufferPool			  *pool,
+						ReadbackBufferPool::Allocation allocation,
+						size_t						   size,
+						uint32_t					   width,
+						uint32_t					   height,
+						PixelFormat					   format);
+
+		/// @brief Returns the buffer to the pool, the pool does not reuse it until the copy has completed
+		~TextureReadback();
+
+		TextureReadback(const TextureReadback &)			= delete;
+		TextureReadback &operator=(const TextureReadback &) = delete;
+
+		/// @brief Returns whether the copy has completed, in which case GetData() returns without waiting
+		bool IsReady() const;
+
+		/// @brief Waits for the copy to complete if it has not yet, then returns the pixels. The pixels are copied out of the buffer the first
+		/// time this is called and the buffer is returned to the pool.
+		const std::vector<char> &GetData();
+
+		/// @brief Waits for the pixels as GetData() does and returns them as an image
+		Image GetImage();
+
+		uint32_t GetWidth() const;
+
+		uint32_t GetHeight() const;
+
+		PixelFormat GetFormat() const;
+
+	  private:
+		ReadbackBufferPool			  *m_Pool		= nullptr;
+		ReadbackBufferPool::Allocation m_Allocation = {};
+		size_t						   m_Size		= 0;
+		uint32_t					   m_Width		= 0;
+		uint32_t					   m_Height		= 0;
+		PixelFormat					   m_Format		= PixelFormat::R8_G8_B8_A8_UNorm;
+		bool						   m_Resolved	= false;
+		std::vector<char>			   m_Pixels		= {};
+	};
+}	 // namespace Nexus::Graphics
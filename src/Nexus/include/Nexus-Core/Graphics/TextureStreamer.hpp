@@ -0,0 +1,229 @@
+#pragma once
+
+#include "Nexus-Core/Graphics/CommandQueue.hpp"
+#include "Nexus-Core/Graphics/Image.hpp"
+#include "Nexus-Core/Graphics/Texture.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Graphics
+{
+	class GraphicsDevice;
+
+	struct TextureStreamingSettings
+	{
+		/// @brief The number of bytes that the resident mips of every streamed texture may use together
+		size_t MemoryBudget = 256 * 1024 * 1024;
+
+		/// @brief Mips that are no larger than this in either dimension are loaded when a texture is created and are never evicted
+		uint32_t MinimumResidentSize = 64;
+
+		/// @brief The number of threads that decode textures from disk
+		uint32_t WorkerCount = 2;
+
+		/// @brief The maximum number of decoded textures that are uploaded each frame, which bounds the time spent recording uploads
+		uint32_t MaxUploadsPerFrame = 4;
+
+		/// @brief The maximum number of loads that can be waiting for or running on a worker, further requests wait for a later frame so
+		/// that the queue does not fill with requests that are stale by the time they run
+		uint32_t MaxPendingLoads = 8;
+	};
+
+	/// @brief The mips of a streamed texture that are resident and the mips that were needed to draw it during the last frame
+	struct TextureResidency
+	{
+		uint32_t	Width	 = 0;
+		uint32_t	Height	 = 0;
+		uint32_t	MipCount = 1;
+		PixelFormat Format	 = PixelFormat::R8_G8_B8_A8_UNorm;
+
+		/// @brief The finest mip that is resident, every coarser mip is resident too
+		uint32_t ResidentMip = 0;
+
+		/// @brief The finest mip that the texture keeps when it is evicted
+		uint32_t EvictionMip = 0;
+
+		/// @brief The finest mip that was needed by any draw of the texture during the frame that it was last used
+		uint32_t DesiredMip = 0;
+
+		uint64_t LastUsedFrame = 0;
+
+		/// @brief Whether a load of the texture is in progress, its ResidentMip is then the mip that the load will make resident
+		bool Loading = false;
+	};
+
+	/// @brief A new resident mip for one of the textures that were given to PlanTextureResidency()
+	struct TextureResidencyChange
+	{
+		size_t	 Texture = 0;
+		uint32_t Mip	 = 0;
+	};
+
+	struct TextureResidencyPlan
+	{
+		/// @brief Textures that need finer mips, ordered from the largest number of missing mips to the smallest
+		std::vector<TextureResidencyChange> Loads = {};
+
+		/// @brief Textures whose finer mips are dropped to make room for the loads, least recently used first
+		std::vector<TextureResidencyChange> Evictions = {};
+	};
+
+	/// @brief Returns the number of bytes used by the resident mips of a texture
+	NX_API size_t GetResidentTextureSize(uint32_t width, uint32_t height, uint32_t mipCount, uint32_t residentMip, PixelFormat format);
+
+	/// @brief Chooses the mip of a texture whose texels are closest to one per pixel when the texture is stretched across an area of the
+	/// screen, assuming that the texture coordinates cover the texture once
+	/// @param projectedSize The size in pixels of the largest side of the area on the screen
+	NX_API uint32_t SelectTextureMip(uint32_t width, uint32_t height, uint32_t mipCount, float projectedSize);
+
+	/// @brief Returns the finest mip that is no larger than a size in either dimension, or the last mip if every mip is larger
+	NX_API uint32_t GetEvictionMip(uint32_t width, uint32_t height, uint32_t mipCount, uint32_t minimumResidentSize);
+
+	/// @brief Downsamples an image with a box filter, averaging in linear space so that sRGB images do not darken
+	/// @param image An image in PixelFormat::R8_G8_B8_A8_UNorm, its sRGB equivalent or PixelFormat::R32_G32_B32_A32_Float
+	/// @param firstMip The first mip to return
+	/// @param mipCount The number of mips in the full chain, including the image itself
+	/// @return The mips from firstMip to the end of the chain, in the format of the image
+	NX_API std::vector<Image> GenerateMipChain(const Image &image, uint32_t firstMip, uint32_t mipCount);
+
+	/// @brief Decides which textures to load finer mips for and which to evict so that the resident mips stay within a budget. Textures that
+	/// were used during the frame are given the mips that they need in order of how many mips they are missing, and the memory for them is
+	/// taken from the least recently used textures first. Textures that are still visible only ever lose mips that they no longer need.
+	/// @param textures The textures that are streamed
+	/// @param budget The number of bytes that the resident mips may use
+	/// @param frame The number of the frame that the usage was recorded in
+	/// @param maxLoads The maximum number of loads to return
+	NX_API TextureResidencyPlan PlanTextureResidency(std::span<const TextureResidency> textures, size_t budget, uint64_t frame, uint32_t maxLoads);
+
+	/// @brief A texture loaded from disk whose finer mips are only made resident while something on screen needs them
+	class NX_API StreamedTexture
+	{
+	  public:
+		StreamedTexture(const std::string &filepath, PixelFormat format);
+
+		/// @brief Returns a texture containing the resident mips, the first mip of which is the resident mip of the full chain. This is null
+		/// until the first mips have loaded and is replaced whenever mips are loaded or evicted, so it should be fetched each frame.
+		Ref<Texture> GetTexture() const;
+
+		const std::string &GetFilepath() const;
+
+		PixelFormat GetFormat() const;
+
+		/// @brief Returns the residency of the texture, the size is zero until the first mips have loaded
+		const TextureResidency &GetResidency() const;
+
+		/// @brief Returns whether the first mips have loaded
+		bool IsLoaded() const;
+
+		/// @brief Returns whether the file could not be loaded, in which case the texture never becomes resident
+		bool HasFailed() const;
+
+	  private:
+		std::string		 m_Filepath	  = {};
+		PixelFormat		 m_Format	  = PixelFormat::R8_G8_B8_A8_UNorm;
+		Ref<Texture>	 m_Texture	  = nullptr;
+		TextureResidency m_Residency  = {};
+		uint32_t		 m_LoadingMip = 0;
+		bool			 m_Loaded	  = false;
+		bool			 m_Failed	  = false;
+
+		friend class TextureStreamer;
+	};
+
+	/// @brief Creates textures with only their smallest mips resident and loads finer mips as draws need them. Draws report the size that
+	/// their textures cover on screen, each call to Update() then decodes the mips that are missing on worker threads, evicts the least
+	/// recently used mips when the budget is exceeded and uploads decoded mips through staging buffers, so the CPU never waits on the GPU.
+	/// Everything apart from the decoding happens on the thread that calls Update().
+	class NX_API TextureStreamer
+	{
+	  public:
+		TextureStreamer(GraphicsDevice *device, Ref<ICommandQueue> commandQueue, const TextureStreamingSettings &settings = {});
+
+		/// @brief Stops the workers, loads that have not finished are discarded
+		~TextureStreamer();
+
+		TextureStreamer(const TextureStreamer &)			= delete;
+		TextureStreamer &operator=(const TextureStreamer &) = delete;
+
+		/// @brief Starts loading the smallest mips of a texture, the texture is released by the streamer once nothing else references it
+		/// @param filepath The image file to load
+		/// @param srgb Whether the image is sRGB encoded
+		Ref<StreamedTexture> Load(const std::string &filepath, bool srgb = false);
+
+		/// @brief Records that a texture was drawn during the current frame
+		/// @param texture The texture that was drawn
+		/// @param projectedSize The size in pixels of the largest side of the area on the screen that the texture covers
+		void RecordUsage(const Ref<StreamedTexture> &texture, float projectedSize);
+
+		/// @brief Uploads mips that have finished loading, plans the residency of every texture from the usage recorded since the last call
+		/// and starts the loads and evictions that it needs. This should be called once per frame after the frame has been recorded.
+		void Update();
+
+		/// @brief Changes the settings, the number of workers is only read when the streamer is created
+		void SetSettings(const TextureStreamingSettings &settings);
+
+		const TextureStreamingSettings &GetSettings() const;
+
+		/// @brief Returns the number of bytes used by the resident mips of every streamed texture
+		size_t GetResidentSize() const;
+
+		/// @brief Returns the number of loads that are waiting for or running on a worker, or waiting to be uploaded
+		size_t GetPendingLoadCount() const;
+
+	  private:
+		struct LoadRequest
+		{
+			Ref<StreamedTexture> Texture			 = nullptr;
+			uint32_t			 Mip				 = 0;
+			uint32_t			 Priority			 = 0;
+			uint32_t			 MinimumResidentSize = 0;
+		};
+
+		struct LoadResult
+		{
+			Ref<StreamedTexture> Texture  = nullptr;
+			uint32_t			 Width	  = 0;
+			uint32_t			 Height	  = 0;
+			uint32_t			 MipCount = 0;
+			uint32_t			 FirstMip = 0;
+			std::vector<Image>	 Mips	  = {};
+
+			/// @brief Why the texture could not be loaded, or an empty string if it loaded
+			std::string Error = {};
+		};
+
+		void RunWorker();
+
+		/// @brief Decodes the mips of a request, this runs on a worker
+		static LoadResult Decode(const LoadRequest &request);
+
+		/// @brief Replaces the texture of a load result with a texture containing the decoded mips
+		void ApplyLoad(LoadResult &result);
+
+		/// @brief Replaces a texture with a smaller texture holding only its mips from a given mip onwards, the mips are copied on the GPU
+		void Evict(StreamedTexture &texture, uint32_t mip);
+
+		/// @brief Creates an empty texture for the mips of a streamed texture from a given mip onwards
+		Ref<Texture> CreateResidentTexture(const StreamedTexture &texture, uint32_t mip);
+
+		/// @brief Swaps in a texture holding the mips from a given mip onwards, the replaced texture is kept alive until the GPU has finished
+		/// the frames that may be drawing with it
+		void ReplaceTexture(StreamedTexture &texture, Ref<Texture> replacement, uint32_t mip);
+
+	  private:
+		GraphicsDevice			*m_Device		= nullptr;
+		Ref<ICommandQueue>		 m_CommandQueue = nullptr;
+		TextureStreamingSettings m_Settings		= {};
+
+		std::vector<Ref<StreamedTexture>> m_Textures	 = {};
+		uint64_t						  m_FrameNumber	 = 1;
+		size_t							  m_ResidentSize = 0;
+		size_t							  m_PendingLoads = 0;
+
+		mutable std::mutex		 m_Mutex		 = {};
+		std::condition_variable	 m_RequestQueued = {};
+		std::vector<LoadRequest> m_Requests		 = {};
+		std::deque<LoadResult>	 m_Results		 = {};
+		bool					 m_Stopping		 = false;
+		std::vector<std::thread> m_Workers		 = {};
+	};
+}	 // namespace Nexus::Graphics
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Nexus-Core/Vertex.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Graphics
+{
+	struct MeshData;
+
+	/// @brief Functions that compress vertices into VertexQuantizedPositionTexCoordNormalColourTangent and decode them again, which reduces
+	/// the memory and bandwidth taken by a mesh's vertices to a third
+	namespace VertexQuantization
+	{
+		/// @brief Encodes a direction as octahedral coordinates, choosing the rounding that decodes closest to the direction
+		/// @param direction The direction to encode, this does not need to be normalized and a zero vector is encoded as the positive z axis
+		/// @return The coordinates as signed normalized 16 bit integers
+		NX_API glm::i16vec2 EncodeOctahedral(const glm::vec3 &direction);
+
+		/// @brief Decodes octahedral coordinates in the same way as the GPU
+		/// @param encoded The coordinates as signed normalized 16 bit integers
+		/// @return The normalized direction
+		NX_API glm::vec3 DecodeOctahedral(const glm::i16vec2 &encoded);
+
+		/// @brief Finds the ranges of the positions and texture coordinates of a mesh's vertices
+		/// @param mesh The mesh to quantize
+		/// @return The values that decode the quantized vertices of the mesh
+		NX_API VertexDequantization CalculateDequantization(const MeshData &mesh);
+
+		/// @brief Compresses a vertex, the tangent frame is stored as the normal, the tangent and the handedness of the bitangent
+		/// @param vertex The vertex to compress
+		/// @param dequantization The ranges to encode the position and texture coordinates in
+		/// @return The compressed vertex
+		NX_API VertexQuantizedPositionTexCoordNormalColourTangent QuantizeVertex(const VertexPositionTexCoordNormalColourTangentBitangent &vertex,
+																				 const VertexDequantization &dequantization);
+
+		/// @brief Decodes a compressed vertex in the same way as the model shaders
+		/// @param vertex The vertex to decode
+		/// @param dequantization The ranges that the vertex was encoded in
+		/// @return The decoded vertex, its bitangent is the cross product of the normal and tangent multiplied by the stored handedness
+		NX_API VertexPositionTexCoordNormalColourTangentBitangent DequantizeVertex(const VertexQuantizedPositionTexCoordNormalColourTangent &vertex,
+																				   const VertexDequantization &dequantization);
+
+		/// @brief Compresses every vertex of a mesh
+		/// @param mesh The mesh to compress
+		/// @param dequantization The ranges to encode the vertices in, usually created by CalculateDequantization
+		/// @return The compressed vertices, in the same order so that the mesh's indices can still be used
+		NX_API std::vector<VertexQuantizedPositionTexCoordNormalColourTangent> QuantizeVertices(const MeshData			   &mesh,
+																								const VertexDequantization &dequantization);
+	}	 // namespace VertexQuantization
+}	 // namespace Nexus::Graphics
@@ -2,23 +2,37 @@
 
 #include "Nexus-Core/nxpch.hpp"
 
+#include <format>
+
+/// @brief Messages less severe than this are compiled out of the logging macros, the value is the value of a Nexus::Severity
+#if !defined(NX_MIN_LOG_SEVERITY)
+	#define NX_MIN_LOG_SEVERITY -1
+#endif
+
 namespace Nexus
 {
-	/// @brief An enum representing the severity of a log message
+	/// @brief An enum representing the severity of a log message, more severe messages have greater values. The values are explicit so
+	/// that Debug sorts below Info without changing the values of the existing severities.
 	enum class Severity
 	{
+		/// @brief The message contains detailed information that is only useful while debugging
+		Debug = -1,
+
 		/// @brief The message provides useful debugging data
-		Info,
+		Info = 0,
 
 		/// @brief The message contains a potential problem that may reduce
 		/// performance or cause crashes
-		Warning,
+		Warning = 1,
 
 		/// @brief The message contains an fatal issue with the application that will
 		/// result in a crash
-		Error
+		Error = 2
 	};
 
+	/// @brief Returns the upper case name of a severity, e.g. "WARNING"
+	const char *GetSeverityName(Severity severity);
+
 	/// @brief A struct representing all of the information about a log message
 	struct Log
 	{
@@ -32,6 +46,15 @@ namespace Nexus
 		/// @brief The time that the log was produced
 		std::chrono::system_clock::time_point Time;
 
+		/// @brief The file that produced the log
+		const char *File = "";
+
+		/// @brief The line within the file that produced the log
+		uint32_t Line = 0;
+
+		/// @brief The thread that produced the log
+		std::thread::id ThreadId = {};
+
 	  public:
 		/// @brief An empty log cannot be created
 		Log() = delete;
@@ -40,12 +63,38 @@ namespace Nexus
 		/// @param message The text message of the log
 		/// @param severity The severity of the log
 		Log(const std::string &message, Severity severity);
+
+		/// @brief A constructor that takes in a message, a severity and the location that produced it
+		/// @param message The text message of the log
+		/// @param severity The severity of the log
+		/// @param location The location in the source code that produced the log
+		Log(std::string message, Severity severity, const std::source_location &location);
 	};
 
-	/// @brief A class that allows logs to be recorded and retrieve later
+	class LogSink;
+
+	/// @brief A class that allows logs to be recorded and retrieved later. Logging only formats the message on the calling thread and pushes
+	/// it onto a lock-free queue, a background thread then writes the queued messages to the logger's sinks in batches.
 	class Logger
 	{
 	  public:
+		/// @brief The number of logs kept in the history by default
+		static constexpr size_t c_DefaultHistoryCapacity = 1024;
+
+		/// @brief Creates a logger without any sinks and starts its background thread
+		/// @param historyCapacity The number of the most recent logs to keep for GetLogs
+		explicit Logger(size_t historyCapacity = c_DefaultHistoryCapacity);
+
+		/// @brief Writes any logs that are still queued and then stops the background thread
+		~Logger();
+
+		Logger(const Logger &)			  = delete;
+		Logger &operator=(const Logger &) = delete;
+
+		/// @brief A method that adds a new debug log to the logger
+		/// @param message The text of the error message
+		void LogDebug(const std::string &message, const std::source_location location = std::source_location::current());
+
 		/// @brief A method that adds a new info log to the logger
 		/// @param message The text of the error message
 		void LogInfo(const std::string &message, const std::source_location location = std::source_location::current());
@@ -58,28 +107,124 @@ namespace Nexus
 		/// @param message The text of the error message
 		void LogError(const std::string &message, const std::source_location location = std::source_location::current());
 
-		/// @brief A method that returns the logs stored within the logger
-		/// @return A const reference to the vector of logs
-		const std::vector<Nexus::Log> &GetLogs();
+		/// @brief Adds a log with a message that is used as is
+		/// @param severity The severity of the log
+		/// @param location The location in the source code that produced the log
+		/// @param message The text of the log
+		void Write(Severity severity, const std::source_location &location, std::string_view message);
+
+		/// @brief Adds a log with a message built by std::format, the message is only formatted if the severity passes the logger's level
+		/// @param severity The severity of the log
+		/// @param location The location in the source code that produced the log
+		/// @param format The format string
+		/// @param args The arguments to format
+		template<typename... Args>
+			requires(sizeof...(Args) > 0)
+		void Write(Severity severity, const std::source_location &location, std::format_string<Args...> format, Args &&...args)
+		{
+			if (!ShouldLog(severity))
+			{
+				return;
+			}
+
+			// formatting reuses a buffer owned by the thread, so only the copy pushed onto the queue allocates
+			std::string &buffer = GetThreadBuffer();
+			buffer.clear();
+			std::format_to(std::back_inserter(buffer), format, std::forward<Args>(args)...);
+			Enqueue(severity, location, buffer);
+		}
+
+		/// @brief Sets the least severe logs that are recorded, anything less severe is discarded without being formatted
+		void SetLevel(Severity level);
+
+		Severity GetLevel() const;
+
+		/// @brief Returns whether a log with the given severity would be recorded
+		bool ShouldLog(Severity severity) const;
+
+		/// @brief Adds a sink that the background thread writes logs to
+		void AddSink(std::shared_ptr<LogSink> sink);
+
+		/// @brief Removes all of the logger's sinks, logs that are still queued are only kept in the history
+		void ClearSinks();
+
+		/// @brief Blocks until every log that was added before the call has been written to the sinks, and then flushes the sinks
+		void Flush();
+
+		/// @brief Writes any logs that are still queued and joins the background thread. Logs that are added afterwards are written to the
+		/// sinks by the thread that adds them, so a logger that outlives its thread can still be used (e.g. from static destructors).
+		void Stop();
+
+		/// @brief A method that returns the most recent logs stored within the logger
+		/// @return A copy of the logs, oldest first
+		std::vector<Nexus::Log> GetLogs() const;
 
 	  private:
-		/// @brief A method that returns the current time as a string
-		/// @return A const reference to a string containing the current time
-		static std::string GetTime();
+		/// @brief A node of the queue, the queue always contains one node that has already been consumed
+		struct Node
+		{
+			std::optional<Nexus::Log> Entry = {};
+			std::atomic<Node *>		  Next	= nullptr;
+		};
+
+		static std::string &GetThreadBuffer();
+
+		void Enqueue(Severity severity, const std::source_location &location, std::string_view message);
+
+		/// @brief Removes the oldest log from the queue, this is only called from the background thread or with the mutex held once the
+		/// background thread has stopped
+		std::optional<Nexus::Log> Dequeue();
+
+		/// @brief Writes every log that is queued and flushes the sinks, this is used once the background thread has stopped
+		void WriteQueued();
+
+		void Run();
 
 	  private:
-		/// @brief A vector containing the logger's logs
-		std::vector<Nexus::Log> m_Logs;
+		/// @brief The most recently added node, producers swap themselves in here so adding a log never takes a lock
+		std::atomic<Node *> m_Head = nullptr;
+
+		/// @brief The node that was most recently consumed, this is only accessed by the background thread
+		Node *m_Tail = nullptr;
+
+		std::atomic<Severity> m_Level	 = Severity::Debug;
+		std::atomic<uint64_t> m_Enqueued = 0;
+		std::atomic<bool>	  m_Stopped	 = false;
+
+		mutable std::mutex		m_Mutex;
+		std::condition_variable m_WorkAvailable = {};
+		std::condition_variable m_Written		= {};
+		uint64_t				m_WrittenCount	= 0;
+		uint64_t				m_FlushTarget	= 0;
+		bool					m_FlushPending	= false;
+		bool					m_ErrorPending	= false;
+		bool					m_Stopping		= false;
+
+		std::vector<std::shared_ptr<LogSink>> m_Sinks			= {};
+		std::deque<Nexus::Log>				  m_History			= {};
+		size_t								  m_HistoryCapacity = c_DefaultHistoryCapacity;
+
+		std::thread m_Thread = {};
 	};
 
-	/// @brief A method that returns a raw pointer to the engine's core logger
+	/// @brief A method that returns a raw pointer to the engine's core logger, this writes to the console. The logger is never destroyed
+	/// so that it can be used from static destructors, Nexus::Shutdown() stops its background thread.
 	/// @return A raw pointer to the core logger of the engine
 	Logger *GetCoreLogger();
 }	 // namespace Nexus
 
-#define NX_LOG(message)				   Nexus::GetCoreLogger()->LogInfo(message)
-#define NX_WARNING(message)			   Nexus::GetCoreLogger()->LogWarning(message)
-#define NX_ERROR(message)			   Nexus::GetCoreLogger()->LogError(message)
+#define NX_LOG_WRITE(severity, ...)                                                                                                                  \
+	do {                                                                                                                                             \
+		if constexpr ((int)(severity) >= NX_MIN_LOG_SEVERITY)                                                                                        \
+		{                                                                                                                                            \
+			Nexus::GetCoreLogger()->Write(severity, std::source_location::current(), __VA_ARGS__);                                                   \
+		}                                                                                                                                            \
+	} while (false)
+
+#define NX_DEBUG(...)				   NX_LOG_WRITE(Nexus::Severity::Debug, __VA_ARGS__)
+#define NX_LOG(...)					   NX_LOG_WRITE(Nexus::Severity::Info, __VA_ARGS__)
+#define NX_WARNING(...)				   NX_LOG_WRITE(Nexus::Severity::Warning, __VA_ARGS__)
+#define NX_ERROR(...)				   NX_LOG_WRITE(Nexus::Severity::Error, __VA_ARGS__)
 #define NX_ASSERT(expression, message) assert(expression &&message)
 #define NX_VALIDATE(expression, message)                                                                                                             \
 	do {                                                                                                                                             \
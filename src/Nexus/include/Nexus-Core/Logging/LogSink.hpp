@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Nexus-Core/Logging/Log.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus
+{
+	/// @brief A destination that a logger writes its logs to, sinks are only called from the logger's background thread or, once the logger
+	/// has been stopped, by one logging thread at a time
+	class NX_API LogSink
+	{
+	  public:
+		virtual ~LogSink() = default;
+
+		/// @brief Writes a batch of logs, oldest first
+		virtual void Write(std::span<const Nexus::Log> logs) = 0;
+
+		/// @brief Makes sure that everything that has been written has reached its destination
+		virtual void Flush()
+		{
+		}
+	};
+
+	/// @brief Appends a log to a string as a single line, including its time, severity and source location
+	NX_API void FormatLog(const Nexus::Log &log, std::string &output);
+
+	/// @brief Writes logs to the standard output, each batch is written with a single call
+	class NX_API ConsoleLogSink : public LogSink
+	{
+	  public:
+		void Write(std::span<const Nexus::Log> logs) override;
+		void Flush() override;
+
+	  private:
+		std::string m_Buffer = {};
+	};
+
+	/// @brief Writes logs to a file, moving the file aside once it grows past a size limit and keeping a fixed number of older files. The
+	/// older files are named after the file with an increasing number appended, e.g. "Nexus.log.1" is the most recent.
+	class NX_API RotatingFileLogSink : public LogSink
+	{
+	  public:
+		/// @brief Opens the file, appending to it if it already exists
+		/// @param path The path of the file to write to
+		/// @param maxFileSize The size in bytes that the file can reach before it is rotated
+		/// @param maxBackupFiles The number of older files to keep
+		RotatingFileLogSink(const std::filesystem::path &path, size_t maxFileSize = 5 * 1024 * 1024, uint32_t maxBackupFiles = 3);
+
+		void Write(std::span<const Nexus::Log> logs) override;
+		void Flush() override;
+
+	  private:
+		void Rotate();
+
+	  private:
+		std::filesystem::path m_Path		   = {};
+		size_t				  m_MaxFileSize	   = 0;
+		uint32_t			  m_MaxBackupFiles = 0;
+		std::ofstream		  m_File		   = {};
+		size_t				  m_FileSize	   = 0;
+		std::string			  m_Buffer		   = {};
+	};
+}	 // namespace Nexus
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Nexus-Core/Graphics/BoundingBox.hpp"
+#include "Nexus-Core/Graphics/Frustum.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Graphics
+{
+	/// @brief A bounding volume hierarchy that is updated incrementally as objects are added, moved and removed, rather than being rebuilt.
+	/// Each object is stored in a leaf with a box that is slightly larger than the object, so that small movements do not change the tree,
+	/// and the tree is kept balanced with rotations as leaves are inserted and removed.
+	class NX_API BoundingVolumeHierarchy
+	{
+	  public:
+		/// @brief The value returned in place of a proxy when there is no node
+		static constexpr uint32_t c_NullNode = UINT32_MAX;
+
+		/// @brief Creates an empty hierarchy
+		/// @param margin The distance that each object's box is enlarged by on every side
+		explicit BoundingVolumeHierarchy(float margin = 0.1f);
+
+		/// @brief Adds an object to the hierarchy
+		/// @param bounds The box enclosing the object
+		/// @param userData A value that is returned by queries that find the object
+		/// @return A proxy that identifies the object until it is removed
+		uint32_t Insert(const BoundingBox &bounds, uint32_t userData);
+
+		/// @brief Removes an object from the hierarchy
+		/// @param proxy The proxy returned by Insert
+		void Remove(uint32_t proxy);
+
+		/// @brief Updates the bounds of an object, the tree is only changed if the object has moved outside of its enlarged box
+		/// @param proxy The proxy returned by Insert
+		/// @param bounds The new box enclosing the object
+		/// @return Whether the object had to be reinserted
+		bool Move(uint32_t proxy, const BoundingBox &bounds);
+
+		/// @brief Finds every object whose enlarged box may be inside a frustum, subtrees that are entirely inside the frustum are added
+		/// without testing their children
+		/// @param frustum The frustum to test against
+		/// @param results The user data of each object that was found is appended to this
+		void Query(const Frustum &frustum, std::vector<uint32_t> &results) const;
+
+		/// @brief Finds every object whose enlarged box overlaps a box
+		/// @param box The box to test against
+		/// @param results The user data of each object that was found is appended to this
+		void Query(const BoundingBox &box, std::vector<uint32_t> &results) const;
+
+		uint32_t		   GetUserData(uint32_t proxy) const;
+		const BoundingBox &GetFatBounds(uint32_t proxy) const;
+
+		/// @brief Returns the number of objects in the hierarchy
+		size_t GetProxyCount() const;
+
+		/// @brief Returns the number of levels below the root, this grows logarithmically with the number of objects
+		uint32_t GetHeight() const;
+
+		/// @brief Removes every object from the hierarchy
+		void Clear();
+
+	  private:
+		struct Node
+		{
+			BoundingBox Bounds	 = {};
+			uint32_t	Parent	 = c_NullNode;
+			uint32_t	Child1	 = c_NullNode;
+			uint32_t	Child2	 = c_NullNode;
+			uint32_t	Height	 = 0;
+			uint32_t	UserData = 0;
+
+			bool IsLeaf() const
+			{
+				return Child1 == c_NullNode;
+			}
+		};
+
+		uint32_t AllocateNode();
+		void	 FreeNode(uint32_t index);
+
+		void InsertLeaf(uint32_t leaf);
+		void RemoveLeaf(uint32_t leaf);
+
+		/// @brief Recomputes the bounds and heights of a node and each of its ancestors, rebalancing them on the way up
+		void Refit(uint32_t index);
+
+		/// @brief Rotates a child of a node upwards if one side of the node is more than one level taller than the other
+		/// @return The node that has taken the original node's place in the tree
+		uint32_t Balance(uint32_t index);
+
+		/// @brief Appends the user data of every leaf below a node
+		void CollectLeaves(uint32_t index, std::vector<uint32_t> &stack, std::vector<uint32_t> &results) const;
+
+	  private:
+		std::vector<Node>	  m_Nodes	   = {};
+		std::vector<uint32_t> m_FreeNodes  = {};
+		uint32_t			  m_Root	   = c_NullNode;
+		size_t				  m_ProxyCount = 0;
+		float				  m_Margin	   = 0.1f;
+	};
+}	 // namespace Nexus::Graphics
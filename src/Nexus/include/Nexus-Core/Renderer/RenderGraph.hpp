@@ -0,0 +1,233 @@
+#pragma once
+
+#include "Nexus-Core/Graphics/CommandList.hpp"
+#include "Nexus-Core/Graphics/CommandQueue.hpp"
+#include "Nexus-Core/Graphics/DeviceBuffer.hpp"
+#include "Nexus-Core/Graphics/Texture.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Graphics
+{
+	class GraphicsDevice;
+
+	/// @brief A handle to a texture or buffer that is used by the passes of a render graph
+	struct RenderGraphResource
+	{
+		uint32_t Index = UINT32_MAX;
+
+		bool IsValid() const
+		{
+			return Index != UINT32_MAX;
+		}
+	};
+
+	/// @brief How a pass uses a resource, this decides the layout and barriers that the resource needs before the pass runs
+	enum class RenderGraphAccess
+	{
+		None,
+		ColourAttachment,
+		DepthStencilAttachment,
+		DepthStencilRead,
+		ShaderRead,
+		ShaderWrite,
+		TransferSource,
+		TransferDestination,
+		VertexBuffer,
+		IndexBuffer,
+		IndirectBuffer,
+		UniformBuffer
+	};
+
+	/// @brief A barrier that the graph has determined is needed before a pass can use a resource
+	struct RenderGraphBarrier
+	{
+		RenderGraphResource	 Resource	  = {};
+		TextureLayout		 Layout		  = TextureLayout::Undefined;
+		BarrierAccess		 BeforeAccess = BarrierAccess::None;
+		BarrierAccess		 AfterAccess  = BarrierAccess::None;
+		BarrierPipelineStage BeforeStage  = BarrierPipelineStage::None;
+		BarrierPipelineStage AfterStage	  = BarrierPipelineStage::None;
+	};
+
+	/// @brief A pass that survived culling, in the order that it will be recorded
+	struct RenderGraphCompiledPass
+	{
+		std::string						Name	 = {};
+		uint32_t						Pass	 = 0;
+		std::vector<RenderGraphBarrier> Barriers = {};
+	};
+
+	struct RenderGraphStatistics
+	{
+		uint32_t DeclaredPasses		= 0;
+		uint32_t ExecutedPasses		= 0;
+		uint32_t Barriers			= 0;
+		uint32_t TransientResources = 0;
+		uint32_t PhysicalResources	= 0;
+		uint32_t CreatedResources	= 0;
+	};
+
+	class RenderGraph;
+
+	/// @brief Used by a pass while it is being added to declare the resources that it reads and writes
+	class NX_API RenderGraphBuilder
+	{
+	  public:
+		RenderGraphBuilder(RenderGraph *graph, uint32_t pass);
+
+		/// @brief Creates a texture that only exists while the graph is executing, its memory may be shared with other transient textures
+		RenderGraphResource CreateTexture(const std::string &name, const TextureDescription &description);
+
+		/// @brief Creates a buffer that only exists while the graph is executing, its memory may be shared with other transient buffers
+		RenderGraphResource CreateBuffer(const std::string &name, const DeviceBufferDescription &description);
+
+		void Read(RenderGraphResource resource, RenderGraphAccess access);
+		void Write(RenderGraphResource resource, RenderGraphAccess access);
+
+		/// @brief Prevents the pass from being culled even if nothing reads what it writes, for example a pass that reads back data
+		void SetSideEffects();
+
+	  private:
+		RenderGraph *m_Graph = nullptr;
+		uint32_t	 m_Pass	 = 0;
+	};
+
+	/// @brief Passed to a pass while it is being recorded to give it access to the command list and the resources it declared
+	class NX_API RenderGraphContext
+	{
+	  public:
+		RenderGraphContext(const RenderGraph *graph, Ref<CommandList> commandList);
+
+		Ref<CommandList>  GetCommandList() const;
+		Ref<Texture>	  GetTexture(RenderGraphResource resource) const;
+		Ref<DeviceBuffer> GetBuffer(RenderGraphResource resource) const;
+
+	  private:
+		const RenderGraph *m_Graph		 = nullptr;
+		Ref<CommandList>   m_CommandList = nullptr;
+	};
+
+	/// @brief A frame described as a set of passes that declare the resources they read and write. Compiling the graph removes passes whose
+	/// results are never used, places the barriers and layout transitions that each pass needs and lets transient resources whose lifetimes
+	/// do not overlap share the same texture or buffer. Every pass is then recorded into a single command list and submitted at once.
+	class NX_API RenderGraph
+	{
+	  public:
+		using SetupFunc	  = std::function<void(RenderGraphBuilder &)>;
+		using ExecuteFunc = std::function<void(RenderGraphContext &)>;
+
+		/// @brief Creates an empty graph
+		/// @param device The device used to create transient resources, this can be null if the graph is only compiled
+		explicit RenderGraph(GraphicsDevice *device);
+
+		/// @brief Makes a texture that outlives the graph available to its passes, passes that write to it are never culled
+		/// @param finalAccess How the texture will be used after the graph has executed, it is transitioned to match this at the end
+		RenderGraphResource ImportTexture(const std::string &name, Ref<Texture> texture, RenderGraphAccess finalAccess = RenderGraphAccess::None);
+
+		/// @brief Makes a buffer that outlives the graph available to its passes, passes that write to it are never culled
+		RenderGraphResource ImportBuffer(const std::string &name, Ref<DeviceBuffer> buffer);
+
+		/// @brief Adds a swapchain or framebuffer that passes render to, its transitions are handled when it is bound so it only orders passes
+		RenderGraphResource ImportRenderTarget(const std::string &name);
+
+		/// @brief Adds a pass to the end of the graph
+		/// @param name The name of the pass, this is used as the name of its debug group
+		/// @param setup Called immediately to declare the resources used by the pass
+		/// @param execute Called when the graph is executed to record the commands of the pass
+		void AddPass(const std::string &name, SetupFunc setup, ExecuteFunc execute);
+
+		/// @brief Culls unused passes, computes the barriers needed by each remaining pass and assigns transient resources to textures and buffers
+		void Compile();
+
+		/// @brief Records every pass that survived culling into a command list and submits it
+		/// @param commandList The command list to record into
+		/// @param commandQueue The queue to submit the command list to
+		/// @param fence An optional fence that is signalled when the commands have completed
+		void Execute(Ref<CommandList> commandList, Ref<ICommandQueue> commandQueue, Ref<Fence> fence = nullptr);
+
+		/// @brief Removes every pass and resource so that the next frame can be described, the textures and buffers backing transient
+		/// resources are kept so they can be reused
+		void Reset();
+
+		const std::vector<RenderGraphCompiledPass> &GetCompiledPasses() const;
+		const RenderGraphStatistics				   &GetStatistics() const;
+
+		/// @brief Returns the index of the texture or buffer backing a transient resource, resources that share an index share memory
+		uint32_t GetPhysicalResource(RenderGraphResource resource) const;
+
+		Ref<Texture>	  GetTexture(RenderGraphResource resource) const;
+		Ref<DeviceBuffer> GetBuffer(RenderGraphResource resource) const;
+
+	  private:
+		enum class ResourceType
+		{
+			Texture,
+			Buffer,
+			RenderTarget
+		};
+
+		struct ResourceUsage
+		{
+			RenderGraphResource Resource = {};
+			RenderGraphAccess	Access	 = RenderGraphAccess::None;
+		};
+
+		struct Resource
+		{
+			std::string					Name		= {};
+			ResourceType				Type		= ResourceType::Texture;
+			bool						Imported	= false;
+			TextureDescription			TextureDesc = {};
+			DeviceBufferDescription		BufferDesc	= {};
+			Ref<Graphics::Texture>		Texture		= nullptr;
+			Ref<Graphics::DeviceBuffer> Buffer		= nullptr;
+			RenderGraphAccess			FinalAccess = RenderGraphAccess::None;
+			uint32_t					Physical	= UINT32_MAX;
+			uint32_t					FirstUse	= UINT32_MAX;
+			uint32_t					LastUse		= 0;
+		};
+
+		struct Pass
+		{
+			std::string				   Name		   = {};
+			ExecuteFunc				   Execute	   = {};
+			std::vector<ResourceUsage> Reads	   = {};
+			std::vector<ResourceUsage> Writes	   = {};
+			bool					   SideEffects = false;
+		};
+
+		/// @brief A texture or buffer that backs one or more transient resources
+		struct PhysicalResource
+		{
+			ResourceType				Type		  = ResourceType::Texture;
+			TextureDescription			TextureDesc	  = {};
+			DeviceBufferDescription		BufferDesc	  = {};
+			Ref<Graphics::Texture>		Texture		  = nullptr;
+			Ref<Graphics::DeviceBuffer> Buffer		  = nullptr;
+			uint32_t					BusyUntil	  = 0;
+			bool						Assigned	  = false;
+			uint64_t					LastUsedFrame = 0;
+		};
+
+		RenderGraphResource AddResource(Resource resource);
+		void				CullPasses(std::vector<bool> &kept) const;
+		void				AllocatePhysicalResources();
+		void				ComputeBarriers();
+		void				CreatePhysicalResources();
+
+		bool IsCompatible(const PhysicalResource &physical, const Resource &resource) const;
+
+	  private:
+		GraphicsDevice						*m_Device		  = nullptr;
+		std::vector<Resource>				 m_Resources	  = {};
+		std::vector<Pass>					 m_Passes		  = {};
+		std::vector<RenderGraphCompiledPass> m_CompiledPasses = {};
+		std::vector<RenderGraphBarrier>		 m_FinalBarriers  = {};
+		std::vector<PhysicalResource>		 m_Physical		  = {};
+		RenderGraphStatistics				 m_Statistics	  = {};
+		uint64_t							 m_FrameIndex	  = 0;
+		bool								 m_Compiled		  = false;
+
+		friend class RenderGraphBuilder;
+	};
+}	 // namespace Nexus::Graphics
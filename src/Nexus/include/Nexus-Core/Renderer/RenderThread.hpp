@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Nexus-Core/Timings/Timespan.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus::Graphics
+{
+	/// @brief An immutable snapshot of everything that is needed to render a frame. Applications derive from this and copy only the data
+	/// that their renderer reads (e.g. transforms, mesh handles and camera matrices) out of the scene, so that the render thread never
+	/// touches state that the main thread is still updating. The engine does not build packets for its own renderers, Renderer3D and
+	/// SceneRenderer read the scene while they render, so they cannot be used from the render thread on a scene that the main thread
+	/// is still updating.
+	struct FramePacket
+	{
+		virtual ~FramePacket() = default;
+
+		/// @brief The elapsed time since the previous frame was extracted
+		TimeSpan Time = {};
+
+		/// @brief The number of the frame, starting at 1 for the first packet submitted to a render thread
+		uint64_t FrameNumber = 0;
+	};
+
+	/// @brief Consumes frame packets on a dedicated thread. The thread that produces the packets is only allowed to run a fixed number of
+	/// frames ahead of the frame that is being rendered, so the latency between an update and its frame appearing stays bounded.
+	class NX_API RenderThread
+	{
+	  public:
+		using RenderFunc = std::function<void(const FramePacket &packet)>;
+
+		/// @brief Starts the render thread
+		/// @param func The function that records and submits the work for a packet, this is only ever called from the render thread
+		/// @param maxQueuedFrames The number of packets that can wait while another is being rendered, this must be at least 1
+		explicit RenderThread(RenderFunc func, uint32_t maxQueuedFrames = 1);
+
+		/// @brief Renders any packets that are still queued and then stops the thread
+		~RenderThread();
+
+		RenderThread(const RenderThread &)			  = delete;
+		RenderThread &operator=(const RenderThread &) = delete;
+
+		/// @brief Hands a packet over to the render thread, blocking while the queue is full. If rendering a previous packet threw an
+		/// exception, it is rethrown here instead.
+		/// @param packet The packet to render, its frame number is assigned by the render thread
+		void Submit(std::unique_ptr<FramePacket> packet);
+
+		/// @brief Blocks until every packet that has been submitted has finished rendering, e.g. before resources used by the renderer are
+		/// recreated or destroyed. If rendering a packet threw an exception, it is rethrown here.
+		void WaitForIdle();
+
+		/// @brief Returns the number of packets that have been submitted
+		uint64_t GetSubmittedFrameCount() const;
+
+		/// @brief Returns the number of packets that have finished rendering
+		uint64_t GetRenderedFrameCount() const;
+
+		uint32_t GetMaxQueuedFrames() const;
+
+	  private:
+		void Run();
+
+		/// @brief Rethrows an exception thrown by the render function, the caller must hold the mutex
+		void RethrowError();
+
+	  private:
+		RenderFunc m_Func			 = {};
+		uint32_t   m_MaxQueuedFrames = 1;
+
+		mutable std::mutex						 m_Mutex		  = {};
+		std::condition_variable					 m_PacketQueued	  = {};
+		std::condition_variable					 m_PacketRendered = {};
+		std::deque<std::unique_ptr<FramePacket>> m_Queue		  = {};
+		uint64_t								 m_Submitted	  = 0;
+		uint64_t								 m_Rendered		  = 0;
+		std::exception_ptr						 m_Error		  = nullptr;
+		bool									 m_Stopping		  = false;
+
+		std::thread m_Thread = {};
+	};
+}	 // namespace Nexus::Graphics
@@ -2,9 +2,13 @@
 
 #include "Nexus-Core/nxpch.hpp"
 
+#include "Nexus-Core/Graphics/FrameTracker.hpp"
 #include "Nexus-Core/Graphics/FullscreenQuad.hpp"
 #include "Nexus-Core/Graphics/GraphicsDevice.hpp"
 #include "Nexus-Core/Graphics/Model.hpp"
+#include "Nexus-Core/Graphics/TextureStreamer.hpp"
+#include "Nexus-Core/Renderer/BoundingVolumeHierarchy.hpp"
+#include "Nexus-Core/Renderer/RenderGraph.hpp"
 #include "Nexus-Core/Runtime/Camera.hpp"
 #include "Nexus-Core/Runtime/Scene.hpp"
 
@@ -23,13 +27,34 @@ namespace Nexus::Graphics
 		glm::vec3 CamPosition = {};
 	};
 
-	struct alignas(16) ModelTransformUniforms
+	/// @brief The values that are shared by every instance of a mesh that is drawn in a batch. Each mesh of a model has its own material and
+	/// vertex dequantization, so these are kept per mesh rather than per model.
+	struct alignas(16) ModelMeshUniforms
 	{
-		glm::mat4 Transform		 = {};
-		glm::vec4 DiffuseColour	 = {};
-		glm::vec4 SpecularColour = {};
-		uint32_t  Guid1			 = {};
-		uint32_t  Guid2			 = {};
+		glm::vec4 DiffuseColour		  = {};
+		glm::vec4 SpecularColour	  = {};
+		glm::vec4 PositionOffset	  = {};
+		glm::vec4 PositionScale		  = {};
+		glm::vec4 TexCoordOffsetScale = {};
+	};
+
+	/// @brief The values that are read from the instance buffer for each copy of a mesh that is drawn
+	struct ModelInstanceData
+	{
+		glm::mat4 Transform = {};
+		uint32_t  Guid1		= 0;
+		uint32_t  Guid2		= 0;
+
+		static VertexBufferLayout GetLayout()
+		{
+			return {{{ShaderDataType::R32G32B32A32_SFloat, "TEXCOORD"},
+					 {ShaderDataType::R32G32B32A32_SFloat, "TEXCOORD"},
+					 {ShaderDataType::R32G32B32A32_SFloat, "TEXCOORD"},
+					 {ShaderDataType::R32G32B32A32_SFloat, "TEXCOORD"},
+					 {ShaderDataType::R32G32_UInt, "TEXCOORD"}},
+					sizeof(ModelInstanceData),
+					StepRate::Instance};
+		}
 	};
 
 	struct ModelRenderData
@@ -38,25 +63,123 @@ namespace Nexus::Graphics
 		GUID	  Guid		= {};
 	};
 
+	/// @brief A mesh of a model that is drawn for an entity, these are kept between frames so that the bounding volume hierarchy only needs
+	/// to be refitted when an entity moves
+	struct MeshInstance
+	{
+		Nexus::Ref<Nexus::Graphics::Model> Model	   = nullptr;
+		Nexus::Ref<Nexus::Graphics::Mesh>  Mesh		   = nullptr;
+		glm::mat4						   Transform   = {};
+		BoundingBox						   WorldBounds = {};
+		GUID							   Guid		   = GUID(0);
+		uint32_t						   Proxy	   = BoundingVolumeHierarchy::c_NullNode;
+		uint64_t						   LastFrame   = 0;
+		uint32_t						   Lod		   = 0;
+	};
+
+	/// @brief Visible instances of a mesh at the same level of detail, which are drawn together with one instanced draw
+	struct MeshDrawBatch
+	{
+		Nexus::Ref<Nexus::Graphics::Mesh> Mesh			= nullptr;
+		uint32_t						  Lod			= 0;
+		uint32_t						  FirstInstance = 0;
+		uint32_t						  InstanceCount = 0;
+	};
+
+	/// @brief The number of meshes that were submitted and drawn during the last frame
+	struct CullingStatistics
+	{
+		size_t SubmittedMeshes = 0;
+		size_t VisibleMeshes   = 0;
+		size_t DrawnTriangles  = 0;
+		size_t DrawCalls	   = 0;
+	};
+
+	/// @brief Groups visible mesh instances into batches that can each be drawn with one instanced draw, the batches are ordered by vertex
+	/// format so that the pipeline only changes between formats
+	/// @param instances The mesh instances that the visible indices refer to
+	/// @param visibleInstances The indices of the visible instances, these are reordered so that the instances of each batch are next to each
+	/// other and FirstInstance indexes into them
+	/// @param batches Receives the batches, any batches that it already contains are removed
+	NX_API void BuildMeshDrawBatches(const std::vector<MeshInstance> &instances,
+									 std::vector<uint32_t>			 &visibleInstances,
+									 std::vector<MeshDrawBatch>		 &batches);
+
+	/// @brief Returns the uniforms that the renderer writes for a mesh, unquantized meshes use a dequantization that leaves their vertices
+	/// unchanged
+	NX_API ModelMeshUniforms CreateModelMeshUniforms(const Mesh &mesh);
+
+	/// @brief The resources that are written while recording a frame, one set is kept for each frame in flight so that a frame can be
+	/// recorded while the GPU is still reading the resources of the previous one
+	struct Renderer3DFrameResources
+	{
+		Ref<Graphics::CommandList>															   CommandList				= nullptr;
+		Ref<Graphics::DeviceBuffer>															   CubemapUniformBuffer		= nullptr;
+		Ref<Graphics::ResourceSet>															   CubemapResourceSet		= nullptr;
+		Ref<Graphics::DeviceBuffer>															   ModelCameraUniformBuffer = nullptr;
+		Ref<Graphics::DeviceBuffer>															   ModelInstanceBuffer		= nullptr;
+		std::map<Nexus::Ref<Nexus::Graphics::Mesh>, Nexus::Ref<Nexus::Graphics::DeviceBuffer>> MeshUniformBuffers		= {};
+		std::map<Nexus::Ref<Nexus::Graphics::Mesh>, Nexus::Ref<Nexus::Graphics::ResourceSet>>  MeshResourceSets			= {};
+	};
+
 	class NX_API Renderer3D
 	{
 	  public:
 		Renderer3D(GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue);
 		~Renderer3D();
 
+		/// @brief Begins rendering a scene, the scene is read until End() returns so it must not be updated by another thread in the
+		/// meantime
 		void Begin(Scene *scene, RenderTarget target, Nexus::TimeSpan time);
 		void End();
 
 		const Nexus::FirstPersonCamera GetCamera() const;
 
+		const CullingStatistics &GetCullingStatistics() const;
+
+		/// @brief Sets how much error meshes are allowed to have on screen when choosing their level of detail
+		void SetLodSelectionSettings(const LodSelectionSettings &settings);
+
+		const LodSelectionSettings &GetLodSelectionSettings() const;
+
+		/// @brief Sets the streamer that the on screen size of the streamed textures of visible meshes is reported to, this can be null. The
+		/// streamer is not updated by the renderer, as it may be shared between renderers.
+		void SetTextureStreamer(TextureStreamer *streamer);
+
 	  private:
-		void RenderModel(Nexus::Ref<Nexus::Graphics::Model> model, const glm::mat4 transform, GUID guid);
-		void RenderCubemap();
-		void ClearGBuffer();
+		/// @brief Updates the world space bounds of each mesh of a model, adding meshes that were not drawn last frame to the hierarchy
+		void UpdateMeshInstances(Nexus::Ref<Nexus::Graphics::Model> model, const glm::mat4 &transform, GUID guid);
+
+		/// @brief Removes meshes from the hierarchy whose entity or model was not submitted this frame
+		void RemoveStaleMeshInstances();
+
+		/// @brief Chooses the level of detail of each visible mesh from the size of its error on screen
+		void SelectMeshLods();
 
-		void CreateCubemapPipeline();
-		void CreateModelPipeline();
-		void CreateClearGBufferPipeline();
+		/// @brief Reports the size on screen of each visible mesh to the texture streamer for the streamed textures of its material
+		void RecordTextureUsage();
+
+		/// @brief Binds the scene's render target and sets the viewport and scissor to cover it
+		void BeginRenderTarget(Ref<CommandList> commandList);
+
+		/// @brief Returns the model pipeline that reads the vertex format of a mesh
+		Ref<GraphicsPipeline> GetModelPipeline(const Mesh &mesh) const;
+
+		/// @brief Writes the transforms of the visible instances into this frame's instance buffer in the order of the batches
+		void UploadModelInstances();
+
+		void RenderMeshBatch(Ref<CommandList> commandList, const MeshDrawBatch &batch);
+		void RenderCubemap(Ref<CommandList> commandList, Ref<Texture> cubemap);
+		void ClearGBuffer(Ref<CommandList> commandList);
+
+		Renderer3DFrameResources CreateFrameResources();
+
+		void				  CreateCubemapPipeline();
+		void				  CreateModelPipelines();
+		Ref<GraphicsPipeline> CreateModelPipeline(const std::string		   &vertexShaderSource,
+												  const std::string		   &vertexShaderName,
+												  const VertexBufferLayout &layout);
+		void				  CreateClearGBufferPipeline();
 
 	  private:
 		GraphicsDevice				*m_Device		  = nullptr;
@@ -67,26 +190,37 @@ namespace Nexus::Graphics
 		Scene		*m_Scene   = nullptr;
 		Ref<Texture> m_Cubemap = nullptr;
 
-		Ref<CommandList> m_CommandList = nullptr;
+		PerFrame<Renderer3DFrameResources> m_Frames = {};
+		Renderer3DFrameResources		  *m_Frame	= nullptr;
+		RenderGraph						   m_RenderGraph;
 
 		Ref<Nexus::Graphics::Mesh> m_Cube;
 
 		Nexus::FirstPersonCamera m_Camera;
 
-		Nexus::Ref<Nexus::Graphics::Sampler>		  m_CubemapSampler		 = nullptr;
-		Nexus::Ref<Nexus::Graphics::GraphicsPipeline> m_CubemapPipeline		 = nullptr;
-		Nexus::Ref<Nexus::Graphics::DeviceBuffer>	  m_CubemapUniformBuffer = nullptr;
-		Nexus::Ref<Nexus::Graphics::ResourceSet>	  m_CubemapResourceSet	 = nullptr;
+		Nexus::Ref<Nexus::Graphics::Sampler>		  m_CubemapSampler	= nullptr;
+		Nexus::Ref<Nexus::Graphics::GraphicsPipeline> m_CubemapPipeline = nullptr;
 
-		Nexus::Ref<Nexus::Graphics::Sampler>													m_ModelSampler				   = nullptr;
-		Nexus::Ref<Nexus::Graphics::GraphicsPipeline>											m_ModelPipeline				   = nullptr;
-		Nexus::Ref<Nexus::Graphics::DeviceBuffer>												m_ModelCameraUniformBuffer	   = nullptr;
-		std::map<Nexus::Ref<Nexus::Graphics::Model>, Nexus::Ref<Nexus::Graphics::DeviceBuffer>> m_ModelTransformUniformBuffers = {};
-		std::map<Nexus::Ref<Nexus::Graphics::Model>, Nexus::Ref<Nexus::Graphics::ResourceSet>>	m_ModelResourceSets			   = {};
-		std::map<Nexus::Ref<Nexus::Graphics::Model>, ModelRenderData>							m_ModelIDs					   = {};
+		Nexus::Ref<Nexus::Graphics::Sampler>						  m_ModelSampler		   = nullptr;
+		Nexus::Ref<Nexus::Graphics::GraphicsPipeline>				  m_ModelPipeline		   = nullptr;
+		Nexus::Ref<Nexus::Graphics::GraphicsPipeline>				  m_QuantizedModelPipeline = nullptr;
+		std::map<Nexus::Ref<Nexus::Graphics::Model>, ModelRenderData> m_ModelIDs			   = {};
 
 		Nexus::Ref<Nexus::Graphics::GraphicsPipeline> m_ClearScreenPipeline = nullptr;
 
+		BoundingVolumeHierarchy m_MeshHierarchy;
+
+		std::vector<MeshInstance>										 m_MeshInstances		= {};
+		std::vector<uint32_t>											 m_FreeMeshInstances	= {};
+		std::map<std::pair<uint64_t, Nexus::Graphics::Mesh *>, uint32_t> m_MeshInstanceLookup	= {};
+		std::vector<uint32_t>											 m_VisibleMeshInstances = {};
+		std::vector<MeshDrawBatch>										 m_MeshDrawBatches		= {};
+		std::vector<ModelInstanceData>									 m_ModelInstanceData	= {};
+		CullingStatistics												 m_CullingStatistics	= {};
+		LodSelectionSettings											 m_LodSettings			= {};
+		uint64_t														 m_FrameIndex			= 0;
+		TextureStreamer													*m_TextureStreamer		= nullptr;
+
 		Nexus::Ref<Nexus::Graphics::Texture> m_DefaultTexture = nullptr;
 	};
 }	 // namespace Nexus::Graphics
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Nexus-Core/nxpch.hpp"
+
+#include "Nexus-Core/ECS/ComponentRegistry.hpp"
+#include "Nexus-Core/ECS/Registry.hpp"
+
+namespace Nexus::BinaryScene
+{
+	/// @brief The version written into the header of new binary scenes, files with a different version are rejected when loading
+	constexpr uint16_t c_Version = 1;
+
+	/// @brief The file extension used for binary scenes, the YAML .scene file remains the source that these are built from
+	constexpr const char *c_Extension = ".scenebin";
+
+	/// @brief The parts of a scene that are stored alongside its entities and components
+	struct SceneDescription
+	{
+		std::string Name		= {};
+		glm::vec4	ClearColour = {1.0f, 1.0f, 1.0f, 1.0f};
+		std::string CubemapPath = {};
+	};
+
+	/// @brief Writes a scene to a binary file. The file is made up of a header followed by chunks, one for the scene description, one for
+	/// the entities and one per component type. Trivially copyable components are stored as their raw bytes so they can be copied straight
+	/// into component storage when loading, all other components are stored using their stream operators.
+	/// @param filepath An absolute path to write the file to, any existing file is replaced
+	/// @param description The name and environment of the scene
+	/// @param registry The registry containing the scene's entities and components
+	/// @param components The registered components, keyed by type name
+	NX_API void Write(const std::string									 &filepath,
+					  const SceneDescription							 &description,
+					  ECS::Registry										 &registry,
+					  const std::map<std::string, ECS::ComponentStorage> &components);
+
+	/// @brief Loads a binary scene into a registry. The file is memory mapped and each component chunk is decoded on a worker thread, unless
+	/// the component requires the main thread, before the components are added to the registry on the calling thread.
+	/// @param filepath An absolute path to the file to load
+	/// @param registry The registry to add the entities and components to
+	/// @param components The registered components, keyed by type name
+	/// @return The name and environment of the scene
+	NX_API SceneDescription Read(const std::string									&filepath,
+								 ECS::Registry										&registry,
+								 const std::map<std::string, ECS::ComponentStorage> &components);
+
+	/// @brief Loads a YAML scene, as written by Scene::Serialize, into a registry
+	/// @param filepath An absolute path to the .scene file to load
+	/// @param registry The registry to add the entities and components to
+	/// @param components The registered components, keyed by type name
+	/// @return The name and environment of the scene
+	NX_API SceneDescription ReadYaml(const std::string									&filepath,
+									 ECS::Registry										&registry,
+									 const std::map<std::string, ECS::ComponentStorage> &components);
+
+	/// @brief Converts a YAML scene into a binary scene
+	/// @param yamlFilepath An absolute path to the .scene file to convert
+	/// @param binaryFilepath An absolute path to write the binary scene to
+	/// @param components The registered components, keyed by type name
+	NX_API void ConvertYamlToBinary(const std::string									&yamlFilepath,
+									const std::string									&binaryFilepath,
+									const std::map<std::string, ECS::ComponentStorage> &components);
+}	 // namespace Nexus::BinaryScene
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Nexus-Core/Timings/Timespan.hpp"
+#include "Nexus-Core/nxpch.hpp"
+
+namespace Nexus
+{
+	enum class LoadStatus
+	{
+		Loading,
+		Completed,
+		Cancelled,
+		Failed
+	};
+
+	/// @brief Loads something on a background thread while the main thread keeps running. The worker can hand work that has to happen on
+	/// the main thread (e.g. creating GPU resources) back to the operation, which the main thread then runs in slices by calling Update
+	/// once per frame. Progress is measured in units of work that the worker declares as it discovers them.
+	class NX_API LoadOperation
+	{
+	  public:
+		using WorkerFunc	 = std::function<void(LoadOperation &operation)>;
+		using MainThreadFunc = std::function<void()>;
+
+		LoadOperation() = default;
+
+		/// @brief Cancels the operation and waits for the worker to finish
+		virtual ~LoadOperation();
+
+		LoadOperation(const LoadOperation &)			= delete;
+		LoadOperation &operator=(const LoadOperation &) = delete;
+
+		/// @brief Starts running the worker on a background thread, this can only be called once
+		/// @param worker The function that performs the load, any exception thrown from it causes the operation to fail
+		void Start(WorkerFunc worker);
+
+		/// @brief Runs queued main thread work until the budget is used up, at least one item of work is run on each call so that the
+		/// operation always makes progress. This must be called from the thread that the main thread work expects, e.g. the thread that
+		/// owns the graphics device.
+		/// @param budget The maximum amount of time to spend running work
+		/// @return The status of the operation after running the work
+		LoadStatus Update(TimeSpan budget);
+
+		/// @brief Blocks until the operation has finished, running all of the main thread work on the calling thread
+		/// @return The final status of the operation
+		LoadStatus Wait();
+
+		/// @brief Requests that the operation stops, the worker stops at the next point where it checks IsCancelled and any main thread work
+		/// that has not run yet is discarded
+		void Cancel();
+
+		/// @brief Returns the status of the operation, this only changes from LoadStatus::Loading during a call to Update or Wait
+		LoadStatus GetStatus() const;
+
+		/// @brief Returns whether the operation has stopped, successfully or not
+		bool IsDone() const;
+
+		/// @brief Returns the fraction of the declared work that has been completed, this never decreases
+		/// @return A value between 0 and 1
+		float GetProgress() const;
+
+		/// @brief Returns the reason that the operation failed
+		/// @return The message of the exception that caused the failure, or an empty string
+		std::string GetError() const;
+
+		/// @brief Declares more work that needs to be done before the operation is finished, this is used to calculate the progress
+		/// @param count The number of units of work
+		void AddWork(uint32_t count);
+
+		/// @brief Marks units of work that were declared with AddWork as finished
+		/// @param count The number of units of work
+		void CompleteWork(uint32_t count = 1);
+
+		/// @brief Queues work to run on the main thread, this counts as a unit of work that is complete once it has run. Work queued from the
+		/// same thread runs in the order that it was queued.
+		/// @param work The function to run
+		void EnqueueMainThreadWork(MainThreadFunc work);
+
+		/// @brief Returns whether Cancel has been called, workers should check this between expensive steps
+		bool IsCancelled() const;
+
+	  protected:
+		/// @brief Called on the main thread when the operation completes successfully, before the status changes to LoadStatus::Completed
+		virtual void OnCompleted()
+		{
+		}
+
+		/// @brief Cancels the operation and waits for the worker to finish, derived classes whose members are used by the worker must call
+		/// this from their destructor so that the worker has stopped before the members are destroyed
+		void CancelAndWait();
+
+	  private:
+		/// @brief Runs a single item of main thread work
+		/// @return Whether there was any work to run
+		bool RunNextMainThreadWork();
+
+		/// @brief Moves the operation to its final status if the worker has finished and there is no main thread work left
+		void UpdateStatus();
+
+		void Fail(const std::string &error);
+
+	  private:
+		std::future<void> m_Worker = {};
+
+		mutable std::mutex		   m_Mutex			  = {};
+		std::deque<MainThreadFunc> m_MainThreadWork	  = {};
+		std::string				   m_Error			  = {};
+		std::atomic<LoadStatus>	   m_Status			  = LoadStatus::Loading;
+		std::atomic<bool>		   m_Cancelled		  = false;
+		std::atomic<uint32_t>	   m_TotalWork		  = 0;
+		std::atomic<uint32_t>	   m_CompletedWork	  = 0;
+		mutable std::atomic<float> m_ReportedProgress = 0.0f;
+	};
+}	 // namespace Nexus
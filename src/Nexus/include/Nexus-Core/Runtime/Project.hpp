@@ -57,6 +57,17 @@ namespace Nexus
 
 		void LoadScene(uint32_t index, Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue);
 		void LoadScene(const std::string &name, Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue);
+
+		/// @brief Starts loading a scene in the background, the current scene stays loaded until the new one has finished loading during
+		/// OnUpdate. Starting another load cancels the one in progress.
+		/// @return The operation that is loading the scene, or nullptr if there is no scene at the index
+		Ref<SceneLoadOperation> LoadSceneAsync(uint32_t index, Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue);
+		Ref<SceneLoadOperation> LoadSceneAsync(const std::string &name, Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue);
+
+		/// @brief Returns the scene that is being loaded by LoadSceneAsync, this can be used to display the progress of the load
+		/// @return The operation, or nullptr if no scene is being loaded
+		Ref<SceneLoadOperation> GetPendingSceneLoad() const;
+
 		void CreateNewScene(const std::string &name);
 		void ReloadCurrentScene(Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue);
 
@@ -94,17 +105,23 @@ namespace Nexus
 
 		void		RenderComponentUI(ECS::Registry &registry, ECS::ComponentPtr component, Nexus::Ref<Nexus::Project> project);
 		std::string SerializeComponentToString(ECS::Registry &registry, ECS::ComponentPtr component);
-		void		DeserializeComponentFromString(ECS::Registry	 &registry,
-												   GUID				  guid,
-												   const std::string &displayName,
-												   const std::string &data,
-												   size_t			  entityHierarchyIndex);
+		/// @brief Adds a component to an entity from its string encoding and creates the GPU resources that it references
+		void		DeserializeComponentFromString(ECS::Registry			   &registry,
+												   GUID							guid,
+												   const std::string		   &displayName,
+												   const std::string		   &data,
+												   size_t						entityHierarchyIndex,
+												   Graphics::GraphicsDevice	   *device,
+												   Ref<Graphics::ICommandQueue>	commandQueue);
 		YAML::Node	SerializeComponentToYaml(ECS::Registry &registry, ECS::ComponentPtr component);
-		void		DeserializeComponentFromYaml(ECS::Registry	   &registry,
-												 GUID				guid,
-												 const std::string &displayName,
-												 const YAML::Node  &node,
-												 size_t				entityHierarchyIndex);
+		/// @brief Adds a component to an entity from its YAML encoding and creates the GPU resources that it references
+		void		DeserializeComponentFromYaml(ECS::Registry				 &registry,
+												 GUID						  guid,
+												 const std::string			 &displayName,
+												 const YAML::Node			 &node,
+												 size_t						  entityHierarchyIndex,
+												 Graphics::GraphicsDevice	 *device,
+												 Ref<Graphics::ICommandQueue> commandQueue);
 
 		void				   CreateComponent(const char *typeName, ECS::Registry &registry, const Entity &entity);
 		Assets::AssetRegistry &GetAssetRegistry();
@@ -122,8 +139,9 @@ namespace Nexus
 
 		std::vector<SceneInfo> m_Scenes = {};
 
-		std::unique_ptr<Scene> m_LoadedScene  = nullptr;
-		uint32_t			   m_StartupScene = 0;
+		std::unique_ptr<Scene>	m_LoadedScene	   = nullptr;
+		Ref<SceneLoadOperation> m_PendingSceneLoad = nullptr;
+		uint32_t				m_StartupScene	   = 0;
 
 		Nexus::Utils::SharedLibrary						*m_Library					= nullptr;
 		std::vector<std::string>						 m_AvailableScripts			= {};
@@ -6,6 +6,7 @@
 #include "glm/glm.hpp"
 
 #include "Nexus-Core/ECS/Registry.hpp"
+#include "Nexus-Core/ECS/TransformHierarchy.hpp"
 
 #include "Nexus-Core/Utils/GUID.hpp"
 
@@ -15,6 +16,8 @@
 
 #include "Nexus-Core/Renderer/BatchRenderer.hpp"
 
+#include "Nexus-Core/Runtime/LoadOperation.hpp"
+
 namespace Nexus
 {
 	struct SceneInfo
@@ -39,8 +42,9 @@ namespace Nexus
 		glm::vec4			   ClearColour		  = {1.0f, 1.0f, 1.0f, 1.0f};
 	};
 
-	// forward declaration
+	// forward declarations
 	class Project;
+	class SceneLoadOperation;
 
 	struct NX_API Scene
 	{
@@ -48,6 +52,10 @@ namespace Nexus
 		Scene();
 		void Serialize(const std::string &filepath);
 
+		/// @brief Writes the scene in the binary format, which loads considerably faster than the YAML written by Serialize
+		/// @param filepath An absolute path to write the file to
+		void SerializeBinary(const std::string &filepath);
+
 		void				 AddEmptyEntity();
 		Entity				*GetEntity(GUID id);
 		std::vector<Entity> &GetEntities();
@@ -61,13 +69,37 @@ namespace Nexus
 
 		SceneState GetSceneState();
 
+		/// @brief Rebuilds the world matrices of entities whose Transform has changed since the last call, the matrices of every other
+		/// entity are kept from the previous call. A Transform whose parent is an entity with a Transform is relative to that entity, a
+		/// parent that does not exist or would create a cycle is ignored. This should be called once per frame before any world matrices
+		/// are read.
+		void UpdateTransforms();
+
+		/// @brief Returns the world matrix of an entity's Transform as of the last call to UpdateTransforms
+		/// @param entity The entity to query
+		/// @return The world matrix, or an identity matrix if the entity did not have a Transform when the transforms were last updated
+		const glm::mat4 &GetWorldMatrix(GUID entity) const;
+
 	  public:
+		/// @brief Loads a scene from the scene directory, blocking until the scene and all of its resources have been loaded. The binary
+		/// version of the scene is used if it is at least as new as the YAML file.
+		/// @return The scene, or nullptr if it could not be loaded
 		static Scene *Deserialize(const SceneInfo			  &info,
 								  const std::string			  &sceneDirectory,
 								  Project					  *project,
 								  Graphics::GraphicsDevice	  *device,
 								  Ref<Graphics::ICommandQueue> commandQueue);
 
+		/// @brief Starts loading a scene from the scene directory in the background. The scene file is read and the models, textures and
+		/// environment map that it references are decoded on worker threads, the GPU resources are then created when the returned operation
+		/// is updated. This must be called from the thread that owns the graphics device.
+		/// @return The operation that is loading the scene
+		static Ref<SceneLoadOperation> LoadAsync(const SceneInfo			 &info,
+												 const std::string			 &sceneDirectory,
+												 Project					 *project,
+												 Graphics::GraphicsDevice	 *device,
+												 Ref<Graphics::ICommandQueue> commandQueue);
+
 	  public:
 		GUID		  Guid			   = {};
 		std::string	  Name			   = {};
@@ -75,7 +107,42 @@ namespace Nexus
 		ECS::Registry Registry		   = {};
 		Project		 *ParentProject	   = nullptr;
 
+	  private:
+		/// @brief The node that holds the world matrix of an entity, along with the Transform that the matrix was built from
+		struct EntityTransform
+		{
+			ECS::TransformNode Node		  = {};
+			glm::vec3		   Position	  = {};
+			glm::vec3		   Rotation	  = {};
+			glm::vec3		   Scale	  = {};
+			uint64_t		   Parent	  = 0;
+			uint64_t		   LastUpdate = 0;
+		};
+
 	  private:
 		SceneState m_SceneState = SceneState::Stopped;
+
+		ECS::TransformHierarchy						  m_TransformHierarchy = {};
+		std::unordered_map<uint64_t, EntityTransform> m_EntityTransforms   = {};
+		uint64_t									  m_TransformUpdate	   = 0;
+	};
+
+	/// @brief A scene that is being loaded by Scene::LoadAsync, the scene must not be used until the operation has completed
+	class NX_API SceneLoadOperation : public LoadOperation
+	{
+	  public:
+		explicit SceneLoadOperation(std::unique_ptr<Scene> scene);
+		~SceneLoadOperation();
+
+		/// @brief Returns the scene being loaded
+		/// @return The scene, or nullptr if it has been taken
+		Scene *GetScene();
+
+		/// @brief Takes ownership of the scene once the operation has completed
+		/// @return The scene, or nullptr if the operation has not completed successfully
+		std::unique_ptr<Scene> TakeScene();
+
+	  private:
+		std::unique_ptr<Scene> m_Scene = nullptr;
 	};
 }	 // namespace Nexus
\ No newline at end of file
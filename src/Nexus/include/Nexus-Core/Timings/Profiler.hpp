@@ -1,46 +1,204 @@
 #pragma once
 
-#include "Nexus-Core/Timings/Profiler.hpp"
 #include "Nexus-Core/Timings/Timespan.hpp"
 #include "Nexus-Core/nxpch.hpp"
 #include "tracy/Tracy.hpp"
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+	#define NX_PROFILER_USE_TSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+	#include <x86intrin.h>
+	#define NX_PROFILER_USE_TSC
+#endif
+
+namespace Nexus::Graphics
+{
+	class TimingQuery;
+}
+
 namespace Nexus::Timings
 {
+	/// @brief A scope that was recorded by the profiler, the name must point to storage that outlives the profiler (e.g. a string literal)
+	struct ProfileEvent
+	{
+		const char *Name	 = nullptr;
+		uint64_t	Begin	 = 0;
+		uint64_t	End		 = 0;
+		uint32_t	ThreadId = 0;
+	};
+
 	struct ProfileResult
 	{
-		std::string Name = {};
+		const char *Name = nullptr;
 		TimeSpan	Time = {};
 	};
 
+	/// @brief A scope within a capture, referring to its name by index so that the capture can be stored and loaded again
+	struct ProfileCaptureEvent
+	{
+		uint32_t NameIndex = 0;
+		uint32_t ThreadId  = 0;
+		uint64_t Begin	   = 0;
+		uint64_t End	   = 0;
+	};
+
+	/// @brief A self-contained copy of the events collected by the profiler that can be written to disk
+	struct NX_API ProfileCapture
+	{
+		/// @brief The rate of the clock that the event times are measured in
+		double TicksPerSecond = 1'000'000'000.0;
+
+		/// @brief The time that all event times are relative to
+		uint64_t StartTicks = 0;
+
+		std::vector<std::string>		 Names	= {};
+		std::vector<ProfileCaptureEvent> Events = {};
+
+		/// @brief Writes the capture in the Chrome trace event format, which can be opened in chrome://tracing or Perfetto
+		void WriteChromeTrace(std::ostream &stream) const;
+
+		/// @brief Writes the capture in a compact binary format that can be read back with ReadBinary
+		void WriteBinary(std::ostream &stream) const;
+
+		/// @brief Reads a capture that was written with WriteBinary
+		static ProfileCapture ReadBinary(std::istream &stream);
+	};
+
+	/// @brief Collects timed scopes from any number of threads. Each thread records into its own fixed size ring buffer without locking or
+	/// allocating (apart from creating the buffer the first time the thread records anything), and Flush moves the events out of the
+	/// buffers while the threads keep recording. Events that arrive while a buffer is full are dropped rather than blocking the thread. The
+	/// buffer of a thread that exits is reused by a later thread once its events have been flushed.
+	///
+	/// Most of the cost of a scope is reading the clock twice, storing the event takes around 10 ns. The timestamp counter is fast on bare
+	/// metal but can take around 20 ns to read under some hypervisors, which puts a scope at 45-60 ns there rather than nearer 20 ns.
 	class NX_API Profiler
 	{
 	  public:
-		void							  AddResult(const std::string &name, TimeSpan timespan);
+		/// @brief The number of events that each thread can record between flushes
+		static constexpr uint32_t c_ThreadBufferCapacity = 1u << 14;
+
+		/// @brief The thread id used for events measured on the GPU
+		static constexpr uint32_t c_GpuThreadId = UINT32_MAX;
+
+		~Profiler();
+
+		Profiler(const Profiler &)			  = delete;
+		Profiler &operator=(const Profiler &) = delete;
+
+		/// @brief Records a scope on the calling thread
+		/// @param name The name of the scope, this must point to storage that outlives the profiler
+		/// @param begin The time that the scope began, as returned by GetTicks
+		/// @param end The time that the scope ended, as returned by GetTicks
+		void Record(const char *name, uint64_t begin, uint64_t end);
+
+		/// @brief Records the time measured by a GPU timing query on a separate GPU track. GPU timing queries only report an elapsed time,
+		/// so the event is placed at the time the work was submitted. This resolves the query, so it should be called once the GPU has
+		/// finished the work.
+		/// @param name The name of the event, this must point to storage that outlives the profiler
+		/// @param query The query that timed the GPU work
+		/// @param submitTicks The time that the work was submitted, as returned by GetTicks
+		void RecordGpu(const char *name, Graphics::TimingQuery &query, uint64_t submitTicks);
+
+		/// @brief Moves the events recorded by every thread into the profiler's list of events. This does not block the threads that are
+		/// recording, and can be called from any thread.
+		void Flush();
+
+		/// @brief Returns the events collected by the previous calls to Flush
+		const std::vector<ProfileEvent> &GetEvents() const;
+
+		/// @brief Returns the name and duration of each of the events collected by the previous calls to Flush
 		const std::vector<ProfileResult> &GetResults() const;
-		void							  Reset();
+
+		/// @brief Returns the number of events that were dropped because a thread's buffer was full
+		uint64_t GetDroppedEventCount() const;
+
+		/// @brief Returns the number of thread buffers that have been created, which is the largest number of threads that have been
+		/// recording at the same time (plus any threads whose buffers still held events when a new thread started recording)
+		size_t GetThreadBufferCount() const;
+
+		/// @brief Removes the events collected by the previous calls to Flush
+		void Reset();
+
+		/// @brief Creates a copy of the collected events that no longer depends on the profiler
+		ProfileCapture CreateCapture() const;
+
+		/// @brief Returns the rate of the clock returned by GetTicks, calibrated against std::chrono::steady_clock
+		double GetTicksPerSecond() const;
+
+		void SetEnabled(bool enabled);
+		bool IsEnabled() const;
 
 		static Profiler &Get();
 
+		/// @brief Returns the current time in the profiler's clock, this reads the CPU's timestamp counter where it is available
+		static inline uint64_t GetTicks()
+		{
+#if defined(NX_PROFILER_USE_TSC)
+			return __rdtsc();
+#else
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+		}
+
+	  private:
+		struct ThreadBuffer;
+		struct ThreadBufferOwner;
+
+		Profiler();
+
+		/// @brief Returns the calling thread's buffer, creating it if this is the first event that the thread has recorded
+		ThreadBuffer *GetThreadBuffer();
+
+		void Push(ThreadBuffer *buffer, const ProfileEvent &event);
+
 	  private:
+		std::atomic<ThreadBuffer *> m_Buffers	   = nullptr;
+		std::atomic<uint32_t>		m_NextThreadId = 0;
+		std::atomic<bool>			m_Enabled	   = true;
+
+		uint64_t m_StartTicks		= 0;
+		uint64_t m_StartNanoseconds = 0;
+
+		mutable std::mutex		   m_Mutex;
+		std::vector<ProfileEvent>  m_Events	 = {};
 		std::vector<ProfileResult> m_Results = {};
-		Profiler()							 = default;
+	};
+
+	/// @brief Records the time between its construction and destruction as a scope on the calling thread
+	class ProfileScope
+	{
+	  public:
+		explicit ProfileScope(const char *name) : m_Name(name), m_Begin(Profiler::GetTicks())
+		{
+		}
+
+		~ProfileScope()
+		{
+			Profiler::Get().Record(m_Name, m_Begin, Profiler::GetTicks());
+		}
+
+		ProfileScope(const ProfileScope &)			  = delete;
+		ProfileScope &operator=(const ProfileScope &) = delete;
+
+	  private:
+		const char *m_Name	= nullptr;
+		uint64_t	m_Begin = 0;
 	};
 }	 // namespace Nexus::Timings
 
 // #define NX_PROFILING_ENABLE
 
+#define NX_PROFILE_CONCAT_INNER(a, b) a##b
+#define NX_PROFILE_CONCAT(a, b)		  NX_PROFILE_CONCAT_INNER(a, b)
+
 #if defined(NX_PROFILING_ENABLE)
 	#define NX_PROFILE_FUNCTION()                                                                                                                    \
-		do {                                                                                                                                         \
-			Nexus::Timings::ProfilingTimer timer("Function");                                                                                        \
-			timer.OnStop.Bind([&](Nexus::TimeSpan timespan) { Nexus::Timings::Profiler::Get().AddResult(timer.GenerateName(), timespan); });         \
-			ZoneScoped;                                                                                                                              \
-		} while (0)
+		Nexus::Timings::ProfileScope NX_PROFILE_CONCAT(nxProfileScope, __LINE__)(std::source_location::current().function_name());                 \
+		ZoneScoped
 
 	#define NX_PROFILE_SCOPE(name)                                                                                                                   \
-		Nexus::Timings::ProfilingTimer timer(name);                                                                                                  \
-		timer.OnStop.Bind([&](Nexus::TimeSpan timespan) { Nexus::Timings::Profiler::Get().AddResult(timer.GenerateName(), timespan); });             \
+		Nexus::Timings::ProfileScope NX_PROFILE_CONCAT(nxProfileScope, __LINE__)(name);                                                              \
 		ZoneScopedN(name)
 
 	#define NX_MARK_FRAME_END() FrameMark
@@ -49,4 +207,4 @@ namespace Nexus::Timings
 	#define NX_PROFILE_FUNCTION()
 	#define NX_PROFILE_SCOPE(name)
 	#define NX_MARK_FRAME_END()
-#endif
\ No newline at end of file
+#endif
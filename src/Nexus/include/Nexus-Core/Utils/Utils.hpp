@@ -53,13 +53,40 @@ namespace Nexus::Utils
 		return ((b1 - b2) * Cross(a1, a2) - (a1 - a2) * Cross(b1, b2)) * (1.0f / Cross(a1 - a2, b1 - b2));
 	}
 
+	/// @brief Clips a polygon against a single edge in place, reusing a per-thread scratch buffer that keeps its storage between calls
+	/// unless it has grown beyond a few thousand points
 	NX_API void Clip(std::vector<glm::vec2> &points, float x1, float y1, float x2, float y2);
 
+	/// @brief Clips a polygon against a single edge, writing the result into output without allocating once output has enough capacity
+	/// @param input The polygon to clip
+	/// @param output A vector that is cleared and then filled with the clipped polygon, must not alias input
+	/// @param insideSign 1.0f if the inside of the edge is to its right (clockwise clip polygon), -1.0f otherwise
+	NX_API void Clip(std::span<const glm::vec2> input, std::vector<glm::vec2> &output, float x1, float y1, float x2, float y2, float insideSign);
+
 	NX_API std::vector<glm::vec2> SutherlandHodgman(const std::vector<glm::vec2> &subjectPolygon, const std::vector<glm::vec2> &clipPolygon);
 	NX_API Nexus::Graphics::Polygon SutherlandHodgman(const Nexus::Graphics::Polygon &subject, const Nexus::Graphics::Polygon &clip);
 
+	/// @brief Clips a polygon using caller owned storage, repeated calls with the same vectors do not allocate once they have grown large
+	/// enough
+	/// @param subjectPolygon The polygon to clip
+	/// @param clipPolygon The convex polygon to clip against
+	/// @param output Receives the clipped polygon in clockwise order
+	/// @param scratch Temporary storage used while clipping
+	NX_API void SutherlandHodgman(std::span<const glm::vec2> subjectPolygon,
+								  std::span<const glm::vec2> clipPolygon,
+								  std::vector<glm::vec2>	&output,
+								  std::vector<glm::vec2>	&scratch);
+
 	NX_API float FindPolygonArea(std::span<glm::vec2> polygon);
 
+	/// @brief Calculates the signed area of a polygon, positive when the points are counter-clockwise in a y-up coordinate system
+	NX_API float FindSignedPolygonArea(std::span<const glm::vec2> polygon);
+
+	/// @brief Triangulates a simple polygon using an ear clipper that stores the polygon as a linked list and, for larger polygons, indexes
+	/// the vertices by z-order so that each ear test only visits nearby vertices
+	/// @param polygon The outline of the polygon, in either winding order
+	/// @param triangles The indices of the generated triangles are appended to this vector
+	/// @return Whether the polygon could be triangulated
 	NX_API bool Triangulate(const std::vector<glm::vec2> &polygon, std::vector<uint32_t> &triangles);
 
 	NX_API std::vector<Nexus::Graphics::Triangle2D> GenerateGeometry(const std::vector<glm::vec2> &polygon, const std::vector<uint32_t> &indices);
@@ -416,9 +416,94 @@ namespace Nexus::Graphics
 		}
 	};
 
+	/// @brief The ranges that the attributes of a mesh's quantized vertices were encoded from, which are needed to decode them
+	struct VertexDequantization
+	{
+		/// @brief The position that a quantized position of zero decodes to, this is the centre of the mesh's bounds
+		glm::vec3 PositionOffset = {0, 0, 0};
+
+		/// @brief The distance from the offset on each axis that a quantized position of one decodes to
+		glm::vec3 PositionScale = {1, 1, 1};
+
+		/// @brief The texture coordinate that a quantized texture coordinate of zero decodes to
+		glm::vec2 TexCoordOffset = {0, 0};
+
+		/// @brief The size of the range of the mesh's texture coordinates on each axis
+		glm::vec2 TexCoordScale = {1, 1};
+	};
+
+	/// @brief A struct representing the attributes of a VertexPositionTexCoordNormalColourTangentBitangent compressed into 24 bytes. The
+	/// position and texture coordinates are stored relative to the ranges of the mesh, the normal and tangent are stored as octahedral
+	/// coordinates and the bitangent is rebuilt from them in the shader.
+	struct VertexQuantizedPositionTexCoordNormalColourTangent
+	{
+		/// @brief 4 signed normalized 16 bit integers, the first 3 are the position scaled to the mesh's bounds and the fourth is the sign of
+		/// the bitangent
+		glm::i16vec4 Position = {0, 0, 0, 0};
+
+		/// @brief 2 unsigned normalized 16 bit integers representing the texture coordinates scaled to the mesh's range
+		glm::u16vec2 TexCoords = {0, 0};
+
+		/// @brief 2 signed normalized 16 bit integers representing the normal as octahedral coordinates
+		glm::i16vec2 Normal = {0, 0};
+
+		/// @brief 2 signed normalized 16 bit integers representing the tangent as octahedral coordinates
+		glm::i16vec2 Tangent = {0, 0};
+
+		/// @brief 4 unsigned normalized 8 bit integers representing the colour of the vertex
+		glm::u8vec4 Colour = {255, 255, 255, 255};
+
+		/// @brief A static method that returns the vertex buffer layout of this
+		/// vertex type
+		/// @return A VertexBufferLayout object containing the buffer layout of the
+		/// type
+		static Nexus::Graphics::VertexBufferLayout GetLayout()
+		{
+			Nexus::Graphics::VertexBufferLayout layout = {{{Nexus::Graphics::ShaderDataType::R16G16B16A16_SNorm, "TEXCOORD"},
+														   {Nexus::Graphics::ShaderDataType::R16G16_UNorm, "TEXCOORD"},
+														   {Nexus::Graphics::ShaderDataType::R16G16_SNorm, "TEXCOORD"},
+														   {Nexus::Graphics::ShaderDataType::R16G16_SNorm, "TEXCOORD"},
+														   {Nexus::Graphics::ShaderDataType::R8G8B8A8_UNorm, "TEXCOORD"}},
+														  sizeof(VertexQuantizedPositionTexCoordNormalColourTangent),
+														  StepRate::Vertex};
+			return layout;
+		}
+	};
+
+	struct MeshData;
+
 	namespace Utilities
 	{
+		/// @brief Generates tangents and bitangents for a list of triangles where every three vertices form a triangle
+		/// @param vertices The vertices of the triangles
+		/// @return The vertices with a tangent frame, in the same order
 		NX_API std::vector<VertexPositionTexCoordNormalTangentBitangent> GenerateTangentAndBinormals(
 			const std::vector<Nexus::Graphics::VertexPositionTexCoordNormal> &vertices);
-	}
+
+		/// @brief Generates tangents and bitangents for an indexed mesh without duplicating any of its vertices
+		/// @param vertices The vertices of the mesh
+		/// @param indices The indices of the mesh's triangles
+		/// @param maxThreads The number of threads that large meshes can be split across, 0 uses every hardware thread
+		/// @return The vertices with a tangent frame, in the same order so that the indices can still be used
+		NX_API std::vector<VertexPositionTexCoordNormalTangentBitangent> GenerateTangentAndBinormals(
+			const std::vector<Nexus::Graphics::VertexPositionTexCoordNormal> &vertices,
+			const std::vector<uint32_t>										&indices,
+			uint32_t														 maxThreads = 0);
+
+		/// @brief Replaces the tangents and bitangents of an indexed mesh. Each triangle's tangent is projected onto the plane of each of its
+		/// vertices' normals and weighted by the angle of the triangle at that vertex, in the same way as MikkTSpace, and the sums are then
+		/// orthonormalised against the normal. The bitangent is the cross product of the normal and tangent, flipped where the texture
+		/// coordinates are mirrored.
+		/// @param vertices The vertices to update, their positions, texture coordinates and normals are used as inputs
+		/// @param indices The indices of the mesh's triangles
+		/// @param maxThreads The number of threads that large meshes can be split across, 0 uses every hardware thread
+		NX_API void GenerateTangents(std::span<VertexPositionTexCoordNormalTangentBitangent> vertices,
+									 std::span<const uint32_t>								 indices,
+									 uint32_t												 maxThreads = 0);
+
+		/// @brief Replaces the tangents and bitangents of the vertices of a mesh
+		/// @param mesh The mesh to update
+		/// @param maxThreads The number of threads that large meshes can be split across, 0 uses every hardware thread
+		NX_API void GenerateTangents(MeshData &mesh, uint32_t maxThreads = 0);
+	}	 // namespace Utilities
 }	 // namespace Nexus::Graphics
\ No newline at end of file
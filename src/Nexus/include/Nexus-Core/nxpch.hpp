@@ -6,9 +6,12 @@
 #include <algorithm>
 #include <any>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
 #include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <ctime>
 #include <deque>
 #include <filesystem>
@@ -22,8 +25,11 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <numbers>
+#include <numeric>
 #include <optional>
+#include <queue>
 #include <random>
 #include <set>
 #include <source_location>
@@ -31,6 +37,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
@@ -52,13 +52,42 @@ namespace Nexus
 
 		m_AudioDevice = std::unique_ptr<Audio::AudioDevice>(Nexus::CreateAudioDevice(spec.AudioAPI));
 
-		m_Window->SetRenderFunction([&](Nexus::TimeSpan time) { Render(time); });
+		if (spec.UseRenderThread)
+		{
+			m_RenderThread = std::make_unique<Graphics::RenderThread>(
+				[&](const Graphics::FramePacket &packet)
+				{
+					m_GraphicsDevice->GetFrameTracker().BeginFrame();
+					RenderFramePacket(packet);
+				},
+				spec.MaxQueuedFrames);
+
+			m_Window->SetRenderFunction(
+				[&](Nexus::TimeSpan time)
+				{
+					std::unique_ptr<Graphics::FramePacket> packet = ExtractFramePacket(time);
+					packet->Time								  = time;
+					m_RenderThread->Submit(std::move(packet));
+				});
+		}
+		else
+		{
+			m_Window->SetRenderFunction(
+				[&](Nexus::TimeSpan time)
+				{
+					m_GraphicsDevice->GetFrameTracker().BeginFrame();
+					Render(time);
+				});
+		}
+
 		m_Window->SetUpdateFunction([&](Nexus::TimeSpan time) { Update(time); });
 		m_Window->SetTickFunction([&](Nexus::TimeSpan time) { Tick(time); });
 	}
 
 	Application::~Application()
 	{
+		// the render thread finishes its queued frames before the devices that it renders with are destroyed
+		m_RenderThread.reset();
 	}
 
 	void Application::MainLoop()
@@ -139,6 +168,14 @@ namespace Nexus
 		return m_AudioDevice.get();
 	}
 
+	void Application::WaitForRenderThread()
+	{
+		if (m_RenderThread)
+		{
+			m_RenderThread->WaitForIdle();
+		}
+	}
+
 	bool Application::IsRunning()
 	{
 		return m_Running;
@@ -4,13 +4,18 @@
 #include "assimp/postprocess.h"
 #include "assimp/scene.h"
 
+#include "Nexus-Core/Graphics/MeshOptimizer.hpp"
+#include "Nexus-Core/Graphics/MeshSimplifier.hpp"
+#include "Nexus-Core/Graphics/PixelConversion.hpp"
+#include "Nexus-Core/Graphics/VertexQuantization.hpp"
 #include "Nexus-Core/Runtime/Project.hpp"
+#include "Nexus-Core/Vertex.hpp"
 
 #include "stb_image.h"
 
 namespace Nexus::Processors
 {
-	void ProcessMesh(aiMesh *mesh, const aiScene *scene, std::vector<Graphics::MeshData> &meshes, Graphics::GraphicsDevice *device)
+	void ProcessMesh(aiMesh *mesh, const aiScene *scene, std::vector<Graphics::MeshData> &meshes)
 	{
 		Graphics::MeshData meshData = {};
 
@@ -65,6 +70,7 @@ namespace Nexus::Processors
 			}
 
 			meshData.vertices.push_back(vertex);
+			meshData.bounds.Expand(vertex.Position);
 		}
 
 		for (unsigned int i = 0; i < mesh->mNumFaces; i++)
@@ -73,184 +79,137 @@ namespace Nexus::Processors
 			for (unsigned int j = 0; j < face.mNumIndices; j++) { meshData.indices.push_back(face.mIndices[j]); }
 		}
 
+		// tangents that are stored in the file are kept, otherwise they are generated from the shared vertices rather than by assimp
+		if (!mesh->HasTangentsAndBitangents())
+		{
+			Graphics::Utilities::GenerateTangents(meshData);
+		}
+
+		Graphics::MeshOptimizationReport report = Graphics::MeshOptimizer::OptimizeMesh(meshData);
+		NX_LOG("Optimized mesh '{}': {} -> {} vertices, ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}",
+			   mesh->mName.C_Str(),
+			   report.VerticesBefore,
+			   report.VerticesAfter,
+			   report.Before.ACMR,
+			   report.After.ACMR,
+			   report.Before.ATVR,
+			   report.After.ATVR);
+
+		// the levels of detail are created after optimizing, so that they keep the optimized triangle order and use the same vertices
+		Graphics::MeshSimplifier::GenerateLods(meshData);
+
 		meshData.name		   = std::string(mesh->mName.C_Str());
 		meshData.materialIndex = mesh->mMaterialIndex;
 		meshes.push_back(meshData);
 	}
 
-	void ProcessNode(aiNode										  *node,
-					 const aiScene								  *scene,
-					 const std::vector<Nexus::Graphics::Material> &materials,
-					 std::vector<Graphics::MeshData>			  &meshData,
-					 Graphics::GraphicsDevice					  *device)
+	void ProcessNode(aiNode *node, const aiScene *scene, std::vector<Graphics::MeshData> &meshData)
 	{
 		for (unsigned int i = 0; i < node->mNumMeshes; i++)
 		{
 			aiMesh *mesh = scene->mMeshes[node->mMeshes[i]];
-			ProcessMesh(mesh, scene, meshData, device);
+			ProcessMesh(mesh, scene, meshData);
 		}
 
-		for (unsigned int i = 0; i < node->mNumChildren; i++) { ProcessNode(node->mChildren[i], scene, materials, meshData, device); }
+		for (unsigned int i = 0; i < node->mNumChildren; i++) { ProcessNode(node->mChildren[i], scene, meshData); }
 	}
 
-	Nexus::Ref<Nexus::Graphics::Texture> LoadEmbeddedTexture(const aiTexture				 *texture,
-															 Nexus::Graphics::GraphicsDevice *device,
-															 Ref<Graphics::ICommandQueue>	  commandQueue)
+	Graphics::Image LoadEmbeddedImage(const aiTexture *texture)
 	{
-		std::vector<unsigned char> pixels;
-		pixels.reserve(texture->mWidth * texture->mHeight * 4);
-		memcpy(pixels.data(), texture->pcData, pixels.size());
-		Nexus::Utils::FlipPixelsVertically(pixels.data(), texture->mWidth, texture->mHeight, Graphics::PixelFormat::R8_G8_B8_A8_UNorm);
-
-		Nexus::Graphics::TextureDescription textureSpec = {};
-		textureSpec.Format								= Nexus::Graphics::PixelFormat::R8_G8_B8_A8_UNorm;
-		textureSpec.MipLevels							= 1;
-		textureSpec.DepthOrArrayLayers					= 1;
-		textureSpec.Width								= texture->mWidth;
-		textureSpec.Height								= texture->mHeight;
-		textureSpec.Type								= Nexus::Graphics::TextureType::Texture2D;
-		textureSpec.Usage								= Nexus::Graphics::TextureUsage_Sampled;
-
-		Nexus::Ref<Nexus::Graphics::Texture> createdTexture = Nexus::Ref<Nexus::Graphics::Texture>(device->CreateTexture(textureSpec));
-
-		Graphics::DeviceBufferDescription bufferDesc = {};
-		bufferDesc.Access							 = Graphics::BufferMemoryAccess::Upload;
-		bufferDesc.Usage							 = BUFFER_USAGE_NONE;
-		bufferDesc.SizeInBytes						 = pixels.size();
-		bufferDesc.StrideInBytes					 = pixels.size();
-		Ref<Graphics::DeviceBuffer> buffer			 = device->CreateDeviceBuffer(bufferDesc);
-
-		Ref<Graphics::CommandList> cmdList = commandQueue->CreateCommandList();
-
-		return createdTexture;
+		// a height of zero means that the texture is stored in a compressed format such as PNG
+		if (texture->mHeight == 0)
+		{
+			return Graphics::Image::FromMemory(texture->pcData, texture->mWidth, Graphics::PixelFormat::R8_G8_B8_A8_UNorm);
+		}
+
+		Graphics::Image image = {};
+		image.Width			  = texture->mWidth;
+		image.Height		  = texture->mHeight;
+		image.Format		  = Graphics::PixelFormat::R8_G8_B8_A8_UNorm;
+		image.Pixels.resize((size_t)image.Width * image.Height * 4);
+
+		// uncompressed texels are stored as BGRA
+		Graphics::SwapRedAndBlue(reinterpret_cast<const uint8_t *>(texture->pcData),
+								 reinterpret_cast<uint8_t *>(image.Pixels.data()),
+								 (size_t)image.Width * image.Height);
+
+		image.FlipVertically();
+		return image;
 	}
 
-	Nexus::Ref<Nexus::Graphics::Texture> LoadTextureFile(const std::string				 &filename,
-														 const std::string				 &directory,
-														 bool							  generateMips,
-														 Nexus::Graphics::GraphicsDevice *device,
-														 Ref<Graphics::ICommandQueue>	  commandQueue)
+	Graphics::Image LoadMaterialImage(const aiScene *scene, const aiString &path, const std::string &directory)
 	{
-		std::string texturePath = directory + std::string("/") + filename;
-
-		Nexus::Ref<Nexus::Graphics::Texture> texture = nullptr;
+		if (const aiTexture *embeddedTexture = scene->GetEmbeddedTexture(path.C_Str()))
+		{
+			return LoadEmbeddedImage(embeddedTexture);
+		}
 
+		std::string texturePath = directory + std::string("/") + path.C_Str();
 		if (std::filesystem::is_regular_file(texturePath))
 		{
-			texture = device->CreateTexture2D(commandQueue, texturePath, generateMips);
+			return Graphics::Image::FromFile(texturePath, Graphics::PixelFormat::R8_G8_B8_A8_UNorm);
 		}
 
-		return texture;
+		return {};
 	}
 
-	std::vector<Nexus::Graphics::Material> ImportMaterials(const aiScene				   *scene,
-														   const std::string			   &directory,
-														   Nexus::Graphics::GraphicsDevice *device,
-														   Ref<Graphics::ICommandQueue>		commandQueue)
+	std::vector<MaterialSourceData> ImportMaterials(const aiScene *scene, const std::string &directory)
 	{
-		std::vector<Nexus::Graphics::Material> materials;
+		std::vector<MaterialSourceData> materials;
 		materials.reserve(scene->mNumMaterials);
 
 		for (uint32_t i = 0; i < scene->mNumMaterials; i++)
 		{
-			aiMaterial *material = scene->mMaterials[i];
+			aiMaterial		  *material = scene->mMaterials[i];
+			MaterialSourceData source	= {};
 
 			aiString diffuseTexturePath;
 			aiString normalTexturePath;
 			aiString specularTexturePath;
 
-			glm::vec4 diffuseColour	 = {1, 1, 1, 1};
-			glm::vec4 specularColour = {1, 1, 1, 1};
-
-			bool hasDiffuseTexture	= false;
-			bool hasNormalTexture	= false;
-			bool hasSpecularTexture = false;
-
 			if (material->Get(AI_MATKEY_TEXTURE(aiTextureType_DIFFUSE, 0), diffuseTexturePath) == AI_SUCCESS)
 			{
-				hasDiffuseTexture = true;
+				source.DiffuseImage = LoadMaterialImage(scene, diffuseTexturePath, directory);
 			}
 
 			if (material->Get(AI_MATKEY_TEXTURE(aiTextureType_NORMALS, 0), normalTexturePath) == AI_SUCCESS)
 			{
-				hasNormalTexture = true;
+				source.NormalImage = LoadMaterialImage(scene, normalTexturePath, directory);
 			}
 
 			if (material->Get(AI_MATKEY_TEXTURE(aiTextureType_SPECULAR, 0), specularTexturePath) == AI_SUCCESS)
 			{
-				hasSpecularTexture = true;
+				source.SpecularImage = LoadMaterialImage(scene, specularTexturePath, directory);
 			}
 
 			aiColor4D assimpDiffuseColour;
 			if (material->Get(AI_MATKEY_COLOR_DIFFUSE, assimpDiffuseColour) == AI_SUCCESS)
 			{
-				diffuseColour.r = assimpDiffuseColour.r;
-				diffuseColour.g = assimpDiffuseColour.g;
-				diffuseColour.b = assimpDiffuseColour.b;
-				diffuseColour.a = assimpDiffuseColour.a;
+				source.DiffuseColour = {assimpDiffuseColour.r, assimpDiffuseColour.g, assimpDiffuseColour.b, assimpDiffuseColour.a};
 			}
 
 			aiColor4D assimpSpecularColour;
 			if (material->Get(AI_MATKEY_COLOR_SPECULAR, assimpSpecularColour) == AI_SUCCESS)
 			{
-				specularColour.r = assimpSpecularColour.r;
-				specularColour.g = assimpSpecularColour.g;
-				specularColour.b = assimpSpecularColour.b;
-				specularColour.a = assimpSpecularColour.a;
+				source.SpecularColour = {assimpSpecularColour.r, assimpSpecularColour.g, assimpSpecularColour.b, assimpSpecularColour.a};
 			}
 
-			Nexus::Ref<Nexus::Graphics::Texture> diffuseTexture	 = nullptr;
-			Nexus::Ref<Nexus::Graphics::Texture> normalTexture	 = nullptr;
-			Nexus::Ref<Nexus::Graphics::Texture> specularTexture = nullptr;
-
-			if (hasDiffuseTexture)
-			{
-				if (auto embeddedTexture = scene->GetEmbeddedTexture(diffuseTexturePath.C_Str()))
-				{
-					diffuseTexture = LoadEmbeddedTexture(embeddedTexture, device, commandQueue);
-				}
-				else
-				{
-					diffuseTexture = LoadTextureFile(diffuseTexturePath.C_Str(), directory, true, device, commandQueue);
-				}
-			}
-
-			if (hasNormalTexture)
-			{
-				if (auto embeddedTexture = scene->GetEmbeddedTexture(normalTexturePath.C_Str()))
-				{
-					normalTexture = LoadEmbeddedTexture(embeddedTexture, device, commandQueue);
-				}
-				else
-				{
-					normalTexture = LoadTextureFile(normalTexturePath.C_Str(), directory, true, device, commandQueue);
-				}
-			}
-
-			if (hasSpecularTexture)
-			{
-				if (auto embeddedTexture = scene->GetEmbeddedTexture(specularTexturePath.C_Str()))
-				{
-					specularTexture = LoadEmbeddedTexture(embeddedTexture, device, commandQueue);
-				}
-				else
-				{
-					specularTexture = LoadTextureFile(specularTexturePath.C_Str(), directory, true, device, commandQueue);
-				}
-			}
-
-			Nexus::Graphics::Material mat = {};
-			mat.DiffuseTexture			  = diffuseTexture;
-			mat.NormalTexture			  = normalTexture;
-			mat.SpecularTexture			  = specularTexture;
+			materials.push_back(std::move(source));
+		}
 
-			mat.DiffuseColour  = {diffuseColour.r, diffuseColour.g, diffuseColour.b, diffuseColour.a};
-			mat.SpecularColour = {specularColour.r, specularColour.g, specularColour.b, specularColour.a};
+		return materials;
+	}
 
-			materials.push_back(mat);
+	Nexus::Ref<Nexus::Graphics::Texture> CreateMaterialTexture(const Graphics::Image		   &image,
+															   Nexus::Graphics::GraphicsDevice *device,
+															   Ref<Graphics::ICommandQueue>		commandQueue)
+	{
+		if (image.IsEmpty())
+		{
+			return nullptr;
 		}
 
-		return materials;
+		return device->CreateTexture2D(commandQueue, image, true);
 	}
 
 	void WriteBinaryModelFile(const std::string &filepath, const std::vector<Graphics::MeshData> &meshes)
@@ -278,14 +237,19 @@ namespace Nexus::Processors
 	ModelImportData AssimpProcessor::LoadModel(const std::string		   &filepath,
 											   Graphics::GraphicsDevice	   *device,
 											   Ref<Graphics::ICommandQueue> commandQueue)
+	{
+		ModelSourceData source = ReadModel(filepath);
+		return ModelImportData {.meshes = source.meshes, .materials = CreateMaterials(source.materials, device, commandQueue)};
+	}
+
+	ModelSourceData AssimpProcessor::ReadModel(const std::string &filepath)
 	{
 		Assimp::Importer	  importer = {};
 		std::filesystem::path path	   = filepath;
 
 		unsigned int flags = aiProcess_JoinIdenticalVertices | aiProcess_Triangulate | aiProcess_FindInvalidData | aiProcess_GenSmoothNormals |
-							 aiProcess_ImproveCacheLocality | aiProcess_CalcTangentSpace | aiProcess_ValidateDataStructure | aiProcess_FindInstances |
-							 aiProcess_GlobalScale | aiProcess_PreTransformVertices | aiProcess_TransformUVCoords | aiProcess_FixInfacingNormals |
-							 aiProcess_MakeLeftHanded;
+							 aiProcess_ValidateDataStructure | aiProcess_FindInstances | aiProcess_GlobalScale | aiProcess_PreTransformVertices |
+							 aiProcess_TransformUVCoords | aiProcess_FixInfacingNormals | aiProcess_MakeLeftHanded;
 
 		importer.SetPropertyBool(AI_CONFIG_IMPORT_NO_SKELETON_MESHES, true);
 		importer.SetPropertyBool(AI_CONFIG_IMPORT_FBX_READ_CAMERAS, false);
@@ -304,41 +268,95 @@ namespace Nexus::Processors
 			return {};
 		}
 
-		std::vector<Graphics::Material> materials = ImportMaterials(scene, path.parent_path().string(), device, commandQueue);
+		std::vector<MaterialSourceData> materials = ImportMaterials(scene, path.parent_path().string());
 		std::vector<Graphics::MeshData> meshData  = {};
 
-		ProcessNode(scene->mRootNode, scene, materials, meshData, device);
+		ProcessNode(scene->mRootNode, scene, meshData);
+
+		return ModelSourceData {.meshes = std::move(meshData), .materials = std::move(materials)};
+	}
+
+	std::vector<Graphics::Material> AssimpProcessor::CreateMaterials(const std::vector<MaterialSourceData> &materials,
+																	 Graphics::GraphicsDevice			   *device,
+																	 Ref<Graphics::ICommandQueue>			commandQueue)
+	{
+		std::vector<Graphics::Material> createdMaterials;
+		createdMaterials.reserve(materials.size());
+
+		for (const MaterialSourceData &source : materials)
+		{
+			Nexus::Graphics::Material mat = {};
+			mat.DiffuseTexture			  = CreateMaterialTexture(source.DiffuseImage, device, commandQueue);
+			mat.NormalTexture			  = CreateMaterialTexture(source.NormalImage, device, commandQueue);
+			mat.SpecularTexture			  = CreateMaterialTexture(source.SpecularImage, device, commandQueue);
+			mat.DiffuseColour			  = source.DiffuseColour;
+			mat.SpecularColour			  = source.SpecularColour;
+			createdMaterials.push_back(mat);
+		}
 
-		return ModelImportData {.meshes = meshData, .materials = materials};
+		return createdMaterials;
 	}
 
 	Ref<Graphics::Model> AssimpProcessor::Import(const std::string			 &filepath,
 												 Graphics::GraphicsDevice	 *device,
-												 Ref<Graphics::ICommandQueue> commandQueue)
+												 Ref<Graphics::ICommandQueue> commandQueue,
+												 bool						  quantizeVertices)
 	{
-		ModelImportData					 importData = LoadModel(filepath, device, commandQueue);
+		return CreateModel(ReadModel(filepath), device, commandQueue, quantizeVertices);
+	}
+
+	Ref<Graphics::Model> AssimpProcessor::CreateModel(const ModelSourceData		   &source,
+													  Graphics::GraphicsDevice	   *device,
+													  Ref<Graphics::ICommandQueue> commandQueue,
+													  bool						   quantizeVertices)
+	{
+		std::vector<Graphics::Material>	 materials = CreateMaterials(source.materials, device, commandQueue);
 		std::vector<Ref<Graphics::Mesh>> meshes;
 
-		for (size_t i = 0; i < importData.meshes.size(); i++)
+		for (size_t i = 0; i < source.meshes.size(); i++)
 		{
-			const Graphics::MeshData &data = importData.meshes[i];
+			const Graphics::MeshData &data = source.meshes[i];
+
+			Nexus::Ref<Nexus::Graphics::DeviceBuffer>	  vertexBuffer   = nullptr;
+			std::optional<Graphics::VertexDequantization> dequantization = {};
+			if (quantizeVertices)
+			{
+				dequantization = Graphics::VertexQuantization::CalculateDequantization(data);
+				std::vector<Graphics::VertexQuantizedPositionTexCoordNormalColourTangent> vertices =
+					Graphics::VertexQuantization::QuantizeVertices(data, *dequantization);
+				vertexBuffer = Nexus::Utils::CreateFilledVertexBuffer(vertices.data(),
+																	  vertices.size() * sizeof(vertices[0]),
+																	  sizeof(vertices[0]),
+																	  device,
+																	  commandQueue);
+			}
+			else
+			{
+				vertexBuffer = Nexus::Utils::CreateFilledVertexBuffer(data.vertices.data(),
+																	  data.vertices.size() * sizeof(data.vertices[0]),
+																	  sizeof(data.vertices[0]),
+																	  device,
+																	  commandQueue);
+			}
 
-			Nexus::Ref<Nexus::Graphics::DeviceBuffer> vertexBuffer =
-				Nexus::Utils::CreateFilledVertexBuffer(data.vertices.data(),
-													   data.vertices.size() * sizeof(data.vertices[0]),
-													   sizeof(data.vertices[0]),
-													   device,
-													   commandQueue);
+			// the levels of detail are stored after the full detail indices in the same index buffer
+			std::vector<uint32_t>				indices = data.indices;
+			std::vector<Graphics::MeshLodRange> lods	= {{.IndexStart = 0, .IndexCount = (uint32_t)data.indices.size(), .Error = 0.0f}};
+			for (const Graphics::MeshLod &lod : data.lods)
+			{
+				lods.push_back({.IndexStart = (uint32_t)indices.size(), .IndexCount = (uint32_t)lod.Indices.size(), .Error = lod.Error});
+				indices.insert(indices.end(), lod.Indices.begin(), lod.Indices.end());
+			}
 
 			Nexus::Ref<Nexus::Graphics::DeviceBuffer> indexBuffer =
-				Nexus::Utils::CreateFilledIndexBuffer(data.indices.data(),
-													  data.indices.size() * sizeof(data.indices[0]),
-													  sizeof(data.indices[0]),
-													  device,
-													  commandQueue);
-
-			Graphics::Material		   material = importData.materials[data.materialIndex];
-			Nexus::Ref<Graphics::Mesh> mesh		= CreateRef<Graphics::Mesh>(vertexBuffer, indexBuffer, material, data.name);
+				Nexus::Utils::CreateFilledIndexBuffer(indices.data(), indices.size() * sizeof(indices[0]), sizeof(indices[0]), device, commandQueue);
+
+			Graphics::Material		   material = materials[data.materialIndex];
+			Nexus::Ref<Graphics::Mesh> mesh		= CreateRef<Graphics::Mesh>(vertexBuffer, indexBuffer, material, data.name, data.bounds, lods);
+			if (dequantization)
+			{
+				mesh->SetVertexDequantization(*dequantization);
+			}
 			meshes.push_back(mesh);
 		}
 
@@ -4,6 +4,7 @@
 #include "libnyquist/Decoders.h"
 
 #include "Nexus-Core/Audio/AudioTypes.hpp"
+#include "Nexus-Core/Audio/SampleConversion.hpp"
 
 namespace Nexus::Audio
 {
@@ -55,6 +56,37 @@ namespace Nexus::Audio
 		}
 	}
 
+	/// @brief Only data that is being reduced from a higher bit depth needs dither, content that was authored at 8 or 16 bits converts
+	/// back to its original values exactly
+	DitherMode GetDitherMode(nqr::PCMFormat format)
+	{
+		switch (format)
+		{
+			case nqr::PCMFormat::PCM_24: return DitherMode::Triangular;
+			default: return DitherMode::None;
+		}
+	}
+
+	/// @brief The available formats are mono or stereo, so any additional channels are dropped, an empty vector is returned if the data
+	/// can be used as it is
+	std::vector<float> FoldToStereo(const nqr::AudioData &data)
+	{
+		std::vector<float> folded = {};
+		if (data.channelCount > 2)
+		{
+			size_t frameCount = data.samples.size() / data.channelCount;
+			folded.resize(frameCount * 2);
+
+			for (size_t frame = 0; frame < frameCount; frame++)
+			{
+				folded[frame * 2]	  = data.samples[frame * data.channelCount];
+				folded[frame * 2 + 1] = data.samples[frame * data.channelCount + 1];
+			}
+		}
+
+		return folded;
+	}
+
 	Ref<AudioBuffer> LoadAudioFileToBuffer(const std::string &filepath, AudioDevice *device, nqr::BaseDecoder *decoder)
 	{
 		Ref<AudioBuffer> buffer = device->CreateAudioBuffer();
@@ -62,13 +94,14 @@ namespace Nexus::Audio
 		nqr::AudioData data;
 		decoder->LoadFromPath(&data, filepath);
 
-		int				   bitsPerSample = nqr::GetFormatBitsPerSample(data.sourceFormat);
-		size_t			   fileSize		 = data.samples.size() * sizeof(float);
-		int				   sampleRate	 = data.sampleRate;
-		Audio::AudioFormat format		 = GetAudioFormat(data.sourceFormat, data.channelCount);
-		const void *const  dataPtr		 = data.samples.data();
+		int				   sampleRate = data.sampleRate;
+		Audio::AudioFormat format	  = GetAudioFormat(data.sourceFormat, data.channelCount);
+
+		std::vector<float>	   folded  = FoldToStereo(data);
+		std::span<const float> samples = folded.empty() ? std::span<const float>(data.samples) : std::span<const float>(folded);
 
-		buffer->SetData(dataPtr, fileSize, format, sampleRate);
+		std::vector<uint8_t> converted = ConvertSamples(samples, format, GetDitherMode(data.sourceFormat));
+		buffer->SetData(converted.data(), converted.size(), format, sampleRate);
 
 		return buffer;
 	}
@@ -84,4 +117,23 @@ namespace Nexus::Audio
 		nqr::Mp3Decoder decoder;
 		return LoadAudioFileToBuffer(filepath, device, &decoder);
 	}
+
+	Ref<AudioClip> AudioLoader::LoadAudioClip(const std::string &filepath)
+	{
+		nqr::AudioData data;
+		nqr::NyquistIO loader;
+		loader.Load(&data, filepath);
+
+		Ref<AudioClip> clip = CreateRef<AudioClip>();
+		clip->ChannelCount	= std::min(data.channelCount, 2);
+		clip->SampleRate	= data.sampleRate;
+		clip->Samples		= FoldToStereo(data);
+
+		if (clip->Samples.empty())
+		{
+			clip->Samples = std::move(data.samples);
+		}
+
+		return clip;
+	}
 }	 // namespace Nexus::Audio
\ No newline at end of file
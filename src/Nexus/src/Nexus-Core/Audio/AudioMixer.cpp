@@ -0,0 +1,378 @@
+#include "Nexus-Core/Audio/AudioMixer.hpp"
+
+#include "Nexus-Core/Audio/SampleConversion.hpp"
+
+#include "glm/gtc/constants.hpp"
+
+namespace Nexus::Audio
+{
+	/// @brief Linearly interpolates frames from a clip, the caller must ensure that every frame read has another frame after it
+	template<uint32_t Channels>
+	void InterpolateFrames(const float *source, double &position, double step, float *output, size_t frameCount)
+	{
+		for (size_t frame = 0; frame < frameCount; frame++)
+		{
+			size_t		 index	 = (size_t)position;
+			float		 t		 = (float)(position - (double)index);
+			const float *current = source + index * Channels;
+
+			for (uint32_t channel = 0; channel < Channels; channel++)
+			{
+				output[frame * Channels + channel] = current[channel] + (current[channel + Channels] - current[channel]) * t;
+			}
+
+			position += step;
+		}
+	}
+
+	AudioMixer::AudioMixer(const AudioMixerDescription &description, Scope<AudioMixerOutput> output)
+		: m_Description(description),
+		  m_Output(std::move(output))
+	{
+		if (!m_Output)
+		{
+			throw std::runtime_error("An audio mixer requires an output");
+		}
+
+		if (m_Description.MaxVoices == 0 || m_Description.BusCount == 0 || m_Description.BlockSize == 0)
+		{
+			throw std::runtime_error("An audio mixer requires at least one voice, bus and frame per block");
+		}
+
+		m_Voices.resize(m_Description.MaxVoices);
+		m_BusGains.resize(m_Description.BusCount, 1.0f);
+
+		// voices are handed out from the back of the list, so fill it in reverse to start with the lowest slot
+		m_FreeVoices.reserve(m_Description.MaxVoices);
+		for (uint32_t i = m_Description.MaxVoices; i > 0; i--) { m_FreeVoices.push_back(i - 1); }
+	}
+
+	VoiceHandle AudioMixer::Play(Ref<AudioClip> clip, const VoiceDescription &description)
+	{
+		if (description.Bus >= m_Description.BusCount)
+		{
+			throw std::runtime_error("Attempting to play a voice on a bus that does not exist");
+		}
+
+		if (!clip || clip->GetFrameCount() == 0 || clip->ChannelCount < 1 || clip->ChannelCount > 2)
+		{
+			return {};
+		}
+
+		if (m_FreeVoices.empty())
+		{
+			// steal the lowest priority voice, preferring the one that has been playing the longest
+			uint32_t stolen = UINT32_MAX;
+			for (uint32_t i = 0; i < (uint32_t)m_Voices.size(); i++)
+			{
+				const Voice &voice = m_Voices[i];
+				if (voice.Description.Priority > description.Priority)
+				{
+					continue;
+				}
+
+				if (stolen == UINT32_MAX || voice.Description.Priority < m_Voices[stolen].Description.Priority ||
+					(voice.Description.Priority == m_Voices[stolen].Description.Priority && voice.StartOrder < m_Voices[stolen].StartOrder))
+				{
+					stolen = i;
+				}
+			}
+
+			if (stolen == UINT32_MAX)
+			{
+				return {};
+			}
+
+			ReleaseVoice(stolen);
+		}
+
+		uint32_t index = m_FreeVoices.back();
+		m_FreeVoices.pop_back();
+
+		Voice &voice	  = m_Voices[index];
+		voice.Clip		  = clip;
+		voice.Description = description;
+		voice.Position	  = 0.0;
+		voice.StartOrder  = m_NextStartOrder++;
+		voice.Active	  = true;
+		m_ActiveVoiceCount++;
+
+		return VoiceHandle {index, voice.Generation};
+	}
+
+	void AudioMixer::Stop(VoiceHandle handle)
+	{
+		if (GetVoice(handle))
+		{
+			ReleaseVoice(handle.Index);
+		}
+	}
+
+	void AudioMixer::StopAll()
+	{
+		for (uint32_t i = 0; i < (uint32_t)m_Voices.size(); i++)
+		{
+			if (m_Voices[i].Active)
+			{
+				ReleaseVoice(i);
+			}
+		}
+	}
+
+	bool AudioMixer::IsPlaying(VoiceHandle handle) const
+	{
+		if (handle.Index >= m_Voices.size())
+		{
+			return false;
+		}
+
+		const Voice &voice = m_Voices[handle.Index];
+		return voice.Active && voice.Generation == handle.Generation;
+	}
+
+	void AudioMixer::SetGain(VoiceHandle handle, float gain)
+	{
+		if (Voice *voice = GetVoice(handle))
+		{
+			voice->Description.Gain = gain;
+		}
+	}
+
+	void AudioMixer::SetPan(VoiceHandle handle, float pan)
+	{
+		if (Voice *voice = GetVoice(handle))
+		{
+			voice->Description.Pan = pan;
+		}
+	}
+
+	void AudioMixer::SetPitch(VoiceHandle handle, float pitch)
+	{
+		if (Voice *voice = GetVoice(handle))
+		{
+			voice->Description.Pitch = pitch;
+		}
+	}
+
+	void AudioMixer::SetBusGain(uint32_t bus, float gain)
+	{
+		m_BusGains.at(bus) = gain;
+	}
+
+	float AudioMixer::GetBusGain(uint32_t bus) const
+	{
+		return m_BusGains.at(bus);
+	}
+
+	uint32_t AudioMixer::GetActiveVoiceCount() const
+	{
+		return m_ActiveVoiceCount;
+	}
+
+	void AudioMixer::Update()
+	{
+		size_t framesRequested = m_Output->GetFramesRequested();
+
+		while (framesRequested > 0)
+		{
+			size_t frameCount = std::min<size_t>(framesRequested, m_Description.BlockSize);
+			m_MixBuffer.resize(frameCount * 2);
+
+			Mix(m_MixBuffer);
+			m_Output->Submit(m_MixBuffer);
+
+			framesRequested -= frameCount;
+		}
+	}
+
+	void AudioMixer::Mix(std::span<float> output)
+	{
+		std::fill(output.begin(), output.end(), 0.0f);
+
+		for (uint32_t i = 0; i < (uint32_t)m_Voices.size(); i++)
+		{
+			Voice &voice = m_Voices[i];
+			if (!voice.Active)
+			{
+				continue;
+			}
+
+			if (!MixVoice(voice, output))
+			{
+				ReleaseVoice(i);
+			}
+		}
+
+		// the master bus is applied once to the whole mix instead of to every voice
+		ApplyGain(output, m_BusGains[0]);
+	}
+
+	AudioMixerOutput *AudioMixer::GetOutput() const
+	{
+		return m_Output.get();
+	}
+
+	AudioMixer::Voice *AudioMixer::GetVoice(VoiceHandle handle)
+	{
+		if (handle.Index >= m_Voices.size())
+		{
+			return nullptr;
+		}
+
+		Voice &voice = m_Voices[handle.Index];
+		if (!voice.Active || voice.Generation != handle.Generation)
+		{
+			return nullptr;
+		}
+
+		return &voice;
+	}
+
+	void AudioMixer::ReleaseVoice(uint32_t index)
+	{
+		Voice &voice = m_Voices[index];
+		voice.Clip	 = nullptr;
+		voice.Active = false;
+		voice.Generation++;
+
+		m_FreeVoices.push_back(index);
+		m_ActiveVoiceCount--;
+	}
+
+	bool AudioMixer::MixVoice(Voice &voice, std::span<float> output)
+	{
+		const AudioClip		   &clip		= *voice.Clip;
+		const VoiceDescription &description = voice.Description;
+		const uint32_t			channels	= clip.ChannelCount;
+		const size_t			clipFrames	= clip.GetFrameCount();
+		const size_t			frameCount	= output.size() / 2;
+
+		float gain = description.Gain * (description.Bus == 0 ? 1.0f : m_BusGains[description.Bus]);
+		float pan  = glm::clamp(description.Pan, -1.0f, 1.0f);
+		float leftGain, rightGain;
+
+		if (channels == 1)
+		{
+			// constant power panning keeps the perceived loudness of a mono voice the same as it moves across the stereo field
+			float angle = (pan + 1.0f) * glm::quarter_pi<float>();
+			leftGain	= std::cos(angle) * gain;
+			rightGain	= std::sin(angle) * gain;
+		}
+		else
+		{
+			leftGain  = std::min(1.0f, 1.0f - pan) * gain;
+			rightGain = std::min(1.0f, 1.0f + pan) * gain;
+		}
+
+		double step = (double)description.Pitch * clip.SampleRate / m_Output->GetSampleRate();
+		if (step <= 0.0)
+		{
+			return true;
+		}
+
+		size_t framesMixed = 0;
+
+		// clips at the output rate are mixed straight from their samples without any resampling
+		if (step == 1.0 && voice.Position == std::floor(voice.Position))
+		{
+			while (framesMixed < frameCount)
+			{
+				size_t position	  = (size_t)voice.Position;
+				size_t framesToMix = std::min(frameCount - framesMixed, clipFrames - position);
+
+				std::span<const float> samples(clip.Samples.data() + position * channels, framesToMix * channels);
+				float				  *destination = output.data() + framesMixed * 2;
+
+				if (channels == 1)
+				{
+					MixMonoToStereo(samples, destination, leftGain, rightGain);
+				}
+				else
+				{
+					MixStereoToStereo(samples, destination, leftGain, rightGain);
+				}
+
+				framesMixed += framesToMix;
+				voice.Position += (double)framesToMix;
+
+				if (voice.Position >= (double)clipFrames)
+				{
+					if (!description.Looping)
+					{
+						return false;
+					}
+
+					voice.Position = 0.0;
+				}
+			}
+
+			return true;
+		}
+
+		// otherwise the voice is linearly interpolated into a scratch buffer which is then mixed in the same way
+		m_ResampleScratch.resize(frameCount * channels);
+		bool finished = false;
+
+		while (framesMixed < frameCount && !finished)
+		{
+			// frames that are far enough from the end of the clip to always have a following frame to interpolate towards
+			double framesBeforeEnd = ((double)(clipFrames - 1) - voice.Position) / step;
+			size_t safeFrames	   = framesBeforeEnd > 0.0 ? std::min(frameCount - framesMixed, (size_t)framesBeforeEnd) : 0;
+			float *destination	   = m_ResampleScratch.data() + framesMixed * channels;
+
+			if (channels == 1)
+			{
+				InterpolateFrames<1>(clip.Samples.data(), voice.Position, step, destination, safeFrames);
+			}
+			else
+			{
+				InterpolateFrames<2>(clip.Samples.data(), voice.Position, step, destination, safeFrames);
+			}
+
+			framesMixed += safeFrames;
+			if (framesMixed == frameCount)
+			{
+				break;
+			}
+
+			// the last frame of the clip either wraps around to the start or is held
+			size_t index = (size_t)voice.Position;
+			size_t next	 = index + 1 < clipFrames ? index + 1 : (description.Looping ? 0 : index);
+			float  t	 = (float)(voice.Position - (double)index);
+
+			for (uint32_t channel = 0; channel < channels; channel++)
+			{
+				float a = clip.Samples[index * channels + channel];
+				float b = clip.Samples[next * channels + channel];
+				m_ResampleScratch[framesMixed * channels + channel] = a + (b - a) * t;
+			}
+
+			framesMixed++;
+			voice.Position += step;
+
+			if (voice.Position >= (double)clipFrames)
+			{
+				if (description.Looping)
+				{
+					voice.Position = std::fmod(voice.Position, (double)clipFrames);
+				}
+				else
+				{
+					finished = true;
+				}
+			}
+		}
+
+		std::span<const float> samples(m_ResampleScratch.data(), framesMixed * channels);
+		if (channels == 1)
+		{
+			MixMonoToStereo(samples, output.data(), leftGain, rightGain);
+		}
+		else
+		{
+			MixStereoToStereo(samples, output.data(), leftGain, rightGain);
+		}
+
+		return !finished;
+	}
+}	 // namespace Nexus::Audio
@@ -0,0 +1,202 @@
+#include "Nexus-Core/Audio/AudioMixerOutput.hpp"
+
+#include "Nexus-Core/Audio/SampleConversion.hpp"
+
+namespace Nexus::Audio
+{
+	NullAudioOutput::NullAudioOutput(uint32_t sampleRate, uint32_t framesPerUpdate) : m_SampleRate(sampleRate), m_FramesPerUpdate(framesPerUpdate)
+	{
+	}
+
+	uint32_t NullAudioOutput::GetSampleRate() const
+	{
+		return m_SampleRate;
+	}
+
+	size_t NullAudioOutput::GetFramesRequested()
+	{
+		return m_FramesPerUpdate;
+	}
+
+	void NullAudioOutput::Submit(std::span<const float> samples)
+	{
+		m_FramesSubmitted += samples.size() / 2;
+	}
+
+	size_t NullAudioOutput::GetFramesSubmitted() const
+	{
+		return m_FramesSubmitted;
+	}
+
+	WavFileAudioOutput::WavFileAudioOutput(const std::string &filepath, uint32_t sampleRate, uint32_t framesPerUpdate)
+		: m_File(filepath, std::ios::binary | std::ios::trunc),
+		  m_SampleRate(sampleRate),
+		  m_FramesPerUpdate(framesPerUpdate)
+	{
+		if (!m_File)
+		{
+			throw std::runtime_error("Failed to open " + filepath + " for writing");
+		}
+
+		// the sizes in the header are not known yet, so they are filled in when the output is destroyed
+		WriteHeader();
+	}
+
+	WavFileAudioOutput::~WavFileAudioOutput()
+	{
+		m_File.seekp(0);
+		WriteHeader();
+	}
+
+	uint32_t WavFileAudioOutput::GetSampleRate() const
+	{
+		return m_SampleRate;
+	}
+
+	size_t WavFileAudioOutput::GetFramesRequested()
+	{
+		return m_FramesPerUpdate;
+	}
+
+	void WavFileAudioOutput::Submit(std::span<const float> samples)
+	{
+		m_ConvertedSamples.resize(samples.size());
+
+		// a different seed is used for each block so the dither noise does not repeat at the block rate
+		ConvertFloatToInt16(samples, m_ConvertedSamples.data(), DitherMode::Triangular, m_DitherSeed++);
+
+		// WAV files are little endian, so the samples need to be swapped on big endian hosts
+		if constexpr (std::endian::native == std::endian::big)
+		{
+			for (int16_t &sample : m_ConvertedSamples) { sample = (int16_t)(((uint16_t)sample << 8) | ((uint16_t)sample >> 8)); }
+		}
+
+		m_File.write(reinterpret_cast<const char *>(m_ConvertedSamples.data()), m_ConvertedSamples.size() * sizeof(int16_t));
+		m_FramesWritten += samples.size() / 2;
+	}
+
+	void WavFileAudioOutput::WriteHeader()
+	{
+		const uint16_t channelCount	 = 2;
+		const uint16_t bitsPerSample = 16;
+		const uint16_t blockAlign	 = channelCount * bitsPerSample / 8;
+		const uint32_t dataSize		 = (uint32_t)(m_FramesWritten * blockAlign);
+
+		auto write16 = [&](uint16_t value)
+		{
+			char bytes[2] = {(char)(value & 0xFF), (char)(value >> 8)};
+			m_File.write(bytes, sizeof(bytes));
+		};
+
+		auto write32 = [&](uint32_t value)
+		{
+			char bytes[4] = {(char)(value & 0xFF), (char)((value >> 8) & 0xFF), (char)((value >> 16) & 0xFF), (char)(value >> 24)};
+			m_File.write(bytes, sizeof(bytes));
+		};
+
+		m_File.write("RIFF", 4);
+		write32(36 + dataSize);
+		m_File.write("WAVE", 4);
+
+		m_File.write("fmt ", 4);
+		write32(16);
+		write16(1);
+		write16(channelCount);
+		write32(m_SampleRate);
+		write32(m_SampleRate * blockAlign);
+		write16(blockAlign);
+		write16(bitsPerSample);
+
+		m_File.write("data", 4);
+		write32(dataSize);
+	}
+
+	AudioDeviceOutput::AudioDeviceOutput(AudioDevice *device, uint32_t sampleRate, uint32_t bufferCount, uint32_t framesPerBuffer)
+		: m_Device(device),
+		  m_SampleRate(sampleRate),
+		  m_FramesPerBuffer(framesPerBuffer)
+	{
+		if (bufferCount < 2)
+		{
+			throw std::runtime_error("An audio device output requires at least two buffers");
+		}
+
+		m_Source = m_Device->CreateAudioSource();
+		m_Source->SetIsRelative(true);
+
+		for (uint32_t i = 0; i < bufferCount; i++) { m_FreeBuffers.push_back(m_Device->CreateAudioBuffer()); }
+		m_PendingSamples.reserve((size_t)m_FramesPerBuffer * 2);
+	}
+
+	AudioDeviceOutput::~AudioDeviceOutput()
+	{
+		m_Device->Stop(m_Source);
+
+		// stopping a source marks all of its buffers as processed so they can be removed
+		while (!m_QueuedBuffers.empty())
+		{
+			m_Source->UnqueueBuffer(m_QueuedBuffers.front());
+			m_QueuedBuffers.pop_front();
+		}
+	}
+
+	uint32_t AudioDeviceOutput::GetSampleRate() const
+	{
+		return m_SampleRate;
+	}
+
+	size_t AudioDeviceOutput::GetFramesRequested()
+	{
+		ReclaimProcessedBuffers();
+
+		size_t capacity = m_FreeBuffers.size() * m_FramesPerBuffer;
+		size_t pending	= m_PendingSamples.size() / 2;
+		return capacity > pending ? capacity - pending : 0;
+	}
+
+	void AudioDeviceOutput::Submit(std::span<const float> samples)
+	{
+		m_PendingSamples.insert(m_PendingSamples.end(), samples.begin(), samples.end());
+
+		const size_t samplesPerBuffer = (size_t)m_FramesPerBuffer * 2;
+		bool		 queued			  = false;
+
+		while (m_PendingSamples.size() >= samplesPerBuffer && !m_FreeBuffers.empty())
+		{
+			Ref<AudioBuffer> buffer = m_FreeBuffers.back();
+			m_FreeBuffers.pop_back();
+
+			buffer->SetData(m_PendingSamples.data(), samplesPerBuffer * sizeof(float), AudioFormat::StereoFloat32, m_SampleRate);
+			m_Source->QueueBuffer(buffer);
+			m_QueuedBuffers.push_back(buffer);
+
+			m_PendingSamples.erase(m_PendingSamples.begin(), m_PendingSamples.begin() + samplesPerBuffer);
+			queued = true;
+		}
+
+		// the source stops by itself if it runs out of buffers, so restart it once there is data again
+		if (queued && m_Source->GetSourceState() != SourceState::Playing)
+		{
+			m_Device->Play(m_Source);
+		}
+	}
+
+	Ref<AudioSource> AudioDeviceOutput::GetSource() const
+	{
+		return m_Source;
+	}
+
+	void AudioDeviceOutput::ReclaimProcessedBuffers()
+	{
+		size_t processed = m_Source->GetNumProcessedBuffers();
+
+		for (size_t i = 0; i < processed && !m_QueuedBuffers.empty(); i++)
+		{
+			Ref<AudioBuffer> buffer = m_QueuedBuffers.front();
+			m_QueuedBuffers.pop_front();
+
+			m_Source->UnqueueBuffer(buffer);
+			m_FreeBuffers.push_back(buffer);
+		}
+	}
+}	 // namespace Nexus::Audio
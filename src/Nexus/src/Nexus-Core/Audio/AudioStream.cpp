@@ -0,0 +1,630 @@
+#include "Nexus-Core/Audio/AudioStream.hpp"
+
+#include "libnyquist/Common.h"
+#include "libnyquist/Decoders.h"
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+	#define NX_AUDIO_STREAM_DECODE_INLINE 1
+#endif
+
+namespace Nexus::Audio
+{
+	/// @brief OpenAL only accepts mono and stereo data, so streams are limited to two channels
+	constexpr uint32_t c_MaxStreamChannels = 2;
+
+	/// @brief A decoder that reads uncompressed PCM data from a RIFF/WAVE file as it is requested, so only a single block of the file is
+	/// ever held in memory
+	class WavStreamDecoder final : public AudioStreamDecoder
+	{
+	  public:
+		explicit WavStreamDecoder(const std::string &filepath) : m_File(filepath, std::ios::binary)
+		{
+			if (!m_File)
+			{
+				throw std::runtime_error("Failed to open audio file: " + filepath);
+			}
+
+			ReadHeader(filepath);
+		}
+
+		void Open() final
+		{
+			// the header has already been read, so the format is known as soon as the decoder is created
+		}
+
+		uint32_t GetChannelCount() const final
+		{
+			return m_ChannelCount;
+		}
+
+		uint32_t GetSampleRate() const final
+		{
+			return m_SampleRate;
+		}
+
+		size_t ReadFrames(float *output, size_t frameCount) final
+		{
+			const size_t bytesPerFrame	= (size_t)m_BytesPerSample * m_ChannelCount;
+			const size_t remainingBytes = m_DataSize - m_DataRead;
+			const size_t framesToRead	= std::min(frameCount, remainingBytes / bytesPerFrame);
+
+			m_ReadBuffer.resize(framesToRead * bytesPerFrame);
+			m_File.read(reinterpret_cast<char *>(m_ReadBuffer.data()), m_ReadBuffer.size());
+
+			const size_t framesRead = (size_t)m_File.gcount() / bytesPerFrame;
+			m_DataRead += framesRead * bytesPerFrame;
+
+			ConvertToFloat(m_ReadBuffer.data(), output, framesRead * m_ChannelCount);
+			return framesRead;
+		}
+
+		void Rewind() final
+		{
+			m_File.clear();
+			m_File.seekg(m_DataOffset);
+			m_DataRead = 0;
+		}
+
+	  private:
+		template<typename T>
+		T ReadValue()
+		{
+			T value = {};
+			m_File.read(reinterpret_cast<char *>(&value), sizeof(T));
+			return value;
+		}
+
+		void ReadHeader(const std::string &filepath)
+		{
+			char riff[4], wave[4];
+			m_File.read(riff, 4);
+			ReadValue<uint32_t>();
+			m_File.read(wave, 4);
+
+			if (!m_File || memcmp(riff, "RIFF", 4) != 0 || memcmp(wave, "WAVE", 4) != 0)
+			{
+				throw std::runtime_error("File is not a valid WAV file: " + filepath);
+			}
+
+			bool foundFormat = false;
+
+			// walk the chunks until the sample data is found, chunks are padded to an even number of bytes
+			while (m_File)
+			{
+				char id[4];
+				m_File.read(id, 4);
+				uint32_t chunkSize = ReadValue<uint32_t>();
+
+				if (!m_File)
+				{
+					break;
+				}
+
+				if (memcmp(id, "fmt ", 4) == 0)
+				{
+					uint16_t encoding = ReadValue<uint16_t>();
+					m_ChannelCount	  = ReadValue<uint16_t>();
+					m_SampleRate	  = ReadValue<uint32_t>();
+					ReadValue<uint32_t>();	  // byte rate
+					ReadValue<uint16_t>();	  // block align
+					uint16_t bitsPerSample = ReadValue<uint16_t>();
+
+					// WAVE_FORMAT_EXTENSIBLE stores the real encoding at the start of the sub-format GUID
+					if (encoding == 0xFFFE && chunkSize >= 40)
+					{
+						ReadValue<uint16_t>();	  // extension size
+						ReadValue<uint16_t>();	  // valid bits per sample
+						ReadValue<uint32_t>();	  // channel mask
+						encoding = ReadValue<uint16_t>();
+						m_File.seekg(chunkSize - 26 + (chunkSize & 1), std::ios::cur);
+					}
+					else
+					{
+						m_File.seekg(chunkSize - 16 + (chunkSize & 1), std::ios::cur);
+					}
+
+					if (m_ChannelCount == 0 || m_ChannelCount > c_MaxStreamChannels)
+					{
+						throw std::runtime_error("Only mono and stereo WAV files can be streamed: " + filepath);
+					}
+
+					m_IsFloat		 = encoding == 3;
+					m_BytesPerSample = bitsPerSample / 8;
+
+					if ((encoding != 1 && encoding != 3) || (m_IsFloat && m_BytesPerSample != 4) || m_BytesPerSample == 0 ||
+						m_BytesPerSample > 4)
+					{
+						throw std::runtime_error("Unsupported WAV encoding, only 8/16/24/32 bit PCM and 32 bit float data can be streamed: " +
+												 filepath);
+					}
+
+					foundFormat = true;
+				}
+				else if (memcmp(id, "data", 4) == 0)
+				{
+					if (!foundFormat)
+					{
+						throw std::runtime_error("WAV file is missing a format chunk: " + filepath);
+					}
+
+					m_DataOffset = m_File.tellg();
+					m_DataSize	 = chunkSize;
+					return;
+				}
+				else
+				{
+					m_File.seekg(chunkSize + (chunkSize & 1), std::ios::cur);
+				}
+			}
+
+			throw std::runtime_error("WAV file does not contain any sample data: " + filepath);
+		}
+
+		void ConvertToFloat(const uint8_t *input, float *output, size_t sampleCount) const
+		{
+			switch (m_BytesPerSample)
+			{
+				case 1:
+				{
+					// 8 bit WAV data is unsigned
+					for (size_t i = 0; i < sampleCount; i++) { output[i] = ((float)input[i] - 128.0f) / 128.0f; }
+					break;
+				}
+				case 2:
+				{
+					for (size_t i = 0; i < sampleCount; i++)
+					{
+						int16_t value;
+						memcpy(&value, input + i * 2, sizeof(value));
+						output[i] = (float)value / 32768.0f;
+					}
+					break;
+				}
+				case 3:
+				{
+					for (size_t i = 0; i < sampleCount; i++)
+					{
+						const uint8_t *sample = input + i * 3;
+						int32_t		   value  = (int32_t)((uint32_t)sample[0] << 8 | (uint32_t)sample[1] << 16 | (uint32_t)sample[2] << 24) >> 8;
+						output[i]			  = (float)value / 8388608.0f;
+					}
+					break;
+				}
+				case 4:
+				{
+					if (m_IsFloat)
+					{
+						memcpy(output, input, sampleCount * sizeof(float));
+					}
+					else
+					{
+						for (size_t i = 0; i < sampleCount; i++)
+						{
+							int32_t value;
+							memcpy(&value, input + i * 4, sizeof(value));
+							output[i] = (float)((double)value / 2147483648.0);
+						}
+					}
+					break;
+				}
+				default: throw std::runtime_error("Failed to find a valid sample size");
+			}
+		}
+
+	  private:
+		std::ifstream		 m_File;
+		std::vector<uint8_t> m_ReadBuffer;
+		std::streampos		 m_DataOffset	  = 0;
+		size_t				 m_DataSize		  = 0;
+		size_t				 m_DataRead		  = 0;
+		uint32_t			 m_ChannelCount	  = 0;
+		uint32_t			 m_SampleRate	  = 0;
+		uint32_t			 m_BytesPerSample = 0;
+		bool				 m_IsFloat		  = false;
+	};
+
+	/// @brief A decoder for formats that libnyquist can only decode in full, the file is decoded when the decoder is opened so that the
+	/// work happens on the stream's decoding thread rather than the thread that created the stream
+	class NyquistStreamDecoder final : public AudioStreamDecoder
+	{
+	  public:
+		explicit NyquistStreamDecoder(const std::string &filepath) : m_Filepath(filepath)
+		{
+		}
+
+		void Open() final
+		{
+			if (!m_Decoded)
+			{
+				Decode();
+			}
+		}
+
+		uint32_t GetChannelCount() const final
+		{
+			return std::min<uint32_t>(m_Data.channelCount, c_MaxStreamChannels);
+		}
+
+		uint32_t GetSampleRate() const final
+		{
+			return m_Data.sampleRate;
+		}
+
+		size_t ReadFrames(float *output, size_t frameCount) final
+		{
+			Open();
+
+			const size_t sourceChannels = m_Data.channelCount;
+			const size_t outputChannels = GetChannelCount();
+
+			if (sourceChannels == 0)
+			{
+				return 0;
+			}
+
+			const size_t totalFrames  = m_Data.samples.size() / sourceChannels;
+			const size_t framesToRead = std::min(frameCount, totalFrames - m_FramePosition);
+			const float *input		  = m_Data.samples.data() + m_FramePosition * sourceChannels;
+
+			if (sourceChannels == outputChannels)
+			{
+				memcpy(output, input, framesToRead * outputChannels * sizeof(float));
+			}
+			else
+			{
+				// surround files only have their front left and right channels played
+				for (size_t frame = 0; frame < framesToRead; frame++)
+				{
+					for (size_t channel = 0; channel < outputChannels; channel++)
+					{
+						output[frame * outputChannels + channel] = input[frame * sourceChannels + channel];
+					}
+				}
+			}
+
+			m_FramePosition += framesToRead;
+			return framesToRead;
+		}
+
+		void Rewind() final
+		{
+			m_FramePosition = 0;
+		}
+
+	  private:
+		void Decode()
+		{
+			m_Decoded = true;
+
+			try
+			{
+				nqr::NyquistIO loader;
+				loader.Load(&m_Data, m_Filepath);
+			}
+			catch (const std::exception &e)
+			{
+				// this runs on the decoding thread, so report the failure and let the stream end instead of throwing
+				NX_ERROR("Failed to decode audio file " + m_Filepath + ": " + e.what());
+				m_Data = {};
+			}
+		}
+
+	  private:
+		std::string	   m_Filepath;
+		nqr::AudioData m_Data;
+		size_t		   m_FramePosition = 0;
+		bool		   m_Decoded	   = false;
+	};
+
+	Scope<AudioStreamDecoder> AudioStreamDecoder::Create(const std::string &filepath)
+	{
+		std::string extension = std::filesystem::path(filepath).extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return std::tolower(c); });
+
+		if (extension == ".wav" || extension == ".wave")
+		{
+			return CreateScope<WavStreamDecoder>(filepath);
+		}
+
+		return CreateScope<NyquistStreamDecoder>(filepath);
+	}
+
+	AudioStream::AudioStream(const AudioStreamDescription &description, AudioDevice *device)
+		: m_Description(description),
+		  m_Device(device),
+		  m_Looping(description.Looping)
+	{
+		if (m_Description.BufferCount < 2)
+		{
+			throw std::runtime_error("An audio stream requires at least two buffers");
+		}
+
+		m_Decoder = AudioStreamDecoder::Create(m_Description.Filepath);
+		m_Source = m_Device->CreateAudioSource();
+
+		m_Chunks.resize(m_Description.BufferCount);
+		for (StreamChunk &chunk : m_Chunks)
+		{
+			// the channel count of some decoders is only known once decoding has begun, so allow room for stereo data
+			chunk.Samples.resize((size_t)m_Description.FramesPerBuffer * c_MaxStreamChannels);
+			chunk.Buffer = m_Device->CreateAudioBuffer();
+		}
+	}
+
+	AudioStream::~AudioStream()
+	{
+		Stop();
+	}
+
+	void AudioStream::Play()
+	{
+		if (m_Playing && !m_Paused)
+		{
+			return;
+		}
+
+		if (!m_Playing)
+		{
+			StartDecoding();
+			m_Playing = true;
+		}
+
+		m_Paused = false;
+
+		// playback only begins once the first decoded buffers have been queued by Update
+		if (!m_QueuedChunks.empty())
+		{
+			m_Device->Play(m_Source);
+		}
+	}
+
+	void AudioStream::Pause()
+	{
+		if (!m_Playing)
+		{
+			return;
+		}
+
+		m_Paused = true;
+		m_Device->Pause(m_Source);
+	}
+
+	void AudioStream::Stop()
+	{
+		m_Device->Stop(m_Source);
+		StopDecoding();
+
+		// stopping a source marks every queued buffer as processed, so they can all be removed from the queue
+		while (!m_QueuedChunks.empty())
+		{
+			m_Source->UnqueueBuffer(m_Chunks[m_QueuedChunks.front()].Buffer);
+			m_QueuedChunks.pop_front();
+		}
+
+		m_Device->Rewind(m_Source);
+		m_Decoder->Rewind();
+		ResetChunks();
+
+		m_Playing = false;
+		m_Paused  = false;
+	}
+
+	void AudioStream::Update()
+	{
+		if (!m_Playing)
+		{
+			return;
+		}
+
+		size_t processed = m_Source->GetNumProcessedBuffers();
+		if (processed > 0)
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+
+			for (size_t i = 0; i < processed && !m_QueuedChunks.empty(); i++)
+			{
+				uint32_t index = m_QueuedChunks.front();
+				m_QueuedChunks.pop_front();
+
+				lock.unlock();
+				m_Source->UnqueueBuffer(m_Chunks[index].Buffer);
+				lock.lock();
+
+				m_Chunks[index].State = ChunkState::Free;
+			}
+
+			m_ChunkFreed.notify_one();
+		}
+
+#if defined(NX_AUDIO_STREAM_DECODE_INLINE)
+		while (DecodeNextChunk()) {}
+#endif
+
+		QueueReadyChunks();
+
+		if (m_AllQueued && m_QueuedChunks.empty())
+		{
+			// the whole file has been played, leave the stream ready to be played again from the start
+			Stop();
+			return;
+		}
+
+		// the source stops by itself if it runs out of queued buffers, so restart it once more data is available
+		if (!m_Paused && !m_QueuedChunks.empty() && m_Source->GetSourceState() != SourceState::Playing)
+		{
+			m_Device->Play(m_Source);
+		}
+	}
+
+	void AudioStream::SetIsLooping(bool looping)
+	{
+		m_Looping = looping;
+	}
+
+	bool AudioStream::GetIsLooping() const
+	{
+		return m_Looping;
+	}
+
+	bool AudioStream::IsPlaying() const
+	{
+		return m_Playing;
+	}
+
+	Ref<AudioSource> AudioStream::GetSource() const
+	{
+		return m_Source;
+	}
+
+	void AudioStream::StartDecoding()
+	{
+		m_ExitRequested = false;
+
+#if !defined(NX_AUDIO_STREAM_DECODE_INLINE)
+		m_DecodeThread = std::thread(&AudioStream::DecodeThreadMain, this);
+#endif
+	}
+
+	void AudioStream::StopDecoding()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_ExitRequested = true;
+		}
+
+		m_ChunkFreed.notify_one();
+
+		if (m_DecodeThread.joinable())
+		{
+			m_DecodeThread.join();
+		}
+	}
+
+	void AudioStream::DecodeThreadMain()
+	{
+		while (!m_ExitRequested)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_ChunkFreed.wait(lock,
+								  [&]()
+								  {
+									  return m_ExitRequested || (!m_DecoderFinished && m_Chunks[m_NextDecodeChunk].State == ChunkState::Free);
+								  });
+			}
+
+			if (m_ExitRequested)
+			{
+				return;
+			}
+
+			DecodeNextChunk();
+		}
+	}
+
+	bool AudioStream::DecodeNextChunk()
+	{
+		StreamChunk *chunk = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (m_DecoderFinished || m_Chunks[m_NextDecodeChunk].State != ChunkState::Free)
+			{
+				return false;
+			}
+
+			chunk		 = &m_Chunks[m_NextDecodeChunk];
+			chunk->State = ChunkState::Decoding;
+		}
+
+		// the decoder and the chunk being decoded are only touched by this thread until the chunk is marked as ready, the decoder must be
+		// open before its channel count is read or every read into the chunk would be written to its start
+		m_Decoder->Open();
+
+		const uint32_t channels	   = m_Decoder->GetChannelCount();
+		size_t		   frameCount  = 0;
+		bool		   endOfStream = false;
+		bool		   rewound	   = false;
+
+		while (frameCount < m_Description.FramesPerBuffer)
+		{
+			size_t framesRead = m_Decoder->ReadFrames(chunk->Samples.data() + frameCount * channels, m_Description.FramesPerBuffer - frameCount);
+			frameCount += framesRead;
+
+			if (frameCount == m_Description.FramesPerBuffer)
+			{
+				break;
+			}
+
+			// the end of the file has been reached, a file that produces no data straight after rewinding would loop forever
+			if (!m_Looping || (rewound && framesRead == 0))
+			{
+				endOfStream = true;
+				break;
+			}
+
+			m_Decoder->Rewind();
+			rewound = true;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			chunk->FrameCount  = frameCount;
+			chunk->EndOfStream = endOfStream;
+			chunk->State	   = ChunkState::Ready;
+			m_DecoderFinished  = endOfStream;
+			m_NextDecodeChunk  = (m_NextDecodeChunk + 1) % m_Chunks.size();
+		}
+
+		return true;
+	}
+
+	void AudioStream::QueueReadyChunks()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		while (!m_AllQueued && m_Chunks[m_NextQueueChunk].State == ChunkState::Ready)
+		{
+			uint32_t	 index = m_NextQueueChunk;
+			StreamChunk &chunk = m_Chunks[index];
+			m_NextQueueChunk   = (m_NextQueueChunk + 1) % m_Chunks.size();
+			m_AllQueued		   = chunk.EndOfStream;
+
+			if (chunk.FrameCount == 0)
+			{
+				chunk.State = ChunkState::Free;
+				continue;
+			}
+
+			chunk.State = ChunkState::Queued;
+			m_QueuedChunks.push_back(index);
+
+			// the chunk is owned by this thread while it is queued, so the upload does not need to hold the lock
+			lock.unlock();
+			const uint32_t channels	   = m_Decoder->GetChannelCount();
+			const size_t   sizeInBytes = chunk.FrameCount * channels * sizeof(float);
+			AudioFormat	   format	   = channels == 1 ? AudioFormat::MonoFloat32 : AudioFormat::StereoFloat32;
+			chunk.Buffer->SetData(chunk.Samples.data(), sizeInBytes, format, m_Decoder->GetSampleRate());
+			m_Source->QueueBuffer(chunk.Buffer);
+			lock.lock();
+		}
+	}
+
+	void AudioStream::ResetChunks()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		for (StreamChunk &chunk : m_Chunks)
+		{
+			chunk.FrameCount  = 0;
+			chunk.EndOfStream = false;
+			chunk.State		  = ChunkState::Free;
+		}
+
+		m_QueuedChunks.clear();
+		m_NextDecodeChunk = 0;
+		m_NextQueueChunk  = 0;
+		m_DecoderFinished = false;
+		m_AllQueued		  = false;
+	}
+}	 // namespace Nexus::Audio
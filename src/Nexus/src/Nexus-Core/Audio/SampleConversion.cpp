@@ -0,0 +1,339 @@
+#include "Nexus-Core/Audio/SampleConversion.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NX_AUDIO_SSE2 1
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	#define NX_AUDIO_NEON 1
+	#include <arm_neon.h>
+#endif
+
+namespace Nexus::Audio
+{
+	/// @brief Dither noise is generated by four independent xorshift generators, sample i always uses generator i % 4 so that the scalar
+	/// and vectorised paths produce identical output
+	struct DitherState
+	{
+		uint32_t Lanes[4];
+
+		explicit DitherState(uint32_t seed)
+		{
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				// xorshift generators must never have a state of zero
+				uint32_t state = (seed + i) * 0x9E3779B9u;
+				Lanes[i]	   = state != 0 ? state : 0x6D2B79F5u;
+			}
+		}
+
+		void Advance()
+		{
+			for (uint32_t &state : Lanes)
+			{
+				state ^= state << 13;
+				state ^= state >> 17;
+				state ^= state << 5;
+			}
+		}
+
+		/// @brief Returns triangular noise in the range (-1, 1) built from the difference of the two 16 bit halves of the lane's state
+		float GetNoise(uint32_t lane) const
+		{
+			float a = (float)(int32_t)(Lanes[lane] & 0xFFFF) * (1.0f / 65536.0f);
+			float b = (float)(int32_t)(Lanes[lane] >> 16) * (1.0f / 65536.0f);
+			return a - b;
+		}
+	};
+
+#if defined(NX_AUDIO_SSE2)
+	inline __m128i AdvanceDitherLanes(__m128i state)
+	{
+		state = _mm_xor_si128(state, _mm_slli_epi32(state, 13));
+		state = _mm_xor_si128(state, _mm_srli_epi32(state, 17));
+		state = _mm_xor_si128(state, _mm_slli_epi32(state, 5));
+		return state;
+	}
+
+	inline __m128 GetDitherNoise(__m128i state)
+	{
+		const __m128  scale = _mm_set1_ps(1.0f / 65536.0f);
+		const __m128i mask	= _mm_set1_epi32(0xFFFF);
+
+		__m128 a = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(state, mask)), scale);
+		__m128 b = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(state, 16)), scale);
+		return _mm_sub_ps(a, b);
+	}
+
+	/// @brief Scales four samples, adds dither and rounds them to the nearest integer (ties to even)
+	inline __m128i QuantiseSamples(__m128 samples, __m128 scale, __m128 noise, bool dither)
+	{
+		samples = _mm_min_ps(_mm_max_ps(samples, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+		samples = _mm_mul_ps(samples, scale);
+
+		if (dither)
+		{
+			samples = _mm_add_ps(samples, noise);
+		}
+
+		return _mm_cvtps_epi32(samples);
+	}
+#endif
+
+	/// @brief Scalar equivalent of the vectorised quantisation, the comparisons mirror maxps/minps (so NaN becomes -1) and std::nearbyint
+	/// uses the same ties to even rounding as cvtps2dq
+	inline int32_t QuantiseSample(float sample, float scale, float noise, bool dither)
+	{
+		sample = sample > -1.0f ? sample : -1.0f;
+		sample = sample < 1.0f ? sample : 1.0f;
+		sample *= scale;
+
+		if (dither)
+		{
+			sample += noise;
+		}
+
+		return (int32_t)std::nearbyint(sample);
+	}
+
+	uint32_t GetAudioFormatBytesPerSample(AudioFormat format)
+	{
+		switch (format)
+		{
+			case AudioFormat::Mono8:
+			case AudioFormat::Stereo8: return 1;
+			case AudioFormat::Mono16:
+			case AudioFormat::Stereo16: return 2;
+			case AudioFormat::MonoFloat32:
+			case AudioFormat::StereoFloat32: return 4;
+			default: throw std::runtime_error("Failed to find a valid audio format");
+		}
+	}
+
+	uint32_t GetAudioFormatChannelCount(AudioFormat format)
+	{
+		switch (format)
+		{
+			case AudioFormat::Mono8:
+			case AudioFormat::Mono16:
+			case AudioFormat::MonoFloat32: return 1;
+			case AudioFormat::Stereo8:
+			case AudioFormat::Stereo16:
+			case AudioFormat::StereoFloat32: return 2;
+			default: throw std::runtime_error("Failed to find a valid audio format");
+		}
+	}
+
+	void ConvertFloatToInt16(std::span<const float> input, int16_t *output, DitherMode dither, uint32_t seed)
+	{
+		const bool	useDither = dither == DitherMode::Triangular;
+		const float scale	  = 32767.0f;
+		DitherState state(seed);
+		size_t		i = 0;
+
+#if defined(NX_AUDIO_SSE2)
+		__m128i lanes		 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state.Lanes));
+		__m128	scaleVector = _mm_set1_ps(scale);
+
+		for (; i + 8 <= input.size(); i += 8)
+		{
+			lanes		   = AdvanceDitherLanes(lanes);
+			__m128i first  = QuantiseSamples(_mm_loadu_ps(input.data() + i), scaleVector, GetDitherNoise(lanes), useDither);
+			lanes		   = AdvanceDitherLanes(lanes);
+			__m128i second = QuantiseSamples(_mm_loadu_ps(input.data() + i + 4), scaleVector, GetDitherNoise(lanes), useDither);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), _mm_packs_epi32(first, second));
+		}
+
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(state.Lanes), lanes);
+#elif defined(NX_AUDIO_NEON)
+		for (; i + 4 <= input.size(); i += 4)
+		{
+			state.Advance();
+
+			float32x4_t samples = vminq_f32(vmaxq_f32(vld1q_f32(input.data() + i), vdupq_n_f32(-1.0f)), vdupq_n_f32(1.0f));
+			samples				= vmulq_f32(samples, vdupq_n_f32(scale));
+
+			if (useDither)
+			{
+				float noise[4] = {state.GetNoise(0), state.GetNoise(1), state.GetNoise(2), state.GetNoise(3)};
+				samples		   = vaddq_f32(samples, vld1q_f32(noise));
+			}
+
+			vst1_s16(output + i, vqmovn_s32(vcvtnq_s32_f32(samples)));
+		}
+#endif
+
+		for (; i < input.size(); i++)
+		{
+			uint32_t lane = i % 4;
+			if (lane == 0)
+			{
+				state.Advance();
+			}
+
+			int32_t value = QuantiseSample(input[i], scale, state.GetNoise(lane), useDither);
+			output[i]	  = (int16_t)std::clamp(value, -32768, 32767);
+		}
+	}
+
+	void ConvertFloatToUInt8(std::span<const float> input, uint8_t *output, DitherMode dither, uint32_t seed)
+	{
+		const bool	useDither = dither == DitherMode::Triangular;
+		const float scale	  = 127.0f;
+		DitherState state(seed);
+		size_t		i = 0;
+
+#if defined(NX_AUDIO_SSE2)
+		__m128i lanes		 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state.Lanes));
+		__m128	scaleVector = _mm_set1_ps(scale);
+		__m128i bias		 = _mm_set1_epi16(128);
+
+		for (; i + 8 <= input.size(); i += 8)
+		{
+			lanes		   = AdvanceDitherLanes(lanes);
+			__m128i first  = QuantiseSamples(_mm_loadu_ps(input.data() + i), scaleVector, GetDitherNoise(lanes), useDither);
+			lanes		   = AdvanceDitherLanes(lanes);
+			__m128i second = QuantiseSamples(_mm_loadu_ps(input.data() + i + 4), scaleVector, GetDitherNoise(lanes), useDither);
+
+			__m128i words = _mm_add_epi16(_mm_packs_epi32(first, second), bias);
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(output + i), _mm_packus_epi16(words, words));
+		}
+
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(state.Lanes), lanes);
+#endif
+
+		for (; i < input.size(); i++)
+		{
+			uint32_t lane = i % 4;
+			if (lane == 0)
+			{
+				state.Advance();
+			}
+
+			int32_t value = QuantiseSample(input[i], scale, state.GetNoise(lane), useDither) + 128;
+			output[i]	  = (uint8_t)std::clamp(value, 0, 255);
+		}
+	}
+
+	void InterleaveChannels(const float *const *channels, uint32_t channelCount, size_t frameCount, float *output)
+	{
+		size_t frame = 0;
+
+#if defined(NX_AUDIO_SSE2)
+		if (channelCount == 2)
+		{
+			for (; frame + 4 <= frameCount; frame += 4)
+			{
+				__m128 left	 = _mm_loadu_ps(channels[0] + frame);
+				__m128 right = _mm_loadu_ps(channels[1] + frame);
+				_mm_storeu_ps(output + frame * 2, _mm_unpacklo_ps(left, right));
+				_mm_storeu_ps(output + frame * 2 + 4, _mm_unpackhi_ps(left, right));
+			}
+		}
+#elif defined(NX_AUDIO_NEON)
+		if (channelCount == 2)
+		{
+			for (; frame + 4 <= frameCount; frame += 4)
+			{
+				float32x4x2_t pair = {vld1q_f32(channels[0] + frame), vld1q_f32(channels[1] + frame)};
+				vst2q_f32(output + frame * 2, pair);
+			}
+		}
+#endif
+
+		for (; frame < frameCount; frame++)
+		{
+			for (uint32_t channel = 0; channel < channelCount; channel++) { output[frame * channelCount + channel] = channels[channel][frame]; }
+		}
+	}
+
+	void MixMonoToStereo(std::span<const float> input, float *accumulator, float leftGain, float rightGain)
+	{
+		size_t i = 0;
+
+#if defined(NX_AUDIO_SSE2)
+		__m128 left	 = _mm_set1_ps(leftGain);
+		__m128 right = _mm_set1_ps(rightGain);
+
+		for (; i + 4 <= input.size(); i += 4)
+		{
+			__m128 samples = _mm_loadu_ps(input.data() + i);
+			__m128 l	   = _mm_mul_ps(samples, left);
+			__m128 r	   = _mm_mul_ps(samples, right);
+
+			float *destination = accumulator + i * 2;
+			_mm_storeu_ps(destination, _mm_add_ps(_mm_loadu_ps(destination), _mm_unpacklo_ps(l, r)));
+			_mm_storeu_ps(destination + 4, _mm_add_ps(_mm_loadu_ps(destination + 4), _mm_unpackhi_ps(l, r)));
+		}
+#elif defined(NX_AUDIO_NEON)
+		for (; i + 4 <= input.size(); i += 4)
+		{
+			float32x4_t	  samples	 = vld1q_f32(input.data() + i);
+			float32x4x2_t destination = vld2q_f32(accumulator + i * 2);
+			destination.val[0]		  = vmlaq_n_f32(destination.val[0], samples, leftGain);
+			destination.val[1]		  = vmlaq_n_f32(destination.val[1], samples, rightGain);
+			vst2q_f32(accumulator + i * 2, destination);
+		}
+#endif
+
+		for (; i < input.size(); i++)
+		{
+			accumulator[i * 2] += input[i] * leftGain;
+			accumulator[i * 2 + 1] += input[i] * rightGain;
+		}
+	}
+
+	void MixStereoToStereo(std::span<const float> input, float *accumulator, float leftGain, float rightGain)
+	{
+		size_t i = 0;
+
+#if defined(NX_AUDIO_SSE2)
+		__m128 gains = _mm_setr_ps(leftGain, rightGain, leftGain, rightGain);
+
+		for (; i + 4 <= input.size(); i += 4)
+		{
+			__m128 samples = _mm_mul_ps(_mm_loadu_ps(input.data() + i), gains);
+			_mm_storeu_ps(accumulator + i, _mm_add_ps(_mm_loadu_ps(accumulator + i), samples));
+		}
+#elif defined(NX_AUDIO_NEON)
+		const float gainValues[4] = {leftGain, rightGain, leftGain, rightGain};
+		float32x4_t gains		  = vld1q_f32(gainValues);
+
+		for (; i + 4 <= input.size(); i += 4)
+		{
+			vst1q_f32(accumulator + i, vmlaq_f32(vld1q_f32(accumulator + i), vld1q_f32(input.data() + i), gains));
+		}
+#endif
+
+		for (; i < input.size(); i++) { accumulator[i] += input[i] * (i % 2 == 0 ? leftGain : rightGain); }
+	}
+
+	void ApplyGain(std::span<float> samples, float gain)
+	{
+		size_t i = 0;
+
+#if defined(NX_AUDIO_SSE2)
+		__m128 gains = _mm_set1_ps(gain);
+		for (; i + 4 <= samples.size(); i += 4) { _mm_storeu_ps(samples.data() + i, _mm_mul_ps(_mm_loadu_ps(samples.data() + i), gains)); }
+#elif defined(NX_AUDIO_NEON)
+		for (; i + 4 <= samples.size(); i += 4) { vst1q_f32(samples.data() + i, vmulq_n_f32(vld1q_f32(samples.data() + i), gain)); }
+#endif
+
+		for (; i < samples.size(); i++) { samples[i] *= gain; }
+	}
+
+	std::vector<uint8_t> ConvertSamples(std::span<const float> input, AudioFormat format, DitherMode dither)
+	{
+		std::vector<uint8_t> output(input.size() * GetAudioFormatBytesPerSample(format));
+
+		switch (GetAudioFormatBytesPerSample(format))
+		{
+			case 1: ConvertFloatToUInt8(input, output.data(), dither); break;
+			case 2: ConvertFloatToInt16(input, reinterpret_cast<int16_t *>(output.data()), dither); break;
+			case 4: memcpy(output.data(), input.data(), input.size_bytes()); break;
+			default: throw std::runtime_error("Failed to find a valid audio format");
+		}
+
+		return output;
+	}
+}	 // namespace Nexus::Audio
@@ -0,0 +1,544 @@
+#include "Nexus-Core/ECS/TransformHierarchy.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NX_TRANSFORM_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+namespace Nexus::ECS
+{
+	/// @brief Multiplies two column major matrices, this is the innermost operation when propagating world matrices
+	inline void MultiplyMatrices(const glm::mat4 &a, const glm::mat4 &b, glm::mat4 &output)
+	{
+#if defined(NX_TRANSFORM_SSE2)
+		const float *left  = glm::value_ptr(a);
+		const float *right = glm::value_ptr(b);
+		float		*out   = glm::value_ptr(output);
+
+		__m128 column0 = _mm_loadu_ps(left + 0);
+		__m128 column1 = _mm_loadu_ps(left + 4);
+		__m128 column2 = _mm_loadu_ps(left + 8);
+		__m128 column3 = _mm_loadu_ps(left + 12);
+
+		// each column of the result is a combination of the columns of a, weighted by the matching column of b
+		for (int column = 0; column < 4; column++)
+		{
+			const float *weights = right + column * 4;
+			__m128		 result	 = _mm_mul_ps(column0, _mm_set1_ps(weights[0]));
+			result				 = _mm_add_ps(result, _mm_mul_ps(column1, _mm_set1_ps(weights[1])));
+			result				 = _mm_add_ps(result, _mm_mul_ps(column2, _mm_set1_ps(weights[2])));
+			result				 = _mm_add_ps(result, _mm_mul_ps(column3, _mm_set1_ps(weights[3])));
+			_mm_storeu_ps(out + column * 4, result);
+		}
+#else
+		output = a * b;
+#endif
+	}
+
+	glm::mat4 ComposeTransform(const LocalTransform &transform)
+	{
+		const glm::quat &q = transform.Rotation;
+		const glm::vec3 &s = transform.Scale;
+
+		float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+		float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+		float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+		// the rotation matrix of the quaternion with each column multiplied by the scale, followed by the translation
+		glm::mat4 result(1.0f);
+		result[0] = glm::vec4((1.0f - 2.0f * (yy + zz)) * s.x, 2.0f * (xy + wz) * s.x, 2.0f * (xz - wy) * s.x, 0.0f);
+		result[1] = glm::vec4(2.0f * (xy - wz) * s.y, (1.0f - 2.0f * (xx + zz)) * s.y, 2.0f * (yz + wx) * s.y, 0.0f);
+		result[2] = glm::vec4(2.0f * (xz + wy) * s.z, 2.0f * (yz - wx) * s.z, (1.0f - 2.0f * (xx + yy)) * s.z, 0.0f);
+		result[3] = glm::vec4(transform.Position.x, transform.Position.y, transform.Position.z, 1.0f);
+		return result;
+	}
+
+	void ComposeTransforms(std::span<const LocalTransform> transforms, glm::mat4 *output)
+	{
+		size_t i = 0;
+
+#if defined(NX_TRANSFORM_SSE2)
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 two = _mm_set1_ps(2.0f);
+
+		// four transforms are converted at a time, each register holds the same component of all four so that the arithmetic matches the
+		// scalar path exactly
+		for (; i + 4 <= transforms.size(); i += 4)
+		{
+			const LocalTransform &t0 = transforms[i + 0];
+			const LocalTransform &t1 = transforms[i + 1];
+			const LocalTransform &t2 = transforms[i + 2];
+			const LocalTransform &t3 = transforms[i + 3];
+
+			__m128 qx = _mm_setr_ps(t0.Rotation.x, t1.Rotation.x, t2.Rotation.x, t3.Rotation.x);
+			__m128 qy = _mm_setr_ps(t0.Rotation.y, t1.Rotation.y, t2.Rotation.y, t3.Rotation.y);
+			__m128 qz = _mm_setr_ps(t0.Rotation.z, t1.Rotation.z, t2.Rotation.z, t3.Rotation.z);
+			__m128 qw = _mm_setr_ps(t0.Rotation.w, t1.Rotation.w, t2.Rotation.w, t3.Rotation.w);
+			__m128 sx = _mm_setr_ps(t0.Scale.x, t1.Scale.x, t2.Scale.x, t3.Scale.x);
+			__m128 sy = _mm_setr_ps(t0.Scale.y, t1.Scale.y, t2.Scale.y, t3.Scale.y);
+			__m128 sz = _mm_setr_ps(t0.Scale.z, t1.Scale.z, t2.Scale.z, t3.Scale.z);
+
+			__m128 xx = _mm_mul_ps(qx, qx), yy = _mm_mul_ps(qy, qy), zz = _mm_mul_ps(qz, qz);
+			__m128 xy = _mm_mul_ps(qx, qy), xz = _mm_mul_ps(qx, qz), yz = _mm_mul_ps(qy, qz);
+			__m128 wx = _mm_mul_ps(qw, qx), wy = _mm_mul_ps(qw, qy), wz = _mm_mul_ps(qw, qz);
+
+			__m128 m00 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+			__m128 m01 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx);
+			__m128 m02 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx);
+
+			__m128 m10 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy);
+			__m128 m11 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+			__m128 m12 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy);
+
+			__m128 m20 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz);
+			__m128 m21 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz);
+			__m128 m22 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+
+			__m128 m30 = _mm_setr_ps(t0.Position.x, t1.Position.x, t2.Position.x, t3.Position.x);
+			__m128 m31 = _mm_setr_ps(t0.Position.y, t1.Position.y, t2.Position.y, t3.Position.y);
+			__m128 m32 = _mm_setr_ps(t0.Position.z, t1.Position.z, t2.Position.z, t3.Position.z);
+
+			// each set of registers holds one column of all four matrices, transposing it gives that column of each matrix in turn
+			__m128 column0[4] = {m00, m01, m02, _mm_setzero_ps()};
+			__m128 column1[4] = {m10, m11, m12, _mm_setzero_ps()};
+			__m128 column2[4] = {m20, m21, m22, _mm_setzero_ps()};
+			__m128 column3[4] = {m30, m31, m32, one};
+			_MM_TRANSPOSE4_PS(column0[0], column0[1], column0[2], column0[3]);
+			_MM_TRANSPOSE4_PS(column1[0], column1[1], column1[2], column1[3]);
+			_MM_TRANSPOSE4_PS(column2[0], column2[1], column2[2], column2[3]);
+			_MM_TRANSPOSE4_PS(column3[0], column3[1], column3[2], column3[3]);
+
+			for (int matrix = 0; matrix < 4; matrix++)
+			{
+				float *out = glm::value_ptr(output[i + matrix]);
+				_mm_storeu_ps(out + 0, column0[matrix]);
+				_mm_storeu_ps(out + 4, column1[matrix]);
+				_mm_storeu_ps(out + 8, column2[matrix]);
+				_mm_storeu_ps(out + 12, column3[matrix]);
+			}
+		}
+#endif
+
+		for (; i < transforms.size(); i++) { output[i] = ComposeTransform(transforms[i]); }
+	}
+
+	TransformNode TransformHierarchy::Create(const LocalTransform &transform, TransformNode parent)
+	{
+		// the parent is looked up first so that an invalid parent does not leave a slot allocated
+		uint32_t parentOrder = parent.IsValid() ? GetOrder(parent) : c_NoParent;
+		uint32_t slotIndex	 = 0;
+		if (!m_FreeSlots.empty())
+		{
+			slotIndex = m_FreeSlots.back();
+			m_FreeSlots.pop_back();
+		}
+		else
+		{
+			slotIndex = (uint32_t)m_Slots.size();
+			m_Slots.emplace_back();
+		}
+
+		// the new node is always appended, which keeps the depth-first order when it is a root or when its parent's subtree is the last
+		// one in storage, as happens when a hierarchy is built parent first
+		uint32_t order = (uint32_t)m_Nodes.size();
+		Slot	&slot  = m_Slots[slotIndex];
+		slot		   = Slot {.Order = order, .Generation = slot.Generation, .Occupied = true};
+		Link(slotIndex, parent.IsValid() ? parent.Index : c_NoSlot);
+
+		m_Nodes.push_back(Node {.Parent = parentOrder, .SubtreeSize = 1, .SlotIndex = slotIndex});
+		m_Locals.push_back(transform);
+		m_LocalMatrices.push_back(glm::mat4(1.0f));
+		m_WorldMatrices.push_back(glm::mat4(1.0f));
+		m_NodeCount++;
+
+		if (parentOrder != c_NoParent)
+		{
+			if (!m_LayoutDirty && parentOrder + m_Nodes[parentOrder].SubtreeSize == order)
+			{
+				for (uint32_t ancestor = parentOrder; ancestor != c_NoParent; ancestor = m_Nodes[ancestor].Parent)
+				{
+					m_Nodes[ancestor].SubtreeSize++;
+				}
+			}
+			else
+			{
+				m_LayoutDirty = true;
+			}
+		}
+
+		MarkDirty(order, true);
+		return TransformNode {.Index = slotIndex, .Generation = slot.Generation};
+	}
+
+	void TransformHierarchy::Destroy(TransformNode node)
+	{
+		if (!IsAlive(node))
+		{
+			return;
+		}
+
+		Unlink(node.Index);
+
+		// the subtree is walked through the links in depth-first order, the links of the freed slots are only reset when they are reused
+		// so they can still be followed back up to the destroyed node
+		uint32_t current = node.Index;
+		while (current != c_NoSlot)
+		{
+			uint32_t next = m_Slots[current].FirstChild;
+			if (next == c_NoSlot)
+			{
+				uint32_t ancestor = current;
+				while (ancestor != node.Index && m_Slots[ancestor].NextSibling == c_NoSlot) { ancestor = m_Slots[ancestor].Parent; }
+				next = ancestor == node.Index ? c_NoSlot : m_Slots[ancestor].NextSibling;
+			}
+
+			Slot &slot	  = m_Slots[current];
+			slot.Occupied = false;
+			slot.Generation++;
+			m_FreeSlots.push_back(current);
+			m_NodeCount--;
+
+			current = next;
+		}
+
+		// the destroyed nodes stay in storage until the layout is rebuilt
+		m_LayoutDirty = true;
+	}
+
+	void TransformHierarchy::SetParent(TransformNode node, TransformNode parent)
+	{
+		uint32_t order		= GetOrder(node);
+		uint32_t parentSlot = c_NoSlot;
+
+		if (parent.IsValid())
+		{
+			GetOrder(parent);
+			if (IsDescendant(parent, node))
+			{
+				throw std::runtime_error("A transform cannot be parented to itself or one of its descendants");
+			}
+
+			parentSlot = parent.Index;
+		}
+
+		if (m_Slots[node.Index].Parent == parentSlot)
+		{
+			return;
+		}
+
+		Unlink(node.Index);
+		Link(node.Index, parentSlot);
+		m_LayoutDirty = true;
+
+		// the local matrix is unchanged, but the world matrices of the whole subtree are now relative to a different parent
+		MarkDirty(order, false);
+	}
+
+	TransformNode TransformHierarchy::GetParent(TransformNode node) const
+	{
+		GetOrder(node);
+
+		uint32_t parent = m_Slots[node.Index].Parent;
+		if (parent == c_NoSlot)
+		{
+			return {};
+		}
+
+		return TransformNode {.Index = parent, .Generation = m_Slots[parent].Generation};
+	}
+
+	bool TransformHierarchy::IsDescendant(TransformNode node, TransformNode ancestor) const
+	{
+		GetOrder(node);
+		GetOrder(ancestor);
+
+		for (uint32_t current = node.Index; current != c_NoSlot; current = m_Slots[current].Parent)
+		{
+			if (current == ancestor.Index)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool TransformHierarchy::IsAlive(TransformNode node) const
+	{
+		if (node.Index >= m_Slots.size())
+		{
+			return false;
+		}
+
+		const Slot &slot = m_Slots[node.Index];
+		return slot.Occupied && slot.Generation == node.Generation;
+	}
+
+	size_t TransformHierarchy::GetNodeCount() const
+	{
+		return m_NodeCount;
+	}
+
+	const LocalTransform &TransformHierarchy::GetLocalTransform(TransformNode node) const
+	{
+		return m_Locals[GetOrder(node)];
+	}
+
+	void TransformHierarchy::SetLocalTransform(TransformNode node, const LocalTransform &transform)
+	{
+		uint32_t order	= GetOrder(node);
+		m_Locals[order] = transform;
+		MarkDirty(order, true);
+	}
+
+	void TransformHierarchy::SetLocalPosition(TransformNode node, const glm::vec3 &position)
+	{
+		uint32_t order			 = GetOrder(node);
+		m_Locals[order].Position = position;
+		MarkDirty(order, true);
+	}
+
+	void TransformHierarchy::SetLocalRotation(TransformNode node, const glm::quat &rotation)
+	{
+		uint32_t order			 = GetOrder(node);
+		m_Locals[order].Rotation = rotation;
+		MarkDirty(order, true);
+	}
+
+	void TransformHierarchy::SetLocalScale(TransformNode node, const glm::vec3 &scale)
+	{
+		uint32_t order		  = GetOrder(node);
+		m_Locals[order].Scale = scale;
+		MarkDirty(order, true);
+	}
+
+	const glm::mat4 &TransformHierarchy::GetLocalMatrix(TransformNode node) const
+	{
+		return m_LocalMatrices[GetOrder(node)];
+	}
+
+	const glm::mat4 &TransformHierarchy::GetWorldMatrix(TransformNode node) const
+	{
+		return m_WorldMatrices[GetOrder(node)];
+	}
+
+	size_t TransformHierarchy::Update()
+	{
+		if (m_LayoutDirty)
+		{
+			RebuildLayout();
+		}
+
+		if (m_DirtySlots.empty())
+		{
+			return 0;
+		}
+
+		// nodes may have moved since they were marked, so the slots are converted to their current positions and sorted into depth-first
+		// order, slots that were destroyed or reused since are either skipped or appear twice
+		m_DirtyOrders.clear();
+		for (uint32_t slotIndex : m_DirtySlots)
+		{
+			const Slot &slot = m_Slots[slotIndex];
+			if (slot.Occupied && m_Nodes[slot.Order].WorldDirty)
+			{
+				m_DirtyOrders.push_back(slot.Order);
+			}
+		}
+
+		std::sort(m_DirtyOrders.begin(), m_DirtyOrders.end());
+		m_DirtyOrders.erase(std::unique(m_DirtyOrders.begin(), m_DirtyOrders.end()), m_DirtyOrders.end());
+
+		// local matrices are rebuilt in runs of adjacent nodes so that the batched path can be used, e.g. when a whole subtree is animated
+		for (size_t i = 0; i < m_DirtyOrders.size();)
+		{
+			uint32_t start = m_DirtyOrders[i];
+			if (!m_Nodes[start].LocalDirty)
+			{
+				i++;
+				continue;
+			}
+
+			size_t count = 1;
+			while (i + count < m_DirtyOrders.size() && m_DirtyOrders[i + count] == start + count && m_Nodes[start + count].LocalDirty)
+			{
+				count++;
+			}
+
+			ComposeTransforms(std::span<const LocalTransform>(m_Locals.data() + start, count), m_LocalMatrices.data() + start);
+			i += count;
+		}
+
+		// a parent always comes before its children, so walking each dirty subtree in order means that every parent's world matrix is up
+		// to date before it is used, subtrees nested inside one that has already been walked are skipped
+		size_t	 recomputed	 = 0;
+		uint32_t walkedUntil = 0;
+
+		for (uint32_t start : m_DirtyOrders)
+		{
+			Node &root		= m_Nodes[start];
+			root.LocalDirty = false;
+			root.WorldDirty = false;
+
+			if (start < walkedUntil)
+			{
+				continue;
+			}
+
+			uint32_t end = start + root.SubtreeSize;
+			for (uint32_t i = start; i < end; i++)
+			{
+				uint32_t parent = m_Nodes[i].Parent;
+				if (parent == c_NoParent)
+				{
+					m_WorldMatrices[i] = m_LocalMatrices[i];
+				}
+				else
+				{
+					MultiplyMatrices(m_WorldMatrices[parent], m_LocalMatrices[i], m_WorldMatrices[i]);
+				}
+			}
+
+			recomputed += end - start;
+			walkedUntil = end;
+		}
+
+		m_DirtySlots.clear();
+		return recomputed;
+	}
+
+	uint32_t TransformHierarchy::GetOrder(TransformNode node) const
+	{
+		if (!IsAlive(node))
+		{
+			throw std::runtime_error("Attempting to use a transform node that does not exist");
+		}
+
+		return m_Slots[node.Index].Order;
+	}
+
+	void TransformHierarchy::MarkDirty(uint32_t order, bool local)
+	{
+		Node &node = m_Nodes[order];
+
+		// each node is only queued once per update, even if it is modified several times
+		if (!node.WorldDirty)
+		{
+			node.WorldDirty = true;
+			m_DirtySlots.push_back(node.SlotIndex);
+		}
+
+		node.LocalDirty |= local;
+	}
+
+	void TransformHierarchy::Link(uint32_t slotIndex, uint32_t parentSlot)
+	{
+		uint32_t &first = parentSlot == c_NoSlot ? m_FirstRoot : m_Slots[parentSlot].FirstChild;
+		uint32_t &last	= parentSlot == c_NoSlot ? m_LastRoot : m_Slots[parentSlot].LastChild;
+
+		Slot &slot		 = m_Slots[slotIndex];
+		slot.Parent		 = parentSlot;
+		slot.PrevSibling = last;
+		slot.NextSibling = c_NoSlot;
+
+		if (last != c_NoSlot)
+		{
+			m_Slots[last].NextSibling = slotIndex;
+		}
+		else
+		{
+			first = slotIndex;
+		}
+
+		last = slotIndex;
+	}
+
+	void TransformHierarchy::Unlink(uint32_t slotIndex)
+	{
+		Slot	 &slot	= m_Slots[slotIndex];
+		uint32_t &first = slot.Parent == c_NoSlot ? m_FirstRoot : m_Slots[slot.Parent].FirstChild;
+		uint32_t &last	= slot.Parent == c_NoSlot ? m_LastRoot : m_Slots[slot.Parent].LastChild;
+
+		if (slot.PrevSibling != c_NoSlot)
+		{
+			m_Slots[slot.PrevSibling].NextSibling = slot.NextSibling;
+		}
+		else
+		{
+			first = slot.NextSibling;
+		}
+
+		if (slot.NextSibling != c_NoSlot)
+		{
+			m_Slots[slot.NextSibling].PrevSibling = slot.PrevSibling;
+		}
+		else
+		{
+			last = slot.PrevSibling;
+		}
+
+		slot.Parent		 = c_NoSlot;
+		slot.PrevSibling = c_NoSlot;
+		slot.NextSibling = c_NoSlot;
+	}
+
+	void TransformHierarchy::RebuildLayout()
+	{
+		m_LayoutNodes.clear();
+		m_LayoutLocals.clear();
+		m_LayoutLocalMatrices.clear();
+		m_LayoutWorldMatrices.clear();
+
+		m_LayoutNodes.reserve(m_NodeCount);
+		m_LayoutLocals.reserve(m_NodeCount);
+		m_LayoutLocalMatrices.reserve(m_NodeCount);
+		m_LayoutWorldMatrices.reserve(m_NodeCount);
+
+		// every root and its descendants are visited in depth-first order by following the links, a parent is always visited before its
+		// children so its new position is already known when the children are copied
+		uint32_t current = m_FirstRoot;
+		while (current != c_NoSlot)
+		{
+			Slot	&slot	  = m_Slots[current];
+			uint32_t previous = slot.Order;
+
+			Node node		 = m_Nodes[previous];
+			node.Parent		 = slot.Parent == c_NoSlot ? c_NoParent : m_Slots[slot.Parent].Order;
+			node.SubtreeSize = 1;
+
+			slot.Order = (uint32_t)m_LayoutNodes.size();
+			m_LayoutNodes.push_back(node);
+			m_LayoutLocals.push_back(m_Locals[previous]);
+			m_LayoutLocalMatrices.push_back(m_LocalMatrices[previous]);
+			m_LayoutWorldMatrices.push_back(m_WorldMatrices[previous]);
+
+			if (slot.FirstChild != c_NoSlot)
+			{
+				current = slot.FirstChild;
+				continue;
+			}
+
+			while (current != c_NoSlot && m_Slots[current].NextSibling == c_NoSlot) { current = m_Slots[current].Parent; }
+			if (current != c_NoSlot)
+			{
+				current = m_Slots[current].NextSibling;
+			}
+		}
+
+		// children are stored after their parents, so walking backwards adds up each subtree before its size is added to its parent
+		for (size_t i = m_LayoutNodes.size(); i-- > 0;)
+		{
+			uint32_t parent = m_LayoutNodes[i].Parent;
+			if (parent != c_NoParent)
+			{
+				m_LayoutNodes[parent].SubtreeSize += m_LayoutNodes[i].SubtreeSize;
+			}
+		}
+
+		m_Nodes.swap(m_LayoutNodes);
+		m_Locals.swap(m_LayoutLocals);
+		m_LocalMatrices.swap(m_LayoutLocalMatrices);
+		m_WorldMatrices.swap(m_LayoutWorldMatrices);
+		m_LayoutDirty = false;
+	}
+}	 // namespace Nexus::ECS
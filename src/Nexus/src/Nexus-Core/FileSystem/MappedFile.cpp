@@ -0,0 +1,113 @@
+#include "Nexus-Core/FileSystem/MappedFile.hpp"
+
+#if defined(WIN32)
+	#include <Windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace Nexus::FileSystem
+{
+#if defined(WIN32)
+	MappedFile::MappedFile(const std::string &filepath)
+	{
+		HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			throw std::runtime_error("Failed to open " + filepath);
+		}
+
+		LARGE_INTEGER size = {};
+		GetFileSizeEx(file, &size);
+		m_FileHandle = file;
+		m_Size		 = (size_t)size.QuadPart;
+
+		// an empty file cannot be mapped, so it is represented by an empty span
+		if (m_Size == 0)
+		{
+			return;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping)
+		{
+			CloseHandle(file);
+			throw std::runtime_error("Failed to map " + filepath);
+		}
+
+		m_MappingHandle = mapping;
+		m_Data			= static_cast<const std::byte *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		if (!m_Data)
+		{
+			CloseHandle(mapping);
+			CloseHandle(file);
+			throw std::runtime_error("Failed to map " + filepath);
+		}
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (m_Data)
+		{
+			UnmapViewOfFile(m_Data);
+		}
+
+		if (m_MappingHandle)
+		{
+			CloseHandle((HANDLE)m_MappingHandle);
+		}
+
+		CloseHandle((HANDLE)m_FileHandle);
+	}
+#else
+	MappedFile::MappedFile(const std::string &filepath)
+	{
+		int file = open(filepath.c_str(), O_RDONLY);
+		if (file < 0)
+		{
+			throw std::runtime_error("Failed to open " + filepath);
+		}
+
+		struct stat info = {};
+		if (fstat(file, &info) != 0)
+		{
+			close(file);
+			throw std::runtime_error("Failed to read the size of " + filepath);
+		}
+
+		m_Size = (size_t)info.st_size;
+
+		// an empty file cannot be mapped, so it is represented by an empty span
+		if (m_Size > 0)
+		{
+			void *data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, file, 0);
+			if (data == MAP_FAILED)
+			{
+				close(file);
+				throw std::runtime_error("Failed to map " + filepath);
+			}
+
+			m_Data = static_cast<const std::byte *>(data);
+		}
+
+		// the mapping keeps its own reference to the file, so the descriptor is not needed once it has been created
+		close(file);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (m_Data)
+		{
+			munmap(const_cast<std::byte *>(m_Data), m_Size);
+		}
+	}
+#endif
+
+	std::span<const std::byte> MappedFile::GetData() const
+	{
+		return std::span<const std::byte>(m_Data, m_Size);
+	}
+}	 // namespace Nexus::FileSystem
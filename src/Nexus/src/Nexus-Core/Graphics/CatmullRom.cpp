@@ -0,0 +1,107 @@
+#include "Nexus-Core/Graphics/CatmullRom.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NX_SPLINE_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+namespace Nexus::Graphics
+{
+	static float EvaluateCubic(const float *c, float u, uint32_t derivative)
+	{
+		switch (derivative)
+		{
+			case 0: return ((c[3] * u + c[2]) * u + c[1]) * u + c[0];
+			case 1: return (3.0f * c[3] * u + 2.0f * c[2]) * u + c[1];
+			default: return 6.0f * c[3] * u + 2.0f * c[2];
+		}
+	}
+
+	void EvaluateCubicSegments(std::span<const float> coefficients,
+							   uint32_t				  dimensions,
+							   uint32_t				  derivative,
+							   std::span<const float> parameters,
+							   float				 *output)
+	{
+		if (dimensions == 0 || derivative > 2)
+		{
+			throw std::runtime_error("Attempting to evaluate cubic segments with no dimensions or a derivative above the second");
+		}
+
+		size_t coefficientsPerSegment = (size_t)dimensions * 4;
+		size_t segmentCount			  = coefficients.size() / coefficientsPerSegment;
+		if (segmentCount == 0)
+		{
+			throw std::runtime_error("Attempting to evaluate cubic segments without any segments");
+		}
+
+		float  lastSegment = (float)(segmentCount - 1);
+		float  maxT		   = (float)segmentCount;
+		size_t i		   = 0;
+
+#if defined(NX_SPLINE_SSE2)
+		// four parameters are evaluated at once, each lane gathers the coefficients of its own segment so that the parameters do not need
+		// to be sorted, and the polynomial is then evaluated for every lane together
+		const __m128 zero		  = _mm_setzero_ps();
+		const __m128 maxTs		  = _mm_set1_ps(maxT);
+		const __m128 lastSegments = _mm_set1_ps(lastSegment);
+		const __m128 two		  = _mm_set1_ps(2.0f);
+		const __m128 three		  = _mm_set1_ps(3.0f);
+		const __m128 six		  = _mm_set1_ps(6.0f);
+
+		for (; i + 4 <= parameters.size(); i += 4)
+		{
+			__m128 t	   = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(parameters.data() + i), zero), maxTs);
+			__m128 segment = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(t)), lastSegments);
+			__m128 u	   = _mm_sub_ps(t, segment);
+
+			alignas(16) int32_t segments[4];
+			_mm_store_si128((__m128i *)segments, _mm_cvttps_epi32(segment));
+
+			const float *lanes[4] = {coefficients.data() + segments[0] * coefficientsPerSegment,
+									 coefficients.data() + segments[1] * coefficientsPerSegment,
+									 coefficients.data() + segments[2] * coefficientsPerSegment,
+									 coefficients.data() + segments[3] * coefficientsPerSegment};
+
+			for (uint32_t dimension = 0; dimension < dimensions; dimension++)
+			{
+				// the four coefficients of a dimension are next to each other, so each lane loads them at once and they are transposed
+				// into one register per power of the parameter
+				size_t offset = (size_t)dimension * 4;
+				__m128 c0	  = _mm_loadu_ps(lanes[0] + offset);
+				__m128 c1	  = _mm_loadu_ps(lanes[1] + offset);
+				__m128 c2	  = _mm_loadu_ps(lanes[2] + offset);
+				__m128 c3	  = _mm_loadu_ps(lanes[3] + offset);
+				_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+				__m128 result;
+				switch (derivative)
+				{
+					case 0: result = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(c3, u), c2), u), c1), u), c0); break;
+					case 1:
+						result = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(three, c3), u), _mm_mul_ps(two, c2)), u), c1);
+						break;
+					default: result = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(six, c3), u), _mm_mul_ps(two, c2)); break;
+				}
+
+				alignas(16) float values[4];
+				_mm_store_ps(values, result);
+				for (uint32_t lane = 0; lane < 4; lane++) { output[(i + lane) * dimensions + dimension] = values[lane]; }
+			}
+		}
+#endif
+
+		for (; i < parameters.size(); i++)
+		{
+			// the parameter is clamped in the same order as the SSE2 path, where a NaN fails the comparison with zero and becomes zero
+			float		 t		 = std::min(std::max(0.0f, parameters[i]), maxT);
+			float		 segment = std::min((float)(int32_t)t, lastSegment);
+			const float *lane	 = coefficients.data() + (size_t)segment * coefficientsPerSegment;
+
+			for (uint32_t dimension = 0; dimension < dimensions; dimension++)
+			{
+				output[i * dimensions + dimension] = EvaluateCubic(lane + dimension * 4, t - segment, derivative);
+			}
+		}
+	}
+}	 // namespace Nexus::Graphics
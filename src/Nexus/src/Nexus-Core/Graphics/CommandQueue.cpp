@@ -26,6 +26,11 @@ namespace Nexus::Graphics
 		SubmitCommandLists(commandLists, numCommandLists, nullptr);
 	}
 
+	void ICommandQueue::SubmitCommandListsForFrame(Ref<CommandList> *commandLists, uint32_t numCommandLists)
+	{
+		SubmitCommandLists(commandLists, numCommandLists, GetGraphicsDevice()->GetFrameTracker().AcquireFence());
+	}
+
 	void ICommandQueue::WriteToTexture(Ref<Texture> texture,
 									   uint32_t		arrayLayer,
 									   uint32_t		mipLevel,
@@ -63,8 +68,11 @@ namespace Nexus::Graphics
 		cmdList->CopyBufferToTexture(copyDesc);
 
 		cmdList->End();
-		SubmitCommandLists(&cmdList, 1, nullptr);
-		WaitForIdle();
+
+		// later submissions to the queue run after the copy, so only the staging buffer has to outlive it
+		SubmitCommandListsForFrame(&cmdList, 1);
+		device->GetFrameTracker().DeferDeletion(buffer);
+		device->GetFrameTracker().DeferDeletion(cmdList);
 	}
 
 	std::vector<char> ICommandQueue::ReadFromTexture(Ref<Texture> texture,
@@ -102,9 +110,12 @@ namespace Nexus::Graphics
 
 		cmdList->CopyTextureToBuffer(copyDesc);
 
+		// the data is needed immediately, so this waits for the copy itself rather than for the whole queue
+		Ref<Fence> fence = device->CreateFence(FenceDescription {.Signalled = false});
+
 		cmdList->End();
-		SubmitCommandLists(&cmdList, 1, nullptr);
-		WaitForIdle();
+		SubmitCommandLists(&cmdList, 1, fence);
+		device->WaitForFences(&fence, 1, true, TimeSpan::FromNanoseconds(UINT64_MAX));
 
 		return buffer->GetData(0, bufferSize);
 	}
@@ -0,0 +1,115 @@
+#include "Nexus-Core/Graphics/FrameTracker.hpp"
+
+#include "Nexus-Core/Graphics/GraphicsDevice.hpp"
+#include "Nexus-Core/Logging/Log.hpp"
+
+namespace Nexus::Graphics
+{
+	FrameTracker::FrameTracker(GraphicsDevice *device, uint32_t framesInFlight) : m_Device(device), m_Frames(std::max(framesInFlight, 1u))
+	{
+	}
+
+	void FrameTracker::BeginFrame()
+	{
+		std::vector<std::shared_ptr<void>> deletions;
+
+		// the resources are released once the lock has been dropped, as their destructors may defer deletions of their own
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_FrameNumber++;
+			deletions = RetireFrame(m_Frames[m_FrameNumber % m_Frames.size()]);
+		}
+	}
+
+	Ref<Fence> FrameTracker::AcquireFence()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		Frame &frame = m_Frames[m_FrameNumber % m_Frames.size()];
+		NX_ASSERT(frame.Fences.size() < c_MaxFencesPerFrame, "BeginFrame must be called once per frame so that submissions are retired");
+
+		Ref<Fence> fence = nullptr;
+		if (!m_FreeFences.empty())
+		{
+			fence = m_FreeFences.back();
+			m_FreeFences.pop_back();
+		}
+		else
+		{
+			if (!m_Device)
+			{
+				throw std::runtime_error("A frame tracker needs a graphics device to create fences");
+			}
+
+			fence = m_Device->CreateFence(FenceDescription {.Signalled = false});
+		}
+
+		frame.Fences.push_back(fence);
+		return fence;
+	}
+
+	void FrameTracker::DeferDeletion(std::shared_ptr<void> resource)
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_Frames[m_FrameNumber % m_Frames.size()].Deletions.push_back(std::move(resource));
+	}
+
+	void FrameTracker::Flush()
+	{
+		// releasing a resource can defer the deletion of the resources that it owns, so this repeats until nothing is left
+		while (true)
+		{
+			std::vector<std::shared_ptr<void>> deletions;
+
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				for (Frame &frame : m_Frames)
+				{
+					std::vector<std::shared_ptr<void>> retired = RetireFrame(frame);
+					deletions.insert(deletions.end(), retired.begin(), retired.end());
+				}
+			}
+
+			if (deletions.empty())
+			{
+				break;
+			}
+		}
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_FreeFences.clear();
+	}
+
+	uint32_t FrameTracker::GetFrameIndex() const
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		return (uint32_t)(m_FrameNumber % m_Frames.size());
+	}
+
+	uint64_t FrameTracker::GetFrameNumber() const
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		return m_FrameNumber;
+	}
+
+	uint32_t FrameTracker::GetFramesInFlight() const
+	{
+		return (uint32_t)m_Frames.size();
+	}
+
+	std::vector<std::shared_ptr<void>> FrameTracker::RetireFrame(Frame &frame)
+	{
+		if (!frame.Fences.empty())
+		{
+			m_Device->WaitForFences(frame.Fences.data(), (uint32_t)frame.Fences.size(), true, TimeSpan::FromNanoseconds(UINT64_MAX));
+			m_Device->ResetFences(frame.Fences.data(), (uint32_t)frame.Fences.size());
+			m_FreeFences.insert(m_FreeFences.end(), frame.Fences.begin(), frame.Fences.end());
+			frame.Fences.clear();
+		}
+
+		// the resources are only handed back after the wait, so the GPU can no longer be using any of them
+		std::vector<std::shared_ptr<void>> deletions;
+		deletions.swap(frame.Deletions);
+		return deletions;
+	}
+}	 // namespace Nexus::Graphics
@@ -0,0 +1,103 @@
+#include "Nexus-Core/Graphics/Frustum.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NX_FRUSTUM_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+namespace Nexus::Graphics
+{
+	static glm::vec4 GetRow(const glm::mat4 &matrix, int index)
+	{
+		return glm::vec4(matrix[0][index], matrix[1][index], matrix[2][index], matrix[3][index]);
+	}
+
+	Frustum::Frustum(const glm::mat4 &viewProjection)
+	{
+		// each plane is a sum or difference of the fourth row of the matrix and one of the other rows (Gribb and Hartmann)
+		glm::vec4 x = GetRow(viewProjection, 0);
+		glm::vec4 y = GetRow(viewProjection, 1);
+		glm::vec4 z = GetRow(viewProjection, 2);
+		glm::vec4 w = GetRow(viewProjection, 3);
+
+		glm::vec4 planes[6] = {w + x, w - x, w + y, w - y, w + z, w - z};
+
+		for (int i = 0; i < 6; i++)
+		{
+			glm::vec4 plane	 = planes[i];
+			float	  length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+			if (length > 0.0f)
+			{
+				plane = plane / length;
+			}
+
+			m_PlaneX[i] = plane.x;
+			m_PlaneY[i] = plane.y;
+			m_PlaneZ[i] = plane.z;
+			m_PlaneW[i] = plane.w;
+		}
+	}
+
+	glm::vec4 Frustum::GetPlane(size_t index) const
+	{
+		return glm::vec4(m_PlaneX[index], m_PlaneY[index], m_PlaneZ[index], m_PlaneW[index]);
+	}
+
+	FrustumTest Frustum::Test(const BoundingBox &box) const
+	{
+		// for each plane, the corner of the box furthest along the normal gives the largest signed distance and the opposite corner gives
+		// the smallest, choosing the larger of min * n and max * n on each axis picks those corners without branching
+#if defined(NX_FRUSTUM_SSE2)
+		const __m128 minX = _mm_set1_ps(box.Min.x), minY = _mm_set1_ps(box.Min.y), minZ = _mm_set1_ps(box.Min.z);
+		const __m128 maxX = _mm_set1_ps(box.Max.x), maxY = _mm_set1_ps(box.Max.y), maxZ = _mm_set1_ps(box.Max.z);
+
+		int outside = 0;
+		int partial = 0;
+
+		for (int group = 0; group < 8; group += 4)
+		{
+			__m128 nx = _mm_load_ps(m_PlaneX + group);
+			__m128 ny = _mm_load_ps(m_PlaneY + group);
+			__m128 nz = _mm_load_ps(m_PlaneZ + group);
+			__m128 w  = _mm_load_ps(m_PlaneW + group);
+
+			__m128 ax = _mm_mul_ps(nx, minX), bx = _mm_mul_ps(nx, maxX);
+			__m128 ay = _mm_mul_ps(ny, minY), by = _mm_mul_ps(ny, maxY);
+			__m128 az = _mm_mul_ps(nz, minZ), bz = _mm_mul_ps(nz, maxZ);
+
+			__m128 furthest = _mm_add_ps(_mm_add_ps(_mm_max_ps(ax, bx), _mm_max_ps(ay, by)), _mm_add_ps(_mm_max_ps(az, bz), w));
+			__m128 nearest	= _mm_add_ps(_mm_add_ps(_mm_min_ps(ax, bx), _mm_min_ps(ay, by)), _mm_add_ps(_mm_min_ps(az, bz), w));
+
+			outside |= _mm_movemask_ps(_mm_cmplt_ps(furthest, _mm_setzero_ps()));
+			partial |= _mm_movemask_ps(_mm_cmplt_ps(nearest, _mm_setzero_ps()));
+		}
+
+		if (outside)
+		{
+			return FrustumTest::Outside;
+		}
+
+		return partial ? FrustumTest::Intersecting : FrustumTest::Inside;
+#else
+		bool partial = false;
+		for (int i = 0; i < 6; i++)
+		{
+			float ax = m_PlaneX[i] * box.Min.x, bx = m_PlaneX[i] * box.Max.x;
+			float ay = m_PlaneY[i] * box.Min.y, by = m_PlaneY[i] * box.Max.y;
+			float az = m_PlaneZ[i] * box.Min.z, bz = m_PlaneZ[i] * box.Max.z;
+
+			float furthest = std::max(ax, bx) + std::max(ay, by) + std::max(az, bz) + m_PlaneW[i];
+			float nearest  = std::min(ax, bx) + std::min(ay, by) + std::min(az, bz) + m_PlaneW[i];
+
+			if (furthest < 0.0f)
+			{
+				return FrustumTest::Outside;
+			}
+
+			partial |= nearest < 0.0f;
+		}
+
+		return partial ? FrustumTest::Intersecting : FrustumTest::Inside;
+#endif
+	}
+}	 // namespace Nexus::Graphics
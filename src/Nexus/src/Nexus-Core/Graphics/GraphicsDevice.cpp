@@ -8,7 +8,6 @@
 #include "Nexus-Core/Graphics/ShaderUtils.hpp"
 #include "Nexus-Core/Logging/Log.hpp"
 #include "Nexus-Core/Runtime.hpp"
-#include "stb_image.h"
 
 #include "Nexus-Core/Caching/CachedShader.hpp"
 
@@ -115,11 +114,22 @@ namespace Nexus::Graphics
 
 		cmdList->CopyBufferToTexture(copyDesc);
 
+		// the second scope of a barrier covers every later submission to the queue, so this makes the copy visible to them without the
+		// CPU waiting for it, a memory barrier is used rather than a texture barrier as the layouts of textures are left to the backends
+		MemoryBarrierDesc barrier = {};
+		barrier.BeforeAccess	  = BarrierAccess::TransferWrite;
+		barrier.AfterAccess		  = BarrierAccess::MemoryRead;
+		barrier.BeforeStage		  = BarrierPipelineStage::Transfer;
+		barrier.AfterStage		  = BarrierPipelineStage::AllCommands;
+		cmdList->SubmitMemoryBarrier(barrier);
+
 		cmdList->End();
-		commandQueue->SubmitCommandList(cmdList);
-		WaitForIdle();
+		commandQueue->SubmitCommandList(cmdList, m_FrameTracker.AcquireFence());
 
-	}	 // namespace Nexus::Graphics
+		// only the staging buffer and the command list have to outlive the copy
+		m_FrameTracker.DeferDeletion(buffer);
+		m_FrameTracker.DeferDeletion(cmdList);
+	}
 
 	std::vector<char> GraphicsDevice::ReadFromTexture(Ref<Texture>		 texture,
 													  Ref<ICommandQueue> commandQueue,
@@ -131,21 +141,32 @@ namespace Nexus::Graphics
 													  uint32_t			 width,
 													  uint32_t			 height)
 	{
-		size_t bufferSize = width * height * GetPixelFormatSizeInBytes(texture->GetDescription().Format);
+		// the data is needed immediately, so this waits for the copy itself rather than for the whole device
+		Ref<TextureReadback> readback = ReadFromTextureAsync(texture, commandQueue, arrayLayer, mipLevel, x, y, z, width, height);
+		return readback->GetData();
+	}
 
-		DeviceBufferDescription bufferDesc = {};
-		bufferDesc.Access				   = BufferMemoryAccess::Readback;
-		bufferDesc.Usage				   = BUFFER_USAGE_NONE;
-		bufferDesc.SizeInBytes			   = bufferSize;
-		bufferDesc.StrideInBytes		   = bufferSize;
+	Ref<TextureReadback> GraphicsDevice::ReadFromTextureAsync(Ref<Texture>		 texture,
+															  Ref<ICommandQueue> commandQueue,
+															  uint32_t			 arrayLayer,
+															  uint32_t			 mipLevel,
+															  uint32_t			 x,
+															  uint32_t			 y,
+															  uint32_t			 z,
+															  uint32_t			 width,
+															  uint32_t			 height)
+	{
+		PixelFormat format	   = texture->GetDescription().Format;
+		size_t		bufferSize = width * height * GetPixelFormatSizeInBytes(format);
 
-		Ref<DeviceBuffer> buffer  = CreateDeviceBuffer(bufferDesc);
-		Ref<CommandList>  cmdList = commandQueue->CreateCommandList();
+		ReadbackBufferPool::Allocation allocation = m_ReadbackBufferPool.Acquire(bufferSize);
+		allocation.CommandList					  = commandQueue->CreateCommandList();
 
+		Ref<CommandList> cmdList = allocation.CommandList;
 		cmdList->Begin();
 
 		BufferTextureCopyDescription copyDesc = {};
-		copyDesc.BufferHandle				  = buffer;
+		copyDesc.BufferHandle				  = allocation.Buffer;
 		copyDesc.BufferOffset				  = 0;
 		copyDesc.BufferRowLength			  = 0;
 		copyDesc.BufferImageHeight			  = 0;
@@ -157,10 +178,19 @@ namespace Nexus::Graphics
 		cmdList->CopyTextureToBuffer(copyDesc);
 
 		cmdList->End();
-		commandQueue->SubmitCommandList(cmdList);
-		WaitForIdle();
+		commandQueue->SubmitCommandList(cmdList, allocation.Fence);
 
-		return buffer->GetData(0, bufferSize);
+		return CreateRef<TextureReadback>(&m_ReadbackBufferPool, std::move(allocation), bufferSize, width, height, format);
+	}
+
+	FrameTracker &GraphicsDevice::GetFrameTracker()
+	{
+		return m_FrameTracker;
+	}
+
+	ReadbackBufferPool &GraphicsDevice::GetReadbackBufferPool()
+	{
+		return m_ReadbackBufferPool;
 	}
 
 	bool GraphicsDevice::Validate()
@@ -203,24 +233,17 @@ namespace Nexus::Graphics
 
 	Ref<Texture> GraphicsDevice::CreateTexture2D(Ref<ICommandQueue> commandQueue, const char *filepath, bool generateMips, bool srgb)
 	{
-		int receivedChannels  = 0;
-		int width			  = 0;
-		int height			  = 0;
-		int requestedChannels = 4;
-
-		stbi_set_flip_vertically_on_load(true);
+		PixelFormat format = srgb ? PixelFormat::R8_G8_B8_A8_UNorm_SRGB : PixelFormat::R8_G8_B8_A8_UNorm;
+		return CreateTexture2D(commandQueue, Image::FromFile(filepath, format), generateMips);
+	}
 
+	Ref<Texture> GraphicsDevice::CreateTexture2D(Ref<ICommandQueue> commandQueue, const Image &image, bool generateMips)
+	{
 		TextureDescription spec;
-		unsigned char	  *data = stbi_load(filepath, &width, &height, &receivedChannels, requestedChannels);
-		spec.Width				= (uint32_t)width;
-		spec.Height				= (uint32_t)height;
-		spec.Format				= PixelFormat::R8_G8_B8_A8_UNorm;
-		spec.MipLevels			= 1;
-
-		if (srgb)
-		{
-			spec.Format = PixelFormat::R8_G8_B8_A8_UNorm_SRGB;
-		}
+		spec.Width	   = image.Width;
+		spec.Height	   = image.Height;
+		spec.Format	   = image.Format;
+		spec.MipLevels = 1;
 
 		if (generateMips)
 		{
@@ -228,10 +251,8 @@ namespace Nexus::Graphics
 			spec.MipLevels	  = mipCount;
 		}
 
-		size_t bufferSize = spec.Width * spec.Height * GetPixelFormatSizeInBytes(spec.Format);
-		auto   texture	  = Ref<Texture>(CreateTexture(spec));
-		WriteToTexture(texture, commandQueue, 0, 0, 0, 0, 0, spec.Width, spec.Height, data, bufferSize);
-		stbi_image_free(data);
+		auto texture = Ref<Texture>(CreateTexture(spec));
+		WriteToTexture(texture, commandQueue, 0, 0, 0, 0, 0, spec.Width, spec.Height, image.Pixels.data(), image.Pixels.size());
 
 		if (generateMips)
 		{
@@ -59,19 +59,22 @@ namespace Nexus::Graphics
 	};
 
 	HdriProcessor::HdriProcessor(const std::string &filepath, GraphicsDevice *device, Nexus::Ref<Nexus::Graphics::ICommandQueue> commandQueue)
+		: HdriProcessor(LoadImage(filepath), device, commandQueue)
+	{
+	}
+
+	HdriProcessor::HdriProcessor(const Image &image, GraphicsDevice *device, Nexus::Ref<Nexus::Graphics::ICommandQueue> commandQueue)
 		: m_Device(device),
+		  m_Width((int32_t)image.Width),
+		  m_Height((int32_t)image.Height),
 		  m_CommandQueue(commandQueue)
 	{
-		stbi_set_flip_vertically_on_load(true);
-		int	   channels			 = 0;
-		int	   requestedChannels = 4;
-		float *data				 = stbi_loadf(filepath.c_str(), &m_Width, &m_Height, &channels, requestedChannels);
+		if (image.IsEmpty())
+		{
+			throw std::runtime_error("Failed to load HDRI image");
+		}
 
-		std::vector<unsigned char> pixels;
-		size_t					   bufferSize = m_Width * m_Height * requestedChannels * sizeof(float);
-		pixels.resize(bufferSize);
-		memcpy(pixels.data(), data, pixels.size());
-		stbi_image_free(data);
+		std::vector<char> pixels = image.Pixels;
 
 		if (m_Device->GetGraphicsAPI() == GraphicsAPI::OpenGL)
 		{
@@ -90,7 +93,19 @@ namespace Nexus::Graphics
 		m_Device->WriteToTexture(m_HdriImage, m_CommandQueue, 0, 0, 0, 0, 0, m_Width, m_Height, pixels.data(), pixels.size());
 	}
 
+	Image HdriProcessor::LoadImage(const std::string &filepath)
+	{
+		return Image::FromFile(filepath, PixelFormat::R32_G32_B32_A32_Float);
+	}
+
 	Ref<Texture> HdriProcessor::Generate(uint32_t size)
+	{
+		BeginGenerate(size);
+		while (!GenerateNextFace()) {}
+		return GetCubemap();
+	}
+
+	void HdriProcessor::BeginGenerate(uint32_t size)
 	{
 		Nexus::Graphics::FramebufferSpecification framebufferSpec = {};
 		framebufferSpec.Width									  = size;
@@ -100,7 +115,6 @@ namespace Nexus::Graphics
 		framebufferSpec.DepthAttachmentSpecification			  = PixelFormat::D24_UNorm_S8_UInt;
 
 		Ref<Framebuffer> framebuffer = m_Device->CreateFramebuffer(framebufferSpec);
-		Ref<CommandList> commandList = m_CommandQueue->CreateCommandList();
 
 		Graphics::TextureDescription cubemapSpec = {};
 		cubemapSpec.Type						 = Graphics::TextureType::TextureCube;
@@ -124,9 +138,8 @@ namespace Nexus::Graphics
 		pipelineDescription.ColourTargetCount = 1;
 		pipelineDescription.DepthFormat		  = framebufferSpec.DepthAttachmentSpecification.DepthFormat;
 
-		pipelineDescription.Layouts		  = {Nexus::Graphics::VertexPositionTexCoordNormalTangentBitangent::GetLayout()};
-		Ref<GraphicsPipeline> pipeline	  = m_Device->CreateGraphicsPipeline(pipelineDescription);
-		Ref<ResourceSet>	  resourceSet = m_Device->CreateResourceSet(pipeline);
+		pipelineDescription.Layouts	   = {Nexus::Graphics::VertexPositionTexCoordNormalTangentBitangent::GetLayout()};
+		Ref<GraphicsPipeline> pipeline = m_Device->CreateGraphicsPipeline(pipelineDescription);
 
 		Nexus::Graphics::SamplerDescription samplerSpec {};
 		samplerSpec.AddressModeU = Nexus::Graphics::SamplerAddressMode::Clamp;
@@ -137,7 +150,32 @@ namespace Nexus::Graphics
 		Nexus::Graphics::MeshFactory	  factory(m_Device, m_CommandQueue);
 		Nexus::Ref<Nexus::Graphics::Mesh> cube = factory.CreateCube();
 
-		VB_UNIFORM_HDRI_PROCESSOR_CAMERA cameraUniforms;
+		m_Generation				 = {};
+		m_Generation.Size			 = size;
+		m_Generation.FaceFramebuffer = framebuffer;
+		m_Generation.Cubemap		 = cubemap;
+		m_Generation.Pipeline		 = pipeline;
+		m_Generation.FaceSampler	 = sampler;
+		m_Generation.Cube			 = cube;
+	}
+
+	bool HdriProcessor::GenerateNextFace()
+	{
+		if (m_Generation.NextFace >= 6)
+		{
+			return true;
+		}
+
+		uint32_t		 face		 = m_Generation.NextFace++;
+		uint32_t		 size		 = m_Generation.Size;
+		Ref<Framebuffer> framebuffer = m_Generation.FaceFramebuffer;
+		Ref<Sampler>	 sampler	 = m_Generation.FaceSampler;
+		Ref<Mesh>		 cube		 = m_Generation.Cube;
+
+		// the previous faces may still be rendering, so each face records into its own command list and reads its own camera, the device
+		// defers destroying them until the frame that they were submitted in has completed
+		Ref<CommandList> commandList = m_CommandQueue->CreateCommandList();
+		Ref<ResourceSet> resourceSet = m_Device->CreateResourceSet(m_Generation.Pipeline);
 
 		Nexus::Graphics::DeviceBufferDescription cameraUniformBufferDesc = {};
 		cameraUniformBufferDesc.Access									 = BufferMemoryAccess::Upload;
@@ -146,99 +184,116 @@ namespace Nexus::Graphics
 		cameraUniformBufferDesc.SizeInBytes								 = sizeof(VB_UNIFORM_HDRI_PROCESSOR_CAMERA);
 		Ref<DeviceBuffer> uniformBuffer									 = m_Device->CreateDeviceBuffer(cameraUniformBufferDesc);
 
-		for (uint32_t i = 0; i < 6; i++)
+		VB_UNIFORM_HDRI_PROCESSOR_CAMERA cameraUniforms;
+
+		glm::vec3 position = glm::vec3(0.0f, 0.0f, 0.0f);
+
+		float yaw = 0.0f, pitch = 0.0f;
+		GetDirection(face, yaw, pitch, m_Device->IsUVOriginTopLeft());
+
+		glm::vec3 up = glm::vec3(0.0f, 1.0f, 0.0f);
+
+		glm::quat rotP = glm::angleAxis(glm::radians(pitch), glm::vec3(1.0f, 0.0f, 0.0f));
+		glm::quat rotY = glm::angleAxis(glm::radians(yaw), glm::vec3(0.0f, 1.0f, 0.0f));
+		glm::mat4 view = glm::mat4_cast(rotY) * glm::mat4_cast(rotP);
+
+		if (!m_Device->IsUVOriginTopLeft())
+		{
+			view *= glm::rotate(glm::mat4(1.0f), glm::radians(180.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+		}
+
+		float	  fov		  = 90.0f;
+		float	  aspectRatio = 1.0f;
+		float	  camNear	  = 0.1f;
+		float	  camFar	  = 100.0f;
+		glm::mat4 projection  = glm::perspective(glm::radians(fov), aspectRatio, camNear, camFar);
+
+		cameraUniforms.View		  = view;
+		cameraUniforms.Projection = projection;
+
+		uniformBuffer->SetData(&cameraUniforms, 0, sizeof(cameraUniforms));
+
+		UniformBufferView uniformBufferView = {};
+		uniformBufferView.BufferHandle		= uniformBuffer;
+		uniformBufferView.Offset			= 0;
+		uniformBufferView.Size				= uniformBuffer->GetDescription().SizeInBytes;
+		resourceSet->WriteUniformBuffer(uniformBufferView, "Camera");
+		resourceSet->WriteCombinedImageSampler(m_HdriImage, sampler, "equirectangularMap");
+
+		commandList->Begin();
+		commandList->SetPipeline(m_Generation.Pipeline);
+		commandList->SetRenderTarget(Nexus::Graphics::RenderTarget(framebuffer));
+
+		Nexus::Graphics::Viewport vp {};
+		vp.X		= 0;
+		vp.Y		= 0;
+		vp.Width	= size;
+		vp.Height	= size;
+		vp.MinDepth = 0.0f;
+		vp.MaxDepth = 1.0f;
+		commandList->SetViewport(vp);
+
+		Nexus::Graphics::Scissor scissor {};
+		scissor.X	   = 0;
+		scissor.Y	   = 0;
+		scissor.Width  = size;
+		scissor.Height = size;
+		commandList->SetScissor(scissor);
+
+		commandList->SetResourceSet(resourceSet);
+
+		Graphics::VertexBufferView vertexBufferView = {};
+		vertexBufferView.BufferHandle				= cube->GetVertexBuffer();
+		vertexBufferView.Offset						= 0;
+		vertexBufferView.Size						= cube->GetVertexBuffer()->GetSizeInBytes();
+		commandList->SetVertexBuffer(vertexBufferView, 0);
+
+		Graphics::IndexBufferView indexBufferView = {};
+		indexBufferView.BufferHandle			  = cube->GetIndexBuffer();
+		indexBufferView.Offset					  = 0;
+		indexBufferView.Size					  = cube->GetIndexBuffer()->GetSizeInBytes();
+		indexBufferView.BufferFormat			  = Nexus::Graphics::IndexFormat::UInt32;
+		commandList->SetIndexBuffer(indexBufferView);
+
+		auto indexCount = cube->GetIndexBuffer()->GetCount();
+
+		Nexus::Graphics::DrawIndexedDescription drawDesc = {};
+		drawDesc.VertexStart							 = 0;
+		drawDesc.IndexStart								 = 0;
+		drawDesc.InstanceStart							 = 0;
+		drawDesc.IndexCount								 = indexCount;
+		drawDesc.InstanceCount							 = 1;
+		commandList->DrawIndexed(drawDesc);
+
+		// the face is copied into the cubemap on the GPU, so nothing waits for it to be rendered
+		Nexus::Graphics::TextureCopyDescription faceCopyDesc = {};
+		faceCopyDesc.Source									 = framebuffer->GetColorTexture(0);
+		faceCopyDesc.Destination							 = m_Generation.Cubemap;
+		faceCopyDesc.SourceSubresource						 = {.MipLevel = 0, .BaseArrayLayer = 0, .LayerCount = 1};
+		faceCopyDesc.DestinationSubresource					 = {.MipLevel = 0, .BaseArrayLayer = face, .LayerCount = 1};
+		faceCopyDesc.Extent									 = {.Width = size, .Height = size, .Depth = 1};
+		commandList->CopyTextureToTexture(faceCopyDesc);
+
+		commandList->End();
+
+		m_CommandQueue->SubmitCommandListsForFrame(&commandList, 1);
+
+		if (m_Generation.NextFace < 6)
 		{
-			glm::vec3 position = glm::vec3(0.0f, 0.0f, 0.0f);
-
-			float yaw = 0.0f, pitch = 0.0f;
-			GetDirection(i, yaw, pitch, m_Device->IsUVOriginTopLeft());
-
-			glm::vec3 up = glm::vec3(0.0f, 1.0f, 0.0f);
-
-			glm::quat rotP = glm::angleAxis(glm::radians(pitch), glm::vec3(1.0f, 0.0f, 0.0f));
-			glm::quat rotY = glm::angleAxis(glm::radians(yaw), glm::vec3(0.0f, 1.0f, 0.0f));
-			glm::mat4 view = glm::mat4_cast(rotY) * glm::mat4_cast(rotP);
-
-			if (!m_Device->IsUVOriginTopLeft())
-			{
-				view *= glm::rotate(glm::mat4(1.0f), glm::radians(180.0f), glm::vec3(1.0f, 0.0f, 0.0f));
-			}
-
-			float	  fov		  = 90.0f;
-			float	  aspectRatio = 1.0f;
-			float	  camNear	  = 0.1f;
-			float	  camFar	  = 100.0f;
-			glm::mat4 projection  = glm::perspective(glm::radians(fov), aspectRatio, camNear, camFar);
-
-			cameraUniforms.View		  = view;
-			cameraUniforms.Projection = projection;
-
-			uniformBuffer->SetData(&cameraUniforms, 0, sizeof(cameraUniforms));
-
-			UniformBufferView uniformBufferView = {};
-			uniformBufferView.BufferHandle		= uniformBuffer;
-			uniformBufferView.Offset			= 0;
-			uniformBufferView.Size				= uniformBuffer->GetDescription().SizeInBytes;
-			resourceSet->WriteUniformBuffer(uniformBufferView, "Camera");
-			resourceSet->WriteCombinedImageSampler(m_HdriImage, sampler, "equirectangularMap");
-
-			commandList->Begin();
-			commandList->SetPipeline(pipeline);
-			commandList->SetRenderTarget(Nexus::Graphics::RenderTarget(framebuffer));
-
-			Nexus::Graphics::Viewport vp {};
-			vp.X		= 0;
-			vp.Y		= 0;
-			vp.Width	= size;
-			vp.Height	= size;
-			vp.MinDepth = 0.0f;
-			vp.MaxDepth = 1.0f;
-			commandList->SetViewport(vp);
-
-			Nexus::Graphics::Scissor scissor {};
-			scissor.X	   = 0;
-			scissor.Y	   = 0;
-			scissor.Width  = size;
-			scissor.Height = size;
-			commandList->SetScissor(scissor);
-
-			commandList->SetResourceSet(resourceSet);
-
-			Graphics::VertexBufferView vertexBufferView = {};
-			vertexBufferView.BufferHandle				= cube->GetVertexBuffer();
-			vertexBufferView.Offset						= 0;
-			vertexBufferView.Size						= cube->GetVertexBuffer()->GetSizeInBytes();
-			commandList->SetVertexBuffer(vertexBufferView, 0);
-
-			Graphics::IndexBufferView indexBufferView = {};
-			indexBufferView.BufferHandle			  = cube->GetIndexBuffer();
-			indexBufferView.Offset					  = 0;
-			indexBufferView.Size					  = cube->GetIndexBuffer()->GetSizeInBytes();
-			indexBufferView.BufferFormat			  = Nexus::Graphics::IndexFormat::UInt32;
-			commandList->SetIndexBuffer(indexBufferView);
-
-			auto indexCount = cube->GetIndexBuffer()->GetCount();
-
-			Nexus::Graphics::DrawIndexedDescription drawDesc = {};
-			drawDesc.VertexStart							 = 0;
-			drawDesc.IndexStart								 = 0;
-			drawDesc.InstanceStart							 = 0;
-			drawDesc.IndexCount								 = indexCount;
-			drawDesc.InstanceCount							 = 1;
-			commandList->DrawIndexed(drawDesc);
-
-			commandList->End();
-
-			m_CommandQueue->SubmitCommandLists(&commandList, 1, nullptr);
-			m_Device->WaitForIdle();
-
-			Ref<Texture>	  colourTexture = framebuffer->GetColorTexture(0);
-			std::vector<char> pixels		= m_Device->ReadFromTexture(colourTexture, m_CommandQueue, 0, 0, 0, 0, 0, size, size);
-
-			m_Device->WriteToTexture(cubemap, m_CommandQueue, i, 0, 0, 0, 0, size, size, pixels.data(), pixels.size());
+			return false;
 		}
 
-		return cubemap;
+		// the cubemap is kept, but the resources used to render it are no longer needed
+		Ref<Texture> cubemap  = m_Generation.Cubemap;
+		m_Generation		  = {};
+		m_Generation.Cubemap  = cubemap;
+		m_Generation.NextFace = 6;
+		return true;
+	}
+
+	Ref<Texture> HdriProcessor::GetCubemap() const
+	{
+		return m_Generation.Cubemap;
 	}
 
 	Ref<Texture> HdriProcessor::GetLoadedTexture() const
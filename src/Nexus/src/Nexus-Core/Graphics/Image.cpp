@@ -5,6 +5,8 @@
 #include "Nexus-Core/Graphics/GraphicsDevice.hpp"
 #include "Nexus-Core/Graphics/Texture.hpp"
 
+#include "stb_image.h"
+
 namespace Nexus::Graphics
 {
 	void Image::FlipVertically()
@@ -12,6 +14,73 @@ namespace Nexus::Graphics
 		Utils::FlipPixelsVertically(Pixels.data(), Width, Height, Format);
 	}
 
+	/// @brief Copies pixels returned by stb_image into an image, stb_image's global vertical flip setting is not used because it is shared
+	/// between threads
+	static Image CreateDecodedImage(void *pixels, int width, int height, PixelFormat format, bool flipVertically)
+	{
+		Image image = {};
+		if (!pixels)
+		{
+			return image;
+		}
+
+		image.Width	 = (uint32_t)width;
+		image.Height = (uint32_t)height;
+		image.Format = format;
+
+		const char *bytes = static_cast<const char *>(pixels);
+		image.Pixels.assign(bytes, bytes + (size_t)width * height * GetPixelFormatSizeInBytes(format));
+		stbi_image_free(pixels);
+
+		if (flipVertically)
+		{
+			image.FlipVertically();
+		}
+
+		return image;
+	}
+
+	Image Image::FromFile(const std::string &filepath, PixelFormat format, bool flipVertically)
+	{
+		int width = 0, height = 0, channels = 0;
+
+		if (format == PixelFormat::R32_G32_B32_A32_Float)
+		{
+			float *pixels = stbi_loadf(filepath.c_str(), &width, &height, &channels, 4);
+			return CreateDecodedImage(pixels, width, height, format, flipVertically);
+		}
+
+		if (format != PixelFormat::R8_G8_B8_A8_UNorm && format != PixelFormat::R8_G8_B8_A8_UNorm_SRGB)
+		{
+			throw std::runtime_error("Images can only be loaded as R8_G8_B8_A8 or R32_G32_B32_A32_Float");
+		}
+
+		unsigned char *pixels = stbi_load(filepath.c_str(), &width, &height, &channels, 4);
+		return CreateDecodedImage(pixels, width, height, format, flipVertically);
+	}
+
+	Image Image::FromMemory(const void *data, size_t size, PixelFormat format, bool flipVertically)
+	{
+		int width = 0, height = 0, channels = 0;
+
+		const stbi_uc *encoded	   = static_cast<const stbi_uc *>(data);
+		int			   encodedSize = (int)size;
+
+		if (format == PixelFormat::R32_G32_B32_A32_Float)
+		{
+			float *pixels = stbi_loadf_from_memory(encoded, encodedSize, &width, &height, &channels, 4);
+			return CreateDecodedImage(pixels, width, height, format, flipVertically);
+		}
+
+		if (format != PixelFormat::R8_G8_B8_A8_UNorm && format != PixelFormat::R8_G8_B8_A8_UNorm_SRGB)
+		{
+			throw std::runtime_error("Images can only be loaded as R8_G8_B8_A8 or R32_G32_B32_A32_Float");
+		}
+
+		unsigned char *pixels = stbi_load_from_memory(encoded, encodedSize, &width, &height, &channels, 4);
+		return CreateDecodedImage(pixels, width, height, format, flipVertically);
+	}
+
 	Image Image::FromTexture(GraphicsDevice	   *device,
 							 Ref<ICommandQueue> commandQueue,
 							 Ref<Texture>		texture,
@@ -63,7 +63,7 @@ namespace Nexus::Graphics
 
 											 22, 21, 20, 20, 23, 22};
 
-		auto fullVertices = Nexus::Graphics::Utilities::GenerateTangentAndBinormals(vertices);
+		auto fullVertices = Nexus::Graphics::Utilities::GenerateTangentAndBinormals(vertices, indices);
 
 		auto vertexBuffer = Utils::CreateFilledVertexBuffer(fullVertices.data(),
 															fullVertices.size() * sizeof(VertexPositionTexCoordNormalTangentBitangent),
@@ -74,7 +74,8 @@ namespace Nexus::Graphics
 		auto indexBuffer =
 			Utils::CreateFilledIndexBuffer(indices.data(), indices.size() * sizeof(uint32_t), sizeof(uint32_t), m_Device, m_CommandQueue);
 
-		return CreateRef<Mesh>(vertexBuffer, indexBuffer, Material {});
+		BoundingBox bounds = {.Min = glm::vec3(-0.5f, -0.5f, -0.5f), .Max = glm::vec3(0.5f, 0.5f, 0.5f)};
+		return CreateRef<Mesh>(vertexBuffer, indexBuffer, Material {}, "Cube", bounds);
 	}
 
 	Ref<Mesh> MeshFactory::CreateSprite()
@@ -96,7 +97,8 @@ namespace Nexus::Graphics
 		auto indexBuffer =
 			Utils::CreateFilledIndexBuffer(indices.data(), indices.size() * sizeof(uint32_t), sizeof(uint32_t), m_Device, m_CommandQueue);
 
-		return CreateRef<Mesh>(vertexBuffer, indexBuffer, Material {});
+		BoundingBox bounds = {.Min = glm::vec3(-0.5f, -0.5f, 0.0f), .Max = glm::vec3(0.5f, 0.5f, 0.0f)};
+		return CreateRef<Mesh>(vertexBuffer, indexBuffer, Material {}, "Sprite", bounds);
 	}
 
 	Ref<Mesh> MeshFactory::CreateTriangle()
@@ -117,13 +119,14 @@ namespace Nexus::Graphics
 		auto indexBuffer =
 			Utils::CreateFilledIndexBuffer(indices.data(), indices.size() * sizeof(uint32_t), sizeof(uint32_t), m_Device, m_CommandQueue);
 
-		return CreateRef<Mesh>(vertexBuffer, indexBuffer, Material {});
+		BoundingBox bounds = {.Min = glm::vec3(-0.5f, -0.5f, 0.0f), .Max = glm::vec3(0.5f, 0.5f, 0.0f)};
+		return CreateRef<Mesh>(vertexBuffer, indexBuffer, Material {}, "Triangle", bounds);
 	}
 
-	Ref<Model> MeshFactory::CreateFrom3DModelFile(const std::string &filepath)
+	Ref<Model> MeshFactory::CreateFrom3DModelFile(const std::string &filepath, bool quantizeVertices)
 	{
 		Nexus::Processors::AssimpProcessor importer {};
-		Ref<Model>						   model = importer.Import(filepath, m_Device, m_CommandQueue);
+		Ref<Model>						   model = importer.Import(filepath, m_Device, m_CommandQueue, quantizeVertices);
 		return model;
 	}
 }	 // namespace Nexus::Graphics
\ No newline at end of file
@@ -0,0 +1,419 @@
+#include "Nexus-Core/Graphics/MeshOptimizer.hpp"
+
+#include "Nexus-Core/Graphics/Model.hpp"
+
+namespace Nexus::Graphics::MeshOptimizer
+{
+	using MeshVertex = VertexPositionTexCoordNormalColourTangentBitangent;
+
+	// vertices are compared and hashed by their bytes, so the vertex must not contain any padding
+	static_assert(sizeof(MeshVertex) == 18 * sizeof(float));
+
+	/// @brief The size of a line of the simulated vertex fetch cache
+	static constexpr size_t c_FetchCacheLineSize = 64;
+
+	/// @brief The number of lines in the simulated direct mapped vertex fetch cache
+	static constexpr size_t c_FetchCacheLineCount = 256;
+
+	/// @brief Simulates a FIFO cache by recording the time that each vertex was added, a vertex is still cached if fewer than the size of the
+	/// cache misses have happened since then
+	struct VertexCacheSimulator
+	{
+		std::vector<uint32_t> Timestamps = {};
+		uint32_t			  Size		 = 0;
+		uint32_t			  Time		 = 0;
+
+		VertexCacheSimulator(size_t vertexCount, uint32_t size) : Timestamps(vertexCount, 0), Size(size), Time(size + 1)
+		{
+		}
+
+		/// @brief Returns whether the vertex missed the cache, adding it if it did
+		bool Access(uint32_t vertex)
+		{
+			if (Time - Timestamps[vertex] > Size)
+			{
+				Timestamps[vertex] = Time++;
+				return true;
+			}
+
+			return false;
+		}
+
+		uint32_t AccessTriangle(const uint32_t *triangle)
+		{
+			return (uint32_t)Access(triangle[0]) + (uint32_t)Access(triangle[1]) + (uint32_t)Access(triangle[2]);
+		}
+
+		void Clear()
+		{
+			Time += Size + 1;
+		}
+	};
+
+	static void ValidateMesh(const MeshData &mesh)
+	{
+		if (mesh.indices.size() % 3 != 0)
+		{
+			throw std::runtime_error("Attempting to optimize a mesh not made of triangles");
+		}
+
+		for (uint32_t index : mesh.indices)
+		{
+			if (index >= mesh.vertices.size())
+			{
+				throw std::runtime_error("Attempting to optimize a mesh with an index outside of its vertices");
+			}
+		}
+	}
+
+	MeshStatistics AnalyzeMesh(const MeshData &mesh, uint32_t cacheSize)
+	{
+		ValidateMesh(mesh);
+
+		MeshStatistics statistics = {};
+		if (mesh.indices.empty())
+		{
+			return statistics;
+		}
+
+		VertexCacheSimulator cache(mesh.vertices.size(), cacheSize);
+		std::vector<bool>	 referenced(mesh.vertices.size(), false);
+		size_t				 referencedCount = 0;
+		size_t				 misses			 = 0;
+
+		std::array<size_t, c_FetchCacheLineCount> lines = {};
+		lines.fill(SIZE_MAX);
+		size_t fetchedBytes = 0;
+
+		for (uint32_t index : mesh.indices)
+		{
+			if (!referenced[index])
+			{
+				referenced[index] = true;
+				referencedCount++;
+			}
+
+			if (!cache.Access(index))
+			{
+				continue;
+			}
+
+			// only vertices that miss the post-transform cache are read from memory
+			misses++;
+			size_t begin = (size_t)index * sizeof(MeshVertex);
+			size_t end	 = begin + sizeof(MeshVertex);
+			for (size_t line = begin / c_FetchCacheLineSize; line <= (end - 1) / c_FetchCacheLineSize; line++)
+			{
+				size_t &slot = lines[line % c_FetchCacheLineCount];
+				if (slot != line)
+				{
+					slot = line;
+					fetchedBytes += c_FetchCacheLineSize;
+				}
+			}
+		}
+
+		statistics.ACMR			  = (float)misses / (float)(mesh.indices.size() / 3);
+		statistics.ATVR			  = (float)misses / (float)referencedCount;
+		statistics.OverfetchRatio = (float)fetchedBytes / (float)(referencedCount * sizeof(MeshVertex));
+		return statistics;
+	}
+
+	size_t DeduplicateVertices(MeshData &mesh)
+	{
+		ValidateMesh(mesh);
+
+		// the keys point into the original vertices, which stay alive until the unique vertices replace them
+		std::unordered_map<std::string_view, uint32_t> unique;
+		unique.reserve(mesh.vertices.size());
+
+		std::vector<uint32_t>	remap(mesh.vertices.size());
+		std::vector<MeshVertex> vertices;
+		vertices.reserve(mesh.vertices.size());
+
+		for (size_t i = 0; i < mesh.vertices.size(); i++)
+		{
+			std::string_view key	  = std::string_view((const char *)&mesh.vertices[i], sizeof(MeshVertex));
+			auto [iterator, inserted] = unique.try_emplace(key, (uint32_t)vertices.size());
+			if (inserted)
+			{
+				vertices.push_back(mesh.vertices[i]);
+			}
+			remap[i] = iterator->second;
+		}
+
+		for (uint32_t &index : mesh.indices) { index = remap[index]; }
+
+		size_t removed = mesh.vertices.size() - vertices.size();
+		mesh.vertices  = std::move(vertices);
+		return removed;
+	}
+
+	void OptimizeVertexCache(MeshData &mesh, uint32_t cacheSize)
+	{
+		ValidateMesh(mesh);
+
+		size_t vertexCount	 = mesh.vertices.size();
+		size_t triangleCount = mesh.indices.size() / 3;
+		if (triangleCount == 0)
+		{
+			return;
+		}
+
+		// the triangles that use each vertex, stored contiguously with each vertex's triangles starting at its offset
+		std::vector<uint32_t> offsets(vertexCount + 1, 0);
+		for (uint32_t index : mesh.indices) { offsets[index + 1]++; }
+		for (size_t i = 0; i < vertexCount; i++) { offsets[i + 1] += offsets[i]; }
+
+		std::vector<uint32_t> adjacency(mesh.indices.size());
+		std::vector<uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+		for (size_t i = 0; i < mesh.indices.size(); i++) { adjacency[cursors[mesh.indices[i]]++] = (uint32_t)(i / 3); }
+
+		std::vector<uint32_t> liveTriangles(vertexCount);
+		for (size_t i = 0; i < vertexCount; i++) { liveTriangles[i] = offsets[i + 1] - offsets[i]; }
+
+		VertexCacheSimulator  cache(vertexCount, cacheSize);
+		std::vector<bool>	  emitted(triangleCount, false);
+		std::vector<uint32_t> deadEnds	 = {};
+		std::vector<uint32_t> candidates = {};
+		std::vector<uint32_t> output	 = {};
+		output.reserve(mesh.indices.size());
+		size_t scan = 0;
+
+		// when none of the recently used vertices have triangles left, Tipsify jumps to the most recently used vertex that still does, and
+		// only scans the whole mesh once there are none
+		auto skipDeadEnd = [&]() -> int64_t
+		{
+			while (!deadEnds.empty())
+			{
+				uint32_t vertex = deadEnds.back();
+				deadEnds.pop_back();
+				if (liveTriangles[vertex] > 0)
+				{
+					return vertex;
+				}
+			}
+
+			for (; scan < vertexCount; scan++)
+			{
+				if (liveTriangles[scan] > 0)
+				{
+					return (int64_t)scan;
+				}
+			}
+
+			return -1;
+		};
+
+		int64_t fan = skipDeadEnd();
+		while (fan >= 0)
+		{
+			candidates.clear();
+
+			for (uint32_t i = offsets[fan]; i < offsets[fan + 1]; i++)
+			{
+				uint32_t triangle = adjacency[i];
+				if (emitted[triangle])
+				{
+					continue;
+				}
+
+				emitted[triangle] = true;
+				for (uint32_t corner = 0; corner < 3; corner++)
+				{
+					uint32_t vertex = mesh.indices[triangle * 3 + corner];
+					output.push_back(vertex);
+					deadEnds.push_back(vertex);
+					candidates.push_back(vertex);
+					liveTriangles[vertex]--;
+					cache.Access(vertex);
+				}
+			}
+
+			// the next fan is the candidate that has been cached the longest while still being cached once all of its triangles are drawn
+			int64_t next		 = -1;
+			int64_t bestPriority = -1;
+			for (uint32_t vertex : candidates)
+			{
+				if (liveTriangles[vertex] == 0)
+				{
+					continue;
+				}
+
+				int64_t priority = 0;
+				int64_t age		 = (int64_t)cache.Time - (int64_t)cache.Timestamps[vertex];
+				if (age + 2 * (int64_t)liveTriangles[vertex] <= (int64_t)cacheSize)
+				{
+					priority = age;
+				}
+
+				if (priority > bestPriority)
+				{
+					bestPriority = priority;
+					next		 = vertex;
+				}
+			}
+
+			fan = next >= 0 ? next : skipDeadEnd();
+		}
+
+		mesh.indices = std::move(output);
+	}
+
+	void OptimizeOverdraw(MeshData &mesh, float threshold, uint32_t cacheSize)
+	{
+		ValidateMesh(mesh);
+
+		size_t triangleCount = mesh.indices.size() / 3;
+		if (triangleCount < 2)
+		{
+			return;
+		}
+
+		// a triangle that misses the cache with every vertex is where the previous ordering jumped to another part of the mesh, so clusters
+		// can always be split there without making the cache any worse
+		VertexCacheSimulator  cache(mesh.vertices.size(), cacheSize);
+		std::vector<uint32_t> misses(triangleCount);
+		std::vector<size_t>	  hardBoundaries = {};
+		for (size_t i = 0; i < triangleCount; i++)
+		{
+			misses[i] = cache.AccessTriangle(&mesh.indices[i * 3]);
+			if (i == 0 || misses[i] == 3)
+			{
+				hardBoundaries.push_back(i);
+			}
+		}
+		hardBoundaries.push_back(triangleCount);
+
+		// each cluster is split further once its own ACMR is close enough to that of the part of the mesh it came from, every cluster is
+		// then simulated from an empty cache because the clusters will be drawn in a different order
+		std::vector<size_t> clusters = {};
+		for (size_t h = 0; h + 1 < hardBoundaries.size(); h++)
+		{
+			size_t start = hardBoundaries[h];
+			size_t end	 = hardBoundaries[h + 1];
+
+			float target = (float)std::accumulate(misses.begin() + start, misses.begin() + end, (size_t)0) / (float)(end - start);
+
+			cache.Clear();
+			clusters.push_back(start);
+			size_t clusterStart	 = start;
+			size_t clusterMisses = 0;
+
+			for (size_t i = start; i < end; i++)
+			{
+				clusterMisses += cache.AccessTriangle(&mesh.indices[i * 3]);
+				if (i + 1 < end && (float)clusterMisses <= threshold * target * (float)(i + 1 - clusterStart))
+				{
+					cache.Clear();
+					clusters.push_back(i + 1);
+					clusterStart  = i + 1;
+					clusterMisses = 0;
+				}
+			}
+		}
+		clusters.push_back(triangleCount);
+
+		// the vertex normals are used rather than the winding, so that this works with either front face convention
+		std::vector<glm::vec3> clusterCentroids(clusters.size() - 1, glm::vec3(0.0f));
+		std::vector<glm::vec3> clusterNormals(clusters.size() - 1, glm::vec3(0.0f));
+		glm::vec3			   meshCentroid = glm::vec3(0.0f);
+		float				   meshArea		= 0.0f;
+
+		for (size_t c = 0; c + 1 < clusters.size(); c++)
+		{
+			float clusterArea = 0.0f;
+			for (size_t i = clusters[c]; i < clusters[c + 1]; i++)
+			{
+				const MeshVertex &v0 = mesh.vertices[mesh.indices[i * 3 + 0]];
+				const MeshVertex &v1 = mesh.vertices[mesh.indices[i * 3 + 1]];
+				const MeshVertex &v2 = mesh.vertices[mesh.indices[i * 3 + 2]];
+
+				float	  area	   = glm::length(glm::cross(v1.Position - v0.Position, v2.Position - v0.Position)) * 0.5f;
+				glm::vec3 centroid = (v0.Position + v1.Position + v2.Position) / 3.0f;
+				glm::vec3 normal   = v0.Normal + v1.Normal + v2.Normal;
+				float	  length   = glm::length(normal);
+
+				clusterCentroids[c] += centroid * area;
+				if (length > 0.0f)
+				{
+					clusterNormals[c] += normal * (area / length);
+				}
+				clusterArea += area;
+			}
+
+			meshCentroid += clusterCentroids[c];
+			meshArea += clusterArea;
+			if (clusterArea > 0.0f)
+			{
+				clusterCentroids[c] /= clusterArea;
+			}
+		}
+
+		if (meshArea > 0.0f)
+		{
+			meshCentroid /= meshArea;
+		}
+
+		// clusters that face away from the centre of the mesh are the most likely to occlude the others, so they are drawn first
+		std::vector<float>	  sortKeys(clusters.size() - 1, 0.0f);
+		std::vector<uint32_t> order(clusters.size() - 1);
+		for (size_t c = 0; c < order.size(); c++)
+		{
+			float length = glm::length(clusterNormals[c]);
+			if (length > 0.0f)
+			{
+				sortKeys[c] = glm::dot(clusterCentroids[c] - meshCentroid, clusterNormals[c] / length);
+			}
+			order[c] = (uint32_t)c;
+		}
+
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return sortKeys[a] > sortKeys[b]; });
+
+		std::vector<uint32_t> indices;
+		indices.reserve(mesh.indices.size());
+		for (uint32_t c : order)
+		{
+			indices.insert(indices.end(), mesh.indices.begin() + clusters[c] * 3, mesh.indices.begin() + clusters[c + 1] * 3);
+		}
+
+		mesh.indices = std::move(indices);
+	}
+
+	void OptimizeVertexFetch(MeshData &mesh)
+	{
+		ValidateMesh(mesh);
+
+		std::vector<uint32_t>	remap(mesh.vertices.size(), UINT32_MAX);
+		std::vector<MeshVertex> vertices;
+		vertices.reserve(mesh.vertices.size());
+
+		for (uint32_t &index : mesh.indices)
+		{
+			if (remap[index] == UINT32_MAX)
+			{
+				remap[index] = (uint32_t)vertices.size();
+				vertices.push_back(mesh.vertices[index]);
+			}
+			index = remap[index];
+		}
+
+		mesh.vertices = std::move(vertices);
+	}
+
+	MeshOptimizationReport OptimizeMesh(MeshData &mesh)
+	{
+		MeshOptimizationReport report = {};
+		report.VerticesBefore		  = mesh.vertices.size();
+		report.Before				  = AnalyzeMesh(mesh);
+
+		DeduplicateVertices(mesh);
+		OptimizeVertexCache(mesh);
+		OptimizeOverdraw(mesh);
+		OptimizeVertexFetch(mesh);
+
+		report.VerticesAfter = mesh.vertices.size();
+		report.After		 = AnalyzeMesh(mesh);
+		return report;
+	}
+}	 // namespace Nexus::Graphics::MeshOptimizer
@@ -0,0 +1,399 @@
+#include "Nexus-Core/Graphics/MeshSimplifier.hpp"
+
+#include "Nexus-Core/Graphics/Model.hpp"
+
+namespace Nexus::Graphics::MeshSimplifier
+{
+	/// @brief A level of detail is only kept if it has at most this fraction of the indices of the previous level
+	static constexpr float c_MinLodReduction = 0.85f;
+
+	/// @brief The sum of the squared distances from a point to a set of planes, stored as the upper triangle of a symmetric 4x4 matrix
+	struct Quadric
+	{
+		double A00 = 0.0, A01 = 0.0, A02 = 0.0, A11 = 0.0, A12 = 0.0, A22 = 0.0;
+		double B0  = 0.0, B1 = 0.0, B2 = 0.0;
+		double C   = 0.0;
+
+		/// @brief Adds the plane with the given unit normal that passes through a point
+		void AddPlane(const glm::dvec3 &normal, const glm::dvec3 &point)
+		{
+			double distance = -glm::dot(normal, point);
+
+			A00 += normal.x * normal.x;
+			A01 += normal.x * normal.y;
+			A02 += normal.x * normal.z;
+			A11 += normal.y * normal.y;
+			A12 += normal.y * normal.z;
+			A22 += normal.z * normal.z;
+			B0 += normal.x * distance;
+			B1 += normal.y * distance;
+			B2 += normal.z * distance;
+			C += distance * distance;
+		}
+
+		void Add(const Quadric &other)
+		{
+			A00 += other.A00;
+			A01 += other.A01;
+			A02 += other.A02;
+			A11 += other.A11;
+			A12 += other.A12;
+			A22 += other.A22;
+			B0 += other.B0;
+			B1 += other.B1;
+			B2 += other.B2;
+			C += other.C;
+		}
+
+		double Evaluate(const glm::dvec3 &p) const
+		{
+			double result = A00 * p.x * p.x + A11 * p.y * p.y + A22 * p.z * p.z + 2.0 * (A01 * p.x * p.y + A02 * p.x * p.z + A12 * p.y * p.z) +
+							2.0 * (B0 * p.x + B1 * p.y + B2 * p.z) + C;
+
+			// rounding can make the sum very slightly negative
+			return std::max(result, 0.0);
+		}
+	};
+
+	/// @brief A candidate collapse of one vertex onto another, which is out of date if either vertex has changed since it was created
+	struct EdgeCollapse
+	{
+		double	 Cost		 = 0.0;
+		uint32_t From		 = 0;
+		uint32_t To			 = 0;
+		uint32_t FromVersion = 0;
+		uint32_t ToVersion	 = 0;
+	};
+
+	/// @brief Orders collapses so that the cheapest is at the top of a priority queue, with ties broken by the vertices so that the order does
+	/// not depend on the implementation of the queue
+	struct EdgeCollapseOrder
+	{
+		bool operator()(const EdgeCollapse &a, const EdgeCollapse &b) const
+		{
+			return std::tie(a.Cost, a.From, a.To) > std::tie(b.Cost, b.From, b.To);
+		}
+	};
+
+	MeshLod Simplify(const MeshData &mesh, size_t targetIndexCount, float maxError)
+	{
+		if (mesh.indices.size() % 3 != 0)
+		{
+			throw std::runtime_error("Attempting to simplify a mesh not made of triangles");
+		}
+
+		for (uint32_t index : mesh.indices)
+		{
+			if (index >= mesh.vertices.size())
+			{
+				throw std::runtime_error("Attempting to simplify a mesh with an index outside of its vertices");
+			}
+		}
+
+		size_t vertexCount	 = mesh.vertices.size();
+		size_t triangleCount = mesh.indices.size() / 3;
+
+		std::vector<glm::dvec3> positions(vertexCount);
+		for (size_t i = 0; i < vertexCount; i++) { positions[i] = glm::dvec3(mesh.vertices[i].Position); }
+
+		// vertices at the same position share a quadric and are treated as one when finding the neighbours of a vertex, the first vertex at
+		// each position represents the group
+		std::vector<uint32_t> groups(vertexCount);
+		std::vector<uint32_t> groupSizes(vertexCount, 0);
+		{
+			std::unordered_map<std::string_view, uint32_t> firstAtPosition;
+			firstAtPosition.reserve(vertexCount);
+			for (uint32_t i = 0; i < (uint32_t)vertexCount; i++)
+			{
+				std::string_view key = std::string_view((const char *)&mesh.vertices[i].Position, sizeof(glm::vec3));
+				groups[i]			 = firstAtPosition.try_emplace(key, i).first->second;
+				groupSizes[groups[i]]++;
+			}
+		}
+
+		// a group containing several vertices is on a seam, which would open if only one side of it were moved
+		std::vector<bool> locked(vertexCount, false);
+		for (size_t i = 0; i < vertexCount; i++) { locked[i] = groupSizes[groups[i]] > 1; }
+
+		// an edge that is not shared by exactly two triangles is on a border or is non-manifold, so its vertices are kept in place
+		{
+			std::unordered_map<uint64_t, uint32_t> edgeCounts;
+			edgeCounts.reserve(mesh.indices.size());
+			for (size_t i = 0; i < mesh.indices.size(); i++)
+			{
+				uint32_t a = groups[mesh.indices[i]];
+				uint32_t b = groups[mesh.indices[i - i % 3 + (i + 1) % 3]];
+				edgeCounts[((uint64_t)std::min(a, b) << 32) | std::max(a, b)]++;
+			}
+
+			for (const auto &[edge, count] : edgeCounts)
+			{
+				if (count != 2)
+				{
+					locked[(uint32_t)(edge >> 32)]		  = true;
+					locked[(uint32_t)(edge & UINT32_MAX)] = true;
+				}
+			}
+		}
+
+		std::vector<Quadric> quadrics(vertexCount);
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			const glm::dvec3 &p0	 = positions[mesh.indices[t * 3 + 0]];
+			const glm::dvec3 &p1	 = positions[mesh.indices[t * 3 + 1]];
+			const glm::dvec3 &p2	 = positions[mesh.indices[t * 3 + 2]];
+			glm::dvec3		  normal = glm::cross(p1 - p0, p2 - p0);
+			double			  length = glm::length(normal);
+			if (length == 0.0)
+			{
+				continue;
+			}
+
+			for (uint32_t corner = 0; corner < 3; corner++) { quadrics[groups[mesh.indices[t * 3 + corner]]].AddPlane(normal / length, p0); }
+		}
+
+		std::vector<uint32_t>			   indices = mesh.indices;
+		std::vector<bool>				   removed(triangleCount, false);
+		std::vector<bool>				   collapsed(vertexCount, false);
+		std::vector<uint32_t>			   versions(vertexCount, 0);
+		std::vector<std::vector<uint32_t>> vertexTriangles(vertexCount);
+		std::vector<std::vector<uint32_t>> groupMembers(vertexCount);
+		for (size_t i = 0; i < indices.size(); i++) { vertexTriangles[indices[i]].push_back((uint32_t)(i / 3)); }
+		for (uint32_t i = 0; i < (uint32_t)vertexCount; i++) { groupMembers[groups[i]].push_back(i); }
+
+		std::priority_queue<EdgeCollapse, std::vector<EdgeCollapse>, EdgeCollapseOrder> queue;
+
+		// only unlocked vertices are moved, and they are never part of a larger group, so each collapse moves exactly one vertex
+		auto pushEdge = [&](uint32_t a, uint32_t b)
+		{
+			uint32_t groupA = groups[a], groupB = groups[b];
+			if (groupA == groupB || (locked[a] && locked[b]))
+			{
+				return;
+			}
+
+			Quadric quadric = quadrics[groupA];
+			quadric.Add(quadrics[groupB]);
+
+			double costAToB = locked[a] ? std::numeric_limits<double>::max() : quadric.Evaluate(positions[b]);
+			double costBToA = locked[b] ? std::numeric_limits<double>::max() : quadric.Evaluate(positions[a]);
+
+			if (costAToB <= costBToA)
+			{
+				queue.push(EdgeCollapse {.Cost = costAToB, .From = a, .To = b, .FromVersion = versions[groupA], .ToVersion = versions[groupB]});
+			}
+			else
+			{
+				queue.push(EdgeCollapse {.Cost = costBToA, .From = b, .To = a, .FromVersion = versions[groupB], .ToVersion = versions[groupA]});
+			}
+		};
+
+		auto getCorner = [&](uint32_t triangle, uint32_t vertex) -> int32_t
+		{
+			for (uint32_t corner = 0; corner < 3; corner++)
+			{
+				if (groups[indices[triangle * 3 + corner]] == groups[vertex])
+				{
+					return (int32_t)corner;
+				}
+			}
+			return -1;
+		};
+
+		std::vector<uint32_t> fromNeighbours = {};
+		std::vector<uint32_t> toNeighbours	 = {};
+
+		auto canCollapse = [&](uint32_t from, uint32_t to)
+		{
+			// the vertices that both are connected to must only be the third vertices of the triangles being removed, otherwise the collapse
+			// would join two parts of the surface together
+			fromNeighbours.clear();
+			toNeighbours.clear();
+			size_t sharedTriangles = 0;
+
+			for (uint32_t triangle : vertexTriangles[from])
+			{
+				if (removed[triangle])
+				{
+					continue;
+				}
+
+				sharedTriangles += getCorner(triangle, to) >= 0;
+				for (uint32_t corner = 0; corner < 3; corner++) { fromNeighbours.push_back(groups[indices[triangle * 3 + corner]]); }
+			}
+
+			for (uint32_t member : groupMembers[groups[to]])
+			{
+				for (uint32_t triangle : vertexTriangles[member])
+				{
+					if (!removed[triangle])
+					{
+						for (uint32_t corner = 0; corner < 3; corner++) { toNeighbours.push_back(groups[indices[triangle * 3 + corner]]); }
+					}
+				}
+			}
+
+			std::sort(fromNeighbours.begin(), fromNeighbours.end());
+			fromNeighbours.erase(std::unique(fromNeighbours.begin(), fromNeighbours.end()), fromNeighbours.end());
+			std::sort(toNeighbours.begin(), toNeighbours.end());
+			toNeighbours.erase(std::unique(toNeighbours.begin(), toNeighbours.end()), toNeighbours.end());
+
+			size_t sharedNeighbours = 0;
+			for (uint32_t neighbour : fromNeighbours)
+			{
+				if (neighbour != groups[from] && neighbour != groups[to] &&
+					std::binary_search(toNeighbours.begin(), toNeighbours.end(), neighbour))
+				{
+					sharedNeighbours++;
+				}
+			}
+
+			if (sharedNeighbours != sharedTriangles)
+			{
+				return false;
+			}
+
+			// the triangles that remain must not be flipped over or become degenerate
+			for (uint32_t triangle : vertexTriangles[from])
+			{
+				if (removed[triangle] || getCorner(triangle, to) >= 0)
+				{
+					continue;
+				}
+
+				std::array<glm::dvec3, 3> before = {};
+				std::array<glm::dvec3, 3> after	 = {};
+				for (uint32_t corner = 0; corner < 3; corner++)
+				{
+					uint32_t vertex = indices[triangle * 3 + corner];
+					before[corner]	= positions[vertex];
+					after[corner]	= vertex == from ? positions[to] : positions[vertex];
+				}
+
+				glm::dvec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+				glm::dvec3 normalAfter	= glm::cross(after[1] - after[0], after[2] - after[0]);
+				if (normalBefore != glm::dvec3(0.0) && glm::dot(normalBefore, normalAfter) <= 0.0)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		};
+
+		for (size_t i = 0; i < indices.size(); i++) { pushEdge(indices[i], indices[i - i % 3 + (i + 1) % 3]); }
+
+		double maxCost			   = (double)maxError * (double)maxError;
+		double largestCost		   = 0.0;
+		size_t remainingIndexCount = indices.size();
+
+		while (remainingIndexCount > targetIndexCount && !queue.empty())
+		{
+			EdgeCollapse collapse = queue.top();
+			queue.pop();
+
+			// the queue is ordered by cost and changed edges are always pushed again, so every remaining collapse is too expensive
+			if (collapse.Cost > maxCost)
+			{
+				break;
+			}
+
+			uint32_t from = collapse.From, to = collapse.To;
+			if (collapsed[from] || collapsed[to] || versions[groups[from]] != collapse.FromVersion || versions[groups[to]] != collapse.ToVersion)
+			{
+				continue;
+			}
+
+			if (!canCollapse(from, to))
+			{
+				continue;
+			}
+
+			for (uint32_t triangle : vertexTriangles[from])
+			{
+				if (removed[triangle])
+				{
+					continue;
+				}
+
+				if (getCorner(triangle, to) >= 0)
+				{
+					removed[triangle] = true;
+					remainingIndexCount -= 3;
+					continue;
+				}
+
+				// the triangles on this side of the edge use the same vertex of the target's group as the edge itself
+				for (uint32_t corner = 0; corner < 3; corner++)
+				{
+					if (indices[triangle * 3 + corner] == from)
+					{
+						indices[triangle * 3 + corner] = to;
+					}
+				}
+				vertexTriangles[to].push_back(triangle);
+			}
+
+			collapsed[from] = true;
+			vertexTriangles[from].clear();
+			quadrics[groups[to]].Add(quadrics[groups[from]]);
+			versions[groups[to]]++;
+			largestCost = std::max(largestCost, collapse.Cost);
+
+			// the quadric of the target changed, so the collapses of every edge connected to its group are pushed again
+			for (uint32_t member : groupMembers[groups[to]])
+			{
+				std::vector<uint32_t> &triangles = vertexTriangles[member];
+				triangles.erase(std::remove_if(triangles.begin(), triangles.end(), [&](uint32_t triangle) { return removed[triangle]; }),
+								triangles.end());
+
+				for (uint32_t triangle : triangles)
+				{
+					for (uint32_t corner = 0; corner < 3; corner++)
+					{
+						uint32_t vertex = indices[triangle * 3 + corner];
+						if (vertex != member)
+						{
+							pushEdge(vertex, member);
+						}
+					}
+				}
+			}
+		}
+
+		MeshLod lod = {};
+		lod.Indices.reserve(remainingIndexCount);
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			if (!removed[t])
+			{
+				lod.Indices.insert(lod.Indices.end(), indices.begin() + t * 3, indices.begin() + t * 3 + 3);
+			}
+		}
+
+		lod.Error = (float)std::sqrt(largestCost);
+		return lod;
+	}
+
+	void GenerateLods(MeshData &mesh, uint32_t maxLodCount, float reduction, float maxError)
+	{
+		mesh.lods.clear();
+
+		// every level is simplified from the full detail mesh, and as the simplification is deterministic each level continues the collapses
+		// of the previous one, so the errors of the levels only increase
+		size_t previousIndexCount = mesh.indices.size();
+		for (uint32_t i = 0; i < maxLodCount; i++)
+		{
+			size_t	targetIndexCount = (size_t)((float)(previousIndexCount / 3) * reduction) * 3;
+			MeshLod lod				 = Simplify(mesh, targetIndexCount, maxError);
+
+			if (lod.Indices.empty() || (float)lod.Indices.size() > (float)previousIndexCount * c_MinLodReduction)
+			{
+				break;
+			}
+
+			previousIndexCount = lod.Indices.size();
+			mesh.lods.push_back(std::move(lod));
+		}
+	}
+}	 // namespace Nexus::Graphics::MeshSimplifier
@@ -0,0 +1,318 @@
+#include "Nexus-Core/Graphics/MeshletBuilder.hpp"
+
+#include "Nexus-Core/Graphics/Model.hpp"
+
+namespace Nexus::Graphics::MeshletBuilder
+{
+	static constexpr uint32_t c_NotInMeshlet = std::numeric_limits<uint32_t>::max();
+	static constexpr uint32_t c_NoTriangle	 = std::numeric_limits<uint32_t>::max();
+
+	/// @brief Meshlets whose normals are further than this from their average are never treated as backfacing, since their cone would be
+	/// too wide to cull anything
+	static constexpr float c_MinConeDot = 0.1f;
+
+	/// @brief The triangles that use each vertex, stored in one array with the range of each vertex given by its offsets
+	struct TriangleAdjacency
+	{
+		std::vector<uint32_t> Offsets	= {};
+		std::vector<uint32_t> Triangles = {};
+
+		TriangleAdjacency(const std::vector<uint32_t> &indices, size_t vertexCount) : Offsets(vertexCount + 1, 0), Triangles(indices.size())
+		{
+			for (uint32_t index : indices) { Offsets[index + 1]++; }
+			for (size_t i = 0; i < vertexCount; i++) { Offsets[i + 1] += Offsets[i]; }
+
+			std::vector<uint32_t> cursors(Offsets.begin(), Offsets.end() - 1);
+			for (size_t i = 0; i < indices.size(); i++) { Triangles[cursors[indices[i]]++] = (uint32_t)(i / 3); }
+		}
+	};
+
+	/// @brief A triangle that could be added to the meshlet being built, candidates are ordered by the number of vertices they add and then by
+	/// how far they face from the meshlet
+	struct Candidate
+	{
+		uint32_t Triangle	   = c_NoTriangle;
+		uint32_t ExtraVertices = 0;
+		float	 Spread		   = 0.0f;
+
+		bool IsBetterThan(const Candidate &other) const
+		{
+			if (other.Triangle == c_NoTriangle)
+			{
+				return true;
+			}
+
+			return std::tie(ExtraVertices, Spread, Triangle) < std::tie(other.ExtraVertices, other.Spread, other.Triangle);
+		}
+	};
+
+	static glm::vec3 GetTriangleNormal(const MeshData &mesh, uint32_t a, uint32_t b, uint32_t c)
+	{
+		const glm::vec3 &p0		= mesh.vertices[a].Position;
+		glm::vec3		 normal = glm::cross(mesh.vertices[b].Position - p0, mesh.vertices[c].Position - p0);
+		float			 length = glm::length(normal);
+		return length > 0.0f ? normal / length : glm::vec3(0.0f);
+	}
+
+	static void ValidateMesh(const MeshData &mesh, uint32_t maxVertices, uint32_t maxTriangles)
+	{
+		if (maxVertices < 3 || maxVertices > 256)
+		{
+			throw std::runtime_error("Attempting to build meshlets with a vertex limit outside of 3 to 256");
+		}
+
+		if (maxTriangles == 0)
+		{
+			throw std::runtime_error("Attempting to build meshlets with a triangle limit of 0");
+		}
+
+		if (mesh.indices.size() % 3 != 0)
+		{
+			throw std::runtime_error("Attempting to build meshlets from a mesh not made of triangles");
+		}
+
+		for (uint32_t index : mesh.indices)
+		{
+			if (index >= mesh.vertices.size())
+			{
+				throw std::runtime_error("Attempting to build meshlets from a mesh with an index outside of its vertices");
+			}
+		}
+	}
+
+	static MeshletBounds CalculateBounds(const MeshData &mesh, const MeshletData &meshlets, const Meshlet &meshlet)
+	{
+		MeshletBounds bounds = {};
+
+		const uint32_t *vertexIndices = meshlets.VertexIndices.data() + meshlet.VertexOffset;
+		BoundingBox		box			  = {};
+		for (uint32_t i = 0; i < meshlet.VertexCount; i++) { box.Expand(mesh.vertices[vertexIndices[i]].Position); }
+
+		glm::vec3 centre = (box.Min + box.Max) * 0.5f;
+		float	  radius = 0.0f;
+		for (uint32_t i = 0; i < meshlet.VertexCount; i++)
+		{
+			radius = std::max(radius, glm::distance(centre, mesh.vertices[vertexIndices[i]].Position));
+		}
+		bounds.Sphere	= glm::vec4(centre, radius);
+		bounds.ConeApex = glm::vec4(centre, 0.0f);
+
+		std::vector<glm::vec3> normals	 = {};
+		std::vector<glm::vec3> corners	 = {};
+		glm::vec3			   normalSum = glm::vec3(0.0f);
+		for (uint32_t i = 0; i < meshlet.TriangleCount; i++)
+		{
+			std::array<uint32_t, 3> triangle = UnpackTriangle(meshlets.Triangles[meshlet.TriangleOffset + i]);
+			uint32_t				a		 = vertexIndices[triangle[0]];
+			glm::vec3				normal	 = GetTriangleNormal(mesh, a, vertexIndices[triangle[1]], vertexIndices[triangle[2]]);
+			if (normal == glm::vec3(0.0f))
+			{
+				continue;
+			}
+
+			normals.push_back(normal);
+			corners.push_back(mesh.vertices[a].Position);
+			normalSum += normal;
+		}
+
+		float sumLength = glm::length(normalSum);
+		if (sumLength == 0.0f)
+		{
+			return bounds;
+		}
+
+		glm::vec3 axis	 = normalSum / sumLength;
+		float	  minDot = 1.0f;
+		for (const glm::vec3 &normal : normals) { minDot = std::min(minDot, glm::dot(normal, axis)); }
+
+		if (minDot <= c_MinConeDot)
+		{
+			return bounds;
+		}
+
+		// the apex is moved back along the axis until it is behind the plane of every triangle, so that a camera that sees the apex from
+		// within the culling cone also sees every triangle from behind
+		float maxDistance = 0.0f;
+		for (size_t i = 0; i < normals.size(); i++)
+		{
+			float distance = glm::dot(centre - corners[i], normals[i]) / glm::dot(axis, normals[i]);
+			maxDistance	   = std::max(maxDistance, distance);
+		}
+
+		bounds.Cone		= glm::vec4(axis, std::sqrt(1.0f - minDot * minDot));
+		bounds.ConeApex = glm::vec4(centre - axis * maxDistance, 0.0f);
+		return bounds;
+	}
+
+	MeshletData BuildMeshlets(const MeshData &mesh, uint32_t maxVertices, uint32_t maxTriangles)
+	{
+		ValidateMesh(mesh, maxVertices, maxTriangles);
+
+		MeshletData result		  = {};
+		size_t		triangleCount = mesh.indices.size() / 3;
+		if (triangleCount == 0)
+		{
+			return result;
+		}
+
+		TriangleAdjacency	   adjacency(mesh.indices, mesh.vertices.size());
+		std::vector<glm::vec3> normals(triangleCount);
+		for (size_t i = 0; i < triangleCount; i++)
+		{
+			normals[i] = GetTriangleNormal(mesh, mesh.indices[i * 3], mesh.indices[i * 3 + 1], mesh.indices[i * 3 + 2]);
+		}
+
+		std::vector<bool>	  emitted(triangleCount, false);
+		std::vector<uint32_t> localIndices(mesh.vertices.size(), c_NotInMeshlet);
+		size_t				  emittedCount = 0;
+		size_t				  cursor	   = 0;
+
+		Meshlet	  meshlet	= {};
+		glm::vec3 normalSum = glm::vec3(0.0f);
+		uint32_t  seed		= c_NoTriangle;
+
+		auto finishMeshlet = [&]()
+		{
+			// the next meshlet starts next to this one if it can, so that consecutive meshlets are close together
+			seed = c_NoTriangle;
+			for (uint32_t i = 0; i < meshlet.VertexCount && seed == c_NoTriangle; i++)
+			{
+				uint32_t vertex = result.VertexIndices[meshlet.VertexOffset + i];
+				for (uint32_t j = adjacency.Offsets[vertex]; j < adjacency.Offsets[vertex + 1] && seed == c_NoTriangle; j++)
+				{
+					if (!emitted[adjacency.Triangles[j]])
+					{
+						seed = adjacency.Triangles[j];
+					}
+				}
+			}
+
+			for (uint32_t i = 0; i < meshlet.VertexCount; i++) { localIndices[result.VertexIndices[meshlet.VertexOffset + i]] = c_NotInMeshlet; }
+
+			result.Bounds.push_back(CalculateBounds(mesh, result, meshlet));
+			result.Meshlets.push_back(meshlet);
+
+			meshlet				   = {};
+			meshlet.VertexOffset   = (uint32_t)result.VertexIndices.size();
+			meshlet.TriangleOffset = (uint32_t)result.Triangles.size();
+			normalSum			   = glm::vec3(0.0f);
+		};
+
+		// the triangles around the vertices of a meshlet are the only ones that can be added without starting a new meshlet
+		auto findNeighbour = [&]()
+		{
+			float	  sumLength = glm::length(normalSum);
+			glm::vec3 axis		= sumLength > 0.0f ? normalSum / sumLength : glm::vec3(0.0f);
+
+			Candidate best = {};
+			for (uint32_t i = 0; i < meshlet.VertexCount; i++)
+			{
+				uint32_t vertex = result.VertexIndices[meshlet.VertexOffset + i];
+				for (uint32_t j = adjacency.Offsets[vertex]; j < adjacency.Offsets[vertex + 1]; j++)
+				{
+					uint32_t triangle = adjacency.Triangles[j];
+					if (emitted[triangle])
+					{
+						continue;
+					}
+
+					Candidate candidate = {.Triangle = triangle, .ExtraVertices = 0, .Spread = 1.0f - glm::dot(normals[triangle], axis)};
+					for (uint32_t corner = 0; corner < 3; corner++)
+					{
+						candidate.ExtraVertices += localIndices[mesh.indices[triangle * 3 + corner]] == c_NotInMeshlet ? 1 : 0;
+					}
+
+					if (meshlet.VertexCount + candidate.ExtraVertices <= maxVertices && candidate.IsBetterThan(best))
+					{
+						best = candidate;
+					}
+				}
+			}
+
+			return best.Triangle;
+		};
+
+		while (emittedCount < triangleCount)
+		{
+			uint32_t triangle = c_NoTriangle;
+			if (meshlet.TriangleCount > 0)
+			{
+				triangle = findNeighbour();
+				if (triangle == c_NoTriangle)
+				{
+					finishMeshlet();
+				}
+			}
+
+			if (triangle == c_NoTriangle)
+			{
+				triangle = seed;
+			}
+
+			// a meshlet that is not next to any remaining triangles is followed by the first remaining triangle in the index buffer
+			if (triangle == c_NoTriangle)
+			{
+				while (emitted[cursor]) { cursor++; }
+				triangle = (uint32_t)cursor;
+			}
+
+			uint32_t packed = 0;
+			for (uint32_t corner = 0; corner < 3; corner++)
+			{
+				uint32_t vertex = mesh.indices[triangle * 3 + corner];
+				if (localIndices[vertex] == c_NotInMeshlet)
+				{
+					localIndices[vertex] = meshlet.VertexCount++;
+					result.VertexIndices.push_back(vertex);
+				}
+
+				packed |= localIndices[vertex] << (corner * 8);
+			}
+
+			result.Triangles.push_back(packed);
+			meshlet.TriangleCount++;
+			normalSum += normals[triangle];
+			emitted[triangle] = true;
+			emittedCount++;
+
+			if (meshlet.TriangleCount == maxTriangles)
+			{
+				finishMeshlet();
+			}
+		}
+
+		if (meshlet.TriangleCount > 0)
+		{
+			finishMeshlet();
+		}
+
+		return result;
+	}
+
+	bool IsBackfacing(const MeshletBounds &bounds, const glm::vec3 &cameraPosition)
+	{
+		glm::vec3 toApex = glm::vec3(bounds.ConeApex) - cameraPosition;
+		float	  length = glm::length(toApex);
+		if (length == 0.0f)
+		{
+			return false;
+		}
+
+		return glm::dot(toApex / length, glm::vec3(bounds.Cone)) >= bounds.Cone.w;
+	}
+
+	bool IsVisible(const MeshletBounds &bounds, const Frustum &frustum, const glm::vec3 &cameraPosition)
+	{
+		glm::vec3 centre = glm::vec3(bounds.Sphere);
+		for (size_t i = 0; i < 6; i++)
+		{
+			glm::vec4 plane = frustum.GetPlane(i);
+			if (glm::dot(glm::vec3(plane), centre) + plane.w < -bounds.Sphere.w)
+			{
+				return false;
+			}
+		}
+
+		return !IsBackfacing(bounds, cameraPosition);
+	}
+}	 // namespace Nexus::Graphics::MeshletBuilder
@@ -0,0 +1,489 @@
+#include "Nexus-Core/Graphics/PixelConversion.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NX_PIXEL_SSE2 1
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	#define NX_PIXEL_NEON 1
+	#include <arm_neon.h>
+#endif
+
+namespace Nexus::Graphics
+{
+	/// @brief Linear values are encoded as sRGB by selecting a linear function from a table by the exponent and the top three bits of the
+	/// mantissa of the value, then evaluating it with the next eight bits of the mantissa. Values below 2^-13 all encode to zero.
+	static constexpr uint32_t c_SRGBMinBits		  = (127 - 13) << 23;
+	static constexpr uint32_t c_SRGBAlmostOneBits = 0x3F7FFFFF;
+	static constexpr uint32_t c_SRGBTableSize	  = 13 * 8;
+
+	struct SRGBTables
+	{
+		/// @brief The linear value of each 8 bit sRGB value
+		std::array<float, 256> ToLinear = {};
+
+		/// @brief The linear function of each range of linear values, with the value at the start of the range in the upper 16 bits (divided
+		/// by 512) and the slope across the range in the lower 16 bits, both in units of 1 / 65536
+		std::array<uint32_t, c_SRGBTableSize> FromLinear = {};
+	};
+
+	static double DecodeSRGB(double value)
+	{
+		return value <= 0.04045 ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4);
+	}
+
+	static double EncodeSRGB(double value)
+	{
+		return value <= 0.0031308 ? value * 12.92 : 1.055 * std::pow(value, 1.0 / 2.4) - 0.055;
+	}
+
+	static SRGBTables BuildSRGBTables()
+	{
+		SRGBTables tables = {};
+		for (uint32_t i = 0; i < 256; i++) { tables.ToLinear[i] = (float)DecodeSRGB((double)i / 255.0); }
+
+		// each range is fitted with least squares at the centre of each of its 256 steps, the half added to the encoded value makes the
+		// truncation of the result round to the nearest value
+		for (uint32_t range = 0; range < c_SRGBTableSize; range++)
+		{
+			double sumT = 0.0, sumY = 0.0, sumTT = 0.0, sumTY = 0.0;
+			for (uint32_t t = 0; t < 256; t++)
+			{
+				double value = (double)std::bit_cast<float>(c_SRGBMinBits + (range << 20) + (t << 12) + (1 << 11));
+				double y	 = EncodeSRGB(value) * 255.0 + 0.5;
+
+				sumT += t;
+				sumY += y;
+				sumTT += (double)t * t;
+				sumTY += t * y;
+			}
+
+			double slope  = (256.0 * sumTY - sumT * sumY) / (256.0 * sumTT - sumT * sumT);
+			double offset = (sumY - slope * sumT) / 256.0;
+
+			uint32_t bias  = (uint32_t)std::clamp(std::round(offset * 65536.0 / 512.0), 0.0, 32767.0);
+			uint32_t scale = (uint32_t)std::clamp(std::round(slope * 65536.0), 0.0, 32767.0);
+			tables.FromLinear[range] = (bias << 16) | scale;
+		}
+
+		return tables;
+	}
+
+	static const SRGBTables &GetSRGBTables()
+	{
+		static const SRGBTables tables = BuildSRGBTables();
+		return tables;
+	}
+
+	/// @brief Scalar equivalent of the vectorised encoding, the comparisons mirror maxps/minps so that NaN encodes to zero
+	static uint8_t EncodeSRGBChannel(float value, const uint32_t *table)
+	{
+		const float minValue  = std::bit_cast<float>(c_SRGBMinBits);
+		const float almostOne = std::bit_cast<float>(c_SRGBAlmostOneBits);
+
+		value		  = value > minValue ? value : minValue;
+		value		  = value < almostOne ? value : almostOne;
+		uint32_t bits = std::bit_cast<uint32_t>(value);
+
+		uint32_t entry = table[(bits - c_SRGBMinBits) >> 20];
+		uint32_t t	   = (bits >> 12) & 0xFF;
+		return (uint8_t)((((entry >> 16) << 9) + (entry & 0xFFFF) * t) >> 16);
+	}
+
+	static uint8_t EncodeAlphaChannel(float value)
+	{
+		value = value > 0.0f ? value : 0.0f;
+		value = value < 1.0f ? value : 1.0f;
+		return (uint8_t)std::nearbyint(value * 255.0f);
+	}
+
+	/// @brief Converts a float to a half with the integer operations that the vectorised path uses, so that both round identically
+	static uint16_t FloatToHalf(float value)
+	{
+		const uint32_t infinityBits	   = 255 << 23;
+		const uint32_t halfMaxBits	   = (127 + 16) << 23;
+		const uint32_t denormMagicBits = ((127 - 15) + (23 - 10) + 1) << 23;
+
+		uint32_t bits = std::bit_cast<uint32_t>(value);
+		uint32_t sign = bits & 0x80000000u;
+		bits ^= sign;
+
+		uint32_t result = 0;
+		if (bits >= halfMaxBits)
+		{
+			result = bits > infinityBits ? 0x7E00 : 0x7C00;
+		}
+		else if (bits < (113u << 23))
+		{
+			// adding a large power of two shifts the mantissa of a subnormal half into the lowest bits, rounded by the addition
+			result = std::bit_cast<uint32_t>(std::bit_cast<float>(bits) + std::bit_cast<float>(denormMagicBits)) - denormMagicBits;
+		}
+		else
+		{
+			uint32_t mantissaOdd = (bits >> 13) & 1;
+			bits += ((uint32_t)(15 - 127) << 23) + 0xFFF + mantissaOdd;
+			result = bits >> 13;
+		}
+
+		return (uint16_t)(result | (sign >> 16));
+	}
+
+	static float HalfToFloat(uint16_t value)
+	{
+		const uint32_t shiftedExponent = 0x7C00 << 13;
+		const float	   magic		   = std::bit_cast<float>(113u << 23);
+
+		uint32_t bits	  = (uint32_t)(value & 0x7FFF) << 13;
+		uint32_t exponent = bits & shiftedExponent;
+		bits += (127 - 15) << 23;
+
+		if (exponent == shiftedExponent)
+		{
+			bits += (128 - 16) << 23;
+		}
+		else if (exponent == 0)
+		{
+			bits += 1 << 23;
+			bits = std::bit_cast<uint32_t>(std::bit_cast<float>(bits) - magic);
+		}
+
+		return std::bit_cast<float>(bits | ((uint32_t)(value & 0x8000) << 16));
+	}
+
+	static void SwapBytes(uint8_t *a, uint8_t *b, size_t size)
+	{
+		size_t i = 0;
+
+#if defined(NX_PIXEL_SSE2)
+		for (; i + 16 <= size; i += 16)
+		{
+			__m128i first  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+			__m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(a + i), second);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(b + i), first);
+		}
+#elif defined(NX_PIXEL_NEON)
+		for (; i + 16 <= size; i += 16)
+		{
+			uint8x16_t first  = vld1q_u8(a + i);
+			uint8x16_t second = vld1q_u8(b + i);
+			vst1q_u8(a + i, second);
+			vst1q_u8(b + i, first);
+		}
+#endif
+
+		for (; i < size; i++) { std::swap(a[i], b[i]); }
+	}
+
+	void FlipRows(void *pixels, size_t rowPitch, uint32_t height)
+	{
+		if (height < 2)
+		{
+			return;
+		}
+
+		uint8_t *top	= static_cast<uint8_t *>(pixels);
+		uint8_t *bottom = top + (size_t)(height - 1) * rowPitch;
+		for (uint32_t row = 0; row < height / 2; row++, top += rowPitch, bottom -= rowPitch) { SwapBytes(top, bottom, rowPitch); }
+	}
+
+	void SwapRedAndBlue(const uint8_t *input, uint8_t *output, size_t pixelCount)
+	{
+		size_t i = 0;
+
+#if defined(NX_PIXEL_SSE2)
+		const __m128i alphaGreen = _mm_set1_epi32((int)0xFF00FF00);
+		const __m128i lowByte	 = _mm_set1_epi32(0xFF);
+
+		for (; i + 4 <= pixelCount; i += 4)
+		{
+			__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i * 4));
+			__m128i red	   = _mm_slli_epi32(_mm_and_si128(pixels, lowByte), 16);
+			__m128i blue   = _mm_and_si128(_mm_srli_epi32(pixels, 16), lowByte);
+			pixels		   = _mm_or_si128(_mm_and_si128(pixels, alphaGreen), _mm_or_si128(red, blue));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(output + i * 4), pixels);
+		}
+#elif defined(NX_PIXEL_NEON)
+		for (; i + 16 <= pixelCount; i += 16)
+		{
+			uint8x16x4_t pixels = vld4q_u8(input + i * 4);
+			std::swap(pixels.val[0], pixels.val[2]);
+			vst4q_u8(output + i * 4, pixels);
+		}
+#endif
+
+		for (; i < pixelCount; i++)
+		{
+			uint8_t red	 = input[i * 4];
+			uint8_t blue = input[i * 4 + 2];
+
+			output[i * 4]	  = blue;
+			output[i * 4 + 1] = input[i * 4 + 1];
+			output[i * 4 + 2] = red;
+			output[i * 4 + 3] = input[i * 4 + 3];
+		}
+	}
+
+	void ExpandRGBToRGBA(const uint8_t *input, uint8_t *output, size_t pixelCount, uint8_t alpha)
+	{
+		size_t i = 0;
+
+#if defined(NX_PIXEL_SSE2)
+		// each group of three bytes is shifted up by one byte for every pixel before it, so that pixel n lands in the nth 32 bit lane. The
+		// load reads four bytes past the group, so the loop stops while at least two more pixels remain.
+		const __m128i lanes[4]	 = {_mm_setr_epi32(0x00FFFFFF, 0, 0, 0),
+									_mm_setr_epi32(0, 0x00FFFFFF, 0, 0),
+									_mm_setr_epi32(0, 0, 0x00FFFFFF, 0),
+									_mm_setr_epi32(0, 0, 0, 0x00FFFFFF)};
+		const __m128i alphaBytes = _mm_set1_epi32((int)((uint32_t)alpha << 24));
+
+		for (; i + 6 <= pixelCount; i += 4)
+		{
+			__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i * 3));
+			__m128i result = _mm_or_si128(_mm_and_si128(pixels, lanes[0]), _mm_and_si128(_mm_slli_si128(pixels, 1), lanes[1]));
+			result		   = _mm_or_si128(result, _mm_and_si128(_mm_slli_si128(pixels, 2), lanes[2]));
+			result		   = _mm_or_si128(result, _mm_and_si128(_mm_slli_si128(pixels, 3), lanes[3]));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(output + i * 4), _mm_or_si128(result, alphaBytes));
+		}
+#elif defined(NX_PIXEL_NEON)
+		for (; i + 16 <= pixelCount; i += 16)
+		{
+			uint8x16x3_t pixels = vld3q_u8(input + i * 3);
+			uint8x16x4_t result = {{pixels.val[0], pixels.val[1], pixels.val[2], vdupq_n_u8(alpha)}};
+			vst4q_u8(output + i * 4, result);
+		}
+#endif
+
+		for (; i < pixelCount; i++)
+		{
+			output[i * 4]	  = input[i * 3];
+			output[i * 4 + 1] = input[i * 3 + 1];
+			output[i * 4 + 2] = input[i * 3 + 2];
+			output[i * 4 + 3] = alpha;
+		}
+	}
+
+	/// @brief Returns colour * alpha / 255 rounded to the nearest value without a division, which is exact for every pair of 8 bit values
+	static uint8_t MultiplyByAlpha(uint32_t colour, uint32_t alpha)
+	{
+		uint32_t product = colour * alpha + 128;
+		return (uint8_t)((product + (product >> 8)) >> 8);
+	}
+
+#if defined(NX_PIXEL_SSE2)
+	/// @brief Premultiplies two pixels that have been widened to 16 bits per channel, the alpha lanes are multiplied by 255 so that they
+	/// keep their value
+	static __m128i PremultiplyWidePixels(__m128i pixels)
+	{
+		const __m128i colourLanes = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+		const __m128i alphaLanes  = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+
+		__m128i alpha	= _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+		alpha			= _mm_or_si128(_mm_and_si128(alpha, colourLanes), alphaLanes);
+		__m128i product = _mm_add_epi16(_mm_mullo_epi16(pixels, alpha), _mm_set1_epi16(128));
+		return _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+	}
+#elif defined(NX_PIXEL_NEON)
+	/// @brief Matches MultiplyByAlpha, the rounding shift adds (product + 128) >> 8 and the rounding narrow adds the final 128
+	static uint8x8_t MultiplyByAlpha(uint8x8_t colour, uint8x8_t alpha)
+	{
+		uint16x8_t product = vmull_u8(colour, alpha);
+		return vraddhn_u16(product, vrshrq_n_u16(product, 8));
+	}
+#endif
+
+	void PremultiplyAlpha(const uint8_t *input, uint8_t *output, size_t pixelCount)
+	{
+		size_t i = 0;
+
+#if defined(NX_PIXEL_SSE2)
+		const __m128i zero = _mm_setzero_si128();
+
+		for (; i + 4 <= pixelCount; i += 4)
+		{
+			__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i * 4));
+			__m128i low	   = PremultiplyWidePixels(_mm_unpacklo_epi8(pixels, zero));
+			__m128i high   = PremultiplyWidePixels(_mm_unpackhi_epi8(pixels, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(output + i * 4), _mm_packus_epi16(low, high));
+		}
+#elif defined(NX_PIXEL_NEON)
+		for (; i + 16 <= pixelCount; i += 16)
+		{
+			uint8x16x4_t pixels	   = vld4q_u8(input + i * 4);
+			uint8x8_t	 alphaLow  = vget_low_u8(pixels.val[3]);
+			uint8x8_t	 alphaHigh = vget_high_u8(pixels.val[3]);
+
+			for (uint32_t channel = 0; channel < 3; channel++)
+			{
+				pixels.val[channel] = vcombine_u8(MultiplyByAlpha(vget_low_u8(pixels.val[channel]), alphaLow),
+												  MultiplyByAlpha(vget_high_u8(pixels.val[channel]), alphaHigh));
+			}
+
+			vst4q_u8(output + i * 4, pixels);
+		}
+#endif
+
+		for (; i < pixelCount; i++)
+		{
+			uint8_t alpha	  = input[i * 4 + 3];
+			output[i * 4]	  = MultiplyByAlpha(input[i * 4], alpha);
+			output[i * 4 + 1] = MultiplyByAlpha(input[i * 4 + 1], alpha);
+			output[i * 4 + 2] = MultiplyByAlpha(input[i * 4 + 2], alpha);
+			output[i * 4 + 3] = alpha;
+		}
+	}
+
+	void ConvertSRGBToLinear(const uint8_t *input, float *output, size_t pixelCount)
+	{
+		// a table lookup per channel is already cheaper than any arithmetic, so this has no vectorised path
+		const std::array<float, 256> &table = GetSRGBTables().ToLinear;
+
+		for (size_t i = 0; i < pixelCount; i++)
+		{
+			output[i * 4]	  = table[input[i * 4]];
+			output[i * 4 + 1] = table[input[i * 4 + 1]];
+			output[i * 4 + 2] = table[input[i * 4 + 2]];
+			output[i * 4 + 3] = (float)input[i * 4 + 3] / 255.0f;
+		}
+	}
+
+	void ConvertLinearToSRGB(const float *input, uint8_t *output, size_t pixelCount)
+	{
+		const uint32_t *table = GetSRGBTables().FromLinear.data();
+		size_t			i	  = 0;
+
+#if defined(NX_PIXEL_SSE2)
+		const __m128  minValue	= _mm_castsi128_ps(_mm_set1_epi32((int)c_SRGBMinBits));
+		const __m128  almostOne = _mm_castsi128_ps(_mm_set1_epi32((int)c_SRGBAlmostOneBits));
+		const __m128i minBits	= _mm_set1_epi32((int)c_SRGBMinBits);
+		const __m128i stepMask	= _mm_set1_epi32(0xFF);
+		const __m128i biasScale = _mm_set1_epi32(512 << 16);
+		const __m128i alphaLane = _mm_setr_epi32(0, 0, 0, -1);
+
+		// each register holds one pixel, the colour lanes look up their functions and evaluate them with a multiply-add of the 16 bit
+		// halves of the entry against the step and 512, and the alpha lane is rounded linearly
+		auto encodePixel = [&](const float *pixel)
+		{
+			__m128	values = _mm_loadu_ps(pixel);
+			__m128i bits   = _mm_castps_si128(_mm_min_ps(_mm_max_ps(values, minValue), almostOne));
+
+			alignas(16) uint32_t ranges[4];
+			_mm_store_si128(reinterpret_cast<__m128i *>(ranges), _mm_srli_epi32(_mm_sub_epi32(bits, minBits), 20));
+			__m128i entries = _mm_setr_epi32((int)table[ranges[0]], (int)table[ranges[1]], (int)table[ranges[2]], (int)table[ranges[3]]);
+
+			__m128i steps  = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(bits, 12), stepMask), biasScale);
+			__m128i colour = _mm_srli_epi32(_mm_madd_epi16(entries, steps), 16);
+
+			__m128	alpha  = _mm_min_ps(_mm_max_ps(values, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+			__m128i linear = _mm_cvtps_epi32(_mm_mul_ps(alpha, _mm_set1_ps(255.0f)));
+			return _mm_or_si128(_mm_and_si128(alphaLane, linear), _mm_andnot_si128(alphaLane, colour));
+		};
+
+		for (; i + 4 <= pixelCount; i += 4)
+		{
+			__m128i first  = _mm_packs_epi32(encodePixel(input + i * 4), encodePixel(input + i * 4 + 4));
+			__m128i second = _mm_packs_epi32(encodePixel(input + i * 4 + 8), encodePixel(input + i * 4 + 12));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(output + i * 4), _mm_packus_epi16(first, second));
+		}
+#endif
+
+		for (; i < pixelCount; i++)
+		{
+			output[i * 4]	  = EncodeSRGBChannel(input[i * 4], table);
+			output[i * 4 + 1] = EncodeSRGBChannel(input[i * 4 + 1], table);
+			output[i * 4 + 2] = EncodeSRGBChannel(input[i * 4 + 2], table);
+			output[i * 4 + 3] = EncodeAlphaChannel(input[i * 4 + 3]);
+		}
+	}
+
+	void ConvertFloatToHalf(std::span<const float> input, uint16_t *output)
+	{
+		size_t i = 0;
+
+#if defined(NX_PIXEL_SSE2)
+		const __m128i signMask		= _mm_set1_epi32((int)0x80000000u);
+		const __m128i infinityBits	= _mm_set1_epi32(255 << 23);
+		const __m128i halfMaxBits	= _mm_set1_epi32(((127 + 16) << 23) - 1);
+		const __m128i normalBits	= _mm_set1_epi32((113 << 23) - 1);
+		const __m128i denormMagic	= _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+		const __m128i rebias		= _mm_set1_epi32((int)(((uint32_t)(15 - 127) << 23) + 0xFFF));
+		const __m128i one			= _mm_set1_epi32(1);
+		const __m128i quietNaN		= _mm_set1_epi32(0x7E00);
+		const __m128i halfInfinity	= _mm_set1_epi32(0x7C00);
+
+		// the three cases are all computed and then selected with masks, the signed comparisons are safe as the sign bit is removed first
+		auto convert = [&](__m128 values)
+		{
+			__m128i bits = _mm_castps_si128(values);
+			__m128i sign = _mm_and_si128(bits, signMask);
+			bits		 = _mm_xor_si128(bits, sign);
+
+			__m128i isSpecial = _mm_cmpgt_epi32(bits, halfMaxBits);
+			__m128i isNormal  = _mm_cmpgt_epi32(bits, normalBits);
+			__m128i isNaN	  = _mm_cmpgt_epi32(bits, infinityBits);
+
+			__m128i special = _mm_or_si128(_mm_and_si128(isNaN, quietNaN), _mm_andnot_si128(isNaN, halfInfinity));
+			__m128i subnormal =
+				_mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(bits), _mm_castsi128_ps(denormMagic))), denormMagic);
+			__m128i mantissaOdd = _mm_and_si128(_mm_srli_epi32(bits, 13), one);
+			__m128i normal		= _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(bits, rebias), mantissaOdd), 13);
+
+			__m128i result = _mm_or_si128(_mm_and_si128(isNormal, normal), _mm_andnot_si128(isNormal, subnormal));
+			result		   = _mm_or_si128(_mm_and_si128(isSpecial, special), _mm_andnot_si128(isSpecial, result));
+			result		   = _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+
+			// sign extending the 16 bit results lets the signed pack keep them unchanged
+			return _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+		};
+
+		for (; i + 8 <= input.size(); i += 8)
+		{
+			__m128i first  = convert(_mm_loadu_ps(input.data() + i));
+			__m128i second = convert(_mm_loadu_ps(input.data() + i + 4));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), _mm_packs_epi32(first, second));
+		}
+#endif
+
+		for (; i < input.size(); i++) { output[i] = FloatToHalf(input[i]); }
+	}
+
+	void ConvertHalfToFloat(std::span<const uint16_t> input, float *output)
+	{
+		size_t i = 0;
+
+#if defined(NX_PIXEL_SSE2)
+		const __m128i magnitudeMask	  = _mm_set1_epi32(0x7FFF);
+		const __m128i shiftedExponent = _mm_set1_epi32(0x7C00 << 13);
+		const __m128i rebias		  = _mm_set1_epi32((127 - 15) << 23);
+		const __m128i specialRebias	  = _mm_set1_epi32((128 - 16) << 23);
+		const __m128i subnormalRebias = _mm_set1_epi32(1 << 23);
+		const __m128  magic			  = _mm_castsi128_ps(_mm_set1_epi32(113 << 23));
+		const __m128i zero			  = _mm_setzero_si128();
+
+		auto convert = [&](__m128i halves)
+		{
+			__m128i bits	 = _mm_slli_epi32(_mm_and_si128(halves, magnitudeMask), 13);
+			__m128i exponent = _mm_and_si128(bits, shiftedExponent);
+			bits			 = _mm_add_epi32(bits, rebias);
+
+			__m128i isSpecial	= _mm_cmpeq_epi32(exponent, shiftedExponent);
+			__m128i isSubnormal = _mm_cmpeq_epi32(exponent, zero);
+			bits				= _mm_add_epi32(bits, _mm_and_si128(isSpecial, specialRebias));
+
+			__m128i subnormal = _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, subnormalRebias)), magic));
+			bits			  = _mm_or_si128(_mm_and_si128(isSubnormal, subnormal), _mm_andnot_si128(isSubnormal, bits));
+
+			__m128i sign = _mm_slli_epi32(_mm_andnot_si128(magnitudeMask, halves), 16);
+			return _mm_castsi128_ps(_mm_or_si128(bits, sign));
+		};
+
+		for (; i + 8 <= input.size(); i += 8)
+		{
+			__m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input.data() + i));
+			_mm_storeu_ps(output + i, convert(_mm_unpacklo_epi16(halves, zero)));
+			_mm_storeu_ps(output + i + 4, convert(_mm_unpackhi_epi16(halves, zero)));
+		}
+#endif
+
+		for (; i < input.size(); i++) { output[i] = HalfToFloat(input[i]); }
+	}
+}	 // namespace Nexus::Graphics
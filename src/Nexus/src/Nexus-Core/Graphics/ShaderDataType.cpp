@@ -45,8 +45,8 @@ namespace Nexus::Graphics
 			case ShaderDataType::R16_UNorm: return 2; break;
 			case ShaderDataType::R16G16_UNorm: return 2 * 2; break;
 			case ShaderDataType::R16G16B16A16_UNorm: return 2 * 4; break;
-			case ShaderDataType::A2B10G10R10_UInt: return 4 * 4; break;
-			case ShaderDataType::A2B10G10R10_UNorm: return 4 * 4; break;
+			case ShaderDataType::A2B10G10R10_UInt: return 4; break;
+			case ShaderDataType::A2B10G10R10_UNorm: return 4; break;
 			default: return 0; break;
 		}
 	}
@@ -0,0 +1,176 @@
+#include "Nexus-Core/Graphics/TextureReadback.hpp"
+
+#include "Nexus-Core/Graphics/GraphicsDevice.hpp"
+
+namespace Nexus::Graphics
+{
+	ReadbackBufferPool::ReadbackBufferPool(GraphicsDevice *device) : m_Device(device)
+	{
+	}
+
+	ReadbackBufferPool::Allocation ReadbackBufferPool::Acquire(size_t size)
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_Acquisitions++;
+
+		RemoveReleased([&](const Allocation &allocation) { return m_Acquisitions - allocation.ReleasedAt > c_MaxIdleAcquisitions; });
+
+		// the smallest buffer that fits is taken, so that small reads do not hold on to the buffers of full screen captures
+		auto best = m_Released.end();
+		for (auto it = m_Released.begin(); it != m_Released.end(); it++)
+		{
+			size_t capacity = it->Buffer->GetDescription().SizeInBytes;
+			if (capacity < size || !it->Fence->IsSignalled())
+			{
+				continue;
+			}
+
+			if (best == m_Released.end() || capacity < best->Buffer->GetDescription().SizeInBytes)
+			{
+				best = it;
+			}
+		}
+
+		if (best != m_Released.end())
+		{
+			Allocation allocation = std::move(*best);
+			m_Released.erase(best);
+
+			m_Device->ResetFences(&allocation.Fence, 1);
+			allocation.CommandList = nullptr;
+			return allocation;
+		}
+
+		size_t capacity = std::bit_ceil(std::max<size_t>(size, 1));
+
+		DeviceBufferDescription bufferDesc = {};
+		bufferDesc.Access				   = BufferMemoryAccess::Readback;
+		bufferDesc.Usage				   = BUFFER_USAGE_NONE;
+		bufferDesc.SizeInBytes			   = capacity;
+		bufferDesc.StrideInBytes		   = capacity;
+
+		Allocation allocation = {};
+		allocation.Buffer	  = m_Device->CreateDeviceBuffer(bufferDesc);
+		allocation.Fence	  = m_Device->CreateFence(FenceDescription {.Signalled = false});
+		m_BufferCount++;
+
+		return allocation;
+	}
+
+	void ReadbackBufferPool::Release(Allocation allocation)
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		allocation.ReleasedAt = m_Acquisitions;
+		m_Released.push_back(std::move(allocation));
+	}
+
+	void ReadbackBufferPool::Wait(const Allocation &allocation)
+	{
+		Ref<Fence> fence = allocation.Fence;
+		m_Device->WaitForFences(&fence, 1, true, TimeSpan::FromNanoseconds(UINT64_MAX));
+	}
+
+	void ReadbackBufferPool::Trim()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		RemoveReleased([](const Allocation &allocation) { return true; });
+	}
+
+	void ReadbackBufferPool::Flush()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		for (Allocation &allocation : m_Released)
+		{
+			m_Device->WaitForFences(&allocation.Fence, 1, true, TimeSpan::FromNanoseconds(UINT64_MAX));
+		}
+
+		m_BufferCount -= m_Released.size();
+		m_Released.clear();
+	}
+
+	size_t ReadbackBufferPool::GetBufferCount() const
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		return m_BufferCount;
+	}
+
+	void ReadbackBufferPool::RemoveReleased(const std::function<bool(const Allocation &)> &predicate)
+	{
+		// allocations whose copies are still running are kept, as the GPU may still be writing to their buffers
+		auto removed = std::remove_if(m_Released.begin(),
+									  m_Released.end(),
+									  [&](const Allocation &allocation) { return allocation.Fence->IsSignalled() && predicate(allocation); });
+
+		m_BufferCount -= std::distance(removed, m_Released.end());
+		m_Released.erase(removed, m_Released.end());
+	}
+
+	TextureReadback::TextureReadback(ReadbackBufferPool			  *pool,
+									 ReadbackBufferPool::Allocation allocation,
+									 size_t							size,
+									 uint32_t						width,
+									 uint32_t						height,
+									 PixelFormat					format)
+		: m_Pool(pool),
+		  m_Allocation(std::move(allocation)),
+		  m_Size(size),
+		  m_Width(width),
+		  m_Height(height),
+		  m_Format(format)
+	{
+	}
+
+	TextureReadback::~TextureReadback()
+	{
+		if (!m_Resolved)
+		{
+			m_Pool->Release(std::move(m_Allocation));
+		}
+	}
+
+	bool TextureReadback::IsReady() const
+	{
+		return m_Resolved || m_Allocation.Fence->IsSignalled();
+	}
+
+	const std::vector<char> &TextureReadback::GetData()
+	{
+		if (!m_Resolved)
+		{
+			m_Pool->Wait(m_Allocation);
+			m_Pixels = m_Allocation.Buffer->GetData(0, (uint32_t)m_Size);
+
+			m_Pool->Release(std::move(m_Allocation));
+			m_Allocation = {};
+			m_Resolved	 = true;
+		}
+
+		return m_Pixels;
+	}
+
+	Image TextureReadback::GetImage()
+	{
+		Image image	 = {};
+		image.Width	 = m_Width;
+		image.Height = m_Height;
+		image.Format = m_Format;
+		image.Pixels = GetData();
+		return image;
+	}
+
+	uint32_t TextureReadback::GetWidth() const
+	{
+		return m_Width;
+	}
+
+	uint32_t TextureReadback::GetHeight() const
+	{
+		return m_Height;
+	}
+
+	PixelFormat TextureReadback::GetFormat() const
+	{
+		return m_Format;
+	}
+}	 // namespace Nexus::Graphics
@@ -0,0 +1,659 @@
+#include "Nexus-Core/Graphics/TextureStreamer.hpp"
+
+#include "Nexus-Core/Graphics/GraphicsDevice.hpp"
+#include "Nexus-Core/Graphics/MipmapGenerator.hpp"
+#include "Nexus-Core/Graphics/PixelConversion.hpp"
+#include "Nexus-Core/Logging/Log.hpp"
+
+namespace Nexus::Graphics
+{
+	static uint32_t GetMipExtent(uint32_t size, uint32_t mip)
+	{
+		return std::max(size >> mip, 1u);
+	}
+
+	/// @brief The source texels that one texel of the next mip is filtered from along one axis, and how much each of them contributes
+	struct DownsampleTaps
+	{
+		uint32_t Indices[3] = {};
+		float	 Weights[3] = {};
+		uint32_t Count		= 0;
+	};
+
+	/// @brief Returns the texels that a texel of the next mip covers along an axis. An even side averages pairs of texels, an odd side of
+	/// 2n + 1 texels spreads them over n texels, so each covers three texels with weights that keep every source texel's total contribution
+	/// equal and no texel is dropped.
+	static DownsampleTaps GetDownsampleTaps(uint32_t size, uint32_t index)
+	{
+		DownsampleTaps taps = {};
+		if (size == 1)
+		{
+			taps.Indices[0] = 0;
+			taps.Weights[0] = 1.0f;
+			taps.Count		= 1;
+		}
+		else if (size % 2 == 0)
+		{
+			taps.Indices[0] = index * 2;
+			taps.Indices[1] = index * 2 + 1;
+			taps.Weights[0] = 0.5f;
+			taps.Weights[1] = 0.5f;
+			taps.Count		= 2;
+		}
+		else
+		{
+			float outputSize = (float)(size / 2);
+			taps.Indices[0]	 = index * 2;
+			taps.Indices[1]	 = index * 2 + 1;
+			taps.Indices[2]	 = index * 2 + 2;
+			taps.Weights[0]	 = (outputSize - (float)index) / (float)size;
+			taps.Weights[1]	 = outputSize / (float)size;
+			taps.Weights[2]	 = ((float)index + 1.0f) / (float)size;
+			taps.Count		 = 3;
+		}
+		return taps;
+	}
+
+	/// @brief Downsamples a linear RGBA image to its next mip, averaging 2x2 blocks of texels and using three texels along odd sides
+	static std::vector<float> DownsampleLinear(const std::vector<float> &input, uint32_t width, uint32_t height)
+	{
+		uint32_t		   outputWidth	= GetMipExtent(width, 1);
+		uint32_t		   outputHeight = GetMipExtent(height, 1);
+		std::vector<float> output((size_t)outputWidth * outputHeight * 4);
+
+		for (uint32_t y = 0; y < outputHeight; y++)
+		{
+			DownsampleTaps rows = GetDownsampleTaps(height, y);
+			float		  *out	= &output[(size_t)y * outputWidth * 4];
+
+			for (uint32_t x = 0; x < outputWidth; x++)
+			{
+				DownsampleTaps columns = GetDownsampleTaps(width, x);
+
+				for (uint32_t row = 0; row < rows.Count; row++)
+				{
+					const float *in = &input[(size_t)rows.Indices[row] * width * 4];
+					for (uint32_t column = 0; column < columns.Count; column++)
+					{
+						float  weight = rows.Weights[row] * columns.Weights[column];
+						size_t texel  = (size_t)columns.Indices[column] * 4;
+						for (size_t c = 0; c < 4; c++) { out[x * 4 + c] += in[texel + c] * weight; }
+					}
+				}
+			}
+		}
+
+		return output;
+	}
+
+	static Image EncodeMip(const std::vector<float> &linear, uint32_t width, uint32_t height, PixelFormat format)
+	{
+		size_t pixelCount = (size_t)width * height;
+
+		Image image	 = {};
+		image.Width	 = width;
+		image.Height = height;
+		image.Format = format;
+		image.Pixels.resize(pixelCount * GetPixelFormatSizeInBytes(format));
+
+		switch (format)
+		{
+			case PixelFormat::R8_G8_B8_A8_UNorm:
+			{
+				for (size_t i = 0; i < pixelCount * 4; i++)
+				{
+					image.Pixels[i] = (char)(uint8_t)std::lround(std::clamp(linear[i], 0.0f, 1.0f) * 255.0f);
+				}
+				break;
+			}
+			case PixelFormat::R8_G8_B8_A8_UNorm_SRGB: ConvertLinearToSRGB(linear.data(), (uint8_t *)image.Pixels.data(), pixelCount); break;
+			default: memcpy(image.Pixels.data(), linear.data(), pixelCount * 4 * sizeof(float)); break;
+		}
+
+		return image;
+	}
+
+	size_t GetResidentTextureSize(uint32_t width, uint32_t height, uint32_t mipCount, uint32_t residentMip, PixelFormat format)
+	{
+		size_t size = 0;
+		for (uint32_t mip = residentMip; mip < mipCount; mip++) { size += (size_t)GetMipExtent(width, mip) * GetMipExtent(height, mip); }
+		return size * GetPixelFormatSizeInBytes(format);
+	}
+
+	uint32_t SelectTextureMip(uint32_t width, uint32_t height, uint32_t mipCount, float projectedSize)
+	{
+		if (projectedSize <= 0.0f)
+		{
+			return mipCount - 1;
+		}
+
+		// rounding down keeps at least one texel per pixel, so textures are never magnified because a coarser mip was chosen
+		float mip = std::floor(std::log2((float)std::max(width, height) / projectedSize));
+		return (uint32_t)std::clamp(mip, 0.0f, (float)(mipCount - 1));
+	}
+
+	uint32_t GetEvictionMip(uint32_t width, uint32_t height, uint32_t mipCount, uint32_t minimumResidentSize)
+	{
+		for (uint32_t mip = 0; mip < mipCount; mip++)
+		{
+			if (GetMipExtent(width, mip) <= minimumResidentSize && GetMipExtent(height, mip) <= minimumResidentSize)
+			{
+				return mip;
+			}
+		}
+
+		return mipCount - 1;
+	}
+
+	std::vector<Image> GenerateMipChain(const Image &image, uint32_t firstMip, uint32_t mipCount)
+	{
+		size_t			   pixelCount = (size_t)image.Width * image.Height;
+		std::vector<float> linear(pixelCount * 4);
+
+		switch (image.Format)
+		{
+			case PixelFormat::R8_G8_B8_A8_UNorm:
+			{
+				const uint8_t *pixels = (const uint8_t *)image.Pixels.data();
+				for (size_t i = 0; i < pixelCount * 4; i++) { linear[i] = pixels[i] * (1.0f / 255.0f); }
+				break;
+			}
+			case PixelFormat::R8_G8_B8_A8_UNorm_SRGB:
+				ConvertSRGBToLinear((const uint8_t *)image.Pixels.data(), linear.data(), pixelCount);
+				break;
+			case PixelFormat::R32_G32_B32_A32_Float: memcpy(linear.data(), image.Pixels.data(), pixelCount * 4 * sizeof(float)); break;
+			default: throw std::runtime_error("Attempting to generate mips for an image in an unsupported format");
+		}
+
+		std::vector<Image> mips;
+		uint32_t		   width  = image.Width;
+		uint32_t		   height = image.Height;
+
+		for (uint32_t mip = 0; mip < mipCount; mip++)
+		{
+			if (mip > 0)
+			{
+				linear = DownsampleLinear(linear, width, height);
+				width  = GetMipExtent(width, 1);
+				height = GetMipExtent(height, 1);
+			}
+
+			if (mip == 0 && firstMip == 0)
+			{
+				mips.push_back(image);
+			}
+			else if (mip >= firstMip)
+			{
+				mips.push_back(EncodeMip(linear, width, height, image.Format));
+			}
+		}
+
+		return mips;
+	}
+
+	TextureResidencyPlan PlanTextureResidency(std::span<const TextureResidency> textures, size_t budget, uint64_t frame, uint32_t maxLoads)
+	{
+		TextureResidencyPlan plan = {};
+
+		auto getSize = [&](size_t texture, uint32_t mip)
+		{
+			const TextureResidency &residency = textures[texture];
+			return GetResidentTextureSize(residency.Width, residency.Height, residency.MipCount, mip, residency.Format);
+		};
+
+		// textures that were drawn keep the mips that they need, the rest only keep the mips that they were created with
+		std::vector<uint32_t> resident(textures.size());
+		std::vector<uint32_t> keep(textures.size());
+		std::vector<size_t>	  victims;
+		size_t				  total = 0;
+
+		for (size_t i = 0; i < textures.size(); i++)
+		{
+			const TextureResidency &residency = textures[i];
+			resident[i]						  = residency.ResidentMip;
+			keep[i]							  = residency.EvictionMip;
+
+			if (residency.LastUsedFrame == frame)
+			{
+				keep[i] = std::min(residency.DesiredMip, residency.EvictionMip);
+			}
+
+			total += getSize(i, residency.ResidentMip);
+
+			if (!residency.Loading && resident[i] < keep[i])
+			{
+				victims.push_back(i);
+			}
+		}
+
+		std::stable_sort(victims.begin(),
+						 victims.end(),
+						 [&](size_t a, size_t b) { return textures[a].LastUsedFrame < textures[b].LastUsedFrame; });
+
+		size_t nextVictim = 0;
+		auto   evictNext  = [&]()
+		{
+			if (nextVictim == victims.size())
+			{
+				return false;
+			}
+
+			size_t victim = victims[nextVictim++];
+			total -= getSize(victim, resident[victim]) - getSize(victim, keep[victim]);
+
+			resident[victim] = keep[victim];
+			plan.Evictions.push_back({.Texture = victim, .Mip = keep[victim]});
+			return true;
+		};
+
+		// the budget may have been lowered since the last frame
+		while (total > budget && evictNext()) {}
+
+		std::vector<size_t> candidates;
+		for (size_t i = 0; i < textures.size(); i++)
+		{
+			if (!textures[i].Loading && keep[i] < resident[i])
+			{
+				candidates.push_back(i);
+			}
+		}
+
+		std::stable_sort(candidates.begin(),
+						 candidates.end(),
+						 [&](size_t a, size_t b) { return resident[a] - keep[a] > resident[b] - keep[b]; });
+
+		for (size_t candidate : candidates)
+		{
+			if (plan.Loads.size() >= maxLoads)
+			{
+				break;
+			}
+
+			uint32_t mip	 = keep[candidate];
+			size_t	 current = getSize(candidate, resident[candidate]);
+			while (total - current + getSize(candidate, mip) > budget && evictNext()) {}
+
+			// when every mip that is needed does not fit, the texture is given as many as do
+			while (mip < resident[candidate] && total - current + getSize(candidate, mip) > budget) { mip++; }
+
+			if (mip == resident[candidate])
+			{
+				continue;
+			}
+
+			total += getSize(candidate, mip) - current;
+
+			resident[candidate] = mip;
+			plan.Loads.push_back({.Texture = candidate, .Mip = mip});
+		}
+
+		return plan;
+	}
+
+	StreamedTexture::StreamedTexture(const std::string &filepath, PixelFormat format) : m_Filepath(filepath), m_Format(format)
+	{
+	}
+
+	Ref<Texture> StreamedTexture::GetTexture() const
+	{
+		return m_Texture;
+	}
+
+	const std::string &StreamedTexture::GetFilepath() const
+	{
+		return m_Filepath;
+	}
+
+	PixelFormat StreamedTexture::GetFormat() const
+	{
+		return m_Format;
+	}
+
+	const TextureResidency &StreamedTexture::GetResidency() const
+	{
+		return m_Residency;
+	}
+
+	bool StreamedTexture::IsLoaded() const
+	{
+		return m_Loaded;
+	}
+
+	bool StreamedTexture::HasFailed() const
+	{
+		return m_Failed;
+	}
+
+	TextureStreamer::TextureStreamer(GraphicsDevice *device, Ref<ICommandQueue> commandQueue, const TextureStreamingSettings &settings)
+		: m_Device(device),
+		  m_CommandQueue(commandQueue),
+		  m_Settings(settings)
+	{
+		if (m_Settings.WorkerCount == 0)
+		{
+			throw std::runtime_error("A texture streamer needs at least one worker to load textures with");
+		}
+
+		for (uint32_t i = 0; i < m_Settings.WorkerCount; i++) { m_Workers.emplace_back([this]() { RunWorker(); }); }
+	}
+
+	TextureStreamer::~TextureStreamer()
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_Stopping = true;
+		}
+
+		m_RequestQueued.notify_all();
+		for (std::thread &worker : m_Workers) { worker.join(); }
+	}
+
+	Ref<StreamedTexture> TextureStreamer::Load(const std::string &filepath, bool srgb)
+	{
+		PixelFormat			 format	 = srgb ? PixelFormat::R8_G8_B8_A8_UNorm_SRGB : PixelFormat::R8_G8_B8_A8_UNorm;
+		Ref<StreamedTexture> texture = CreateRef<StreamedTexture>(filepath, format);
+		texture->m_Residency.Loading = true;
+		texture->m_LoadingMip		 = UINT32_MAX;
+		m_Textures.push_back(texture);
+		m_PendingLoads++;
+
+		// the first mips are needed before the texture can be drawn at all, so they are loaded ahead of every finer mip
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_Requests.push_back(
+				{.Texture = texture, .Mip = UINT32_MAX, .Priority = UINT32_MAX, .MinimumResidentSize = m_Settings.MinimumResidentSize});
+		}
+
+		m_RequestQueued.notify_one();
+		return texture;
+	}
+
+	void TextureStreamer::RecordUsage(const Ref<StreamedTexture> &texture, float projectedSize)
+	{
+		if (!texture->m_Loaded)
+		{
+			return;
+		}
+
+		TextureResidency &residency = texture->m_Residency;
+		uint32_t		  mip		= SelectTextureMip(residency.Width, residency.Height, residency.MipCount, projectedSize);
+
+		if (residency.LastUsedFrame != m_FrameNumber)
+		{
+			residency.DesiredMip	= mip;
+			residency.LastUsedFrame = m_FrameNumber;
+		}
+		else
+		{
+			residency.DesiredMip = std::min(residency.DesiredMip, mip);
+		}
+	}
+
+	void TextureStreamer::Update()
+	{
+		std::vector<LoadResult> results;
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			while (!m_Results.empty() && results.size() < m_Settings.MaxUploadsPerFrame)
+			{
+				results.push_back(std::move(m_Results.front()));
+				m_Results.pop_front();
+			}
+		}
+
+		for (LoadResult &result : results)
+		{
+			ApplyLoad(result);
+			m_PendingLoads--;
+		}
+
+		// textures that only the streamer references are released, once any load of them has finished
+		std::erase_if(m_Textures,
+					  [&](const Ref<StreamedTexture> &texture)
+					  {
+						  if (texture.use_count() > 1 || texture->m_Residency.Loading)
+						  {
+							  return false;
+						  }
+
+						  if (texture->m_Texture)
+						  {
+							  const TextureResidency &residency = texture->m_Residency;
+							  m_ResidentSize -= GetResidentTextureSize(residency.Width,
+																	   residency.Height,
+																	   residency.MipCount,
+																	   residency.ResidentMip,
+																	   residency.Format);
+							  m_Device->GetFrameTracker().DeferDeletion(texture->m_Texture);
+						  }
+
+						  return true;
+					  });
+
+		std::vector<Ref<StreamedTexture>> planned;
+		std::vector<TextureResidency>	  residencies;
+		for (const Ref<StreamedTexture> &texture : m_Textures)
+		{
+			if (!texture->m_Loaded || texture->m_Failed)
+			{
+				continue;
+			}
+
+			TextureResidency residency = texture->m_Residency;
+			if (residency.Loading)
+			{
+				residency.ResidentMip = texture->m_LoadingMip;
+			}
+
+			planned.push_back(texture);
+			residencies.push_back(residency);
+		}
+
+		uint32_t			 maxLoads = m_Settings.MaxPendingLoads - (uint32_t)std::min<size_t>(m_PendingLoads, m_Settings.MaxPendingLoads);
+		TextureResidencyPlan plan	  = PlanTextureResidency(residencies, m_Settings.MemoryBudget, m_FrameNumber, maxLoads);
+
+		for (const TextureResidencyChange &eviction : plan.Evictions) { Evict(*planned[eviction.Texture], eviction.Mip); }
+
+		if (!plan.Loads.empty())
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			for (const TextureResidencyChange &load : plan.Loads)
+			{
+				StreamedTexture &texture	= *planned[load.Texture];
+				texture.m_Residency.Loading = true;
+				texture.m_LoadingMip		= load.Mip;
+				m_PendingLoads++;
+
+				m_Requests.push_back({.Texture			   = planned[load.Texture],
+									  .Mip				   = load.Mip,
+									  .Priority			   = texture.m_Residency.ResidentMip - load.Mip,
+									  .MinimumResidentSize = m_Settings.MinimumResidentSize});
+			}
+		}
+
+		m_RequestQueued.notify_all();
+		m_FrameNumber++;
+	}
+
+	void TextureStreamer::SetSettings(const TextureStreamingSettings &settings)
+	{
+		m_Settings = settings;
+	}
+
+	const TextureStreamingSettings &TextureStreamer::GetSettings() const
+	{
+		return m_Settings;
+	}
+
+	size_t TextureStreamer::GetResidentSize() const
+	{
+		return m_ResidentSize;
+	}
+
+	size_t TextureStreamer::GetPendingLoadCount() const
+	{
+		return m_PendingLoads;
+	}
+
+	void TextureStreamer::RunWorker()
+	{
+		while (true)
+		{
+			LoadRequest request = {};
+
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_RequestQueued.wait(lock, [&]() { return m_Stopping || !m_Requests.empty(); });
+
+				if (m_Stopping)
+				{
+					return;
+				}
+
+				auto next = std::max_element(m_Requests.begin(),
+											 m_Requests.end(),
+											 [](const LoadRequest &a, const LoadRequest &b) { return a.Priority < b.Priority; });
+				request	  = std::move(*next);
+				m_Requests.erase(next);
+			}
+
+			LoadResult result = Decode(request);
+
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_Results.push_back(std::move(result));
+			}
+		}
+	}
+
+	TextureStreamer::LoadResult TextureStreamer::Decode(const LoadRequest &request)
+	{
+		LoadResult result = {};
+		result.Texture	  = request.Texture;
+
+		try
+		{
+			Image image = Image::FromFile(request.Texture->m_Filepath, request.Texture->m_Format);
+			if (image.IsEmpty())
+			{
+				result.Error = "the file could not be decoded";
+				return result;
+			}
+
+			// the chain matches the one that CreateTexture2D generates, so streamed and preloaded textures have the same number of mips
+			result.Width	= image.Width;
+			result.Height	= image.Height;
+			result.MipCount = std::max(MipmapGenerator::GetMaximumNumberOfMips(image.Width, image.Height), 1u);
+			result.FirstMip = std::min(request.Mip, GetEvictionMip(image.Width, image.Height, result.MipCount, request.MinimumResidentSize));
+			result.Mips		= GenerateMipChain(image, result.FirstMip, result.MipCount);
+		}
+		catch (const std::exception &e)
+		{
+			result.Error = e.what();
+		}
+
+		return result;
+	}
+
+	void TextureStreamer::ApplyLoad(LoadResult &result)
+	{
+		StreamedTexture &texture	= *result.Texture;
+		texture.m_Residency.Loading = false;
+
+		if (!result.Error.empty())
+		{
+			NX_ERROR("Failed to load streamed texture " + texture.m_Filepath + ": " + result.Error);
+			texture.m_Failed = true;
+			return;
+		}
+
+		if (!texture.m_Loaded)
+		{
+			TextureResidency &residency = texture.m_Residency;
+			residency.Width				= result.Width;
+			residency.Height			= result.Height;
+			residency.MipCount			= result.MipCount;
+			residency.Format			= texture.m_Format;
+			residency.ResidentMip		= result.MipCount;
+			residency.EvictionMip		= result.FirstMip;
+			residency.DesiredMip		= result.FirstMip;
+			texture.m_Loaded			= true;
+		}
+
+		if (result.FirstMip >= texture.m_Residency.ResidentMip)
+		{
+			return;
+		}
+
+		// the copies are submitted to the queue that draws with the texture, so the draws after the swap see the new mips
+		Ref<Texture> replacement = CreateResidentTexture(texture, result.FirstMip);
+		for (uint32_t level = 0; level < (uint32_t)result.Mips.size(); level++)
+		{
+			const Image &mip = result.Mips[level];
+			m_Device->WriteToTexture(replacement, m_CommandQueue, 0, level, 0, 0, 0, mip.Width, mip.Height, mip.Pixels.data(), mip.Pixels.size());
+		}
+
+		ReplaceTexture(texture, replacement, result.FirstMip);
+	}
+
+	void TextureStreamer::Evict(StreamedTexture &texture, uint32_t mip)
+	{
+		const TextureResidency &residency = texture.m_Residency;
+		if (!texture.m_Texture || mip <= residency.ResidentMip)
+		{
+			return;
+		}
+
+		// the coarser mips are already on the GPU, so they are copied into the smaller texture rather than loaded again
+		Ref<Texture>	 replacement = CreateResidentTexture(texture, mip);
+		Ref<CommandList> cmdList	 = m_CommandQueue->CreateCommandList();
+		cmdList->Begin();
+
+		for (uint32_t level = mip; level < residency.MipCount; level++)
+		{
+			TextureCopyDescription copyDesc = {};
+			copyDesc.Source					= texture.m_Texture;
+			copyDesc.Destination			= replacement;
+			copyDesc.SourceSubresource		= {.MipLevel = level - residency.ResidentMip, .BaseArrayLayer = 0, .LayerCount = 1};
+			copyDesc.DestinationSubresource = {.MipLevel = level - mip, .BaseArrayLayer = 0, .LayerCount = 1};
+			copyDesc.Extent = {.Width = GetMipExtent(residency.Width, level), .Height = GetMipExtent(residency.Height, level), .Depth = 1};
+			cmdList->CopyTextureToTexture(copyDesc);
+		}
+
+		cmdList->End();
+		m_CommandQueue->SubmitCommandList(cmdList, m_Device->GetFrameTracker().AcquireFence());
+		m_Device->GetFrameTracker().DeferDeletion(cmdList);
+
+		ReplaceTexture(texture, replacement, mip);
+	}
+
+	Ref<Texture> TextureStreamer::CreateResidentTexture(const StreamedTexture &texture, uint32_t mip)
+	{
+		const TextureResidency &residency = texture.m_Residency;
+
+		TextureDescription spec = {};
+		spec.Width				= GetMipExtent(residency.Width, mip);
+		spec.Height				= GetMipExtent(residency.Height, mip);
+		spec.Format				= residency.Format;
+		spec.MipLevels			= residency.MipCount - mip;
+		spec.DebugName			= texture.m_Filepath;
+		return m_Device->CreateTexture(spec);
+	}
+
+	void TextureStreamer::ReplaceTexture(StreamedTexture &texture, Ref<Texture> replacement, uint32_t mip)
+	{
+		TextureResidency &residency = texture.m_Residency;
+
+		if (texture.m_Texture)
+		{
+			m_ResidentSize -=
+				GetResidentTextureSize(residency.Width, residency.Height, residency.MipCount, residency.ResidentMip, residency.Format);
+			m_Device->GetFrameTracker().DeferDeletion(texture.m_Texture);
+		}
+
+		texture.m_Texture	  = replacement;
+		residency.ResidentMip = mip;
+
+		m_ResidentSize += GetResidentTextureSize(residency.Width, residency.Height, residency.MipCount, mip, residency.Format);
+	}
+}	 // namespace Nexus::Graphics
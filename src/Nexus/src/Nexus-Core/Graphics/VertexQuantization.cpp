@@ -0,0 +1,187 @@
+#include "Nexus-Core/Graphics/VertexQuantization.hpp"
+
+#include "Nexus-Core/Graphics/Model.hpp"
+
+namespace Nexus::Graphics::VertexQuantization
+{
+	// the vertex is uploaded as is, so it must match the strides of its layout without any padding
+	static_assert(sizeof(VertexQuantizedPositionTexCoordNormalColourTangent) == 24);
+
+	static int16_t EncodeSNorm16(float value)
+	{
+		return (int16_t)std::round(std::clamp(value, -1.0f, 1.0f) * 32767.0f);
+	}
+
+	static float DecodeSNorm16(int16_t value)
+	{
+		// both -32768 and -32767 decode to -1 on the GPU
+		return std::max((float)value / 32767.0f, -1.0f);
+	}
+
+	static uint16_t EncodeUNorm16(float value)
+	{
+		return (uint16_t)std::round(std::clamp(value, 0.0f, 1.0f) * 65535.0f);
+	}
+
+	static float DecodeUNorm16(uint16_t value)
+	{
+		return (float)value / 65535.0f;
+	}
+
+	static uint8_t EncodeUNorm8(float value)
+	{
+		return (uint8_t)std::round(std::clamp(value, 0.0f, 1.0f) * 255.0f);
+	}
+
+	static float DecodeUNorm8(uint8_t value)
+	{
+		return (float)value / 255.0f;
+	}
+
+	/// @brief Maps a value from the range centred on offset to [-1, 1], or from the range starting at offset to [0, 1], an empty range maps
+	/// everything to zero
+	static float ToRange(float value, float offset, float scale)
+	{
+		return scale > 0.0f ? (value - offset) / scale : 0.0f;
+	}
+
+	static float SignNotZero(float value)
+	{
+		return value >= 0.0f ? 1.0f : -1.0f;
+	}
+
+	glm::i16vec2 EncodeOctahedral(const glm::vec3 &direction)
+	{
+		float manhattanLength = std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z);
+		if (manhattanLength == 0.0f)
+		{
+			return glm::i16vec2(0, 0);
+		}
+
+		// project onto the octahedron and fold the lower half over the upper half
+		glm::vec2 projected = glm::vec2(direction.x, direction.y) / manhattanLength;
+		if (direction.z < 0.0f)
+		{
+			projected =
+				glm::vec2((1.0f - std::abs(projected.y)) * SignNotZero(projected.x), (1.0f - std::abs(projected.x)) * SignNotZero(projected.y));
+		}
+
+		// rounding each coordinate to the nearest value is not always the closest direction, so every combination of rounding up and down is
+		// decoded and the closest one is kept. The candidates are compared by distance because their dot products with the direction are too
+		// close to one to tell apart in single precision.
+		glm::vec3	 normalized	  = glm::normalize(direction);
+		glm::i16vec2 best		  = glm::i16vec2(0, 0);
+		float		 bestDistance = std::numeric_limits<float>::max();
+		for (int corner = 0; corner < 4; corner++)
+		{
+			int			 x		   = std::clamp((int)std::floor(projected.x * 32767.0f) + (corner & 1), -32767, 32767);
+			int			 y		   = std::clamp((int)std::floor(projected.y * 32767.0f) + (corner >> 1), -32767, 32767);
+			glm::i16vec2 candidate = glm::i16vec2((int16_t)x, (int16_t)y);
+
+			float distance = glm::distance(DecodeOctahedral(candidate), normalized);
+			if (distance < bestDistance)
+			{
+				best		 = candidate;
+				bestDistance = distance;
+			}
+		}
+
+		return best;
+	}
+
+	glm::vec3 DecodeOctahedral(const glm::i16vec2 &encoded)
+	{
+		glm::vec3 direction = glm::vec3(DecodeSNorm16(encoded.x), DecodeSNorm16(encoded.y), 0.0f);
+		direction.z			= 1.0f - std::abs(direction.x) - std::abs(direction.y);
+
+		float fold = std::max(-direction.z, 0.0f);
+		direction.x += direction.x >= 0.0f ? -fold : fold;
+		direction.y += direction.y >= 0.0f ? -fold : fold;
+		return glm::normalize(direction);
+	}
+
+	VertexDequantization CalculateDequantization(const MeshData &mesh)
+	{
+		VertexDequantization dequantization = {};
+		if (mesh.vertices.empty())
+		{
+			return dequantization;
+		}
+
+		glm::vec3 minPosition = mesh.vertices[0].Position;
+		glm::vec3 maxPosition = mesh.vertices[0].Position;
+		glm::vec2 minTexCoord = mesh.vertices[0].TexCoords;
+		glm::vec2 maxTexCoord = mesh.vertices[0].TexCoords;
+		for (const VertexPositionTexCoordNormalColourTangentBitangent &vertex : mesh.vertices)
+		{
+			minPosition = glm::min(minPosition, vertex.Position);
+			maxPosition = glm::max(maxPosition, vertex.Position);
+			minTexCoord = glm::min(minTexCoord, vertex.TexCoords);
+			maxTexCoord = glm::max(maxTexCoord, vertex.TexCoords);
+		}
+
+		dequantization.PositionOffset = (minPosition + maxPosition) * 0.5f;
+		dequantization.PositionScale  = (maxPosition - minPosition) * 0.5f;
+		dequantization.TexCoordOffset = minTexCoord;
+		dequantization.TexCoordScale  = maxTexCoord - minTexCoord;
+		return dequantization;
+	}
+
+	VertexQuantizedPositionTexCoordNormalColourTangent QuantizeVertex(const VertexPositionTexCoordNormalColourTangentBitangent &vertex,
+																	  const VertexDequantization							   &dequantization)
+	{
+		VertexQuantizedPositionTexCoordNormalColourTangent quantized = {};
+		for (int axis = 0; axis < 3; axis++)
+		{
+			quantized.Position[axis] =
+				EncodeSNorm16(ToRange(vertex.Position[axis], dequantization.PositionOffset[axis], dequantization.PositionScale[axis]));
+		}
+
+		for (int axis = 0; axis < 2; axis++)
+		{
+			quantized.TexCoords[axis] =
+				EncodeUNorm16(ToRange(vertex.TexCoords[axis], dequantization.TexCoordOffset[axis], dequantization.TexCoordScale[axis]));
+		}
+
+		// the bitangent is rebuilt from the normal and tangent, so only whether the texture coordinates are mirrored needs to be stored
+		float handedness	  = SignNotZero(glm::dot(glm::cross(vertex.Normal, vertex.Tangent), vertex.Bitangent));
+		quantized.Position[3] = EncodeSNorm16(handedness);
+
+		quantized.Normal  = EncodeOctahedral(vertex.Normal);
+		quantized.Tangent = EncodeOctahedral(vertex.Tangent);
+
+		for (int channel = 0; channel < 4; channel++) { quantized.Colour[channel] = EncodeUNorm8(vertex.Colour[channel]); }
+
+		return quantized;
+	}
+
+	VertexPositionTexCoordNormalColourTangentBitangent DequantizeVertex(const VertexQuantizedPositionTexCoordNormalColourTangent &vertex,
+																		const VertexDequantization								 &dequantization)
+	{
+		VertexPositionTexCoordNormalColourTangentBitangent result = {};
+		for (int axis = 0; axis < 3; axis++)
+		{
+			result.Position[axis] = dequantization.PositionOffset[axis] + dequantization.PositionScale[axis] * DecodeSNorm16(vertex.Position[axis]);
+		}
+
+		for (int axis = 0; axis < 2; axis++)
+		{
+			result.TexCoords[axis] = dequantization.TexCoordOffset[axis] + dequantization.TexCoordScale[axis] * DecodeUNorm16(vertex.TexCoords[axis]);
+		}
+
+		result.Normal	 = DecodeOctahedral(vertex.Normal);
+		result.Tangent	 = DecodeOctahedral(vertex.Tangent);
+		result.Bitangent = glm::cross(result.Normal, result.Tangent) * DecodeSNorm16(vertex.Position[3]);
+
+		for (int channel = 0; channel < 4; channel++) { result.Colour[channel] = DecodeUNorm8(vertex.Colour[channel]); }
+
+		return result;
+	}
+
+	std::vector<VertexQuantizedPositionTexCoordNormalColourTangent> QuantizeVertices(const MeshData &mesh, const VertexDequantization &dequantization)
+	{
+		std::vector<VertexQuantizedPositionTexCoordNormalColourTangent> vertices(mesh.vertices.size());
+		for (size_t i = 0; i < mesh.vertices.size(); i++) { vertices[i] = QuantizeVertex(mesh.vertices[i], dequantization); }
+		return vertices;
+	}
+}	 // namespace Nexus::Graphics::VertexQuantization
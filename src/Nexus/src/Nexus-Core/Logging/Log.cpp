@@ -1,82 +1,293 @@
 #include "Nexus-Core/Logging/Log.hpp"
 
+#include "Nexus-Core/Logging/LogSink.hpp"
 #include "Nexus-Core/nxpch.hpp"
 
-Nexus::Logger *logger = new Nexus::Logger();
-
 namespace Nexus
 {
+	/// @brief The longest that the background thread waits before writing logs that it has not been woken for
+	static constexpr std::chrono::milliseconds c_LogWriteInterval = std::chrono::milliseconds(10);
+
+	const char *GetSeverityName(Severity severity)
+	{
+		switch (severity)
+		{
+			case Severity::Debug: return "DEBUG";
+			case Severity::Info: return "INFO";
+			case Severity::Warning: return "WARNING";
+			case Severity::Error: return "ERROR";
+			default: return "UNKNOWN";
+		}
+	}
+
 	Log::Log(const std::string &message, Severity severity) : Message(message), MessageSeverity(severity), Time(std::chrono::system_clock::now())
 	{
 	}
 
-	void Logger::LogInfo(const std::string &message, const std::source_location location)
+	Log::Log(std::string message, Severity severity, const std::source_location &location)
+		: Message(std::move(message)),
+		  MessageSeverity(severity),
+		  Time(std::chrono::system_clock::now()),
+		  File(location.file_name()),
+		  Line(location.line()),
+		  ThreadId(std::this_thread::get_id())
 	{
-		// build the message
-		std::stringstream ss;
-		ss << "[INFO] received from file: {";
-		ss << location.file_name();
-		ss << "} at line: ";
-		ss << location.line();
-		ss << ": ";
-		ss << message;
+	}
 
-		Nexus::Log log(ss.str(), Severity::Info);
-		std::cout << log.Message << std::endl;
-		this->m_Logs.push_back(log);
+	Logger::Logger(size_t historyCapacity) : m_HistoryCapacity(historyCapacity)
+	{
+		m_Tail = new Node();
+		m_Head.store(m_Tail);
+		m_Thread = std::thread([this]() { Run(); });
 	}
 
-	void Logger::LogWarning(const std::string &message, const std::source_location location)
+	Logger::~Logger()
+	{
+		Stop();
+		delete m_Tail;
+	}
+
+	void Logger::LogDebug(const std::string &message, const std::source_location location)
+	{
+		Write(Severity::Debug, location, message);
+	}
+
+	void Logger::LogInfo(const std::string &message, const std::source_location location)
 	{
-		// build the message
-		std::stringstream ss;
-		ss << "[WARNING] received from file: {";
-		ss << location.file_name();
-		ss << "} at line: ";
-		ss << location.line();
-		ss << ": ";
-		ss << message;
+		Write(Severity::Info, location, message);
+	}
 
-		Nexus::Log log(ss.str(), Severity::Warning);
-		std::cout << log.Message << std::endl;
-		this->m_Logs.push_back(log);
+	void Logger::LogWarning(const std::string &message, const std::source_location location)
+	{
+		Write(Severity::Warning, location, message);
 	}
 
 	void Logger::LogError(const std::string &message, const std::source_location location)
 	{
-		// build the message
-		std::stringstream ss;
-		ss << "[ERROR] received from file: {";
-		ss << location.file_name();
-		ss << "} at line: ";
-		ss << std::to_string(location.line());
-		ss << ": ";
-		ss << message;
+		Write(Severity::Error, location, message);
+	}
+
+	void Logger::Write(Severity severity, const std::source_location &location, std::string_view message)
+	{
+		if (ShouldLog(severity))
+		{
+			Enqueue(severity, location, message);
+		}
+	}
+
+	void Logger::SetLevel(Severity level)
+	{
+		m_Level.store(level, std::memory_order_relaxed);
+	}
+
+	Severity Logger::GetLevel() const
+	{
+		return m_Level.load(std::memory_order_relaxed);
+	}
+
+	bool Logger::ShouldLog(Severity severity) const
+	{
+		return severity >= m_Level.load(std::memory_order_relaxed);
+	}
+
+	void Logger::AddSink(std::shared_ptr<LogSink> sink)
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_Sinks.push_back(std::move(sink));
+	}
+
+	void Logger::ClearSinks()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_Sinks.clear();
+	}
+
+	void Logger::Flush()
+	{
+		uint64_t target = m_Enqueued.load();
+
+		// logs are written and flushed as they are added once the background thread has stopped
+		if (m_Stopped.load())
+		{
+			return;
+		}
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_FlushTarget  = std::max(m_FlushTarget, target);
+		m_FlushPending = true;
+		m_WorkAvailable.notify_one();
+
+		// the background thread flushes its sinks before it reports the logs as written
+		m_Written.wait(lock, [&]() { return m_WrittenCount >= target && !m_FlushPending; });
+	}
+
+	void Logger::Stop()
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			if (m_Stopping)
+			{
+				return;
+			}
+			m_Stopping = true;
+		}
+
+		m_WorkAvailable.notify_all();
+		m_Thread.join();
+
+		// a producer that linked its log after the background thread's last batch either sees the logger as stopped and writes the log
+		// itself, or counted it before this store, in which case reading the count makes the link visible to the write below
+		m_Stopped.store(true);
+		m_Enqueued.load();
+		WriteQueued();
+	}
+
+	std::vector<Nexus::Log> Logger::GetLogs() const
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		return std::vector<Nexus::Log>(m_History.begin(), m_History.end());
+	}
 
-		Nexus::Log log(ss.str(), Severity::Error);
-		std::cout << log.Message << std::endl;
-		this->m_Logs.push_back(log);
+	std::string &Logger::GetThreadBuffer()
+	{
+		thread_local std::string t_Buffer;
+		return t_Buffer;
 	}
 
-	const std::vector<Nexus::Log> &Logger::GetLogs()
+	void Logger::Enqueue(Severity severity, const std::source_location &location, std::string_view message)
 	{
-		return m_Logs;
+		Node *node = new Node();
+		node->Entry.emplace(std::string(message), severity, location);
+
+		// claiming the head orders this log after every log that claimed it earlier, linking the previous node then makes it visible
+		Node *previous = m_Head.exchange(node, std::memory_order_acq_rel);
+		previous->Next.store(node, std::memory_order_release);
+		m_Enqueued.fetch_add(1);
+
+		if (m_Stopped.load())
+		{
+			WriteQueued();
+			return;
+		}
+
+		// errors are written straight away, anything else waits for the next batch. The flag is set under the mutex so that the wake up
+		// cannot be missed between the background thread checking for work and starting to wait.
+		if (severity == Severity::Error)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_ErrorPending = true;
+			}
+
+			m_WorkAvailable.notify_one();
+		}
 	}
 
-	std::string Logger::GetTime()
+	std::optional<Nexus::Log> Logger::Dequeue()
 	{
-		std::time_t time = std::time(nullptr);
-		struct tm	tstruct;
-		char		buff[80];
-		tstruct = *std::localtime(&time);
-		strftime(buff, sizeof(buff), "%d-%m-%Y %X", &tstruct);
+		Node *next = m_Tail->Next.load(std::memory_order_acquire);
+		if (!next)
+		{
+			return std::nullopt;
+		}
 
-		std::string text = buff;
-		return text;
+		// the consumed node becomes the new placeholder, so its entry is moved out and the old placeholder is freed
+		std::optional<Nexus::Log> entry = std::move(next->Entry);
+		next->Entry.reset();
+		delete m_Tail;
+		m_Tail = next;
+		return entry;
+	}
+
+	void Logger::WriteQueued()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		std::vector<Nexus::Log> batch = {};
+		while (std::optional<Nexus::Log> log = Dequeue()) { batch.push_back(std::move(log.value())); }
+
+		if (batch.empty())
+		{
+			return;
+		}
+
+		for (const std::shared_ptr<LogSink> &sink : m_Sinks)
+		{
+			sink->Write(batch);
+			sink->Flush();
+		}
+
+		m_WrittenCount += batch.size();
+		for (Nexus::Log &log : batch) { m_History.push_back(std::move(log)); }
+		while (m_History.size() > m_HistoryCapacity) { m_History.pop_front(); }
+	}
+
+	void Logger::Run()
+	{
+		std::vector<Nexus::Log>				  batch = {};
+		std::vector<std::shared_ptr<LogSink>> sinks = {};
+
+		while (true)
+		{
+			bool stopping = false;
+			bool flush	  = false;
+
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_WorkAvailable.wait_for(lock, c_LogWriteInterval, [&]() { return m_Stopping || m_FlushPending || m_ErrorPending; });
+				stopping	   = m_Stopping;
+				flush		   = m_FlushPending;
+				sinks		   = m_Sinks;
+				m_ErrorPending = false;
+			}
+
+			// a producer may have claimed the head without linking its node yet, in which case its log is picked up in the next batch
+			batch.clear();
+			while (std::optional<Nexus::Log> log = Dequeue()) { batch.push_back(std::move(log.value())); }
+
+			if (!batch.empty())
+			{
+				for (const std::shared_ptr<LogSink> &sink : sinks) { sink->Write(batch); }
+			}
+
+			bool hasError = std::any_of(batch.begin(), batch.end(), [](const Nexus::Log &log) { return log.MessageSeverity == Severity::Error; });
+			if (flush || stopping || hasError)
+			{
+				for (const std::shared_ptr<LogSink> &sink : sinks) { sink->Flush(); }
+			}
+
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_WrittenCount += batch.size();
+
+				for (Nexus::Log &log : batch) { m_History.push_back(std::move(log)); }
+				while (m_History.size() > m_HistoryCapacity) { m_History.pop_front(); }
+
+				// a flush is only complete once everything that was queued before it has been written
+				if (flush && m_WrittenCount >= m_FlushTarget)
+				{
+					m_FlushPending = false;
+				}
+			}
+
+			m_Written.notify_all();
+
+			if (stopping && batch.empty() && !m_Tail->Next.load(std::memory_order_acquire))
+			{
+				return;
+			}
+		}
 	}
 
 	Logger *GetCoreLogger()
 	{
-		return logger;
+		static Logger *coreLogger = []()
+		{
+			Logger *created = new Logger();
+			created->AddSink(std::make_shared<ConsoleLogSink>());
+			return created;
+		}();
+
+		return coreLogger;
 	}
-}	 // namespace Nexus
\ No newline at end of file
+}	 // namespace Nexus
@@ -0,0 +1,110 @@
+#include "Nexus-Core/Logging/LogSink.hpp"
+
+namespace Nexus
+{
+	void FormatLog(const Nexus::Log &log, std::string &output)
+	{
+		std::time_t time = std::chrono::system_clock::to_time_t(log.Time);
+		struct tm	tstruct;
+		char		buff[80];
+		tstruct = *std::localtime(&time);
+		strftime(buff, sizeof(buff), "%d-%m-%Y %X", &tstruct);
+
+		std::format_to(std::back_inserter(output),
+					   "[{}] [{}] {}:{}: {}\n",
+					   buff,
+					   GetSeverityName(log.MessageSeverity),
+					   log.File,
+					   log.Line,
+					   log.Message);
+	}
+
+	void ConsoleLogSink::Write(std::span<const Nexus::Log> logs)
+	{
+		m_Buffer.clear();
+		for (const Nexus::Log &log : logs) { FormatLog(log, m_Buffer); }
+
+		std::fwrite(m_Buffer.data(), 1, m_Buffer.size(), stdout);
+	}
+
+	void ConsoleLogSink::Flush()
+	{
+		std::fflush(stdout);
+	}
+
+	RotatingFileLogSink::RotatingFileLogSink(const std::filesystem::path &path, size_t maxFileSize, uint32_t maxBackupFiles)
+		: m_Path(path),
+		  m_MaxFileSize(maxFileSize),
+		  m_MaxBackupFiles(maxBackupFiles)
+	{
+		if (m_Path.has_parent_path())
+		{
+			std::filesystem::create_directories(m_Path.parent_path());
+		}
+
+		std::error_code error;
+		m_FileSize = std::filesystem::exists(m_Path, error) ? (size_t)std::filesystem::file_size(m_Path, error) : 0;
+
+		m_File.open(m_Path, std::ios::binary | std::ios::app);
+		if (!m_File)
+		{
+			throw std::runtime_error("Failed to open log file: " + m_Path.string());
+		}
+	}
+
+	void RotatingFileLogSink::Write(std::span<const Nexus::Log> logs)
+	{
+		m_Buffer.clear();
+
+		for (const Nexus::Log &log : logs)
+		{
+			size_t previousSize = m_Buffer.size();
+			FormatLog(log, m_Buffer);
+
+			// the file is rotated between lines, so a line is never split across two files
+			size_t written = m_FileSize + previousSize;
+			if (written > 0 && written + (m_Buffer.size() - previousSize) > m_MaxFileSize)
+			{
+				m_File.write(m_Buffer.data(), previousSize);
+				m_Buffer.erase(0, previousSize);
+				Rotate();
+			}
+		}
+
+		m_File.write(m_Buffer.data(), m_Buffer.size());
+		m_FileSize += m_Buffer.size();
+	}
+
+	void RotatingFileLogSink::Flush()
+	{
+		m_File.flush();
+	}
+
+	void RotatingFileLogSink::Rotate()
+	{
+		m_File.close();
+
+		std::error_code error;
+		if (m_MaxBackupFiles == 0)
+		{
+			std::filesystem::remove(m_Path, error);
+		}
+		else
+		{
+			auto backupPath = [&](uint32_t index) { return std::filesystem::path(m_Path.string() + "." + std::to_string(index)); };
+
+			std::filesystem::remove(backupPath(m_MaxBackupFiles), error);
+			for (uint32_t i = m_MaxBackupFiles - 1; i > 0; i--)
+			{
+				if (std::filesystem::exists(backupPath(i), error))
+				{
+					std::filesystem::rename(backupPath(i), backupPath(i + 1), error);
+				}
+			}
+			std::filesystem::rename(m_Path, backupPath(1), error);
+		}
+
+		m_File.open(m_Path, std::ios::binary | std::ios::trunc);
+		m_FileSize = 0;
+	}
+}	 // namespace Nexus
@@ -0,0 +1,390 @@
+#include "Nexus-Core/Renderer/BoundingVolumeHierarchy.hpp"
+
+namespace Nexus::Graphics
+{
+	BoundingVolumeHierarchy::BoundingVolumeHierarchy(float margin) : m_Margin(margin)
+	{
+	}
+
+	uint32_t BoundingVolumeHierarchy::Insert(const BoundingBox &bounds, uint32_t userData)
+	{
+		uint32_t leaf		   = AllocateNode();
+		m_Nodes[leaf].Bounds   = bounds.Inflate(m_Margin);
+		m_Nodes[leaf].UserData = userData;
+		m_Nodes[leaf].Height   = 0;
+
+		InsertLeaf(leaf);
+		m_ProxyCount++;
+		return leaf;
+	}
+
+	void BoundingVolumeHierarchy::Remove(uint32_t proxy)
+	{
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+		m_ProxyCount--;
+	}
+
+	bool BoundingVolumeHierarchy::Move(uint32_t proxy, const BoundingBox &bounds)
+	{
+		if (m_Nodes[proxy].Bounds.Contains(bounds))
+		{
+			return false;
+		}
+
+		RemoveLeaf(proxy);
+		m_Nodes[proxy].Bounds = bounds.Inflate(m_Margin);
+		InsertLeaf(proxy);
+		return true;
+	}
+
+	void BoundingVolumeHierarchy::Query(const Frustum &frustum, std::vector<uint32_t> &results) const
+	{
+		if (m_Root == c_NullNode)
+		{
+			return;
+		}
+
+		std::vector<uint32_t> stack;
+		std::vector<uint32_t> subtree;
+		stack.push_back(m_Root);
+
+		while (!stack.empty())
+		{
+			uint32_t index = stack.back();
+			stack.pop_back();
+
+			const Node &node = m_Nodes[index];
+			FrustumTest test = frustum.Test(node.Bounds);
+
+			if (test == FrustumTest::Outside)
+			{
+				continue;
+			}
+
+			if (node.IsLeaf())
+			{
+				results.push_back(node.UserData);
+			}
+			else if (test == FrustumTest::Inside)
+			{
+				CollectLeaves(index, subtree, results);
+			}
+			else
+			{
+				stack.push_back(node.Child1);
+				stack.push_back(node.Child2);
+			}
+		}
+	}
+
+	void BoundingVolumeHierarchy::Query(const BoundingBox &box, std::vector<uint32_t> &results) const
+	{
+		if (m_Root == c_NullNode)
+		{
+			return;
+		}
+
+		std::vector<uint32_t> stack;
+		stack.push_back(m_Root);
+
+		while (!stack.empty())
+		{
+			uint32_t index = stack.back();
+			stack.pop_back();
+
+			const Node &node = m_Nodes[index];
+			if (!node.Bounds.Overlaps(box))
+			{
+				continue;
+			}
+
+			if (node.IsLeaf())
+			{
+				results.push_back(node.UserData);
+			}
+			else
+			{
+				stack.push_back(node.Child1);
+				stack.push_back(node.Child2);
+			}
+		}
+	}
+
+	uint32_t BoundingVolumeHierarchy::GetUserData(uint32_t proxy) const
+	{
+		return m_Nodes[proxy].UserData;
+	}
+
+	const BoundingBox &BoundingVolumeHierarchy::GetFatBounds(uint32_t proxy) const
+	{
+		return m_Nodes[proxy].Bounds;
+	}
+
+	size_t BoundingVolumeHierarchy::GetProxyCount() const
+	{
+		return m_ProxyCount;
+	}
+
+	uint32_t BoundingVolumeHierarchy::GetHeight() const
+	{
+		if (m_Root == c_NullNode)
+		{
+			return 0;
+		}
+
+		return m_Nodes[m_Root].Height;
+	}
+
+	void BoundingVolumeHierarchy::Clear()
+	{
+		m_Nodes.clear();
+		m_FreeNodes.clear();
+		m_Root		 = c_NullNode;
+		m_ProxyCount = 0;
+	}
+
+	uint32_t BoundingVolumeHierarchy::AllocateNode()
+	{
+		if (!m_FreeNodes.empty())
+		{
+			uint32_t index = m_FreeNodes.back();
+			m_FreeNodes.pop_back();
+			m_Nodes[index] = Node {};
+			return index;
+		}
+
+		m_Nodes.emplace_back();
+		return (uint32_t)m_Nodes.size() - 1;
+	}
+
+	void BoundingVolumeHierarchy::FreeNode(uint32_t index)
+	{
+		m_FreeNodes.push_back(index);
+	}
+
+	void BoundingVolumeHierarchy::InsertLeaf(uint32_t leaf)
+	{
+		if (m_Root == c_NullNode)
+		{
+			m_Root				 = leaf;
+			m_Nodes[leaf].Parent = c_NullNode;
+			return;
+		}
+
+		// walk down the tree towards the sibling that increases the total surface area the least, stopping early when making a new parent
+		// at the current level is cheaper than descending any further
+		BoundingBox leafBounds = m_Nodes[leaf].Bounds;
+		uint32_t	index	   = m_Root;
+
+		while (!m_Nodes[index].IsLeaf())
+		{
+			const Node &node = m_Nodes[index];
+
+			float area			  = node.Bounds.GetSurfaceArea();
+			float combinedArea	  = BoundingBox::Merge(node.Bounds, leafBounds).GetSurfaceArea();
+			float cost			  = 2.0f * combinedArea;
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			auto descendCost = [&](uint32_t child)
+			{
+				const Node &childNode = m_Nodes[child];
+				float		merged	  = BoundingBox::Merge(childNode.Bounds, leafBounds).GetSurfaceArea();
+				if (childNode.IsLeaf())
+				{
+					return merged + inheritanceCost;
+				}
+
+				return merged - childNode.Bounds.GetSurfaceArea() + inheritanceCost;
+			};
+
+			float cost1 = descendCost(node.Child1);
+			float cost2 = descendCost(node.Child2);
+
+			if (cost < cost1 && cost < cost2)
+			{
+				break;
+			}
+
+			index = cost1 < cost2 ? node.Child1 : node.Child2;
+		}
+
+		uint32_t sibling   = index;
+		uint32_t oldParent = m_Nodes[sibling].Parent;
+		uint32_t newParent = AllocateNode();
+
+		m_Nodes[newParent].Parent = oldParent;
+		m_Nodes[newParent].Bounds = BoundingBox::Merge(leafBounds, m_Nodes[sibling].Bounds);
+		m_Nodes[newParent].Height = m_Nodes[sibling].Height + 1;
+		m_Nodes[newParent].Child1 = sibling;
+		m_Nodes[newParent].Child2 = leaf;
+
+		if (oldParent != c_NullNode)
+		{
+			if (m_Nodes[oldParent].Child1 == sibling)
+			{
+				m_Nodes[oldParent].Child1 = newParent;
+			}
+			else
+			{
+				m_Nodes[oldParent].Child2 = newParent;
+			}
+		}
+		else
+		{
+			m_Root = newParent;
+		}
+
+		m_Nodes[sibling].Parent = newParent;
+		m_Nodes[leaf].Parent	= newParent;
+
+		Refit(oldParent);
+	}
+
+	void BoundingVolumeHierarchy::RemoveLeaf(uint32_t leaf)
+	{
+		if (leaf == m_Root)
+		{
+			m_Root = c_NullNode;
+			return;
+		}
+
+		// the leaf's parent is removed along with it and the leaf's sibling takes the parent's place
+		uint32_t parent		 = m_Nodes[leaf].Parent;
+		uint32_t grandParent = m_Nodes[parent].Parent;
+		uint32_t sibling	 = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+		if (grandParent != c_NullNode)
+		{
+			if (m_Nodes[grandParent].Child1 == parent)
+			{
+				m_Nodes[grandParent].Child1 = sibling;
+			}
+			else
+			{
+				m_Nodes[grandParent].Child2 = sibling;
+			}
+
+			m_Nodes[sibling].Parent = grandParent;
+			FreeNode(parent);
+			Refit(grandParent);
+		}
+		else
+		{
+			m_Root					= sibling;
+			m_Nodes[sibling].Parent = c_NullNode;
+			FreeNode(parent);
+		}
+	}
+
+	void BoundingVolumeHierarchy::Refit(uint32_t index)
+	{
+		while (index != c_NullNode)
+		{
+			index = Balance(index);
+
+			Node	   &node   = m_Nodes[index];
+			const Node &child1 = m_Nodes[node.Child1];
+			const Node &child2 = m_Nodes[node.Child2];
+
+			node.Height = 1 + std::max(child1.Height, child2.Height);
+			node.Bounds = BoundingBox::Merge(child1.Bounds, child2.Bounds);
+
+			index = node.Parent;
+		}
+	}
+
+	uint32_t BoundingVolumeHierarchy::Balance(uint32_t indexA)
+	{
+		Node &a = m_Nodes[indexA];
+		if (a.IsLeaf() || a.Height < 2)
+		{
+			return indexA;
+		}
+
+		uint32_t indexB = a.Child1;
+		uint32_t indexC = a.Child2;
+		Node	&b		= m_Nodes[indexB];
+		Node	&c		= m_Nodes[indexC];
+
+		int32_t balance = (int32_t)c.Height - (int32_t)b.Height;
+
+		// the taller child replaces A, A takes the place of the taller of that child's children and the shorter of them moves below A
+		auto rotate = [&](uint32_t indexUp, Node &up, uint32_t &aChild, const Node &other)
+		{
+			uint32_t indexF = up.Child1;
+			uint32_t indexG = up.Child2;
+			Node	&f		= m_Nodes[indexF];
+			Node	&g		= m_Nodes[indexG];
+
+			up.Child1 = indexA;
+			up.Parent = a.Parent;
+			a.Parent  = indexUp;
+
+			if (up.Parent != c_NullNode)
+			{
+				if (m_Nodes[up.Parent].Child1 == indexA)
+				{
+					m_Nodes[up.Parent].Child1 = indexUp;
+				}
+				else
+				{
+					m_Nodes[up.Parent].Child2 = indexUp;
+				}
+			}
+			else
+			{
+				m_Root = indexUp;
+			}
+
+			uint32_t indexKept	= f.Height > g.Height ? indexF : indexG;
+			uint32_t indexMoved = f.Height > g.Height ? indexG : indexF;
+			Node	&kept		= m_Nodes[indexKept];
+			Node	&moved		= m_Nodes[indexMoved];
+
+			up.Child2	 = indexKept;
+			aChild		 = indexMoved;
+			moved.Parent = indexA;
+
+			a.Bounds  = BoundingBox::Merge(other.Bounds, moved.Bounds);
+			a.Height  = 1 + std::max(other.Height, moved.Height);
+			up.Bounds = BoundingBox::Merge(a.Bounds, kept.Bounds);
+			up.Height = 1 + std::max(a.Height, kept.Height);
+		};
+
+		if (balance > 1)
+		{
+			rotate(indexC, c, a.Child2, b);
+			return indexC;
+		}
+
+		if (balance < -1)
+		{
+			rotate(indexB, b, a.Child1, c);
+			return indexB;
+		}
+
+		return indexA;
+	}
+
+	void BoundingVolumeHierarchy::CollectLeaves(uint32_t index, std::vector<uint32_t> &stack, std::vector<uint32_t> &results) const
+	{
+		stack.push_back(index);
+
+		while (!stack.empty())
+		{
+			const Node &node = m_Nodes[stack.back()];
+			stack.pop_back();
+
+			if (node.IsLeaf())
+			{
+				results.push_back(node.UserData);
+			}
+			else
+			{
+				stack.push_back(node.Child1);
+				stack.push_back(node.Child2);
+			}
+		}
+	}
+}	 // namespace Nexus::Graphics
@@ -0,0 +1,668 @@
+#include "Nexus-Core/Renderer/RenderGraph.hpp"
+
+#include "Nexus-Core/Graphics/GraphicsDevice.hpp"
+
+namespace Nexus::Graphics
+{
+	/// @brief The state that a resource has to be in for a pass to use it in a particular way
+	struct RenderGraphAccessState
+	{
+		TextureLayout		 Layout			  = TextureLayout::Undefined;
+		BarrierAccess		 Access			  = BarrierAccess::None;
+		BarrierPipelineStage SourceStage	  = BarrierPipelineStage::None;
+		BarrierPipelineStage DestinationStage = BarrierPipelineStage::None;
+		bool				 Write			  = false;
+	};
+
+	static RenderGraphAccessState GetAccessState(RenderGraphAccess access)
+	{
+		switch (access)
+		{
+			case RenderGraphAccess::ColourAttachment:
+				return {TextureLayout::ColourAttachmentOptimal,
+						BarrierAccess::ColourAttachmentWrite,
+						BarrierPipelineStage::ColourAttachmentOutput,
+						BarrierPipelineStage::ColourAttachmentOutput,
+						true};
+			case RenderGraphAccess::DepthStencilAttachment:
+				return {TextureLayout::DepthStencilAttachmentOptimal,
+						BarrierAccess::DepthStencilAttachmentWrite,
+						BarrierPipelineStage::LateFragmentTests,
+						BarrierPipelineStage::EarlyFragmentTests,
+						true};
+			case RenderGraphAccess::DepthStencilRead:
+				return {TextureLayout::DepthStencilReadOnlyOptimal,
+						BarrierAccess::DepthStencilAttachmentRead,
+						BarrierPipelineStage::LateFragmentTests,
+						BarrierPipelineStage::EarlyFragmentTests,
+						false};
+			case RenderGraphAccess::ShaderRead:
+				return {TextureLayout::ShaderReadOnlyOptimal,
+						BarrierAccess::ShaderRead,
+						BarrierPipelineStage::AllCommands,
+						BarrierPipelineStage::AllCommands,
+						false};
+			case RenderGraphAccess::ShaderWrite:
+				return {TextureLayout::General,
+						BarrierAccess::ShaderWrite,
+						BarrierPipelineStage::AllCommands,
+						BarrierPipelineStage::AllCommands,
+						true};
+			case RenderGraphAccess::TransferSource:
+				return {TextureLayout::TransferSrcOptimal,
+						BarrierAccess::TransferRead,
+						BarrierPipelineStage::Transfer,
+						BarrierPipelineStage::Transfer,
+						false};
+			case RenderGraphAccess::TransferDestination:
+				return {TextureLayout::TransferDstOptimal,
+						BarrierAccess::TransferWrite,
+						BarrierPipelineStage::Transfer,
+						BarrierPipelineStage::Transfer,
+						true};
+			case RenderGraphAccess::VertexBuffer:
+				return {TextureLayout::Undefined,
+						BarrierAccess::VertexAttributeRead,
+						BarrierPipelineStage::VertexInput,
+						BarrierPipelineStage::VertexInput,
+						false};
+			case RenderGraphAccess::IndexBuffer:
+				return {TextureLayout::Undefined,
+						BarrierAccess::IndexRead,
+						BarrierPipelineStage::IndexInput,
+						BarrierPipelineStage::IndexInput,
+						false};
+			case RenderGraphAccess::IndirectBuffer:
+				return {TextureLayout::Undefined,
+						BarrierAccess::IndirectCommandRead,
+						BarrierPipelineStage::DrawIndirect,
+						BarrierPipelineStage::DrawIndirect,
+						false};
+			case RenderGraphAccess::UniformBuffer:
+				return {TextureLayout::Undefined,
+						BarrierAccess::UniformRead,
+						BarrierPipelineStage::AllCommands,
+						BarrierPipelineStage::AllCommands,
+						false};
+			default: return {};
+		}
+	}
+
+	/// @brief Returns the usage flags that a transient texture needs to support an access
+	static uint8_t GetTextureUsage(RenderGraphAccess access)
+	{
+		switch (access)
+		{
+			case RenderGraphAccess::ColourAttachment:
+			case RenderGraphAccess::DepthStencilAttachment:
+			case RenderGraphAccess::DepthStencilRead: return TextureUsage_RenderTarget;
+			case RenderGraphAccess::ShaderRead: return TextureUsage_Sampled;
+			case RenderGraphAccess::ShaderWrite: return TextureUsage_Storage;
+			default: return 0;
+		}
+	}
+
+	/// @brief Returns the usage flags that a transient buffer needs to support an access
+	static uint8_t GetBufferUsage(RenderGraphAccess access)
+	{
+		switch (access)
+		{
+			case RenderGraphAccess::VertexBuffer: return BufferUsage::Vertex;
+			case RenderGraphAccess::IndexBuffer: return BufferUsage::Index;
+			case RenderGraphAccess::IndirectBuffer: return BufferUsage::Indirect;
+			case RenderGraphAccess::UniformBuffer: return BufferUsage::Uniform;
+			case RenderGraphAccess::ShaderRead:
+			case RenderGraphAccess::ShaderWrite: return BufferUsage::Storage;
+			default: return 0;
+		}
+	}
+
+	RenderGraphBuilder::RenderGraphBuilder(RenderGraph *graph, uint32_t pass) : m_Graph(graph), m_Pass(pass)
+	{
+	}
+
+	RenderGraphResource RenderGraphBuilder::CreateTexture(const std::string &name, const TextureDescription &description)
+	{
+		RenderGraph::Resource resource = {};
+		resource.Name				   = name;
+		resource.Type				   = RenderGraph::ResourceType::Texture;
+		resource.TextureDesc		   = description;
+		return m_Graph->AddResource(resource);
+	}
+
+	RenderGraphResource RenderGraphBuilder::CreateBuffer(const std::string &name, const DeviceBufferDescription &description)
+	{
+		RenderGraph::Resource resource = {};
+		resource.Name				   = name;
+		resource.Type				   = RenderGraph::ResourceType::Buffer;
+		resource.BufferDesc			   = description;
+		return m_Graph->AddResource(resource);
+	}
+
+	void RenderGraphBuilder::Read(RenderGraphResource resource, RenderGraphAccess access)
+	{
+		if (resource.Index >= m_Graph->m_Resources.size())
+		{
+			throw std::runtime_error("Pass '" + m_Graph->m_Passes[m_Pass].Name + "' reads a resource that does not belong to the render graph");
+		}
+
+		m_Graph->m_Passes[m_Pass].Reads.push_back({resource, access});
+	}
+
+	void RenderGraphBuilder::Write(RenderGraphResource resource, RenderGraphAccess access)
+	{
+		if (resource.Index >= m_Graph->m_Resources.size())
+		{
+			throw std::runtime_error("Pass '" + m_Graph->m_Passes[m_Pass].Name + "' writes a resource that does not belong to the render graph");
+		}
+
+		m_Graph->m_Passes[m_Pass].Writes.push_back({resource, access});
+	}
+
+	void RenderGraphBuilder::SetSideEffects()
+	{
+		m_Graph->m_Passes[m_Pass].SideEffects = true;
+	}
+
+	RenderGraphContext::RenderGraphContext(const RenderGraph *graph, Ref<CommandList> commandList) : m_Graph(graph), m_CommandList(commandList)
+	{
+	}
+
+	Ref<CommandList> RenderGraphContext::GetCommandList() const
+	{
+		return m_CommandList;
+	}
+
+	Ref<Texture> RenderGraphContext::GetTexture(RenderGraphResource resource) const
+	{
+		return m_Graph->GetTexture(resource);
+	}
+
+	Ref<DeviceBuffer> RenderGraphContext::GetBuffer(RenderGraphResource resource) const
+	{
+		return m_Graph->GetBuffer(resource);
+	}
+
+	RenderGraph::RenderGraph(GraphicsDevice *device) : m_Device(device)
+	{
+	}
+
+	RenderGraphResource RenderGraph::ImportTexture(const std::string &name, Ref<Texture> texture, RenderGraphAccess finalAccess)
+	{
+		Resource resource	 = {};
+		resource.Name		 = name;
+		resource.Type		 = ResourceType::Texture;
+		resource.Imported	 = true;
+		resource.Texture	 = texture;
+		resource.TextureDesc = texture->GetDescription();
+		resource.FinalAccess = finalAccess;
+		return AddResource(resource);
+	}
+
+	RenderGraphResource RenderGraph::ImportBuffer(const std::string &name, Ref<DeviceBuffer> buffer)
+	{
+		Resource resource	= {};
+		resource.Name		= name;
+		resource.Type		= ResourceType::Buffer;
+		resource.Imported	= true;
+		resource.Buffer		= buffer;
+		resource.BufferDesc = buffer->GetDescription();
+		return AddResource(resource);
+	}
+
+	RenderGraphResource RenderGraph::ImportRenderTarget(const std::string &name)
+	{
+		Resource resource = {};
+		resource.Name	  = name;
+		resource.Type	  = ResourceType::RenderTarget;
+		resource.Imported = true;
+		return AddResource(resource);
+	}
+
+	void RenderGraph::AddPass(const std::string &name, SetupFunc setup, ExecuteFunc execute)
+	{
+		m_Compiled = false;
+
+		Pass pass	 = {};
+		pass.Name	 = name;
+		pass.Execute = std::move(execute);
+		m_Passes.push_back(std::move(pass));
+
+		RenderGraphBuilder builder(this, (uint32_t)m_Passes.size() - 1);
+		setup(builder);
+	}
+
+	void RenderGraph::Compile()
+	{
+		m_FrameIndex++;
+		m_CompiledPasses.clear();
+		m_FinalBarriers.clear();
+		m_Statistics				= {};
+		m_Statistics.DeclaredPasses = (uint32_t)m_Passes.size();
+
+		std::vector<bool> kept;
+		CullPasses(kept);
+
+		for (uint32_t i = 0; i < m_Passes.size(); i++)
+		{
+			if (!kept[i])
+			{
+				continue;
+			}
+
+			RenderGraphCompiledPass compiled = {};
+			compiled.Name					 = m_Passes[i].Name;
+			compiled.Pass					 = i;
+			m_CompiledPasses.push_back(compiled);
+		}
+
+		// lifetimes are measured in compiled passes, so a resource only used by culled passes is never allocated
+		for (Resource &resource : m_Resources)
+		{
+			resource.FirstUse = UINT32_MAX;
+			resource.LastUse  = 0;
+			resource.Physical = UINT32_MAX;
+		}
+
+		for (uint32_t i = 0; i < m_CompiledPasses.size(); i++)
+		{
+			const Pass &pass = m_Passes[m_CompiledPasses[i].Pass];
+			for (const std::vector<ResourceUsage> *usages : {&pass.Reads, &pass.Writes})
+			{
+				for (const ResourceUsage &usage : *usages)
+				{
+					Resource &resource = m_Resources[usage.Resource.Index];
+					resource.FirstUse  = std::min(resource.FirstUse, i);
+					resource.LastUse   = std::max(resource.LastUse, i);
+
+					if (resource.Imported)
+					{
+						continue;
+					}
+
+					if (resource.Type == ResourceType::Texture)
+					{
+						resource.TextureDesc.Usage |= GetTextureUsage(usage.Access);
+					}
+					else if (resource.Type == ResourceType::Buffer)
+					{
+						resource.BufferDesc.Usage |= GetBufferUsage(usage.Access);
+					}
+				}
+			}
+
+			// a pass that reads and writes a resource on its first use (e.g. a clear that loads the previous contents) is treated as writing
+			// it, so the resource is allocated for that pass and its contents are undefined until the pass has run
+			for (const ResourceUsage &usage : pass.Reads)
+			{
+				const Resource &resource = m_Resources[usage.Resource.Index];
+				bool			written	 = std::any_of(pass.Writes.begin(),
+													   pass.Writes.end(),
+													   [&](const ResourceUsage &write) { return write.Resource.Index == usage.Resource.Index; });
+
+				if (!resource.Imported && resource.FirstUse == i && !written)
+				{
+					throw std::runtime_error("Pass '" + pass.Name + "' reads '" + resource.Name + "' before any pass has written to it");
+				}
+			}
+		}
+
+		AllocatePhysicalResources();
+		ComputeBarriers();
+
+		m_Statistics.ExecutedPasses = (uint32_t)m_CompiledPasses.size();
+		m_Compiled					= true;
+	}
+
+	void RenderGraph::Execute(Ref<CommandList> commandList, Ref<ICommandQueue> commandQueue, Ref<Fence> fence)
+	{
+		if (!m_Compiled)
+		{
+			Compile();
+		}
+
+		CreatePhysicalResources();
+
+		auto submitBarrier = [&](const RenderGraphBarrier &barrier)
+		{
+			const Resource &resource = m_Resources[barrier.Resource.Index];
+			if (resource.Type == ResourceType::Texture)
+			{
+				TextureBarrierDesc desc			 = {};
+				desc.Texture					 = GetTexture(barrier.Resource);
+				desc.Layout						 = barrier.Layout;
+				desc.BeforeAccess				 = barrier.BeforeAccess;
+				desc.AfterAccess				 = barrier.AfterAccess;
+				desc.BeforeStage				 = barrier.BeforeStage;
+				desc.AfterStage					 = barrier.AfterStage;
+				desc.SubresourceRange.LevelCount = resource.TextureDesc.MipLevels;
+				desc.SubresourceRange.LayerCount = resource.TextureDesc.DepthOrArrayLayers;
+				commandList->SubmitTextureBarrier(desc);
+			}
+			else if (resource.Type == ResourceType::Buffer)
+			{
+				BufferBarrierDesc desc = {};
+				desc.Buffer			   = GetBuffer(barrier.Resource);
+				desc.BeforeAccess	   = barrier.BeforeAccess;
+				desc.AfterAccess	   = barrier.AfterAccess;
+				desc.BeforeStage	   = barrier.BeforeStage;
+				desc.AfterStage		   = barrier.AfterStage;
+				desc.Offset			   = 0;
+				desc.Size			   = resource.BufferDesc.SizeInBytes;
+				commandList->SubmitBufferBarrier(desc);
+			}
+		};
+
+		RenderGraphContext context(this, commandList);
+
+		// every pass is recorded into the same command list, so the whole frame is a single submission
+		commandList->Begin();
+		for (const RenderGraphCompiledPass &compiled : m_CompiledPasses)
+		{
+			commandList->BeginDebugGroup(compiled.Name);
+			for (const RenderGraphBarrier &barrier : compiled.Barriers) { submitBarrier(barrier); }
+
+			const Pass &pass = m_Passes[compiled.Pass];
+			if (pass.Execute)
+			{
+				pass.Execute(context);
+			}
+			commandList->EndDebugGroup();
+		}
+
+		for (const RenderGraphBarrier &barrier : m_FinalBarriers) { submitBarrier(barrier); }
+		commandList->End();
+
+		commandQueue->SubmitCommandLists(&commandList, 1, fence);
+	}
+
+	void RenderGraph::Reset()
+	{
+		m_Resources.clear();
+		m_Passes.clear();
+		m_CompiledPasses.clear();
+		m_FinalBarriers.clear();
+		m_Compiled = false;
+	}
+
+	const std::vector<RenderGraphCompiledPass> &RenderGraph::GetCompiledPasses() const
+	{
+		return m_CompiledPasses;
+	}
+
+	const RenderGraphStatistics &RenderGraph::GetStatistics() const
+	{
+		return m_Statistics;
+	}
+
+	uint32_t RenderGraph::GetPhysicalResource(RenderGraphResource resource) const
+	{
+		return m_Resources.at(resource.Index).Physical;
+	}
+
+	Ref<Texture> RenderGraph::GetTexture(RenderGraphResource resource) const
+	{
+		const Resource &entry = m_Resources.at(resource.Index);
+		if (entry.Imported || entry.Physical == UINT32_MAX)
+		{
+			return entry.Texture;
+		}
+
+		return m_Physical[entry.Physical].Texture;
+	}
+
+	Ref<DeviceBuffer> RenderGraph::GetBuffer(RenderGraphResource resource) const
+	{
+		const Resource &entry = m_Resources.at(resource.Index);
+		if (entry.Imported || entry.Physical == UINT32_MAX)
+		{
+			return entry.Buffer;
+		}
+
+		return m_Physical[entry.Physical].Buffer;
+	}
+
+	RenderGraphResource RenderGraph::AddResource(Resource resource)
+	{
+		m_Compiled = false;
+		m_Resources.push_back(std::move(resource));
+		return RenderGraphResource {.Index = (uint32_t)m_Resources.size() - 1};
+	}
+
+	void RenderGraph::CullPasses(std::vector<bool> &kept) const
+	{
+		// walking backwards, a pass is needed if it has side effects or writes something that a later needed pass reads or that outlives
+		// the graph, and everything a needed pass reads is then needed as well
+		std::vector<bool> needed(m_Resources.size(), false);
+		for (size_t i = 0; i < m_Resources.size(); i++) { needed[i] = m_Resources[i].Imported; }
+
+		kept.assign(m_Passes.size(), false);
+		for (size_t i = m_Passes.size(); i-- > 0;)
+		{
+			const Pass &pass = m_Passes[i];
+
+			bool keep = pass.SideEffects;
+			for (const ResourceUsage &usage : pass.Writes) { keep = keep || needed[usage.Resource.Index]; }
+
+			if (!keep)
+			{
+				continue;
+			}
+
+			kept[i] = true;
+			for (const ResourceUsage &usage : pass.Reads) { needed[usage.Resource.Index] = true; }
+		}
+	}
+
+	void RenderGraph::AllocatePhysicalResources()
+	{
+		// textures and buffers that have not been needed for a while are released rather than being kept in the pool indefinitely, frames
+		// that are still in flight may be using them so they are handed to the frame tracker instead of being destroyed immediately
+		const uint64_t unusedFrameLimit = 8;
+		auto		   isUnused			= [&](const PhysicalResource &physical)
+		{
+			return m_FrameIndex - physical.LastUsedFrame > unusedFrameLimit;
+		};
+
+		for (const PhysicalResource &physical : m_Physical)
+		{
+			if (m_Device && isUnused(physical))
+			{
+				m_Device->GetFrameTracker().DeferDeletion(physical.Texture);
+				m_Device->GetFrameTracker().DeferDeletion(physical.Buffer);
+			}
+		}
+
+		m_Physical.erase(std::remove_if(m_Physical.begin(), m_Physical.end(), isUnused), m_Physical.end());
+
+		for (PhysicalResource &physical : m_Physical) { physical.Assigned = false; }
+
+		// resources are visited in the order that they are first used, and take the first compatible texture or buffer whose previous
+		// occupant has already been used for the last time
+		std::vector<uint32_t> order;
+		for (uint32_t i = 0; i < m_Resources.size(); i++)
+		{
+			const Resource &resource = m_Resources[i];
+			if (!resource.Imported && resource.Type != ResourceType::RenderTarget && resource.FirstUse != UINT32_MAX)
+			{
+				order.push_back(i);
+			}
+		}
+
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return m_Resources[a].FirstUse < m_Resources[b].FirstUse; });
+
+		for (uint32_t index : order)
+		{
+			Resource &resource = m_Resources[index];
+
+			uint32_t physicalIndex = UINT32_MAX;
+			for (uint32_t i = 0; i < m_Physical.size(); i++)
+			{
+				const PhysicalResource &physical = m_Physical[i];
+				if ((!physical.Assigned || physical.BusyUntil < resource.FirstUse) && IsCompatible(physical, resource))
+				{
+					physicalIndex = i;
+					break;
+				}
+			}
+
+			if (physicalIndex == UINT32_MAX)
+			{
+				PhysicalResource physical = {};
+				physical.Type			  = resource.Type;
+				physical.TextureDesc	  = resource.TextureDesc;
+				physical.BufferDesc		  = resource.BufferDesc;
+				m_Physical.push_back(physical);
+				physicalIndex = (uint32_t)m_Physical.size() - 1;
+			}
+
+			PhysicalResource &physical = m_Physical[physicalIndex];
+			if (!physical.Assigned)
+			{
+				m_Statistics.PhysicalResources++;
+			}
+
+			physical.Assigned	   = true;
+			physical.BusyUntil	   = resource.LastUse;
+			physical.LastUsedFrame = m_FrameIndex;
+			resource.Physical	   = physicalIndex;
+			m_Statistics.TransientResources++;
+		}
+	}
+
+	void RenderGraph::ComputeBarriers()
+	{
+		// state is tracked per texture or buffer rather than per resource, so that a resource taking over memory from another one waits
+		// for the previous occupant to finish
+		std::vector<RenderGraphAccessState> resourceStates(m_Resources.size());
+		std::vector<RenderGraphAccessState> physicalStates(m_Physical.size());
+
+		auto getState = [&](const Resource &resource, uint32_t index) -> RenderGraphAccessState &
+		{
+			return resource.Physical != UINT32_MAX ? physicalStates[resource.Physical] : resourceStates[index];
+		};
+
+		auto transition = [&](std::vector<RenderGraphBarrier> &barriers, uint32_t index, RenderGraphAccess access)
+		{
+			const Resource &resource = m_Resources[index];
+			if (resource.Type == ResourceType::RenderTarget || access == RenderGraphAccess::None)
+			{
+				return;
+			}
+
+			RenderGraphAccessState &current = getState(resource, index);
+			RenderGraphAccessState	next	= GetAccessState(access);
+
+			// a pass may declare the same usage more than once, but cannot need a resource to be in two different states at the same time
+			for (const RenderGraphBarrier &barrier : barriers)
+			{
+				if (barrier.Resource.Index != index)
+				{
+					continue;
+				}
+
+				if (barrier.AfterAccess == next.Access && barrier.Layout == next.Layout)
+				{
+					return;
+				}
+
+				throw std::runtime_error("A pass uses '" + resource.Name + "' in more than one way");
+			}
+
+			// reads that follow reads in the same layout can run without waiting for each other
+			bool layoutChanged = resource.Type == ResourceType::Texture && current.Layout != next.Layout;
+			bool hazard		   = current.Write || (next.Write && current.Access != BarrierAccess::None);
+			if (!layoutChanged && !hazard)
+			{
+				return;
+			}
+
+			RenderGraphBarrier barrier = {};
+			barrier.Resource		   = RenderGraphResource {.Index = index};
+			barrier.Layout			   = next.Layout;
+			barrier.BeforeAccess	   = current.Access;
+			barrier.AfterAccess		   = next.Access;
+			barrier.BeforeStage		   = current.SourceStage;
+			barrier.AfterStage		   = next.DestinationStage;
+			barriers.push_back(barrier);
+
+			current = next;
+			m_Statistics.Barriers++;
+		};
+
+		for (RenderGraphCompiledPass &compiled : m_CompiledPasses)
+		{
+			const Pass &pass = m_Passes[compiled.Pass];
+
+			// a resource that is both read and written by a pass, such as a depth buffer that is tested and written, takes the written state
+			for (const ResourceUsage &usage : pass.Reads)
+			{
+				bool written = std::any_of(pass.Writes.begin(),
+										   pass.Writes.end(),
+										   [&](const ResourceUsage &write) { return write.Resource.Index == usage.Resource.Index; });
+				if (!written)
+				{
+					transition(compiled.Barriers, usage.Resource.Index, usage.Access);
+				}
+			}
+
+			for (const ResourceUsage &usage : pass.Writes) { transition(compiled.Barriers, usage.Resource.Index, usage.Access); }
+		}
+
+		for (uint32_t i = 0; i < m_Resources.size(); i++)
+		{
+			const Resource &resource = m_Resources[i];
+			if (resource.Imported && resource.FinalAccess != RenderGraphAccess::None)
+			{
+				transition(m_FinalBarriers, i, resource.FinalAccess);
+			}
+		}
+	}
+
+	void RenderGraph::CreatePhysicalResources()
+	{
+		for (PhysicalResource &physical : m_Physical)
+		{
+			if (!physical.Assigned || physical.Texture || physical.Buffer)
+			{
+				continue;
+			}
+
+			if (!m_Device)
+			{
+				throw std::runtime_error("A render graph needs a graphics device to create transient resources");
+			}
+
+			if (physical.Type == ResourceType::Texture)
+			{
+				physical.Texture = m_Device->CreateTexture(physical.TextureDesc);
+			}
+			else
+			{
+				physical.Buffer = m_Device->CreateDeviceBuffer(physical.BufferDesc);
+			}
+
+			m_Statistics.CreatedResources++;
+		}
+	}
+
+	bool RenderGraph::IsCompatible(const PhysicalResource &physical, const Resource &resource) const
+	{
+		if (physical.Type != resource.Type)
+		{
+			return false;
+		}
+
+		if (resource.Type == ResourceType::Texture)
+		{
+			const TextureDescription &a = physical.TextureDesc;
+			const TextureDescription &b = resource.TextureDesc;
+			return a.Type == b.Type && a.Format == b.Format && a.Width == b.Width && a.Height == b.Height &&
+				   a.DepthOrArrayLayers == b.DepthOrArrayLayers && a.MipLevels == b.MipLevels && a.Samples == b.Samples && a.Usage == b.Usage;
+		}
+
+		const DeviceBufferDescription &a = physical.BufferDesc;
+		const DeviceBufferDescription &b = resource.BufferDesc;
+		return a.Access == b.Access && a.Usage == b.Usage && a.SizeInBytes == b.SizeInBytes && a.StrideInBytes == b.StrideInBytes;
+	}
+}	 // namespace Nexus::Graphics
@@ -0,0 +1,132 @@
+#include "Nexus-Core/Renderer/RenderThread.hpp"
+
+namespace Nexus::Graphics
+{
+	RenderThread::RenderThread(RenderFunc func, uint32_t maxQueuedFrames) : m_Func(std::move(func)), m_MaxQueuedFrames(maxQueuedFrames)
+	{
+		if (!m_Func)
+		{
+			throw std::runtime_error("A render thread needs a function to render packets with");
+		}
+
+		if (m_MaxQueuedFrames == 0)
+		{
+			throw std::runtime_error("A render thread must be able to queue at least one frame");
+		}
+
+		m_Thread = std::thread([this]() { Run(); });
+	}
+
+	RenderThread::~RenderThread()
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_Stopping = true;
+		}
+
+		m_PacketQueued.notify_all();
+		m_Thread.join();
+	}
+
+	void RenderThread::Submit(std::unique_ptr<FramePacket> packet)
+	{
+		if (!packet)
+		{
+			throw std::runtime_error("Cannot submit an empty frame packet");
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+
+			// one packet can be rendering while the others wait, so the producer is at most m_MaxQueuedFrames + 1 frames ahead
+			m_PacketRendered.wait(lock, [&]() { return m_Submitted - m_Rendered <= m_MaxQueuedFrames || m_Error; });
+			RethrowError();
+
+			packet->FrameNumber = ++m_Submitted;
+			m_Queue.push_back(std::move(packet));
+		}
+
+		m_PacketQueued.notify_one();
+	}
+
+	void RenderThread::WaitForIdle()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_PacketRendered.wait(lock, [&]() { return m_Rendered == m_Submitted; });
+		RethrowError();
+	}
+
+	uint64_t RenderThread::GetSubmittedFrameCount() const
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		return m_Submitted;
+	}
+
+	uint64_t RenderThread::GetRenderedFrameCount() const
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		return m_Rendered;
+	}
+
+	uint32_t RenderThread::GetMaxQueuedFrames() const
+	{
+		return m_MaxQueuedFrames;
+	}
+
+	void RenderThread::Run()
+	{
+		while (true)
+		{
+			std::unique_ptr<FramePacket> packet = nullptr;
+
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_PacketQueued.wait(lock, [&]() { return m_Stopping || !m_Queue.empty(); });
+
+				// packets that were submitted before stopping are still rendered, so that nothing the producer handed over is dropped
+				if (m_Queue.empty())
+				{
+					return;
+				}
+
+				packet = std::move(m_Queue.front());
+				m_Queue.pop_front();
+			}
+
+			std::exception_ptr error = nullptr;
+			try
+			{
+				m_Func(*packet);
+			}
+			catch (...)
+			{
+				error = std::current_exception();
+			}
+
+			// the packet is released before the frame counts as rendered, so anything it keeps alive is gone once WaitForIdle returns
+			packet.reset();
+
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_Rendered++;
+
+				if (error && !m_Error)
+				{
+					m_Error = error;
+				}
+			}
+
+			m_PacketRendered.notify_all();
+		}
+	}
+
+	void RenderThread::RethrowError()
+	{
+		if (m_Error)
+		{
+			std::exception_ptr error = nullptr;
+			std::swap(error, m_Error);
+			std::rethrow_exception(error);
+		}
+	}
+}	 // namespace Nexus::Graphics
@@ -76,6 +76,8 @@ layout (location = 2) in vec3 Normal;
 layout (location = 3) in vec4 VertexColour;
 layout (location = 4) in vec3 Tangent;
 layout (location = 5) in vec3 Bitangent;
+layout (location = 6) in mat4 InstanceTransform;
+layout (location = 10) in uvec2 InstanceGuid;
 
 layout (location = 0) out vec2 OutTexCoord;
 layout (location = 1) out vec3 OutNormal;
@@ -93,32 +95,101 @@ layout (std140, binding = 0, set = 0) uniform Camera
 	vec3 u_ViewPos;
 };
 
-layout (std140,binding = 1, set = 0) uniform Transform
+layout (std140,binding = 1, set = 0) uniform Mesh
 {
-	mat4 u_Transform;
 	vec4 u_DiffuseColour;
 	vec4 u_SpecularColour;
-	uint u_Guid1;
-	uint u_Guid2;
+	vec4 u_PositionOffset;
+	vec4 u_PositionScale;
+	vec4 u_TexCoordOffsetScale;
 };
 
 void main()
 {
-	gl_Position = u_Projection * u_View * u_Transform * vec4(Position, 1.0);
+	gl_Position = u_Projection * u_View * InstanceTransform * vec4(Position, 1.0);
 	OutTexCoord = TexCoord;
-	OutNormal = mat3(transpose(inverse(u_Transform))) * Normal;
-	FragPos = vec3(u_Transform * vec4(Position, 1.0));
+	OutNormal = mat3(transpose(inverse(InstanceTransform))) * Normal;
+	FragPos = vec3(InstanceTransform * vec4(Position, 1.0));
 	ViewPos = u_ViewPos;
 
 	VertexDiffuseColour = VertexColour;
 	MaterialDiffuseColour = u_DiffuseColour;
 
-	vec3 T = normalize(vec3(u_Transform * vec4(Tangent, 0.0)));
-	vec3 B = normalize(vec3(u_Transform * vec4(Bitangent, 0.0)));
-	vec3 N = normalize(vec3(u_Transform * vec4(Normal, 0.0)));
+	vec3 T = normalize(vec3(InstanceTransform * vec4(Tangent, 0.0)));
+	vec3 B = normalize(vec3(InstanceTransform * vec4(Bitangent, 0.0)));
+	vec3 N = normalize(vec3(InstanceTransform * vec4(Normal, 0.0)));
 	TBN = mat3(T, B, N);
 
-	EntityID = uvec2(u_Guid1, u_Guid2);
+	EntityID = InstanceGuid;
+}
+)";
+
+const std::string c_QuantizedModelVertexShader = R"(
+#version 450 core
+
+layout (location = 0) in vec4 Position;
+layout (location = 1) in vec2 TexCoord;
+layout (location = 2) in vec2 Normal;
+layout (location = 3) in vec2 Tangent;
+layout (location = 4) in vec4 VertexColour;
+layout (location = 5) in mat4 InstanceTransform;
+layout (location = 9) in uvec2 InstanceGuid;
+
+layout (location = 0) out vec2 OutTexCoord;
+layout (location = 1) out vec3 OutNormal;
+layout (location = 2) out vec3 FragPos;
+layout (location = 3) out vec4 VertexDiffuseColour;
+layout (location = 4) out vec4 MaterialDiffuseColour;
+layout (location = 5) out vec3 ViewPos;
+layout (location = 6) flat out uvec2 EntityID;
+layout (location = 7) out mat3 TBN;
+
+layout (std140, binding = 0, set = 0) uniform Camera
+{
+	mat4 u_View;
+	mat4 u_Projection;
+	vec3 u_ViewPos;
+};
+
+layout (std140,binding = 1, set = 0) uniform Mesh
+{
+	vec4 u_DiffuseColour;
+	vec4 u_SpecularColour;
+	vec4 u_PositionOffset;
+	vec4 u_PositionScale;
+	vec4 u_TexCoordOffsetScale;
+};
+
+vec3 DecodeOctahedral(vec2 encoded)
+{
+	vec3 direction = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+	float fold = max(-direction.z, 0.0);
+	direction.xy += mix(vec2(fold), vec2(-fold), greaterThanEqual(direction.xy, vec2(0.0)));
+	return normalize(direction);
+}
+
+void main()
+{
+	vec3 position = u_PositionOffset.xyz + u_PositionScale.xyz * Position.xyz;
+	vec3 normal = DecodeOctahedral(Normal);
+	vec3 tangent = DecodeOctahedral(Tangent);
+	vec3 bitangent = cross(normal, tangent) * Position.w;
+
+	gl_Position = u_Projection * u_View * InstanceTransform * vec4(position, 1.0);
+	OutTexCoord = u_TexCoordOffsetScale.xy + u_TexCoordOffsetScale.zw * TexCoord;
+	OutNormal = mat3(transpose(inverse(InstanceTransform))) * normal;
+	FragPos = vec3(InstanceTransform * vec4(position, 1.0));
+	ViewPos = u_ViewPos;
+
+	VertexDiffuseColour = VertexColour;
+	MaterialDiffuseColour = u_DiffuseColour;
+
+	vec3 T = normalize(vec3(InstanceTransform * vec4(tangent, 0.0)));
+	vec3 B = normalize(vec3(InstanceTransform * vec4(bitangent, 0.0)));
+	vec3 N = normalize(vec3(InstanceTransform * vec4(normal, 0.0)));
+	TBN = mat3(T, B, N);
+
+	EntityID = InstanceGuid;
 }
 )";
 
@@ -154,13 +225,15 @@ namespace Nexus::Graphics
 		: m_Device(device),
 		  m_CommandQueue(commandQueue),
 		  m_Camera(m_Device),
-		  m_FullscreenQuad(m_Device, commandQueue, false)
+		  m_FullscreenQuad(m_Device, commandQueue, false),
+		  m_RenderGraph(device)
 	{
-		m_CommandList = m_CommandQueue->CreateCommandList();
-
 		CreateClearGBufferPipeline();
 		CreateCubemapPipeline();
-		CreateModelPipeline();
+		CreateModelPipelines();
+
+		m_Frames = PerFrame<Renderer3DFrameResources>(m_Device->GetFrameTracker().GetFramesInFlight(),
+													  [&](uint32_t frame) { return CreateFrameResources(); });
 
 		Nexus::Graphics::MeshFactory factory(m_Device, m_CommandQueue);
 		m_Cube = factory.CreateCube();
@@ -192,58 +265,158 @@ namespace Nexus::Graphics
 
 	void Nexus::Graphics::Renderer3D::End()
 	{
+		m_Frame = &m_Frames.Get(m_Device->GetFrameTracker());
+
 		CubemapCameraUniforms cubemapCameraUniforms = {};
 		cubemapCameraUniforms.Projection			= m_Camera.GetProjection();
 		cubemapCameraUniforms.View					= glm::mat4(glm::mat3(m_Camera.GetView()));
-		m_CubemapUniformBuffer->SetData(&cubemapCameraUniforms, 0, sizeof(cubemapCameraUniforms));
+		m_Frame->CubemapUniformBuffer->SetData(&cubemapCameraUniforms, 0, sizeof(cubemapCameraUniforms));
 
 		ModelCameraUniforms modelCameraUniforms = {};
 		modelCameraUniforms.Projection			= m_Camera.GetProjection();
 		modelCameraUniforms.View				= m_Camera.GetView();
 		modelCameraUniforms.CamPosition			= m_Camera.GetPosition();
-		m_ModelCameraUniformBuffer->SetData(&modelCameraUniforms, 0, sizeof(modelCameraUniforms));
-
-		ClearGBuffer();
-		RenderCubemap();
+		m_Frame->ModelCameraUniformBuffer->SetData(&modelCameraUniforms, 0, sizeof(modelCameraUniforms));
 
-		Nexus::Point2D<uint32_t> size = m_RenderTarget.GetSize();
-		m_CommandList->Begin();
-		m_CommandList->SetRenderTarget(m_RenderTarget);
+		m_FrameIndex++;
+		m_VisibleMeshInstances.clear();
 
-		Nexus::Graphics::Viewport vp;
-		vp.X		= 0;
-		vp.Y		= 0;
-		vp.Width	= size.X;
-		vp.Height	= size.Y;
-		vp.MinDepth = 0.0f;
-		vp.MaxDepth = 1.0f;
-		m_CommandList->SetViewport(vp);
-
-		Nexus::Graphics::Scissor scissor;
-		scissor.X	   = 0;
-		scissor.Y	   = 0;
-		scissor.Width  = size.X;
-		scissor.Height = size.Y;
-		m_CommandList->SetScissor(scissor);
-
-		m_CommandList->SetPipeline(m_ModelPipeline);
+		m_Scene->UpdateTransforms();
 
 		ECS::View<Transform, ModelRenderer> transformsModelRenderers = m_Scene->Registry.GetView<Transform, ModelRenderer>();
 		transformsModelRenderers.Each(
 			[&](Entity *entity, const std::tuple<Transform *, ModelRenderer *> &components)
 			{
-				Transform	  *transform	 = std::get<0>(components);
 				ModelRenderer *modelRenderer = std::get<1>(components);
 
 				if (modelRenderer->Model)
 				{
-					RenderModel(modelRenderer->Model, transform->CreateTransformation(), entity->ID);
+					UpdateMeshInstances(modelRenderer->Model, m_Scene->GetWorldMatrix(entity->ID), entity->ID);
 				}
 			});
 
-		m_CommandList->End();
-		m_CommandQueue->SubmitCommandLists(&m_CommandList, 1, nullptr);
-		m_Device->WaitForIdle();
+		RemoveStaleMeshInstances();
+
+		// the hierarchy stores enlarged boxes, so the meshes that it finds are tested again against their exact bounds
+		Frustum frustum(m_Camera.GetProjection() * m_Camera.GetView());
+		size_t	unboundedCount = m_VisibleMeshInstances.size();
+		m_MeshHierarchy.Query(frustum, m_VisibleMeshInstances);
+
+		size_t visibleCount = unboundedCount;
+		for (size_t i = unboundedCount; i < m_VisibleMeshInstances.size(); i++)
+		{
+			if (frustum.Intersects(m_MeshInstances[m_VisibleMeshInstances[i]].WorldBounds))
+			{
+				m_VisibleMeshInstances[visibleCount++] = m_VisibleMeshInstances[i];
+			}
+		}
+		m_VisibleMeshInstances.resize(visibleCount);
+
+		m_CullingStatistics.SubmittedMeshes = m_MeshInstanceLookup.size();
+		m_CullingStatistics.VisibleMeshes	= visibleCount;
+
+		SelectMeshLods();
+		RecordTextureUsage();
+
+		BuildMeshDrawBatches(m_MeshInstances, m_VisibleMeshInstances, m_MeshDrawBatches);
+		m_CullingStatistics.DrawCalls = m_MeshDrawBatches.size();
+		UploadModelInstances();
+
+		// each stage of the frame is a pass of the graph, so they are recorded into one command list and submitted together
+		m_RenderGraph.Reset();
+
+		// the attachments of a framebuffer are imported as textures so that the graph can insert the barriers between the passes that
+		// use them, a swapchain is only transitioned when it is bound so it can only be used to order the passes
+		std::vector<RenderGraphResource> colourTargets;
+		RenderGraphResource				 depthTarget = {};
+		if (Ref<Framebuffer> framebuffer = m_RenderTarget.GetFramebuffer().lock())
+		{
+			for (int i = 0; i < framebuffer->GetColorTextureCount(); i++)
+			{
+				colourTargets.push_back(m_RenderGraph.ImportTexture("Scene colour " + std::to_string(i), framebuffer->GetColorTexture(i)));
+			}
+
+			if (framebuffer->HasDepthTexture())
+			{
+				depthTarget = m_RenderGraph.ImportTexture("Scene depth", framebuffer->GetDepthTexture());
+			}
+		}
+		else
+		{
+			colourTargets.push_back(m_RenderGraph.ImportRenderTarget("Scene target"));
+		}
+
+		RenderGraphResource cubemap = {};
+		if (m_Cubemap)
+		{
+			cubemap = m_RenderGraph.ImportTexture("Environment cubemap", m_Cubemap);
+		}
+
+		auto writeTargets = [&](RenderGraphBuilder &builder, bool writesDepth)
+		{
+			for (RenderGraphResource colourTarget : colourTargets)
+			{
+				builder.Write(colourTarget, RenderGraphAccess::ColourAttachment);
+			}
+
+			if (writesDepth && depthTarget.IsValid())
+			{
+				builder.Write(depthTarget, RenderGraphAccess::DepthStencilAttachment);
+			}
+		};
+
+		m_RenderGraph.AddPass(
+			"Clear GBuffer",
+			[&](RenderGraphBuilder &builder) { writeTargets(builder, false); },
+			[&](RenderGraphContext &context) { ClearGBuffer(context.GetCommandList()); });
+
+		m_RenderGraph.AddPass(
+			"Skybox",
+			[&](RenderGraphBuilder &builder)
+			{
+				writeTargets(builder, true);
+
+				if (cubemap.IsValid())
+				{
+					builder.Read(cubemap, RenderGraphAccess::ShaderRead);
+				}
+			},
+			[&](RenderGraphContext &context)
+			{ RenderCubemap(context.GetCommandList(), cubemap.IsValid() ? context.GetTexture(cubemap) : nullptr); });
+
+		m_RenderGraph.AddPass(
+			"Models",
+			[&](RenderGraphBuilder &builder) { writeTargets(builder, true); },
+			[&](RenderGraphContext &context)
+			{
+				Ref<CommandList> commandList = context.GetCommandList();
+				BeginRenderTarget(commandList);
+
+				// the batches are sorted by vertex format, so the pipeline and the instance buffer are only bound again when it changes
+				Ref<GraphicsPipeline> boundPipeline = nullptr;
+				for (const MeshDrawBatch &batch : m_MeshDrawBatches)
+				{
+					Ref<GraphicsPipeline> pipeline = GetModelPipeline(*batch.Mesh);
+					if (pipeline != boundPipeline)
+					{
+						commandList->SetPipeline(pipeline);
+						boundPipeline = pipeline;
+
+						VertexBufferView instanceBufferView = {};
+						instanceBufferView.BufferHandle		= m_Frame->ModelInstanceBuffer;
+						instanceBufferView.Offset			= 0;
+						instanceBufferView.Size				= m_Frame->ModelInstanceBuffer->GetSizeInBytes();
+						commandList->SetVertexBuffer(instanceBufferView, 1);
+					}
+
+					RenderMeshBatch(commandList, batch);
+				}
+			});
+
+		m_RenderGraph.Compile();
+
+		// the frame tracker waits for this fence before the resources of this frame are used again, so the CPU does not wait here
+		m_RenderGraph.Execute(m_Frame->CommandList, m_CommandQueue, m_Device->GetFrameTracker().AcquireFence());
 	}
 
 	const Nexus::FirstPersonCamera Renderer3D::GetCamera() const
@@ -251,238 +424,523 @@ namespace Nexus::Graphics
 		return m_Camera;
 	}
 
-	void Renderer3D::RenderCubemap()
+	const CullingStatistics &Renderer3D::GetCullingStatistics() const
 	{
-		Nexus::Point2D<uint32_t> size = m_RenderTarget.GetSize();
-		m_CommandList->Begin();
-		m_CommandList->SetRenderTarget(m_RenderTarget);
+		return m_CullingStatistics;
+	}
 
-		Nexus::Graphics::Viewport vp;
-		vp.X		= 0;
-		vp.Y		= 0;
-		vp.Width	= size.X;
-		vp.Height	= size.Y;
-		vp.MinDepth = 0.0f;
-		vp.MaxDepth = 1.0f;
-		m_CommandList->SetViewport(vp);
+	void Renderer3D::SetLodSelectionSettings(const LodSelectionSettings &settings)
+	{
+		m_LodSettings = settings;
+	}
 
-		Nexus::Graphics::Scissor scissor;
-		scissor.X	   = 0;
-		scissor.Y	   = 0;
-		scissor.Width  = size.X;
-		scissor.Height = size.Y;
-		m_CommandList->SetScissor(scissor);
+	const LodSelectionSettings &Renderer3D::GetLodSelectionSettings() const
+	{
+		return m_LodSettings;
+	}
 
-		const Environment &environment = m_Scene->SceneEnvironment;
+	void Renderer3D::SetTextureStreamer(TextureStreamer *streamer)
+	{
+		m_TextureStreamer = streamer;
+	}
 
-		m_CommandList->ClearColourTarget(
-			0,
-			{environment.ClearColour.r, environment.ClearColour.g, environment.ClearColour.b, environment.ClearColour.a});
-		m_CommandList->ClearColourTarget(1, {0.0f, 0.0f, 0.0f, 0.0f});
+	void Renderer3D::SelectMeshLods()
+	{
+		// the number of pixels covered by one unit at a distance of one unit in front of the camera, an orthographic projection keeps
+		// w at 1 so the number of pixels covered by a unit does not change with the distance
+		glm::mat4 projection				  = m_Camera.GetProjection();
+		bool	  orthographic				  = projection[3][3] == 1.0f;
+		float	  pixelsPerUnitAtUnitDistance = projection[1][1] * 0.5f * (float)m_RenderTarget.GetSize().Y;
 
-		m_CommandList->ClearDepthTarget(Nexus::Graphics::ClearDepthStencilValue {});
+		m_CullingStatistics.DrawnTriangles = 0;
 
-		if (m_Cubemap)
+		for (uint32_t index : m_VisibleMeshInstances)
 		{
-			m_CommandList->SetPipeline(m_CubemapPipeline);
+			MeshInstance					&instance = m_MeshInstances[index];
+			const std::vector<MeshLodRange> &lods	  = instance.Mesh->GetLods();
 
-			UniformBufferView uniformBufferView = {};
-			uniformBufferView.BufferHandle		= m_CubemapUniformBuffer;
-			uniformBufferView.Offset			= 0;
-			uniformBufferView.Size				= m_CubemapUniformBuffer->GetDescription().SizeInBytes;
-			m_CubemapResourceSet->WriteUniformBuffer(uniformBufferView, "Camera");
+			if (lods.empty())
+			{
+				continue;
+			}
 
-			m_CubemapResourceSet->WriteCombinedImageSampler(m_Cubemap, m_CubemapSampler, "skybox");
-			m_CommandList->SetResourceSet(m_CubemapResourceSet);
+			// meshes without bounds cannot be measured, so they are always drawn in full detail
+			if (!instance.WorldBounds.IsValid())
+			{
+				instance.Lod = 0;
+			}
+			else
+			{
+				// the errors are in model space, so they are scaled by the transform and measured at the closest point of the bounds
+				float scale = 0.0f;
+				for (int axis = 0; axis < 3; axis++) { scale = std::max(scale, glm::length(glm::vec3(instance.Transform[axis]))); }
 
-			Ref<DeviceBuffer> vertexBuffer	   = m_Cube->GetVertexBuffer();
-			VertexBufferView  vertexBufferView = {};
-			vertexBufferView.BufferHandle	   = vertexBuffer;
-			vertexBufferView.Offset			   = 0;
-			vertexBufferView.Size			   = vertexBuffer->GetSizeInBytes();
-			m_CommandList->SetVertexBuffer(vertexBufferView, 0);
+				glm::vec3 centre   = instance.WorldBounds.GetCentre();
+				float	  radius   = glm::length(instance.WorldBounds.GetExtents());
+				float	  distance = orthographic ? 1.0f : std::max(glm::distance(m_Camera.GetPosition(), centre) - radius, 0.001f);
 
-			Ref<DeviceBuffer> indexBuffer	  = m_Cube->GetIndexBuffer();
-			IndexBufferView	  indexBufferView = {};
-			indexBufferView.BufferHandle	  = indexBuffer;
-			indexBufferView.Offset			  = 0;
-			indexBufferView.Size			  = indexBuffer->GetSizeInBytes();
-			indexBufferView.BufferFormat	  = Graphics::IndexFormat::UInt32;
-			m_CommandList->SetIndexBuffer(indexBufferView);
+				instance.Lod = instance.Mesh->SelectLod(pixelsPerUnitAtUnitDistance * scale / distance, instance.Lod, m_LodSettings);
+			}
 
-			DrawIndexedDescription drawDesc = {};
-			drawDesc.VertexStart			= 0;
-			drawDesc.IndexStart				= 0;
-			drawDesc.InstanceStart			= 0;
-			drawDesc.IndexCount				= m_Cube->GetIndexBuffer()->GetCount();
-			drawDesc.InstanceCount			= 1;
-			m_CommandList->DrawIndexed(drawDesc);
+			m_CullingStatistics.DrawnTriangles += lods[instance.Lod].IndexCount / 3;
 		}
-
-		m_CommandList->End();
-
-		m_CommandQueue->SubmitCommandLists(&m_CommandList, 1, nullptr);
 	}
 
-	void Renderer3D::RenderModel(Nexus::Ref<Nexus::Graphics::Model> model, const glm::mat4 transform, GUID guid)
+	void Renderer3D::RecordTextureUsage()
 	{
-		if (model->GetMeshes().empty())
+		if (!m_TextureStreamer)
 		{
 			return;
 		}
 
-		std::pair<uint32_t, uint32_t> splitId = guid.Split();
+		// as with the LODs, an orthographic projection covers the same number of pixels with a unit at any distance
+		glm::mat4 projection				  = m_Camera.GetProjection();
+		bool	  orthographic				  = projection[3][3] == 1.0f;
+		float	  pixelsPerUnitAtUnitDistance = projection[1][1] * 0.5f * (float)m_RenderTarget.GetSize().Y;
 
-		for (const auto &mesh : model->GetMeshes())
+		for (uint32_t index : m_VisibleMeshInstances)
 		{
-			const Nexus::Graphics::Material &mat = mesh->GetMaterial();
+			const MeshInstance &instance = m_MeshInstances[index];
+			const Material	   &material = instance.Mesh->GetMaterial();
+
+			// meshes without bounds cannot be measured, so their textures are loaded in full detail
+			float projectedSize = std::numeric_limits<float>::max();
+			if (instance.WorldBounds.IsValid())
+			{
+				// texture coordinates are assumed to cover the texture once across the mesh, so the texture spans the bounds on screen
+				glm::vec3 centre   = instance.WorldBounds.GetCentre();
+				float	  radius   = glm::length(instance.WorldBounds.GetExtents());
+				float	  distance = orthographic ? 1.0f : std::max(glm::distance(m_Camera.GetPosition(), centre) - radius, 0.001f);
+				projectedSize	   = pixelsPerUnitAtUnitDistance * radius * 2.0f / distance;
+			}
 
-			// create the uniform buffer if needed
+			for (const Ref<StreamedTexture> &texture :
+				 {material.StreamedDiffuseTexture, material.StreamedNormalTexture, material.StreamedSpecularTexture})
 			{
-				if (m_ModelTransformUniformBuffers.find(model) == m_ModelTransformUniformBuffers.end())
+				if (texture)
 				{
-					DeviceBufferDescription transformBufferDesc = {};
-					transformBufferDesc.Access					= Graphics::BufferMemoryAccess::Upload;
-					transformBufferDesc.Usage					= Graphics::BufferUsage::Uniform;
-					transformBufferDesc.StrideInBytes			= sizeof(ModelTransformUniforms);
-					transformBufferDesc.SizeInBytes				= sizeof(ModelTransformUniforms);
-					Ref<DeviceBuffer> transformUniformBuffer	= m_Device->CreateDeviceBuffer(transformBufferDesc);
-					m_ModelTransformUniformBuffers[model]		= transformUniformBuffer;
+					m_TextureStreamer->RecordUsage(texture, projectedSize);
 				}
 			}
+		}
+	}
 
-			// create the resource set if needed
+	void Renderer3D::UpdateMeshInstances(Nexus::Ref<Nexus::Graphics::Model> model, const glm::mat4 &transform, GUID guid)
+	{
+		for (const Ref<Mesh> &mesh : model->GetMeshes())
+		{
+			auto [it, inserted] = m_MeshInstanceLookup.try_emplace({guid.Value, mesh.get()}, 0);
+			if (inserted)
 			{
-				if (m_ModelResourceSets.find(model) == m_ModelResourceSets.end())
+				if (m_FreeMeshInstances.empty())
+				{
+					it->second = (uint32_t)m_MeshInstances.size();
+					m_MeshInstances.emplace_back();
+				}
+				else
 				{
-					Ref<ResourceSet> resourceSet = m_Device->CreateResourceSet(m_ModelPipeline);
-					m_ModelResourceSets[model]	 = resourceSet;
+					it->second = m_FreeMeshInstances.back();
+					m_FreeMeshInstances.pop_back();
 				}
 			}
 
-			Ref<DeviceBuffer> transformUniformBuffer = m_ModelTransformUniformBuffers[model];
-			Ref<ResourceSet>  resourceSet			 = m_ModelResourceSets[model];
+			uint32_t	  index	   = it->second;
+			MeshInstance &instance = m_MeshInstances[index];
+			instance.Model		   = model;
+			instance.Mesh		   = mesh;
+			instance.Transform	   = transform;
+			instance.Guid		   = guid;
+			instance.LastFrame	   = m_FrameIndex;
 
-			// copy data into the uniform buffer
+			// meshes without bounds cannot be culled, so they are always drawn
+			if (!mesh->GetBounds().IsValid())
 			{
-				ModelTransformUniforms modelTransformUniforms = {};
-				modelTransformUniforms.Transform			  = transform;
-				modelTransformUniforms.Guid1				  = splitId.first;
-				modelTransformUniforms.Guid2				  = splitId.second;
-				modelTransformUniforms.DiffuseColour		  = mat.DiffuseColour;
-				modelTransformUniforms.SpecularColour		  = mat.SpecularColour;
-				transformUniformBuffer->SetData(&modelTransformUniforms, 0, sizeof(modelTransformUniforms));
+				m_VisibleMeshInstances.push_back(index);
+				continue;
 			}
 
-			Nexus::Ref<Nexus::Graphics::Texture> diffuseTexture	 = m_DefaultTexture;
-			Nexus::Ref<Nexus::Graphics::Texture> normalTexture	 = m_DefaultTexture;
-			Nexus::Ref<Nexus::Graphics::Texture> specularTexture = m_DefaultTexture;
+			instance.WorldBounds = mesh->GetBounds().Transform(transform);
+			if (instance.Proxy == BoundingVolumeHierarchy::c_NullNode)
+			{
+				instance.Proxy = m_MeshHierarchy.Insert(instance.WorldBounds, index);
+			}
+			else
+			{
+				m_MeshHierarchy.Move(instance.Proxy, instance.WorldBounds);
+			}
+		}
+	}
 
-			if (mat.DiffuseTexture)
+	void Renderer3D::RemoveStaleMeshInstances()
+	{
+		bool removed = false;
+		for (auto it = m_MeshInstanceLookup.begin(); it != m_MeshInstanceLookup.end();)
+		{
+			MeshInstance &instance = m_MeshInstances[it->second];
+			if (instance.LastFrame == m_FrameIndex)
 			{
-				diffuseTexture = mat.DiffuseTexture;
+				++it;
+				continue;
 			}
 
-			if (mat.NormalTexture)
+			if (instance.Proxy != BoundingVolumeHierarchy::c_NullNode)
 			{
-				normalTexture = mat.NormalTexture;
+				m_MeshHierarchy.Remove(instance.Proxy);
 			}
 
-			if (mat.SpecularTexture)
+			m_FreeMeshInstances.push_back(it->second);
+			instance = {};
+			it		 = m_MeshInstanceLookup.erase(it);
+			removed	 = true;
+		}
+
+		if (!removed)
+		{
+			return;
+		}
+
+		// the uniforms and resource sets of meshes that are no longer drawn are released once the frames that may still be reading them
+		// have completed, which also lets go of the meshes themselves
+		std::set<Mesh *> drawnMeshes = {};
+		for (const auto &[key, index] : m_MeshInstanceLookup) { drawnMeshes.insert(key.second); }
+
+		FrameTracker &frameTracker = m_Device->GetFrameTracker();
+		auto		  releaseStale = [&](const auto &entry)
+		{
+			if (drawnMeshes.contains(entry.first.get()))
 			{
-				specularTexture = mat.SpecularTexture;
+				return false;
 			}
 
-			resourceSet->WriteCombinedImageSampler(diffuseTexture, m_ModelSampler, "diffuseMapSampler");
-			resourceSet->WriteCombinedImageSampler(normalTexture, m_ModelSampler, "normalMapSampler");
-			resourceSet->WriteCombinedImageSampler(specularTexture, m_ModelSampler, "specularMapSampler");
+			frameTracker.DeferDeletion(entry.second);
+			return true;
+		};
 
-			UniformBufferView modelCameraUniformView = {};
-			modelCameraUniformView.BufferHandle		 = m_ModelCameraUniformBuffer;
-			modelCameraUniformView.Offset			 = 0;
-			modelCameraUniformView.Size				 = m_ModelCameraUniformBuffer->GetDescription().SizeInBytes;
-			resourceSet->WriteUniformBuffer(modelCameraUniformView, "Camera");
+		for (size_t frame = 0; frame < m_Frames.GetCount(); frame++)
+		{
+			std::erase_if(m_Frames[frame].MeshUniformBuffers, releaseStale);
+			std::erase_if(m_Frames[frame].MeshResourceSets, releaseStale);
+		}
+	}
 
-			UniformBufferView modelTransformUniformView = {};
-			modelTransformUniformView.BufferHandle		= transformUniformBuffer;
-			modelTransformUniformView.Offset			= 0;
-			modelTransformUniformView.Size				= transformUniformBuffer->GetDescription().SizeInBytes;
-			resourceSet->WriteUniformBuffer(modelTransformUniformView, "Transform");
+	void Renderer3D::RenderCubemap(Ref<CommandList> commandList, Ref<Texture> cubemap)
+	{
+		BeginRenderTarget(commandList);
 
-			m_CommandList->SetResourceSet(resourceSet);
+		const Environment &environment = m_Scene->SceneEnvironment;
+
+		commandList->ClearColourTarget(
+			0,
+			{environment.ClearColour.r, environment.ClearColour.g, environment.ClearColour.b, environment.ClearColour.a});
+		commandList->ClearColourTarget(1, {0.0f, 0.0f, 0.0f, 0.0f});
+
+		commandList->ClearDepthTarget(Nexus::Graphics::ClearDepthStencilValue {});
+
+		if (cubemap)
+		{
+			commandList->SetPipeline(m_CubemapPipeline);
+
+			UniformBufferView uniformBufferView = {};
+			uniformBufferView.BufferHandle		= m_Frame->CubemapUniformBuffer;
+			uniformBufferView.Offset			= 0;
+			uniformBufferView.Size				= m_Frame->CubemapUniformBuffer->GetDescription().SizeInBytes;
+			m_Frame->CubemapResourceSet->WriteUniformBuffer(uniformBufferView, "Camera");
 
-			Ref<DeviceBuffer> vertexBuffer	   = mesh->GetVertexBuffer();
+			m_Frame->CubemapResourceSet->WriteCombinedImageSampler(cubemap, m_CubemapSampler, "skybox");
+			commandList->SetResourceSet(m_Frame->CubemapResourceSet);
+
+			Ref<DeviceBuffer> vertexBuffer	   = m_Cube->GetVertexBuffer();
 			VertexBufferView  vertexBufferView = {};
 			vertexBufferView.BufferHandle	   = vertexBuffer;
 			vertexBufferView.Offset			   = 0;
 			vertexBufferView.Size			   = vertexBuffer->GetSizeInBytes();
-			m_CommandList->SetVertexBuffer(vertexBufferView, 0);
+			commandList->SetVertexBuffer(vertexBufferView, 0);
 
-			Ref<DeviceBuffer> indexBuffer	  = mesh->GetIndexBuffer();
+			Ref<DeviceBuffer> indexBuffer	  = m_Cube->GetIndexBuffer();
 			IndexBufferView	  indexBufferView = {};
 			indexBufferView.BufferHandle	  = indexBuffer;
 			indexBufferView.Offset			  = 0;
-			indexBufferView.BufferFormat	  = Graphics::IndexFormat::UInt32;
 			indexBufferView.Size			  = indexBuffer->GetSizeInBytes();
-			m_CommandList->SetIndexBuffer(indexBufferView);
+			indexBufferView.BufferFormat	  = Graphics::IndexFormat::UInt32;
+			commandList->SetIndexBuffer(indexBufferView);
 
 			DrawIndexedDescription drawDesc = {};
 			drawDesc.VertexStart			= 0;
 			drawDesc.IndexStart				= 0;
 			drawDesc.InstanceStart			= 0;
-			drawDesc.IndexCount				= mesh->GetIndexBuffer()->GetCount();
+			drawDesc.IndexCount				= m_Cube->GetIndexBuffer()->GetCount();
 			drawDesc.InstanceCount			= 1;
-			m_CommandList->DrawIndexed(drawDesc);
+			commandList->DrawIndexed(drawDesc);
 		}
 	}
 
-	void Renderer3D::ClearGBuffer()
+	Ref<GraphicsPipeline> Renderer3D::GetModelPipeline(const Mesh &mesh) const
 	{
-		Nexus::Point2D<uint32_t> size = m_RenderTarget.GetSize();
-		m_CommandList->Begin();
-		m_CommandList->SetRenderTarget(m_RenderTarget);
+		return mesh.GetVertexDequantization() ? m_QuantizedModelPipeline : m_ModelPipeline;
+	}
 
-		Nexus::Graphics::Viewport vp;
-		vp.X		= 0;
-		vp.Y		= 0;
-		vp.Width	= size.X;
-		vp.Height	= size.Y;
-		vp.MinDepth = 0.0f;
-		vp.MaxDepth = 1.0f;
-		m_CommandList->SetViewport(vp);
+	void BuildMeshDrawBatches(const std::vector<MeshInstance> &instances,
+							  std::vector<uint32_t>			  &visibleInstances,
+							  std::vector<MeshDrawBatch>	  &batches)
+	{
+		batches.clear();
+
+		// meshes with the same vertex format are kept together so that they share a pipeline, the order between meshes of one format does
+		// not matter as long as each mesh's instances end up next to each other
+		std::sort(visibleInstances.begin(),
+				  visibleInstances.end(),
+				  [&](uint32_t left, uint32_t right)
+				  {
+					  const MeshInstance &a = instances[left];
+					  const MeshInstance &b = instances[right];
+					  return std::make_tuple(a.Mesh->GetVertexDequantization().has_value(), a.Mesh.get(), a.Lod, left) <
+							 std::make_tuple(b.Mesh->GetVertexDequantization().has_value(), b.Mesh.get(), b.Lod, right);
+				  });
+
+		for (uint32_t i = 0; i < (uint32_t)visibleInstances.size(); i++)
+		{
+			const MeshInstance &instance = instances[visibleInstances[i]];
+			if (!batches.empty() && batches.back().Mesh == instance.Mesh && batches.back().Lod == instance.Lod)
+			{
+				batches.back().InstanceCount++;
+				continue;
+			}
 
-		Nexus::Graphics::Scissor scissor;
-		scissor.X	   = 0;
-		scissor.Y	   = 0;
-		scissor.Width  = size.X;
-		scissor.Height = size.Y;
-		m_CommandList->SetScissor(scissor);
+			batches.push_back({.Mesh = instance.Mesh, .Lod = instance.Lod, .FirstInstance = i, .InstanceCount = 1});
+		}
+	}
+
+	ModelMeshUniforms CreateModelMeshUniforms(const Mesh &mesh)
+	{
+		const Material		&material		= mesh.GetMaterial();
+		VertexDequantization dequantization = mesh.GetVertexDequantization().value_or(VertexDequantization {});
+
+		ModelMeshUniforms meshUniforms	 = {};
+		meshUniforms.DiffuseColour		 = material.DiffuseColour;
+		meshUniforms.SpecularColour		 = material.SpecularColour;
+		meshUniforms.PositionOffset		 = glm::vec4(dequantization.PositionOffset, 0.0f);
+		meshUniforms.PositionScale		 = glm::vec4(dequantization.PositionScale, 0.0f);
+		meshUniforms.TexCoordOffsetScale = glm::vec4(dequantization.TexCoordOffset.x,
+													 dequantization.TexCoordOffset.y,
+													 dequantization.TexCoordScale.x,
+													 dequantization.TexCoordScale.y);
+		return meshUniforms;
+	}
+
+	void Renderer3D::UploadModelInstances()
+	{
+		m_ModelInstanceData.resize(m_VisibleMeshInstances.size());
+		for (size_t i = 0; i < m_VisibleMeshInstances.size(); i++)
+		{
+			const MeshInstance			 &instance = m_MeshInstances[m_VisibleMeshInstances[i]];
+			std::pair<uint32_t, uint32_t> splitId  = instance.Guid.Split();
+			m_ModelInstanceData[i]				   = {.Transform = instance.Transform, .Guid1 = splitId.first, .Guid2 = splitId.second};
+		}
+
+		if (m_ModelInstanceData.empty())
+		{
+			return;
+		}
+
+		// the buffer grows to the next power of two, so that a scene that slowly gains instances does not create a new buffer every frame
+		size_t size = m_ModelInstanceData.size() * sizeof(ModelInstanceData);
+		if (!m_Frame->ModelInstanceBuffer || m_Frame->ModelInstanceBuffer->GetSizeInBytes() < size)
+		{
+			DeviceBufferDescription instanceBufferDesc = {};
+			instanceBufferDesc.Access				   = Graphics::BufferMemoryAccess::Upload;
+			instanceBufferDesc.Usage				   = Graphics::BufferUsage::Vertex;
+			instanceBufferDesc.StrideInBytes		   = sizeof(ModelInstanceData);
+			instanceBufferDesc.SizeInBytes			   = std::bit_ceil(m_ModelInstanceData.size()) * sizeof(ModelInstanceData);
+			m_Frame->ModelInstanceBuffer			   = m_Device->CreateDeviceBuffer(instanceBufferDesc);
+		}
+
+		m_Frame->ModelInstanceBuffer->SetData(m_ModelInstanceData.data(), 0, size);
+	}
+
+	void Renderer3D::RenderMeshBatch(Ref<CommandList> commandList, const MeshDrawBatch &batch)
+	{
+		const Nexus::Ref<Nexus::Graphics::Mesh> &mesh = batch.Mesh;
+		const Nexus::Graphics::Material			&mat  = mesh->GetMaterial();
+
+		// create the uniform buffer if needed
+		{
+			if (m_Frame->MeshUniformBuffers.find(mesh) == m_Frame->MeshUniformBuffers.end())
+			{
+				DeviceBufferDescription meshBufferDesc = {};
+				meshBufferDesc.Access				   = Graphics::BufferMemoryAccess::Upload;
+				meshBufferDesc.Usage				   = Graphics::BufferUsage::Uniform;
+				meshBufferDesc.StrideInBytes		   = sizeof(ModelMeshUniforms);
+				meshBufferDesc.SizeInBytes			   = sizeof(ModelMeshUniforms);
+				m_Frame->MeshUniformBuffers[mesh]	   = m_Device->CreateDeviceBuffer(meshBufferDesc);
+			}
+		}
+
+		// create the resource set if needed
+		{
+			if (m_Frame->MeshResourceSets.find(mesh) == m_Frame->MeshResourceSets.end())
+			{
+				m_Frame->MeshResourceSets[mesh] = m_Device->CreateResourceSet(GetModelPipeline(*mesh));
+			}
+		}
+
+		Ref<DeviceBuffer> meshUniformBuffer = m_Frame->MeshUniformBuffers[mesh];
+		Ref<ResourceSet>  resourceSet		= m_Frame->MeshResourceSets[mesh];
+
+		// copy data into the uniform buffer
+		{
+			ModelMeshUniforms meshUniforms = CreateModelMeshUniforms(*mesh);
+			meshUniformBuffer->SetData(&meshUniforms, 0, sizeof(meshUniforms));
+		}
+
+		Nexus::Ref<Nexus::Graphics::Texture> diffuseTexture	 = m_DefaultTexture;
+		Nexus::Ref<Nexus::Graphics::Texture> normalTexture	 = m_DefaultTexture;
+		Nexus::Ref<Nexus::Graphics::Texture> specularTexture = m_DefaultTexture;
+
+		if (mat.DiffuseTexture)
+		{
+			diffuseTexture = mat.DiffuseTexture;
+		}
+
+		if (mat.NormalTexture)
+		{
+			normalTexture = mat.NormalTexture;
+		}
+
+		if (mat.SpecularTexture)
+		{
+			specularTexture = mat.SpecularTexture;
+		}
+
+		// streamed textures are replaced whenever their mips change, so they are fetched again for every draw
+		if (mat.StreamedDiffuseTexture && mat.StreamedDiffuseTexture->GetTexture())
+		{
+			diffuseTexture = mat.StreamedDiffuseTexture->GetTexture();
+		}
+
+		if (mat.StreamedNormalTexture && mat.StreamedNormalTexture->GetTexture())
+		{
+			normalTexture = mat.StreamedNormalTexture->GetTexture();
+		}
+
+		if (mat.StreamedSpecularTexture && mat.StreamedSpecularTexture->GetTexture())
+		{
+			specularTexture = mat.StreamedSpecularTexture->GetTexture();
+		}
+
+		resourceSet->WriteCombinedImageSampler(diffuseTexture, m_ModelSampler, "diffuseMapSampler");
+		resourceSet->WriteCombinedImageSampler(normalTexture, m_ModelSampler, "normalMapSampler");
+		resourceSet->WriteCombinedImageSampler(specularTexture, m_ModelSampler, "specularMapSampler");
+
+		UniformBufferView modelCameraUniformView = {};
+		modelCameraUniformView.BufferHandle		 = m_Frame->ModelCameraUniformBuffer;
+		modelCameraUniformView.Offset			 = 0;
+		modelCameraUniformView.Size				 = m_Frame->ModelCameraUniformBuffer->GetDescription().SizeInBytes;
+		resourceSet->WriteUniformBuffer(modelCameraUniformView, "Camera");
+
+		UniformBufferView meshUniformView = {};
+		meshUniformView.BufferHandle	  = meshUniformBuffer;
+		meshUniformView.Offset			  = 0;
+		meshUniformView.Size			  = meshUniformBuffer->GetDescription().SizeInBytes;
+		resourceSet->WriteUniformBuffer(meshUniformView, "Mesh");
+
+		commandList->SetResourceSet(resourceSet);
+
+		Ref<DeviceBuffer> vertexBuffer	   = mesh->GetVertexBuffer();
+		VertexBufferView  vertexBufferView = {};
+		vertexBufferView.BufferHandle	   = vertexBuffer;
+		vertexBufferView.Offset			   = 0;
+		vertexBufferView.Size			   = vertexBuffer->GetSizeInBytes();
+		commandList->SetVertexBuffer(vertexBufferView, 0);
+
+		Ref<DeviceBuffer> indexBuffer	  = mesh->GetIndexBuffer();
+		IndexBufferView	  indexBufferView = {};
+		indexBufferView.BufferHandle	  = indexBuffer;
+		indexBufferView.Offset			  = 0;
+		indexBufferView.BufferFormat	  = Graphics::IndexFormat::UInt32;
+		indexBufferView.Size			  = indexBuffer->GetSizeInBytes();
+		commandList->SetIndexBuffer(indexBufferView);
+
+		const MeshLodRange &lod = mesh->GetLods()[batch.Lod];
+
+		DrawIndexedDescription drawDesc = {};
+		drawDesc.VertexStart			= 0;
+		drawDesc.IndexStart				= lod.IndexStart;
+		drawDesc.InstanceStart			= batch.FirstInstance;
+		drawDesc.IndexCount				= lod.IndexCount;
+		drawDesc.InstanceCount			= batch.InstanceCount;
+		commandList->DrawIndexed(drawDesc);
+	}
+
+	void Renderer3D::ClearGBuffer(Ref<CommandList> commandList)
+	{
+		BeginRenderTarget(commandList);
 
 		Nexus::Graphics::VertexBufferView vertexBufferView = {};
 		vertexBufferView.BufferHandle					   = m_FullscreenQuad.GetVertexBuffer();
 		vertexBufferView.Offset							   = 0;
 		vertexBufferView.Size							   = m_FullscreenQuad.GetVertexBuffer()->GetSizeInBytes();
-		m_CommandList->SetVertexBuffer(vertexBufferView, 0);
+		commandList->SetVertexBuffer(vertexBufferView, 0);
 
 		Nexus::Graphics::IndexBufferView indexBufferView = {};
 		indexBufferView.BufferHandle					 = m_FullscreenQuad.GetIndexBuffer();
 		indexBufferView.Offset							 = 0;
 		indexBufferView.Size							 = m_FullscreenQuad.GetIndexBuffer()->GetSizeInBytes();
 		indexBufferView.BufferFormat					 = Graphics::IndexFormat::UInt32;
-		m_CommandList->SetIndexBuffer(indexBufferView);
+		commandList->SetIndexBuffer(indexBufferView);
 
-		m_CommandList->SetPipeline(m_ClearScreenPipeline);
+		commandList->SetPipeline(m_ClearScreenPipeline);
 
 		DrawDescription drawDesc = {};
 		drawDesc.VertexStart	 = 0;
 		drawDesc.InstanceStart	 = 0;
 		drawDesc.VertexCount	 = 6;
 		drawDesc.InstanceCount	 = 1;
-		m_CommandList->Draw(drawDesc);
+		commandList->Draw(drawDesc);
+	}
 
-		m_CommandList->End();
+	void Renderer3D::BeginRenderTarget(Ref<CommandList> commandList)
+	{
+		Nexus::Point2D<uint32_t> size = m_RenderTarget.GetSize();
+		commandList->SetRenderTarget(m_RenderTarget);
+
+		Nexus::Graphics::Viewport vp;
+		vp.X		= 0;
+		vp.Y		= 0;
+		vp.Width	= size.X;
+		vp.Height	= size.Y;
+		vp.MinDepth = 0.0f;
+		vp.MaxDepth = 1.0f;
+		commandList->SetViewport(vp);
 
-		m_CommandQueue->SubmitCommandLists(&m_CommandList, 1, nullptr);
+		Nexus::Graphics::Scissor scissor;
+		scissor.X	   = 0;
+		scissor.Y	   = 0;
+		scissor.Width  = size.X;
+		scissor.Height = size.Y;
+		commandList->SetScissor(scissor);
+	}
+
+	Renderer3DFrameResources Renderer3D::CreateFrameResources()
+	{
+		Renderer3DFrameResources frame = {};
+		frame.CommandList			   = m_CommandQueue->CreateCommandList();
+		frame.CubemapResourceSet	   = m_Device->CreateResourceSet(m_CubemapPipeline);
+
+		DeviceBufferDescription cubemapBufferDesc = {};
+		cubemapBufferDesc.Access				  = Graphics::BufferMemoryAccess::Upload;
+		cubemapBufferDesc.Usage					  = Graphics::BufferUsage::Uniform;
+		cubemapBufferDesc.StrideInBytes			  = sizeof(CubemapCameraUniforms);
+		cubemapBufferDesc.SizeInBytes			  = sizeof(CubemapCameraUniforms);
+		frame.CubemapUniformBuffer				  = m_Device->CreateDeviceBuffer(cubemapBufferDesc);
+
+		DeviceBufferDescription cameraBufferDesc = {};
+		cameraBufferDesc.Access					 = Graphics::BufferMemoryAccess::Upload;
+		cameraBufferDesc.Usage					 = Graphics::BufferUsage::Uniform;
+		cameraBufferDesc.StrideInBytes			 = sizeof(ModelCameraUniforms);
+		cameraBufferDesc.SizeInBytes			 = sizeof(ModelCameraUniforms);
+		frame.ModelCameraUniformBuffer			 = m_Device->CreateDeviceBuffer(cameraBufferDesc);
+
+		return frame;
 	}
 
 	void Renderer3D::CreateCubemapPipeline()
@@ -506,15 +964,7 @@ namespace Nexus::Graphics
 		pipelineDescription.DepthFormat								 = Nexus::Graphics::PixelFormat::D24_UNorm_S8_UInt;
 		pipelineDescription.DepthStencilDesc.DepthComparisonFunction = Nexus::Graphics::ComparisonFunction::Less;
 
-		m_CubemapPipeline	 = m_Device->CreateGraphicsPipeline(pipelineDescription);
-		m_CubemapResourceSet = m_Device->CreateResourceSet(m_CubemapPipeline);
-
-		DeviceBufferDescription cubemapBufferDesc = {};
-		cubemapBufferDesc.Access				  = Graphics::BufferMemoryAccess::Upload;
-		cubemapBufferDesc.Usage					  = Graphics::BufferUsage::Uniform;
-		cubemapBufferDesc.StrideInBytes			  = sizeof(CubemapCameraUniforms);
-		cubemapBufferDesc.SizeInBytes			  = sizeof(CubemapCameraUniforms);
-		m_CubemapUniformBuffer					  = Ref<DeviceBuffer>(m_Device->CreateDeviceBuffer(cubemapBufferDesc));
+		m_CubemapPipeline = m_Device->CreateGraphicsPipeline(pipelineDescription);
 
 		Nexus::Graphics::SamplerDescription samplerSpec = {};
 		samplerSpec.AddressModeU						= Nexus::Graphics::SamplerAddressMode::Clamp;
@@ -523,7 +973,25 @@ namespace Nexus::Graphics
 		m_CubemapSampler								= m_Device->CreateSampler(samplerSpec);
 	}
 
-	void Renderer3D::CreateModelPipeline()
+	void Renderer3D::CreateModelPipelines()
+	{
+		m_ModelPipeline			 = CreateModelPipeline(c_ModelVertexShader,
+													   "model.vert.glsl",
+													   Nexus::Graphics::VertexPositionTexCoordNormalColourTangentBitangent::GetLayout());
+		m_QuantizedModelPipeline = CreateModelPipeline(c_QuantizedModelVertexShader,
+													   "quantized_model.vert.glsl",
+													   Nexus::Graphics::VertexQuantizedPositionTexCoordNormalColourTangent::GetLayout());
+
+		Nexus::Graphics::SamplerDescription samplerSpec = {};
+		samplerSpec.AddressModeU						= Nexus::Graphics::SamplerAddressMode::Clamp;
+		samplerSpec.AddressModeV						= Nexus::Graphics::SamplerAddressMode::Clamp;
+		samplerSpec.AddressModeW						= Nexus::Graphics::SamplerAddressMode::Clamp;
+		m_ModelSampler									= m_Device->CreateSampler(samplerSpec);
+	}
+
+	Ref<GraphicsPipeline> Renderer3D::CreateModelPipeline(const std::string		   &vertexShaderSource,
+														  const std::string		   &vertexShaderName,
+														  const VertexBufferLayout &layout)
 	{
 		Nexus::Graphics::GraphicsPipelineDescription pipelineDescription = {};
 		pipelineDescription.RasterizerStateDesc.TriangleCullMode		 = Nexus::Graphics::CullMode::Back;
@@ -533,11 +1001,11 @@ namespace Nexus::Graphics
 		pipelineDescription.DepthStencilDesc.DepthComparisonFunction	 = Nexus::Graphics::ComparisonFunction::Less;
 
 		pipelineDescription.VertexModule =
-			m_Device->GetOrCreateCachedShaderFromSpirvSource(c_ModelVertexShader, "model.vert.glsl", Nexus::Graphics::ShaderStage::Vertex);
+			m_Device->GetOrCreateCachedShaderFromSpirvSource(vertexShaderSource, vertexShaderName, Nexus::Graphics::ShaderStage::Vertex);
 		pipelineDescription.FragmentModule =
 			m_Device->GetOrCreateCachedShaderFromSpirvSource(c_ModelFragmentShader, "model.frag.glsl", Nexus::Graphics::ShaderStage::Fragment);
 
-		pipelineDescription.Layouts = {Nexus::Graphics::VertexPositionTexCoordNormalColourTangentBitangent::GetLayout()};
+		pipelineDescription.Layouts = {layout, ModelInstanceData::GetLayout()};
 
 		pipelineDescription.ColourTargetCount		= 2;
 		pipelineDescription.ColourFormats[0]		= Nexus::Graphics::PixelFormat::R8_G8_B8_A8_UNorm;
@@ -552,23 +1020,7 @@ namespace Nexus::Graphics
 		pipelineDescription.ColourBlendStates[0].DestinationAlphaBlend	= Nexus::Graphics::BlendFactor::Zero;
 		pipelineDescription.ColourBlendStates[0].AlphaBlendFunction		= Nexus::Graphics::BlendEquation::Add;
 
-		m_ModelPipeline = m_Device->CreateGraphicsPipeline(pipelineDescription);
-
-		// model camera
-		{
-			DeviceBufferDescription cameraBufferDesc = {};
-			cameraBufferDesc.Access					 = Graphics::BufferMemoryAccess::Upload;
-			cameraBufferDesc.Usage					 = Graphics::BufferUsage::Uniform;
-			cameraBufferDesc.StrideInBytes			 = sizeof(ModelCameraUniforms);
-			cameraBufferDesc.SizeInBytes			 = sizeof(ModelCameraUniforms);
-			m_ModelCameraUniformBuffer				 = Ref<DeviceBuffer>(m_Device->CreateDeviceBuffer(cameraBufferDesc));
-		}
-
-		Nexus::Graphics::SamplerDescription samplerSpec = {};
-		samplerSpec.AddressModeU						= Nexus::Graphics::SamplerAddressMode::Clamp;
-		samplerSpec.AddressModeV						= Nexus::Graphics::SamplerAddressMode::Clamp;
-		samplerSpec.AddressModeW						= Nexus::Graphics::SamplerAddressMode::Clamp;
-		m_ModelSampler									= m_Device->CreateSampler(samplerSpec);
+		return m_Device->CreateGraphicsPipeline(pipelineDescription);
 	}
 
 	void Renderer3D::CreateClearGBufferPipeline()
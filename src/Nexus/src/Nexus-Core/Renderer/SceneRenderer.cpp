@@ -45,11 +45,11 @@ namespace Nexus::Graphics
 		transformsSpriteRenderers.Each(
 			[&](Nexus::Entity *entity, const std::tuple<Nexus::Transform *, Nexus::SpriteRendererComponent *> &components)
 			{
-				Nexus::Transform			   *transform	   = std::get<0>(components);
 				Nexus::SpriteRendererComponent *spriteRenderer = std::get<1>(components);
 
+				// the transforms of the scene were updated by the 3D renderer at the start of the frame
 				const Nexus::FirstPersonCamera &camera		= m_Renderer3D->GetCamera();
-				glm::mat4						worldMatrix = transform->CreateTransformation();
+				const glm::mat4				   &worldMatrix = scene->GetWorldMatrix(entity->ID);
 
 				m_BatchRenderer->DrawQuadFill(spriteRenderer->SpriteColour,
 											  spriteRenderer->SpriteTexture,
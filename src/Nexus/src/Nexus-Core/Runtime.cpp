@@ -1,5 +1,6 @@
 #include "Nexus-Core/Runtime.hpp"
 
+#include "Nexus-Core/Logging/Log.hpp"
 #include "Nexus-Core/Platform.hpp"
 #include "Nexus-Core/nxpch.hpp"
 
@@ -30,6 +31,7 @@ namespace Nexus
 		while (appPtr->IsRunning()) { appPtr->MainLoop(); }
 #endif
 
+		app->WaitForRenderThread();
 		app->Unload();
 	}
 
@@ -60,5 +62,9 @@ namespace Nexus
 	{
 		NX_PROFILE_FUNCTION();
 		Platform::Shutdown();
+
+		// logs are written on a background thread, so anything still queued is written out and the thread is joined before the process
+		// exits. Anything logged after this is written by the thread that logs it.
+		GetCoreLogger()->Stop();
 	}
 }	 // namespace Nexus
\ No newline at end of file
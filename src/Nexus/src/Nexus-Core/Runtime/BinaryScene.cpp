@@ -0,0 +1,445 @@
+#include "Nexus-Core/Runtime/BinaryScene.hpp"
+
+#include "Nexus-Core/FileSystem/FileSystem.hpp"
+#include "Nexus-Core/FileSystem/MappedFile.hpp"
+#include "yaml-cpp/yaml.h"
+
+namespace Nexus::BinaryScene
+{
+	/// @brief Written as a native integer so that a file created on a machine with a different byte order can be detected
+	constexpr uint16_t c_EndianMarker = 0xFEFF;
+
+	/// @brief Chunks and component data are aligned so that blitted components start on a boundary suitable for any component type
+	constexpr size_t c_ChunkAlignment = 16;
+
+	constexpr char c_FileMagic[4]	   = {'N', 'X', 'S', 'C'};
+	constexpr char c_SceneChunk[4]	   = {'S', 'C', 'N', 'E'};
+	constexpr char c_EntityChunk[4]	   = {'E', 'N', 'T', 'S'};
+	constexpr char c_ComponentChunk[4] = {'C', 'O', 'M', 'P'};
+
+	enum class ComponentEncoding : uint32_t
+	{
+		Blit   = 0,
+		Stream = 1
+	};
+
+	struct FileHeader
+	{
+		char	 Magic[4]	  = {};
+		uint16_t Version	  = 0;
+		uint16_t EndianMarker = 0;
+		uint32_t ChunkCount	  = 0;
+		uint32_t Reserved	  = 0;
+	};
+
+	struct ChunkHeader
+	{
+		char	 Type[4] = {};
+		uint32_t Version = 0;
+		uint64_t Size	 = 0;
+	};
+
+	static_assert(sizeof(FileHeader) == 16 && sizeof(ChunkHeader) == 16);
+
+	/// @brief Appends values to a growing buffer
+	class BinaryWriter
+	{
+	  public:
+		template<typename T>
+		void Write(const T &value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			WriteBytes(&value, sizeof(T));
+		}
+
+		void WriteBytes(const void *data, size_t size)
+		{
+			const std::byte *bytes = static_cast<const std::byte *>(data);
+			m_Data.insert(m_Data.end(), bytes, bytes + size);
+		}
+
+		void WriteString(const std::string &text)
+		{
+			Write((uint32_t)text.size());
+			WriteBytes(text.data(), text.size());
+		}
+
+		void Align(size_t alignment)
+		{
+			m_Data.resize((m_Data.size() + alignment - 1) / alignment * alignment);
+		}
+
+		std::vector<std::byte> &GetData()
+		{
+			return m_Data;
+		}
+
+	  private:
+		std::vector<std::byte> m_Data = {};
+	};
+
+	/// @brief Reads values from a buffer, throwing instead of reading past the end of it
+	class BinaryReader
+	{
+	  public:
+		explicit BinaryReader(std::span<const std::byte> data) : m_Data(data)
+		{
+		}
+
+		template<typename T>
+		T Read()
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			T value;
+			std::memcpy(&value, ReadBytes(sizeof(T)).data(), sizeof(T));
+			return value;
+		}
+
+		std::span<const std::byte> ReadBytes(size_t size)
+		{
+			if (size > m_Data.size() - m_Offset)
+			{
+				throw std::runtime_error("Binary scene is truncated");
+			}
+
+			std::span<const std::byte> bytes = m_Data.subspan(m_Offset, size);
+			m_Offset += size;
+			return bytes;
+		}
+
+		std::string ReadString()
+		{
+			uint32_t				   length = Read<uint32_t>();
+			std::span<const std::byte> bytes  = ReadBytes(length);
+			return std::string(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+		}
+
+		void Align(size_t alignment)
+		{
+			size_t aligned = (m_Offset + alignment - 1) / alignment * alignment;
+			ReadBytes(std::min(aligned, m_Data.size()) - m_Offset);
+		}
+
+		bool IsAtEnd() const
+		{
+			return m_Offset == m_Data.size();
+		}
+
+	  private:
+		std::span<const std::byte> m_Data	= {};
+		size_t					   m_Offset = 0;
+	};
+
+	/// @brief The components of a single type gathered from every entity in a scene
+	struct ComponentChunkSource
+	{
+		const ECS::ComponentStorage *Storage   = nullptr;
+		std::vector<uint64_t>		 Owners	   = {};
+		std::vector<uint64_t>		 Hierarchy = {};
+		std::vector<std::byte>		 Data	   = {};
+	};
+
+	/// @brief A component chunk that has been decoded but not yet added to a registry
+	struct DecodedComponentChunk
+	{
+		Scope<ECS::IComponentArray> Components = nullptr;
+		std::vector<GUID>			Owners	   = {};
+		std::vector<size_t>			Hierarchy  = {};
+	};
+
+	/// @brief The location of a component chunk within a mapped file along with the information needed to decode it
+	struct PendingComponentChunk
+	{
+		std::string					 TypeName  = {};
+		const ECS::ComponentStorage *Storage   = nullptr;
+		uint64_t					 Count	   = 0;
+		std::span<const std::byte>	 Owners	   = {};
+		std::span<const std::byte>	 Hierarchy = {};
+		std::span<const std::byte>	 Data	   = {};
+	};
+
+	static bool HasType(const char (&type)[4], const char (&expected)[4])
+	{
+		return std::memcmp(type, expected, sizeof(type)) == 0;
+	}
+
+	static void WriteChunk(BinaryWriter &output, const char (&type)[4], BinaryWriter &payload)
+	{
+		payload.Align(c_ChunkAlignment);
+
+		ChunkHeader header = {};
+		std::memcpy(header.Type, type, sizeof(header.Type));
+		header.Version = c_Version;
+		header.Size	   = payload.GetData().size();
+
+		output.Write(header);
+		output.WriteBytes(payload.GetData().data(), payload.GetData().size());
+	}
+
+	static const std::string &FindTypeName(const std::map<std::string, ECS::ComponentStorage> &components, const std::string &displayName)
+	{
+		for (const auto &[typeName, storage] : components)
+		{
+			if (storage.DisplayName == displayName)
+			{
+				return typeName;
+			}
+		}
+
+		throw std::runtime_error("Component " + displayName + " is not registered");
+	}
+
+	static DecodedComponentChunk DecodeComponentChunk(const PendingComponentChunk &chunk)
+	{
+		DecodedComponentChunk decoded = {};
+		decoded.Components			  = chunk.Storage->BinaryDeserializer(chunk.Data, chunk.Count);
+		decoded.Owners.resize(chunk.Count);
+		decoded.Hierarchy.resize(chunk.Count);
+
+		for (size_t i = 0; i < chunk.Count; i++)
+		{
+			uint64_t owner = 0, hierarchyIndex = 0;
+			std::memcpy(&owner, chunk.Owners.data() + i * sizeof(uint64_t), sizeof(uint64_t));
+			std::memcpy(&hierarchyIndex, chunk.Hierarchy.data() + i * sizeof(uint64_t), sizeof(uint64_t));
+			decoded.Owners[i]	 = GUID(owner);
+			decoded.Hierarchy[i] = (size_t)hierarchyIndex;
+		}
+
+		return decoded;
+	}
+
+	void Write(const std::string								  &filepath,
+			   const SceneDescription							  &description,
+			   ECS::Registry									  &registry,
+			   const std::map<std::string, ECS::ComponentStorage> &components)
+	{
+		// gather each type's components in entity order, so that loading preserves the order components were added in
+		std::map<std::string, ComponentChunkSource> sources;
+		for (const Entity &entity : registry.GetEntities())
+		{
+			for (const ECS::ComponentPtr &component : registry.GetAllComponents(entity.ID))
+			{
+				auto storage = components.find(component.typeName);
+				if (storage == components.end())
+				{
+					throw std::runtime_error("Type is not registered for serialization");
+				}
+
+				ComponentChunkSource &source = sources[component.typeName];
+				source.Storage				 = &storage->second;
+				source.Owners.push_back(entity.ID.Value);
+				source.Hierarchy.push_back(component.entityComponentIndex);
+				storage->second.BinarySerializer(registry.GetRawComponent(component), source.Data);
+			}
+		}
+
+		BinaryWriter output;
+
+		FileHeader fileHeader = {};
+		std::memcpy(fileHeader.Magic, c_FileMagic, sizeof(fileHeader.Magic));
+		fileHeader.Version		= c_Version;
+		fileHeader.EndianMarker = c_EndianMarker;
+		fileHeader.ChunkCount	= (uint32_t)(2 + sources.size());
+		output.Write(fileHeader);
+
+		{
+			BinaryWriter payload;
+			payload.WriteString(description.Name);
+			payload.Write(description.ClearColour);
+			payload.WriteString(description.CubemapPath);
+			WriteChunk(output, c_SceneChunk, payload);
+		}
+
+		{
+			BinaryWriter payload;
+			payload.Write((uint64_t)registry.GetEntities().size());
+			for (const Entity &entity : registry.GetEntities())
+			{
+				payload.Write(entity.ID.Value);
+				payload.WriteString(entity.Name);
+			}
+			WriteChunk(output, c_EntityChunk, payload);
+		}
+
+		for (auto &[typeName, source] : sources)
+		{
+			// the display name is stored rather than the type name, as type names differ between compilers
+			BinaryWriter payload;
+			payload.WriteString(source.Storage->DisplayName);
+			payload.Write(source.Storage->IsBlittable ? ComponentEncoding::Blit : ComponentEncoding::Stream);
+			payload.Write(source.Storage->ComponentSize);
+			payload.Write((uint64_t)source.Owners.size());
+			payload.Write((uint64_t)source.Data.size());
+
+			payload.Align(sizeof(uint64_t));
+			payload.WriteBytes(source.Owners.data(), source.Owners.size() * sizeof(uint64_t));
+			payload.WriteBytes(source.Hierarchy.data(), source.Hierarchy.size() * sizeof(uint64_t));
+
+			payload.Align(c_ChunkAlignment);
+			payload.WriteBytes(source.Data.data(), source.Data.size());
+			WriteChunk(output, c_ComponentChunk, payload);
+		}
+
+		std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+		if (!file)
+		{
+			throw std::runtime_error("Failed to open " + filepath + " for writing");
+		}
+
+		file.write(reinterpret_cast<const char *>(output.GetData().data()), output.GetData().size());
+	}
+
+	SceneDescription Read(const std::string &filepath, ECS::Registry &registry, const std::map<std::string, ECS::ComponentStorage> &components)
+	{
+		FileSystem::MappedFile file(filepath);
+		BinaryReader		   reader(file.GetData());
+
+		FileHeader fileHeader = reader.Read<FileHeader>();
+		if (!HasType(fileHeader.Magic, c_FileMagic))
+		{
+			throw std::runtime_error(filepath + " is not a binary scene");
+		}
+
+		if (fileHeader.EndianMarker != c_EndianMarker)
+		{
+			throw std::runtime_error(filepath + " was written on a platform with a different byte order");
+		}
+
+		if (fileHeader.Version != c_Version)
+		{
+			throw std::runtime_error(filepath + " was written with an unsupported binary scene version");
+		}
+
+		SceneDescription				   description = {};
+		std::vector<PendingComponentChunk> pending	   = {};
+
+		// the scene and entity chunks are small so they are read directly, component chunks are only located here so that they can be
+		// decoded in parallel afterwards
+		for (uint32_t chunkIndex = 0; chunkIndex < fileHeader.ChunkCount; chunkIndex++)
+		{
+			ChunkHeader	 chunkHeader = reader.Read<ChunkHeader>();
+			BinaryReader chunk(reader.ReadBytes(chunkHeader.Size));
+
+			if (HasType(chunkHeader.Type, c_SceneChunk))
+			{
+				description.Name		= chunk.ReadString();
+				description.ClearColour = chunk.Read<glm::vec4>();
+				description.CubemapPath = chunk.ReadString();
+			}
+			else if (HasType(chunkHeader.Type, c_EntityChunk))
+			{
+				uint64_t entityCount = chunk.Read<uint64_t>();
+				for (uint64_t i = 0; i < entityCount; i++)
+				{
+					uint64_t	id	 = chunk.Read<uint64_t>();
+					std::string name = chunk.ReadString();
+					registry.AddEntity(Entity(GUID(id), name));
+				}
+			}
+			else if (HasType(chunkHeader.Type, c_ComponentChunk))
+			{
+				std::string		  displayName = chunk.ReadString();
+				ComponentEncoding encoding	  = chunk.Read<ComponentEncoding>();
+				uint32_t		  elementSize = chunk.Read<uint32_t>();
+				uint64_t		  count		  = chunk.Read<uint64_t>();
+				uint64_t		  dataSize	  = chunk.Read<uint64_t>();
+
+				PendingComponentChunk component = {};
+				component.TypeName				= FindTypeName(components, displayName);
+				component.Storage				= &components.at(component.TypeName);
+				component.Count					= count;
+
+				// a component that has changed layout since the file was written cannot be loaded, the scene has to be converted again
+				bool isBlittable = encoding == ComponentEncoding::Blit;
+				if (isBlittable != component.Storage->IsBlittable || (isBlittable && elementSize != component.Storage->ComponentSize))
+				{
+					throw std::runtime_error("The layout of component " + displayName + " has changed since " + filepath + " was written");
+				}
+
+				chunk.Align(sizeof(uint64_t));
+				component.Owners	= chunk.ReadBytes(count * sizeof(uint64_t));
+				component.Hierarchy = chunk.ReadBytes(count * sizeof(uint64_t));
+				chunk.Align(c_ChunkAlignment);
+				component.Data = chunk.ReadBytes(dataSize);
+
+				pending.push_back(component);
+			}
+
+			reader.Align(c_ChunkAlignment);
+		}
+
+		// decoding a chunk only creates an array of components, so every chunk is decoded in parallel
+		std::vector<std::future<DecodedComponentChunk>> futures(pending.size());
+		for (size_t i = 0; i < pending.size(); i++)
+		{
+			futures[i] = std::async(std::launch::async, DecodeComponentChunk, std::cref(pending[i]));
+		}
+
+		// the registry is not thread safe, so the decoded arrays are added one at a time
+		for (size_t i = 0; i < pending.size(); i++)
+		{
+			DecodedComponentChunk decoded = futures[i].get();
+			registry.AddComponentArray(pending[i].TypeName, std::move(decoded.Components), decoded.Owners, decoded.Hierarchy);
+		}
+
+		return description;
+	}
+
+	SceneDescription ReadYaml(const std::string									 &filepath,
+							  ECS::Registry										 &registry,
+							  const std::map<std::string, ECS::ComponentStorage> &components)
+	{
+		std::string input = Nexus::FileSystem::ReadFileToStringAbsolute(filepath);
+		YAML::Node	node  = YAML::Load(input);
+
+		if (!node["Scene"])
+		{
+			throw std::runtime_error(filepath + " is not a scene");
+		}
+
+		SceneDescription description = {};
+		description.Name			 = node["Scene"].as<std::string>();
+
+		auto environment = node["Environment"];
+		auto clearColour = environment["ClearColour"];
+		for (glm::length_t i = 0; i < 4; i++) { description.ClearColour[i] = clearColour[i].as<float>(); }
+		description.CubemapPath = environment["Cubemap"].as<std::string>();
+
+		auto entities = node["Entities"];
+		if (entities)
+		{
+			for (auto entity : entities)
+			{
+				uint64_t	id	 = entity["Entity"].as<uint64_t>();
+				std::string name = entity["Name"].as<std::string>();
+				Entity		e(GUID(id), name);
+				registry.AddEntity(e);
+
+				auto entityComponents = entity["Components"];
+				if (entityComponents)
+				{
+					for (auto component : entityComponents)
+					{
+						std::string componentName		 = component["Name"].as<std::string>();
+						size_t		entityComponentIndex = component["HierarchyIndex"].as<size_t>();
+						YAML::Node	data				 = component["Data"];
+
+						const ECS::ComponentStorage &storage = components.at(FindTypeName(components, componentName));
+						storage.YamlDeserializer(e.ID, registry, data, entityComponentIndex);
+					}
+				}
+			}
+		}
+
+		return description;
+	}
+
+	void ConvertYamlToBinary(const std::string									&yamlFilepath,
+							 const std::string									&binaryFilepath,
+							 const std::map<std::string, ECS::ComponentStorage> &components)
+	{
+		ECS::Registry	 registry;
+		SceneDescription description = ReadYaml(yamlFilepath, registry, components);
+		Write(binaryFilepath, description, registry, components);
+	}
+}	 // namespace Nexus::BinaryScene
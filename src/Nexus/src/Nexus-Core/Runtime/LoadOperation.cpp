@@ -0,0 +1,259 @@
+#include "Nexus-Core/Runtime/LoadOperation.hpp"
+
+namespace Nexus
+{
+	LoadOperation::~LoadOperation()
+	{
+		CancelAndWait();
+	}
+
+	void LoadOperation::Start(WorkerFunc worker)
+	{
+		if (m_Worker.valid())
+		{
+			throw std::runtime_error("A load operation can only be started once");
+		}
+
+		m_Worker = std::async(std::launch::async,
+							  [this, worker]()
+							  {
+								  try
+								  {
+									  worker(*this);
+								  }
+								  catch (const std::exception &e)
+								  {
+									  Fail(e.what());
+								  }
+								  catch (...)
+								  {
+									  Fail("Unknown error");
+								  }
+							  });
+	}
+
+	LoadStatus LoadOperation::Update(TimeSpan budget)
+	{
+		if (IsDone())
+		{
+			return GetStatus();
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		auto limit = std::chrono::nanoseconds(budget.GetNanoseconds<uint64_t>());
+
+		// always run one item so that a frame that is already over budget does not stall the load indefinitely
+		while (RunNextMainThreadWork())
+		{
+			if (std::chrono::steady_clock::now() - start >= limit)
+			{
+				break;
+			}
+		}
+
+		UpdateStatus();
+		return GetStatus();
+	}
+
+	LoadStatus LoadOperation::Wait()
+	{
+		if (!m_Worker.valid())
+		{
+			throw std::runtime_error("Cannot wait for a load operation that has not been started");
+		}
+
+		while (!IsDone())
+		{
+			if (!RunNextMainThreadWork())
+			{
+				// the worker may still be queueing work, so only block on it once it has finished
+				if (m_Worker.wait_for(std::chrono::milliseconds(1)) != std::future_status::ready)
+				{
+					continue;
+				}
+			}
+
+			UpdateStatus();
+		}
+
+		return GetStatus();
+	}
+
+	void LoadOperation::Cancel()
+	{
+		m_Cancelled = true;
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_MainThreadWork.clear();
+	}
+
+	LoadStatus LoadOperation::GetStatus() const
+	{
+		return m_Status;
+	}
+
+	bool LoadOperation::IsDone() const
+	{
+		return m_Status != LoadStatus::Loading;
+	}
+
+	float LoadOperation::GetProgress() const
+	{
+		if (m_Status == LoadStatus::Completed)
+		{
+			return 1.0f;
+		}
+
+		uint32_t total = m_TotalWork;
+		if (total == 0)
+		{
+			return m_ReportedProgress;
+		}
+
+		// work can be declared after some has already completed, so the fraction is clamped to stop a progress bar from moving backwards
+		float progress = std::min((float)m_CompletedWork / (float)total, 1.0f);
+		float reported = m_ReportedProgress;
+		while (progress > reported && !m_ReportedProgress.compare_exchange_weak(reported, progress)) {}
+
+		return std::max(progress, reported);
+	}
+
+	std::string LoadOperation::GetError() const
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		return m_Error;
+	}
+
+	void LoadOperation::AddWork(uint32_t count)
+	{
+		m_TotalWork += count;
+	}
+
+	void LoadOperation::CompleteWork(uint32_t count)
+	{
+		m_CompletedWork += count;
+	}
+
+	void LoadOperation::EnqueueMainThreadWork(MainThreadFunc work)
+	{
+		// the flag is checked while holding the lock so that work cannot be queued after Cancel has cleared the queue
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		if (m_Cancelled)
+		{
+			return;
+		}
+
+		AddWork(1);
+		m_MainThreadWork.push_back(std::move(work));
+	}
+
+	bool LoadOperation::IsCancelled() const
+	{
+		return m_Cancelled;
+	}
+
+	void LoadOperation::CancelAndWait()
+	{
+		Cancel();
+
+		if (m_Worker.valid())
+		{
+			m_Worker.wait();
+		}
+	}
+
+	bool LoadOperation::RunNextMainThreadWork()
+	{
+		MainThreadFunc work = {};
+
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			if (m_MainThreadWork.empty())
+			{
+				return false;
+			}
+
+			work = std::move(m_MainThreadWork.front());
+			m_MainThreadWork.pop_front();
+		}
+
+		try
+		{
+			work();
+		}
+		catch (const std::exception &e)
+		{
+			Fail(e.what());
+		}
+		catch (...)
+		{
+			Fail("Unknown error");
+		}
+
+		CompleteWork();
+		return true;
+	}
+
+	void LoadOperation::UpdateStatus()
+	{
+		if (IsDone() || !m_Worker.valid())
+		{
+			return;
+		}
+
+		if (m_Worker.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		{
+			return;
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			if (!m_MainThreadWork.empty())
+			{
+				return;
+			}
+
+			if (!m_Error.empty())
+			{
+				m_Status = LoadStatus::Failed;
+				return;
+			}
+		}
+
+		if (m_Cancelled)
+		{
+			m_Status = LoadStatus::Cancelled;
+			return;
+		}
+
+		try
+		{
+			OnCompleted();
+			m_Status = LoadStatus::Completed;
+		}
+		catch (const std::exception &e)
+		{
+			Fail(e.what());
+			m_Status = LoadStatus::Failed;
+		}
+		catch (...)
+		{
+			Fail("Unknown error");
+			m_Status = LoadStatus::Failed;
+		}
+	}
+
+	void LoadOperation::Fail(const std::string &error)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			if (m_Error.empty())
+			{
+				m_Error = error.empty() ? "Unknown error" : error;
+			}
+		}
+
+		// there is no point running any more work once something has failed
+		Cancel();
+	}
+}	 // namespace Nexus
@@ -5,6 +5,7 @@
 #include "yaml-cpp/yaml.h"
 
 #include "Nexus-Core/Platform.hpp"
+#include "Nexus-Core/Runtime/BinaryScene.hpp"
 #include "Nexus-Core/Scripting/NativeScript.hpp"
 #include "Nexus-Core/Utils/StringUtils.hpp"
 
@@ -13,6 +14,9 @@
 
 const std::string DefaultSceneName = "UntitledScene";
 
+/// @brief The time spent creating the resources of a scene that is loading in the background each frame
+const Nexus::TimeSpan SceneLoadBudget = Nexus::TimeSpan::FromMilliseconds(4);
+
 namespace Nexus
 {
 	Project::Project(Graphics::GraphicsDevice	 *device,
@@ -40,6 +44,8 @@ namespace Nexus
 
 	Project::~Project()
 	{
+		// the load may still be deserializing components using functions from the shared library
+		m_PendingSceneLoad = nullptr;
 		UnloadSharedLibrary();
 	}
 
@@ -122,6 +128,7 @@ namespace Nexus
 			const SceneInfo &info  = m_Scenes.at(index);
 			Scene			*scene = Scene::Deserialize(info, GetFullSceneDirectory(), this, device, commandQueue);
 			m_LoadedScene		   = std::unique_ptr<Scene>(scene);
+			m_PendingSceneLoad	   = nullptr;
 		}
 	}
 
@@ -138,8 +145,42 @@ namespace Nexus
 		}
 	}
 
+	Ref<SceneLoadOperation> Project::LoadSceneAsync(uint32_t index, Graphics::GraphicsDevice *device, Ref<Graphics::ICommandQueue> commandQueue)
+	{
+		if (m_Scenes.size() <= index)
+		{
+			return nullptr;
+		}
+
+		// releasing the previous operation cancels it
+		m_PendingSceneLoad = Scene::LoadAsync(m_Scenes.at(index), GetFullSceneDirectory(), this, device, commandQueue);
+		return m_PendingSceneLoad;
+	}
+
+	Ref<SceneLoadOperation> Project::LoadSceneAsync(const std::string			&name,
+													Graphics::GraphicsDevice	*device,
+													Ref<Graphics::ICommandQueue> commandQueue)
+	{
+		for (size_t i = 0; i < m_Scenes.size(); i++)
+		{
+			if (m_Scenes.at(i).Name == name)
+			{
+				return LoadSceneAsync((uint32_t)i, device, commandQueue);
+			}
+		}
+
+		return nullptr;
+	}
+
+	Ref<SceneLoadOperation> Project::GetPendingSceneLoad() const
+	{
+		return m_PendingSceneLoad;
+	}
+
 	void Project::CreateNewScene(const std::string &name)
 	{
+		m_PendingSceneLoad = nullptr;
+
 		std::string path = m_SceneDirectory + "\\" + name + ".scene";
 
 		SceneInfo info;
@@ -161,6 +202,24 @@ namespace Nexus
 
 	void Project::OnUpdate(TimeSpan time)
 	{
+		if (m_PendingSceneLoad)
+		{
+			LoadStatus status = m_PendingSceneLoad->Update(SceneLoadBudget);
+			if (status == LoadStatus::Completed)
+			{
+				m_LoadedScene = m_PendingSceneLoad->TakeScene();
+			}
+			else if (status == LoadStatus::Failed)
+			{
+				NX_ERROR("Failed to load scene: " + m_PendingSceneLoad->GetError());
+			}
+
+			if (status != LoadStatus::Loading)
+			{
+				m_PendingSceneLoad = nullptr;
+			}
+		}
+
 		if (!m_LoadedScene || m_LoadedScene->GetSceneState() != SceneState::Playing)
 		{
 			return;
@@ -408,7 +467,7 @@ namespace Nexus
 		if (m_AvailableComponents.find(component.typeName) != m_AvailableComponents.end())
 		{
 			auto &storage = m_AvailableComponents.at(component.typeName);
-			void *obj	  = registry.GetRawComponent(component.typeName, component.componentIndex);
+			void *obj	  = registry.GetRawComponent(component);
 			storage.RenderFunc(obj, project);
 			return;
 		}
@@ -423,25 +482,28 @@ namespace Nexus
 		if (m_AvailableComponents.find(typeName) != m_AvailableComponents.end())
 		{
 			auto &componentStorage = m_AvailableComponents.at(typeName);
-			void *obj			   = registry.GetRawComponent(component.typeName, component.componentIndex);
+			void *obj			   = registry.GetRawComponent(component);
 			return componentStorage.StringSerializer(obj);
 		}
 
 		throw std::runtime_error("Type is not registed for serialization");
 	}
 
-	void Project::DeserializeComponentFromString(ECS::Registry	   &registry,
-												 GUID				guid,
-												 const std::string &displayName,
-												 const std::string &data,
-												 size_t				entityHierarchyIndex)
+	void Project::DeserializeComponentFromString(ECS::Registry				 &registry,
+												 GUID						  guid,
+												 const std::string			 &displayName,
+												 const std::string			 &data,
+												 size_t						  entityHierarchyIndex,
+												 Graphics::GraphicsDevice	 *device,
+												 Ref<Graphics::ICommandQueue> commandQueue)
 	{
 		std::string typeName = GetComponentTypeNameFromDisplayName(displayName);
 
 		if (m_AvailableComponents.find(typeName.c_str()) != m_AvailableComponents.end())
 		{
-			auto &storage = m_AvailableComponents.at(typeName.c_str());
-			storage.StringDeserializer(guid, registry, data, entityHierarchyIndex);
+			auto &storage	= m_AvailableComponents.at(typeName.c_str());
+			void *component = storage.StringDeserializer(guid, registry, data, entityHierarchyIndex);
+			storage.LoadResources(component, device, commandQueue);
 			return;
 		}
 
@@ -455,25 +517,28 @@ namespace Nexus
 		if (m_AvailableComponents.find(typeName) != m_AvailableComponents.end())
 		{
 			auto &componentStorage = m_AvailableComponents.at(typeName);
-			void *obj			   = registry.GetRawComponent(component.typeName, component.componentIndex);
+			void *obj			   = registry.GetRawComponent(component);
 			return componentStorage.YamlSerializer(obj);
 		}
 
 		throw std::runtime_error("Type is not registered for serialization");
 	}
 
-	void Project::DeserializeComponentFromYaml(ECS::Registry	 &registry,
-											   GUID				  guid,
-											   const std::string &displayName,
-											   const YAML::Node	 &node,
-											   size_t			  entityHierarchyIndex)
+	void Project::DeserializeComponentFromYaml(ECS::Registry			   &registry,
+											   GUID							guid,
+											   const std::string		   &displayName,
+											   const YAML::Node			   &node,
+											   size_t						entityHierarchyIndex,
+											   Graphics::GraphicsDevice	   *device,
+											   Ref<Graphics::ICommandQueue>	commandQueue)
 	{
 		std::string typeName = GetComponentTypeNameFromDisplayName(displayName);
 
 		if (m_AvailableComponents.find(typeName.c_str()) != m_AvailableComponents.end())
 		{
-			auto &storage = m_AvailableComponents.at(typeName.c_str());
-			storage.YamlDeserializer(guid, registry, node, entityHierarchyIndex);
+			auto &storage	= m_AvailableComponents.at(typeName.c_str());
+			void *component = storage.YamlDeserializer(guid, registry, node, entityHierarchyIndex);
+			storage.LoadResources(component, device, commandQueue);
 			return;
 		}
 		throw std::runtime_error("Type is not registered for deserialization");
@@ -554,9 +619,11 @@ namespace Nexus
 
 		if (m_LoadedScene)
 		{
-			std::string filename = m_LoadedScene->Name + ".scene";
-			path /= filename;
-			m_LoadedScene->Serialize(path.string());
+			// the YAML file is kept as the editable source of the scene, the binary file is what is used when loading
+			std::filesystem::path yamlPath	 = path / (m_LoadedScene->Name + ".scene");
+			std::filesystem::path binaryPath = path / (m_LoadedScene->Name + BinaryScene::c_Extension);
+			m_LoadedScene->Serialize(yamlPath.string());
+			m_LoadedScene->SerializeBinary(binaryPath.string());
 		}
 	}
 }	 // namespace Nexus
\ No newline at end of file
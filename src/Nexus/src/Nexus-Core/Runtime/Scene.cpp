@@ -3,12 +3,14 @@
 #include "Nexus-Core/FileSystem/FileSystem.hpp"
 #include "yaml-cpp/yaml.h"
 
+#include "Nexus-Core/Assets/Processors/AssimpProcessor.hpp"
 #include "Nexus-Core/Graphics/HdriProcessor.hpp"
 #include "Nexus-Core/Runtime.hpp"
 
 #include "Nexus-Core/ECS/ComponentRegistry.hpp"
 #include "Nexus-Core/ECS/Components.hpp"
 
+#include "Nexus-Core/Runtime/BinaryScene.hpp"
 #include "Nexus-Core/Runtime/Project.hpp"
 #include "Nexus-Core/Scripting/NativeScript.hpp"
 
@@ -154,6 +156,16 @@ namespace Nexus
 		FileSystem::WriteFileAbsolute(filepath, out.c_str());
 	}
 
+	void Scene::SerializeBinary(const std::string &filepath)
+	{
+		BinaryScene::SceneDescription description = {};
+		description.Name						  = Name;
+		description.ClearColour					  = SceneEnvironment.ClearColour;
+		description.CubemapPath					  = SceneEnvironment.CubemapPath;
+
+		BinaryScene::Write(filepath, description, Registry, ParentProject->GetCachedAvailableComponents());
+	}
+
 	void Scene::AddEmptyEntity()
 	{
 		Registry.Create();
@@ -278,64 +290,361 @@ namespace Nexus
 		return m_SceneState;
 	}
 
-	Scene *Scene::Deserialize(const SceneInfo			  &info,
-							  const std::string			  &sceneDirectory,
-							  Project					  *project,
-							  Graphics::GraphicsDevice	  *device,
-							  Ref<Graphics::ICommandQueue> commandQueue)
+	void Scene::UpdateTransforms()
 	{
-		std::string filepath = sceneDirectory + info.Name + std::string(".scene");
+		m_TransformUpdate++;
+
+		// comparing the components against the values that the matrices were built from is far cheaper than converting every entity's
+		// euler angles, so only the entities that have moved are recomputed
+		bool				 structureChanged = false;
+		size_t				 visited		  = 0;
+		ECS::View<Transform> transforms		  = Registry.GetView<Transform>();
+		transforms.Each(
+			[&](Entity *entity, const std::tuple<Transform *> &components)
+			{
+				const Transform *transform = std::get<0>(components);
+
+				EntityTransform &entry = m_EntityTransforms[entity->ID];
+
+				if (entry.LastUpdate == m_TransformUpdate)
+				{
+					// only the first Transform of an entity is used
+					return;
+				}
+
+				if (!entry.Node.IsValid())
+				{
+					entry.Node		 = m_TransformHierarchy.Create(transform->ToLocalTransform());
+					structureChanged = true;
+				}
+				else if (entry.Position != transform->Position || entry.Rotation != transform->Rotation || entry.Scale != transform->Scale)
+				{
+					m_TransformHierarchy.SetLocalTransform(entry.Node, transform->ToLocalTransform());
+				}
+
+				structureChanged |= entry.Parent != transform->Parent;
 
-		std::string input = Nexus::FileSystem::ReadFileToStringAbsolute(filepath);
-		YAML::Node	node  = YAML::Load(input);
+				entry.Position	 = transform->Position;
+				entry.Rotation	 = transform->Rotation;
+				entry.Scale		 = transform->Scale;
+				entry.Parent	 = transform->Parent;
+				entry.LastUpdate = m_TransformUpdate;
+				visited++;
+			});
 
-		if (!node["Scene"])
+		// parents are only resolved once every entity has a node, and before removed entities are destroyed so that their children are
+		// moved to the root rather than destroyed with them
+		if (structureChanged || visited != m_EntityTransforms.size())
 		{
-			return nullptr;
+			for (auto &[id, entry] : m_EntityTransforms)
+			{
+				if (entry.LastUpdate != m_TransformUpdate)
+				{
+					continue;
+				}
+
+				ECS::TransformNode parent = {};
+				auto			   it	  = entry.Parent != 0 ? m_EntityTransforms.find(entry.Parent) : m_EntityTransforms.end();
+				if (it != m_EntityTransforms.end() && it->second.LastUpdate == m_TransformUpdate &&
+					!m_TransformHierarchy.IsDescendant(it->second.Node, entry.Node))
+				{
+					parent = it->second.Node;
+				}
+
+				if (m_TransformHierarchy.GetParent(entry.Node) != parent)
+				{
+					m_TransformHierarchy.SetParent(entry.Node, parent);
+				}
+			}
 		}
 
-		Scene *scene		 = new Scene();
-		scene->Guid			 = info.Guid;
-		scene->Name			 = node["Scene"].as<std::string>();
-		scene->ParentProject = project;
+		// entities that have been removed or have lost their Transform were not visited above
+		std::erase_if(m_EntityTransforms,
+					  [&](const auto &pair)
+					  {
+						  if (pair.second.LastUpdate == m_TransformUpdate)
+						  {
+							  return false;
+						  }
 
-		auto environment					= node["Environment"];
-		scene->SceneEnvironment.ClearColour = environment["ClearColour"].as<glm::vec4>();
-		scene->SceneEnvironment.CubemapPath = environment["Cubemap"].as<std::string>();
+						  m_TransformHierarchy.Destroy(pair.second.Node);
+						  return true;
+					  });
 
-		if (!scene->SceneEnvironment.CubemapPath.empty() && std::filesystem::exists(scene->SceneEnvironment.CubemapPath))
+		m_TransformHierarchy.Update();
+	}
+
+	const glm::mat4 &Scene::GetWorldMatrix(GUID entity) const
+	{
+		static const glm::mat4 c_Identity = glm::mat4(1.0f);
+
+		auto it = m_EntityTransforms.find(entity);
+		if (it == m_EntityTransforms.end())
 		{
-			Graphics::HdriProcessor processor(scene->SceneEnvironment.CubemapPath, device, commandQueue);
-			scene->SceneEnvironment.EnvironmentCubemap = processor.Generate(2048);
+			return c_Identity;
 		}
 
-		auto entities = node["Entities"];
-		if (entities)
+		return m_TransformHierarchy.GetWorldMatrix(it->second.Node);
+	}
+
+	/// @brief Reads the entities and components of a scene into a registry, preferring the binary scene when it is up to date
+	static BinaryScene::SceneDescription ReadSceneFile(const std::string								  &filepath,
+													   const std::string								  &binaryFilepath,
+													   ECS::Registry									  &registry,
+													   const std::map<std::string, ECS::ComponentStorage> &components)
+	{
+		// the binary scene is only a cache of the YAML file, so it is ignored if the YAML file has been edited since it was written
+		std::error_code error;
+		if (std::filesystem::exists(binaryFilepath, error) &&
+			(!std::filesystem::exists(filepath, error) ||
+			 std::filesystem::last_write_time(binaryFilepath, error) >= std::filesystem::last_write_time(filepath, error)))
+		{
+			try
+			{
+				return BinaryScene::Read(binaryFilepath, registry, components);
+			}
+			catch (const std::exception &e)
+			{
+				NX_WARNING(std::string("Falling back to YAML scene: ") + e.what());
+				registry = ECS::Registry {};
+			}
+		}
+
+		return BinaryScene::ReadYaml(filepath, registry, components);
+	}
+
+	/// @brief Imports a model on a worker thread and queues the creation of its meshes and textures on the main thread
+	static void LoadModelResource(LoadOperation				  &operation,
+								  const std::string			  &filepath,
+								  std::vector<ModelRenderer *> renderers,
+								  Graphics::GraphicsDevice	  *device,
+								  Ref<Graphics::ICommandQueue> commandQueue)
+	{
+		if (operation.IsCancelled())
 		{
-			for (auto entity : entities)
+			return;
+		}
+
+		Processors::AssimpProcessor		 processor = {};
+		Ref<Processors::ModelSourceData> source	   = CreateRef<Processors::ModelSourceData>(processor.ReadModel(filepath));
+		operation.CompleteWork();
+
+		operation.EnqueueMainThreadWork(
+			[source, renderers, device, commandQueue]()
 			{
-				uint64_t	id	 = entity["Entity"].as<uint64_t>();
-				std::string name = entity["Name"].as<std::string>();
-				Entity		e(GUID(id), name);
-				scene->Registry.AddEntity(e);
+				Ref<Graphics::Model> model = Processors::AssimpProcessor::CreateModel(*source, device, commandQueue);
+				for (ModelRenderer *renderer : renderers) { renderer->Model = model; }
+			});
+	}
+
+	/// @brief Decodes a sprite's texture on a worker thread and queues its upload on the main thread
+	static void LoadSpriteResource(LoadOperation						 &operation,
+								   const std::string					 &filepath,
+								   std::vector<SpriteRendererComponent *> sprites,
+								   Graphics::GraphicsDevice				 *device,
+								   Ref<Graphics::ICommandQueue>			  commandQueue)
+	{
+		if (operation.IsCancelled())
+		{
+			return;
+		}
+
+		auto image = CreateRef<Graphics::Image>(Graphics::Image::FromFile(filepath, Graphics::PixelFormat::R8_G8_B8_A8_UNorm));
+		operation.CompleteWork();
+
+		if (image->IsEmpty())
+		{
+			NX_WARNING("Failed to load sprite texture: " + filepath);
+			return;
+		}
+
+		operation.EnqueueMainThreadWork(
+			[image, sprites, device, commandQueue]()
+			{
+				Ref<Graphics::Texture> texture = device->CreateTexture2D(commandQueue, *image, true);
+				for (SpriteRendererComponent *sprite : sprites) { sprite->SpriteTexture = texture; }
+			});
+	}
+
+	/// @brief Decodes a scene's HDRI on a worker thread and queues the rendering of its environment cubemap on the main thread
+	static void LoadEnvironmentResource(LoadOperation				&operation,
+										Scene						*scene,
+										Graphics::GraphicsDevice	*device,
+										Ref<Graphics::ICommandQueue> commandQueue)
+	{
+		if (operation.IsCancelled())
+		{
+			return;
+		}
+
+		auto image = CreateRef<Graphics::Image>(Graphics::HdriProcessor::LoadImage(scene->SceneEnvironment.CubemapPath));
+		operation.CompleteWork();
+
+		// the processor cannot be created from an empty image, so a missing environment is reported in the same way as a missing sprite
+		if (image->IsEmpty())
+		{
+			NX_WARNING("Failed to load environment map: " + scene->SceneEnvironment.CubemapPath);
+			return;
+		}
 
-				auto components = entity["Components"];
-				if (components)
+		operation.EnqueueMainThreadWork(
+			[&operation, scene, image, device, commandQueue]()
+			{
+				auto processor = CreateRef<Graphics::HdriProcessor>(*image, device, commandQueue);
+				processor->BeginGenerate(2048);
+
+				// each face is rendered by a separate item of work so that no single frame has to render the whole cubemap
+				for (uint32_t face = 0; face < 6; face++)
 				{
-					for (auto component : components)
-					{
-						Nexus::ECS::ComponentRegistry &componentRegistry = Nexus::ECS::ComponentRegistry::GetRegistry();
+					operation.EnqueueMainThreadWork(
+						[scene, processor]()
+						{
+							if (processor->GenerateNextFace())
+							{
+								scene->SceneEnvironment.EnvironmentCubemap = processor->GetCubemap();
+							}
+						});
+				}
+			});
+	}
 
-						std::string componentName		 = component["Name"].as<std::string>();
-						size_t		entityComponentIndex = component["HierarchyIndex"].as<size_t>();
-						YAML::Node	data				 = component["Data"];
+	/// @brief Decodes the models, sprite textures and environment map used by a scene on worker threads, queueing the creation of their GPU
+	/// resources on the operation. The registry is not modified while this runs, so pointers to its components remain valid.
+	static void LoadSceneResources(LoadOperation			   &operation,
+								   Scene					   *scene,
+								   Graphics::GraphicsDevice	   *device,
+								   Ref<Graphics::ICommandQueue> commandQueue)
+	{
+		// components that reference the same file share the resource created from it
+		std::map<std::string, std::vector<ModelRenderer *>>			  models;
+		std::map<std::string, std::vector<SpriteRendererComponent *>> sprites;
 
-						project->DeserializeComponentFromYaml(scene->Registry, e.ID, componentName, data, entityComponentIndex);
-					}
+		for (auto &[entity, components] : scene->Registry.GetView<ModelRenderer>())
+		{
+			for (const auto &component : components)
+			{
+				ModelRenderer *renderer = std::get<0>(component);
+				if (!renderer->FilePath.empty() && std::filesystem::exists(renderer->FilePath))
+				{
+					models[renderer->FilePath].push_back(renderer);
+				}
+			}
+		}
+
+		for (auto &[entity, components] : scene->Registry.GetView<SpriteRendererComponent>())
+		{
+			for (const auto &component : components)
+			{
+				SpriteRendererComponent *sprite = std::get<0>(component);
+				if (!sprite->TexturePath.empty())
+				{
+					sprites[sprite->TexturePath].push_back(sprite);
 				}
 			}
 		}
 
-		return scene;
+		const std::string &cubemapPath = scene->SceneEnvironment.CubemapPath;
+		bool			   hasCubemap  = !cubemapPath.empty() && std::filesystem::exists(cubemapPath);
+
+		// decoding each file is one unit of work, creating its resources is another that is added when the main thread work is queued
+		operation.AddWork((uint32_t)(models.size() + sprites.size() + (hasCubemap ? 1 : 0)));
+
+		std::vector<std::future<void>> tasks;
+		for (auto &[filepath, renderers] : models)
+		{
+			tasks.push_back(std::async(std::launch::async, LoadModelResource, std::ref(operation), filepath, renderers, device, commandQueue));
+		}
+
+		for (auto &[filepath, components] : sprites)
+		{
+			tasks.push_back(std::async(std::launch::async, LoadSpriteResource, std::ref(operation), filepath, components, device, commandQueue));
+		}
+
+		if (hasCubemap)
+		{
+			tasks.push_back(std::async(std::launch::async, LoadEnvironmentResource, std::ref(operation), scene, device, commandQueue));
+		}
+
+		for (std::future<void> &task : tasks) { task.get(); }
+	}
+
+	SceneLoadOperation::SceneLoadOperation(std::unique_ptr<Scene> scene) : m_Scene(std::move(scene))
+	{
+	}
+
+	SceneLoadOperation::~SceneLoadOperation()
+	{
+		CancelAndWait();
+	}
+
+	Scene *SceneLoadOperation::GetScene()
+	{
+		return m_Scene.get();
+	}
+
+	std::unique_ptr<Scene> SceneLoadOperation::TakeScene()
+	{
+		if (GetStatus() != LoadStatus::Completed)
+		{
+			return nullptr;
+		}
+
+		return std::move(m_Scene);
+	}
+
+	Scene *Scene::Deserialize(const SceneInfo			  &info,
+							  const std::string			  &sceneDirectory,
+							  Project					  *project,
+							  Graphics::GraphicsDevice	  *device,
+							  Ref<Graphics::ICommandQueue> commandQueue)
+	{
+		Ref<SceneLoadOperation> operation = LoadAsync(info, sceneDirectory, project, device, commandQueue);
+		if (operation->Wait() != LoadStatus::Completed)
+		{
+			NX_ERROR("Failed to load scene " + info.Name + ": " + operation->GetError());
+			return nullptr;
+		}
+
+		return operation->TakeScene().release();
+	}
+
+	Ref<SceneLoadOperation> Scene::LoadAsync(const SceneInfo			 &info,
+											 const std::string			 &sceneDirectory,
+											 Project					 *project,
+											 Graphics::GraphicsDevice	 *device,
+											 Ref<Graphics::ICommandQueue> commandQueue)
+	{
+		std::string filepath	   = sceneDirectory + info.Name + std::string(".scene");
+		std::string binaryFilepath = sceneDirectory + info.Name + std::string(BinaryScene::c_Extension);
+
+		// the scene is created here because its constructor uses the graphics device
+		std::unique_ptr<Scene> scene = std::make_unique<Scene>();
+		scene->Guid					 = info.Guid;
+		scene->ParentProject		 = project;
+
+		Ref<SceneLoadOperation> operation = CreateRef<SceneLoadOperation>(std::move(scene));
+		Scene				   *target	  = operation->GetScene();
+
+		operation->Start(
+			[target, filepath, binaryFilepath, project, device, commandQueue](LoadOperation &operation)
+			{
+				operation.AddWork(1);
+				BinaryScene::SceneDescription description =
+					ReadSceneFile(filepath, binaryFilepath, target->Registry, project->GetCachedAvailableComponents());
+				operation.CompleteWork();
+
+				target->Name						 = description.Name;
+				target->SceneEnvironment.ClearColour = description.ClearColour;
+				target->SceneEnvironment.CubemapPath = description.CubemapPath;
+
+				if (operation.IsCancelled())
+				{
+					return;
+				}
+
+				LoadSceneResources(operation, target, device, commandQueue);
+			});
+
+		return operation;
 	}
 }	 // namespace Nexus
\ No newline at end of file
@@ -1,12 +1,265 @@
 #include "Nexus-Core/Timings/Profiler.hpp"
 
+#include "Nexus-Core/Graphics/TimingQuery.hpp"
+
 namespace Nexus::Timings
 {
-	void Profiler::AddResult(const std::string &name, TimeSpan timespan)
+	/// @brief A single producer, single consumer ring of events. Only the thread that owns the buffer advances Head and only Flush advances
+	/// Tail, so neither side ever needs a lock.
+	struct Profiler::ThreadBuffer
+	{
+		std::unique_ptr<ProfileEvent[]> Events	 = std::make_unique<ProfileEvent[]>(c_ThreadBufferCapacity);
+		uint32_t						ThreadId = 0;
+		ThreadBuffer				   *Next	 = nullptr;
+
+		// the two ends are written by different threads, so they are kept on separate cache lines. The owner keeps the last tail that it
+		// read next to the head, so it only reads the tail written by Flush when the buffer looks full.
+		alignas(64) std::atomic<uint64_t> Head = 0;
+		uint64_t CachedTail					   = 0;
+		alignas(64) std::atomic<uint64_t> Tail = 0;
+		std::atomic<uint64_t> Dropped		   = 0;
+
+		/// @brief Set once the thread that owned the buffer has exited, the buffer can then be claimed by another thread
+		std::atomic<bool> Retired = false;
+	};
+
+	/// @brief Retires the buffer of a thread when the thread exits
+	struct Profiler::ThreadBufferOwner
+	{
+		ThreadBuffer *Buffer = nullptr;
+
+		~ThreadBufferOwner()
+		{
+			if (Buffer)
+			{
+				Buffer->Retired.store(true, std::memory_order_release);
+			}
+		}
+	};
+
+	static constexpr uint32_t c_BinaryMagic	  = 0x4650584E;	   // "NXPF"
+	static constexpr uint32_t c_BinaryVersion = 1;
+
+	static uint64_t GetSteadyNanoseconds()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	static void WriteJsonString(std::ostream &stream, const std::string &value)
+	{
+		stream << '"';
+		for (char c : value)
+		{
+			switch (c)
+			{
+				case '"': stream << "\\\""; break;
+				case '\\': stream << "\\\\"; break;
+				case '\n': stream << "\\n"; break;
+				case '\r': stream << "\\r"; break;
+				case '\t': stream << "\\t"; break;
+				default:
+					if ((unsigned char)c < 0x20)
+					{
+						stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c << std::dec << std::setfill(' ');
+					}
+					else
+					{
+						stream << c;
+					}
+			}
+		}
+		stream << '"';
+	}
+
+	template<typename T>
+	static void WriteValue(std::ostream &stream, const T &value)
+	{
+		stream.write((const char *)&value, sizeof(T));
+	}
+
+	template<typename T>
+	static T ReadValue(std::istream &stream)
+	{
+		T value = {};
+		if (!stream.read((char *)&value, sizeof(T)))
+		{
+			throw std::runtime_error("Profile capture ended unexpectedly");
+		}
+		return value;
+	}
+
+	void ProfileCapture::WriteChromeTrace(std::ostream &stream) const
+	{
+		std::set<uint32_t> threads = {};
+
+		stream << "{\"traceEvents\":[";
+		for (size_t i = 0; i < Events.size(); i++)
+		{
+			const ProfileCaptureEvent &event = Events[i];
+			threads.insert(event.ThreadId);
+
+			double begin	= ((double)event.Begin - (double)StartTicks) / TicksPerSecond * 1'000'000.0;
+			double duration = (double)(event.End - event.Begin) / TicksPerSecond * 1'000'000.0;
+
+			stream << (i > 0 ? ",\n" : "\n") << "{\"name\":";
+			WriteJsonString(stream, Names[event.NameIndex]);
+			stream << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.ThreadId << std::fixed << std::setprecision(3) << ",\"ts\":" << begin
+				   << ",\"dur\":" << duration << "}";
+		}
+
+		// name the tracks so that the GPU events are distinguishable from the threads
+		for (uint32_t thread : threads)
+		{
+			std::string name = thread == Profiler::c_GpuThreadId ? "GPU" : "Thread " + std::to_string(thread);
+			stream << (Events.empty() ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread
+				   << ",\"args\":{\"name\":";
+			WriteJsonString(stream, name);
+			stream << "}}";
+		}
+
+		stream << "\n]}\n";
+	}
+
+	void ProfileCapture::WriteBinary(std::ostream &stream) const
+	{
+		WriteValue(stream, c_BinaryMagic);
+		WriteValue(stream, c_BinaryVersion);
+		WriteValue(stream, TicksPerSecond);
+		WriteValue(stream, StartTicks);
+
+		WriteValue(stream, (uint32_t)Names.size());
+		for (const std::string &name : Names)
+		{
+			WriteValue(stream, (uint32_t)name.size());
+			stream.write(name.data(), name.size());
+		}
+
+		WriteValue(stream, (uint64_t)Events.size());
+		for (const ProfileCaptureEvent &event : Events)
+		{
+			WriteValue(stream, event.NameIndex);
+			WriteValue(stream, event.ThreadId);
+			WriteValue(stream, event.Begin);
+			WriteValue(stream, event.End);
+		}
+	}
+
+	ProfileCapture ProfileCapture::ReadBinary(std::istream &stream)
+	{
+		if (ReadValue<uint32_t>(stream) != c_BinaryMagic)
+		{
+			throw std::runtime_error("Stream does not contain a profile capture");
+		}
+
+		if (ReadValue<uint32_t>(stream) != c_BinaryVersion)
+		{
+			throw std::runtime_error("Profile capture was written with an unsupported version");
+		}
+
+		ProfileCapture capture = {};
+		capture.TicksPerSecond = ReadValue<double>(stream);
+		capture.StartTicks	   = ReadValue<uint64_t>(stream);
+
+		uint32_t nameCount = ReadValue<uint32_t>(stream);
+		capture.Names.resize(nameCount);
+		for (std::string &name : capture.Names)
+		{
+			name.resize(ReadValue<uint32_t>(stream));
+			if (!stream.read(name.data(), name.size()))
+			{
+				throw std::runtime_error("Profile capture ended unexpectedly");
+			}
+		}
+
+		uint64_t eventCount = ReadValue<uint64_t>(stream);
+		capture.Events.reserve(eventCount);
+		for (uint64_t i = 0; i < eventCount; i++)
+		{
+			ProfileCaptureEvent event = {};
+			event.NameIndex			  = ReadValue<uint32_t>(stream);
+			event.ThreadId			  = ReadValue<uint32_t>(stream);
+			event.Begin				  = ReadValue<uint64_t>(stream);
+			event.End				  = ReadValue<uint64_t>(stream);
+
+			if (event.NameIndex >= nameCount)
+			{
+				throw std::runtime_error("Profile capture contains an event with an invalid name");
+			}
+
+			capture.Events.push_back(event);
+		}
+
+		return capture;
+	}
+
+	Profiler::Profiler() : m_StartTicks(GetTicks()), m_StartNanoseconds(GetSteadyNanoseconds())
+	{
+	}
+
+	Profiler::~Profiler()
+	{
+		ThreadBuffer *buffer = m_Buffers.load();
+		while (buffer)
+		{
+			ThreadBuffer *next = buffer->Next;
+			delete buffer;
+			buffer = next;
+		}
+	}
+
+	void Profiler::Record(const char *name, uint64_t begin, uint64_t end)
 	{
-		ProfileResult result {.Name = name, .Time = timespan};
+		if (!m_Enabled.load(std::memory_order_relaxed))
+		{
+			return;
+		}
 
-		m_Results.push_back(result);
+		ThreadBuffer *buffer = GetThreadBuffer();
+		Push(buffer, ProfileEvent {.Name = name, .Begin = begin, .End = end, .ThreadId = buffer->ThreadId});
+	}
+
+	void Profiler::RecordGpu(const char *name, Graphics::TimingQuery &query, uint64_t submitTicks)
+	{
+		if (!m_Enabled.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		query.Resolve();
+		double	 milliseconds = query.GetElapsedMilliseconds();
+		uint64_t duration	  = (uint64_t)(milliseconds / 1000.0 * GetTicksPerSecond());
+
+		Push(GetThreadBuffer(), ProfileEvent {.Name = name, .Begin = submitTicks, .End = submitTicks + duration, .ThreadId = c_GpuThreadId});
+	}
+
+	void Profiler::Flush()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		size_t firstNewEvent = m_Events.size();
+		for (ThreadBuffer *buffer = m_Buffers.load(std::memory_order_acquire); buffer; buffer = buffer->Next)
+		{
+			uint64_t tail = buffer->Tail.load(std::memory_order_relaxed);
+			uint64_t head = buffer->Head.load(std::memory_order_acquire);
+
+			for (uint64_t i = tail; i < head; i++) { m_Events.push_back(buffer->Events[i % c_ThreadBufferCapacity]); }
+
+			// publishing the new tail hands the slots back to the thread that owns the buffer
+			buffer->Tail.store(head, std::memory_order_release);
+		}
+
+		double nanosecondsPerTick = 1'000'000'000.0 / GetTicksPerSecond();
+		for (size_t i = firstNewEvent; i < m_Events.size(); i++)
+		{
+			const ProfileEvent &event	= m_Events[i];
+			uint64_t			elapsed = (uint64_t)((double)(event.End - event.Begin) * nanosecondsPerTick);
+			m_Results.push_back(ProfileResult {.Name = event.Name, .Time = TimeSpan::FromNanoseconds(elapsed)});
+		}
+	}
+
+	const std::vector<ProfileEvent> &Profiler::GetEvents() const
+	{
+		return m_Events;
 	}
 
 	const std::vector<ProfileResult> &Profiler::GetResults() const
@@ -14,15 +267,144 @@ namespace Nexus::Timings
 		return m_Results;
 	}
 
+	uint64_t Profiler::GetDroppedEventCount() const
+	{
+		uint64_t dropped = 0;
+		for (ThreadBuffer *buffer = m_Buffers.load(std::memory_order_acquire); buffer; buffer = buffer->Next)
+		{
+			dropped += buffer->Dropped.load(std::memory_order_relaxed);
+		}
+		return dropped;
+	}
+
+	size_t Profiler::GetThreadBufferCount() const
+	{
+		size_t count = 0;
+		for (ThreadBuffer *buffer = m_Buffers.load(std::memory_order_acquire); buffer; buffer = buffer->Next) { count++; }
+		return count;
+	}
+
 	void Profiler::Reset()
 	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_Events.clear();
 		m_Results.clear();
 	}
 
+	ProfileCapture Profiler::CreateCapture() const
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		ProfileCapture capture = {};
+		capture.TicksPerSecond = GetTicksPerSecond();
+		capture.StartTicks	   = m_StartTicks;
+		capture.Events.reserve(m_Events.size());
+
+		// the same name can be stored at different addresses in different translation units, so names are matched by their contents
+		std::unordered_map<std::string_view, uint32_t> nameIndices = {};
+		for (const ProfileEvent &event : m_Events)
+		{
+			std::string_view name = event.Name ? event.Name : "";
+			auto [it, inserted]	  = nameIndices.try_emplace(name, (uint32_t)capture.Names.size());
+			if (inserted)
+			{
+				capture.Names.emplace_back(name);
+			}
+
+			capture.Events.push_back(
+				ProfileCaptureEvent {.NameIndex = it->second, .ThreadId = event.ThreadId, .Begin = event.Begin, .End = event.End});
+		}
+
+		return capture;
+	}
+
+	double Profiler::GetTicksPerSecond() const
+	{
+#if defined(NX_PROFILER_USE_TSC)
+		// the rate is measured over the lifetime of the profiler, waiting briefly if it was only just created so that the estimate is usable
+		uint64_t ticks		 = 0;
+		uint64_t nanoseconds = 0;
+		do {
+			ticks		= GetTicks() - m_StartTicks;
+			nanoseconds = GetSteadyNanoseconds() - m_StartNanoseconds;
+		} while (nanoseconds < 1'000'000);
+
+		return (double)ticks * 1'000'000'000.0 / (double)nanoseconds;
+#else
+		return 1'000'000'000.0;
+#endif
+	}
+
+	void Profiler::SetEnabled(bool enabled)
+	{
+		m_Enabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	bool Profiler::IsEnabled() const
+	{
+		return m_Enabled.load(std::memory_order_relaxed);
+	}
+
 	Profiler &Profiler::Get()
 	{
 		static Profiler profiler = {};
 		return profiler;
 	}
 
-}	 // namespace Nexus::Timings
\ No newline at end of file
+	Profiler::ThreadBuffer *Profiler::GetThreadBuffer()
+	{
+		thread_local ThreadBuffer *t_Buffer = nullptr;
+		if (t_Buffer)
+		{
+			return t_Buffer;
+		}
+
+		// the owner is only created on this path, so that recording does not pay for checking whether it has been initialised
+		thread_local ThreadBufferOwner t_Owner = {};
+
+		// a buffer left behind by a thread that has exited is reused once Flush has taken everything that was recorded into it
+		for (ThreadBuffer *buffer = m_Buffers.load(std::memory_order_acquire); buffer; buffer = buffer->Next)
+		{
+			bool retired = true;
+			if (buffer->Retired.load(std::memory_order_acquire) &&
+				buffer->Tail.load(std::memory_order_acquire) == buffer->Head.load(std::memory_order_relaxed) &&
+				buffer->Retired.compare_exchange_strong(retired, false, std::memory_order_acquire, std::memory_order_relaxed))
+			{
+				t_Buffer		   = buffer;
+				t_Buffer->ThreadId = m_NextThreadId.fetch_add(1, std::memory_order_relaxed);
+				t_Owner.Buffer	   = t_Buffer;
+				return t_Buffer;
+			}
+		}
+
+		t_Buffer		   = new ThreadBuffer();
+		t_Buffer->ThreadId = m_NextThreadId.fetch_add(1, std::memory_order_relaxed);
+		t_Owner.Buffer	   = t_Buffer;
+
+		// buffers are only ever added to the front of the list, so the list can be walked by Flush while other threads register
+		ThreadBuffer *head = m_Buffers.load(std::memory_order_relaxed);
+		do {
+			t_Buffer->Next = head;
+		} while (!m_Buffers.compare_exchange_weak(head, t_Buffer, std::memory_order_release, std::memory_order_relaxed));
+
+		return t_Buffer;
+	}
+
+	void Profiler::Push(ThreadBuffer *buffer, const ProfileEvent &event)
+	{
+		uint64_t head = buffer->Head.load(std::memory_order_relaxed);
+
+		if (head - buffer->CachedTail >= c_ThreadBufferCapacity)
+		{
+			buffer->CachedTail = buffer->Tail.load(std::memory_order_acquire);
+			if (head - buffer->CachedTail >= c_ThreadBufferCapacity)
+			{
+				buffer->Dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+		}
+
+		buffer->Events[head % c_ThreadBufferCapacity] = event;
+		buffer->Head.store(head + 1, std::memory_order_release);
+	}
+}	 // namespace Nexus::Timings
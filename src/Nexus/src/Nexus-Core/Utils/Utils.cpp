@@ -1,6 +1,7 @@
 #include "Nexus-Core/Utils/Utils.hpp"
 
 #include "Nexus-Core/Graphics/GraphicsDevice.hpp"
+#include "Nexus-Core/Graphics/PixelConversion.hpp"
 
 namespace Nexus::Utils
 {
@@ -41,82 +42,113 @@ namespace Nexus::Utils
 		return num / den;
 	}
 
-	void Clip(std::vector<glm::vec2> &points, float x1, float y1, float x2, float y2)
+	void Clip(std::span<const glm::vec2> input, std::vector<glm::vec2> &output, float x1, float y1, float x2, float y2, float insideSign)
 	{
-		std::vector<glm::vec2> newPoints;
+		output.clear();
 
-		for (size_t i = 0; i < points.size(); i++)
+		for (size_t i = 0; i < input.size(); i++)
 		{
-			size_t	  k	 = (i + 1) % points.size();
-			glm::vec2 pi = points[i];
-			glm::vec2 pk = points[k];
+			size_t	  k	 = (i + 1) % input.size();
+			glm::vec2 pi = input[i];
+			glm::vec2 pk = input[k];
 
-			float i_pos = (x2 - x1) * (pi.y - y1) - (y2 - y1) * (pi.x - x1);
-			float k_pos = (x2 - x1) * (pk.y - y1) - (y2 - y1) * (pk.x - x1);
+			float i_pos = ((x2 - x1) * (pi.y - y1) - (y2 - y1) * (pi.x - x1)) * insideSign;
+			float k_pos = ((x2 - x1) * (pk.y - y1) - (y2 - y1) * (pk.x - x1)) * insideSign;
 
 			if (i_pos < 0 && k_pos < 0)
 			{
-				newPoints.push_back(pk);
+				output.push_back(pk);
 			}
 			else if (i_pos >= 0 && k_pos < 0)
 			{
 				float newX = XIntersect(x1, y1, x2, y2, pi.x, pi.y, pk.x, pk.y);
 				float newY = YIntersect(x1, y1, x2, y2, pi.x, pi.y, pk.x, pk.y);
 
-				newPoints.push_back(glm::vec2(newX, newY));
-				newPoints.push_back(pk);
+				output.push_back(glm::vec2(newX, newY));
+				output.push_back(pk);
 			}
 			else if (i_pos < 0 && k_pos >= 0)
 			{
 				float newX = XIntersect(x1, y1, x2, y2, pi.x, pi.y, pk.x, pk.y);
 				float newY = YIntersect(x1, y1, x2, y2, pi.x, pi.y, pk.x, pk.y);
 
-				newPoints.push_back(glm::vec2(newX, newY));
+				output.push_back(glm::vec2(newX, newY));
 			}
 		}
-
-		points = newPoints;
 	}
 
-	std::vector<glm::vec2> SutherlandHodgman(const std::vector<glm::vec2> &subjectPolygon, const std::vector<glm::vec2> &clipPolygon)
+	/// @brief The largest number of points that the thread's clipping scratch buffer keeps its storage for between calls
+	constexpr size_t c_MaxRetainedClipPoints = 4096;
+
+	void Clip(std::vector<glm::vec2> &points, float x1, float y1, float x2, float y2)
 	{
-		assert(subjectPolygon.size() >= 3 && "The subject polygon must have at least 3 points");
-		assert(clipPolygon.size() >= 3 && "The clipping polygon must have at least 3 points");
+		// the scratch buffer is swapped with the caller's storage, so both allocations are reused by subsequent calls on this thread
+		thread_local std::vector<glm::vec2> scratch;
+		Clip(points, scratch, x1, y1, x2, y2, 1.0f);
+		points.swap(scratch);
+
+		// a single large polygon would otherwise pin its storage for the lifetime of the thread
+		if (scratch.capacity() > c_MaxRetainedClipPoints)
+		{
+			scratch.clear();
+			scratch.shrink_to_fit();
+		}
+	}
 
-		std::vector<glm::vec2> poly(subjectPolygon);
-		std::vector<glm::vec2> clip(clipPolygon);
+	float FindSignedPolygonArea(std::span<const glm::vec2> polygon)
+	{
+		float totalArea = 0.0f;
 
-		Graphics::Triangle2D subjectTri;
-		subjectTri.A = poly[0];
-		subjectTri.B = poly[1];
-		subjectTri.C = poly[2];
+		for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++)
+		{
+			totalArea += (polygon[j].x * polygon[i].y) - (polygon[i].x * polygon[j].y);
+		}
 
-		Graphics::Triangle2D clipTri;
-		clipTri.A = clip[0];
-		clipTri.B = clip[1];
-		clipTri.C = clip[2];
+		return totalArea * 0.5f;
+	}
 
-		Graphics::WindingOrder subjectWindingOrder = subjectTri.GetWindingOrder();
-		Graphics::WindingOrder clipWindingOrder	   = clipTri.GetWindingOrder();
+	void SutherlandHodgman(std::span<const glm::vec2> subjectPolygon,
+						   std::span<const glm::vec2> clipPolygon,
+						   std::vector<glm::vec2>	  &output,
+						   std::vector<glm::vec2>	  &scratch)
+	{
+		assert(subjectPolygon.size() >= 3 && "The subject polygon must have at least 3 points");
+		assert(clipPolygon.size() >= 3 && "The clipping polygon must have at least 3 points");
 
-		if (subjectWindingOrder == Graphics::WindingOrder::CounterClockwise)
+		// the output is always produced with a clockwise winding order, so a counter-clockwise subject is copied in reverse
+		output.clear();
+		if (FindSignedPolygonArea(subjectPolygon) > 0.0f)
 		{
-			poly = ReverseWindingOrder(poly);
+			output.insert(output.end(), subjectPolygon.rbegin(), subjectPolygon.rend());
 		}
-
-		if (clipWindingOrder == Graphics::WindingOrder::CounterClockwise)
+		else
 		{
-			clip = ReverseWindingOrder(clipPolygon);
+			output.insert(output.end(), subjectPolygon.begin(), subjectPolygon.end());
 		}
 
-		for (size_t i = 0; i < clip.size(); i++)
+		// rather than reversing a counter-clockwise clip polygon, flip the side of each edge that is considered inside
+		float insideSign = FindSignedPolygonArea(clipPolygon) > 0.0f ? -1.0f : 1.0f;
+
+		for (size_t i = 0; i < clipPolygon.size() && !output.empty(); i++)
 		{
-			size_t k = (i + 1) % clip.size();
+			size_t k = (i + 1) % clipPolygon.size();
 
-			Clip(poly, clip[i].x, clip[i].y, clip[k].x, clip[k].y);
+			Clip(output, scratch, clipPolygon[i].x, clipPolygon[i].y, clipPolygon[k].x, clipPolygon[k].y, insideSign);
+			output.swap(scratch);
 		}
+	}
 
-		return poly;
+	std::vector<glm::vec2> SutherlandHodgman(const std::vector<glm::vec2> &subjectPolygon, const std::vector<glm::vec2> &clipPolygon)
+	{
+		std::vector<glm::vec2> output;
+		std::vector<glm::vec2> scratch;
+
+		// every clip edge can add at most one extra vertex
+		output.reserve(subjectPolygon.size() + clipPolygon.size());
+		scratch.reserve(subjectPolygon.size() + clipPolygon.size());
+
+		SutherlandHodgman(subjectPolygon, clipPolygon, output, scratch);
+		return output;
 	}
 
 	NX_API Nexus::Graphics::Polygon SutherlandHodgman(const Nexus::Graphics::Polygon &subject, const Nexus::Graphics::Polygon &clip)
@@ -170,62 +202,343 @@ namespace Nexus::Utils
 		return true;
 	}
 
-	bool Triangulate(const std::vector<glm::vec2> &polygon, std::vector<uint32_t> &triangles)
+	/// @brief A vertex in the doubly linked list used by the ear clipper, the polygon is walked through Prev/Next and the z-order index
+	/// through PrevZ/NextZ
+	struct TriangulationNode
+	{
+		glm::vec2 Position = {};
+		uint32_t  Index	   = 0;
+		uint32_t  Z		   = 0;
+		uint32_t  Prev	   = 0;
+		uint32_t  Next	   = 0;
+		uint32_t  PrevZ	   = UINT32_MAX;
+		uint32_t  NextZ	   = UINT32_MAX;
+	};
+
+	/// @brief Polygons with fewer vertices than this are cheaper to clip by scanning the remaining reflex vertices than by building the
+	/// z-order index
+	constexpr size_t c_TriangulationHashThreshold = 80;
+
+	/// @brief Returns twice the signed area of the triangle, positive when the triangle is counter-clockwise
+	inline float SignedTriangleArea(const glm::vec2 &a, const glm::vec2 &b, const glm::vec2 &c)
+	{
+		return Cross(b - a, c - a);
+	}
+
+	inline bool IsPointInCounterClockwiseTriangle(const glm::vec2 &a, const glm::vec2 &b, const glm::vec2 &c, const glm::vec2 &p)
+	{
+		return SignedTriangleArea(a, b, p) >= 0.0f && SignedTriangleArea(b, c, p) >= 0.0f && SignedTriangleArea(c, a, p) >= 0.0f;
+	}
+
+	/// @brief Interleaves the bits of two 15-bit coordinates to produce a morton code
+	inline uint32_t CalculateZOrder(float x, float y, const glm::vec2 &min, float invSize)
 	{
-		std::vector<uint32_t> indexList;
-		for (size_t i = 0; i < polygon.size(); i++) { indexList.push_back(i); }
+		uint32_t ix = static_cast<uint32_t>((x - min.x) * invSize);
+		uint32_t iy = static_cast<uint32_t>((y - min.y) * invSize);
+
+		ix = (ix | (ix << 8)) & 0x00FF00FF;
+		ix = (ix | (ix << 4)) & 0x0F0F0F0F;
+		ix = (ix | (ix << 2)) & 0x33333333;
+		ix = (ix | (ix << 1)) & 0x55555555;
+
+		iy = (iy | (iy << 8)) & 0x00FF00FF;
+		iy = (iy | (iy << 4)) & 0x0F0F0F0F;
+		iy = (iy | (iy << 2)) & 0x33333333;
+		iy = (iy | (iy << 1)) & 0x55555555;
 
-		while (indexList.size() > 3)
+		return ix | (iy << 1);
+	}
+
+	class EarClipper
+	{
+	  public:
+		EarClipper(std::span<const glm::vec2> polygon, std::vector<uint32_t> &triangles) : m_Triangles(triangles)
 		{
-			for (size_t i = 0; i < indexList.size(); i++)
+			const uint32_t count = static_cast<uint32_t>(polygon.size());
+			m_Nodes.resize(count);
+
+			// the list is always linked counter-clockwise so that a convex corner has a positive area regardless of the input winding
+			bool reverse = FindSignedPolygonArea(polygon) < 0.0f;
+			m_Reversed	 = reverse;
+
+			for (uint32_t i = 0; i < count; i++)
 			{
-				uint32_t a = GetItem<uint32_t>(indexList, i);
-				uint32_t b = GetItem<uint32_t>(indexList, i - 1);
-				uint32_t c = GetItem<uint32_t>(indexList, i + 1);
+				uint32_t		   index = reverse ? count - 1 - i : i;
+				TriangulationNode &node	 = m_Nodes[i];
+				node.Position			 = polygon[index];
+				node.Index				 = index;
+				node.Prev				 = (i + count - 1) % count;
+				node.Next				 = (i + 1) % count;
+			}
 
-				Graphics::Triangle2D tri;
-				tri.A = polygon[a];
-				tri.B = polygon[b];
-				tri.C = polygon[c];
+			m_Remaining = count;
+			m_Triangles.reserve(m_Triangles.size() + (count - 2) * 3);
 
-				bool isEar = true;
+			if (count >= c_TriangulationHashThreshold)
+			{
+				BuildZOrderIndex();
+			}
+		}
+
+		bool Run()
+		{
+			uint32_t ear = FilterPoints(0, UINT32_MAX);
+
+			// pass 0 clips valid ears, pass 1 clips ears after removing degenerate vertices, pass 2 clips any convex corner so that
+			// self-intersecting input still terminates
+			uint32_t pass = 0;
+			uint32_t stop = ear;
+
+			while (m_Remaining > 3)
+			{
+				uint32_t prev = m_Nodes[ear].Prev;
+				uint32_t next = m_Nodes[ear].Next;
+
+				if (IsEar(ear, pass == 2))
+				{
+					EmitTriangle(prev, ear, next);
+					RemoveNode(ear);
+
+					// skipping the next vertex leads to fewer sliver triangles
+					ear	 = m_Nodes[next].Next;
+					stop = ear;
+					continue;
+				}
+
+				ear = next;
 
-				for (size_t j = 0; j < polygon.size(); j++)
+				if (ear == stop)
 				{
-					if (j == a || j == b || j == c)
+					if (pass == 2)
 					{
-						continue;
+						return false;
 					}
 
-					glm::vec2 p = polygon[j];
+					pass++;
+					ear	 = FilterPoints(ear, UINT32_MAX);
+					stop = ear;
+				}
+			}
+
+			if (m_Remaining == 3)
+			{
+				EmitTriangle(m_Nodes[ear].Prev, ear, m_Nodes[ear].Next);
+			}
+
+			return true;
+		}
+
+	  private:
+		void BuildZOrderIndex()
+		{
+			glm::vec2 min = m_Nodes[0].Position;
+			glm::vec2 max = m_Nodes[0].Position;
+
+			for (const TriangulationNode &node : m_Nodes)
+			{
+				min = glm::min(min, node.Position);
+				max = glm::max(max, node.Position);
+			}
+
+			float size = glm::max(max.x - min.x, max.y - min.y);
+			m_Min	   = min;
+			m_InvSize  = size > 0.0f ? 32767.0f / size : 0.0f;
+
+			std::vector<uint32_t> order(m_Nodes.size());
+			for (uint32_t i = 0; i < order.size(); i++)
+			{
+				order[i]	  = i;
+				m_Nodes[i].Z = CalculateZOrder(m_Nodes[i].Position.x, m_Nodes[i].Position.y, m_Min, m_InvSize);
+			}
+
+			std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return m_Nodes[a].Z < m_Nodes[b].Z; });
+
+			for (size_t i = 0; i < order.size(); i++)
+			{
+				m_Nodes[order[i]].PrevZ = i > 0 ? order[i - 1] : UINT32_MAX;
+				m_Nodes[order[i]].NextZ = i + 1 < order.size() ? order[i + 1] : UINT32_MAX;
+			}
+
+			m_Hashed = true;
+		}
+
+		void EmitTriangle(uint32_t a, uint32_t b, uint32_t c)
+		{
+			// triangles are emitted as (ear, previous, next) in terms of the input order, so undo the reversal of the list
+			if (m_Reversed)
+			{
+				std::swap(a, c);
+			}
+
+			m_Triangles.push_back(m_Nodes[b].Index);
+			m_Triangles.push_back(m_Nodes[a].Index);
+			m_Triangles.push_back(m_Nodes[c].Index);
+		}
+
+		void RemoveNode(uint32_t node)
+		{
+			TriangulationNode &n = m_Nodes[node];
+			m_Nodes[n.Prev].Next = n.Next;
+			m_Nodes[n.Next].Prev = n.Prev;
+
+			if (n.PrevZ != UINT32_MAX)
+			{
+				m_Nodes[n.PrevZ].NextZ = n.NextZ;
+			}
+
+			if (n.NextZ != UINT32_MAX)
+			{
+				m_Nodes[n.NextZ].PrevZ = n.PrevZ;
+			}
+
+			m_Remaining--;
+		}
+
+		/// @brief Removes duplicate and collinear vertices between start and end, returning a node that is still in the list
+		uint32_t FilterPoints(uint32_t start, uint32_t end)
+		{
+			if (end == UINT32_MAX)
+			{
+				end = start;
+			}
+
+			uint32_t node = start;
+			bool	 again;
 
-					if (tri.Contains(p))
+			do {
+				again = false;
+
+				const TriangulationNode &n = m_Nodes[node];
+				if (m_Remaining > 3 &&
+					(n.Position == m_Nodes[n.Next].Position ||
+					 SignedTriangleArea(m_Nodes[n.Prev].Position, n.Position, m_Nodes[n.Next].Position) == 0.0f))
+				{
+					uint32_t prev = n.Prev;
+					RemoveNode(node);
+					node = end = prev;
+
+					if (node == m_Nodes[node].Next)
 					{
-						isEar = false;
 						break;
 					}
+
+					again = true;
+				}
+				else
+				{
+					node = n.Next;
 				}
+			} while (again || node != end);
+
+			return end;
+		}
+
+		bool IsEar(uint32_t ear, bool force) const
+		{
+			const TriangulationNode &b = m_Nodes[ear];
+			const glm::vec2			&a = m_Nodes[b.Prev].Position;
+			const glm::vec2			&c = m_Nodes[b.Next].Position;
+
+			// reflex corners can never be ears
+			if (SignedTriangleArea(a, b.Position, c) <= 0.0f)
+			{
+				return false;
+			}
+
+			if (force)
+			{
+				return true;
+			}
+
+			return m_Hashed ? IsEarHashed(ear) : IsEarLinear(ear);
+		}
+
+		bool BlocksEar(uint32_t candidate, const TriangulationNode &ear, const glm::vec2 &a, const glm::vec2 &c) const
+		{
+			if (candidate == ear.Prev || candidate == ear.Next || &m_Nodes[candidate] == &ear)
+			{
+				return false;
+			}
 
-				if (isEar)
+			// only reflex vertices can lie inside the ear of a simple polygon
+			const TriangulationNode &p = m_Nodes[candidate];
+			return IsPointInCounterClockwiseTriangle(a, ear.Position, c, p.Position) &&
+				   SignedTriangleArea(m_Nodes[p.Prev].Position, p.Position, m_Nodes[p.Next].Position) <= 0.0f;
+		}
+
+		bool IsEarLinear(uint32_t ear) const
+		{
+			const TriangulationNode &b = m_Nodes[ear];
+			const glm::vec2			&a = m_Nodes[b.Prev].Position;
+			const glm::vec2			&c = m_Nodes[b.Next].Position;
+
+			for (uint32_t node = m_Nodes[b.Next].Next; node != b.Prev; node = m_Nodes[node].Next)
+			{
+				if (BlocksEar(node, b, a, c))
 				{
-					triangles.push_back(a);
-					triangles.push_back(b);
-					triangles.push_back(c);
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool IsEarHashed(uint32_t ear) const
+		{
+			const TriangulationNode &b = m_Nodes[ear];
+			const glm::vec2			&a = m_Nodes[b.Prev].Position;
+			const glm::vec2			&c = m_Nodes[b.Next].Position;
 
-					indexList.erase(indexList.begin() + i);
-					break;
+			glm::vec2 min = glm::min(a, glm::min(b.Position, c));
+			glm::vec2 max = glm::max(a, glm::max(b.Position, c));
+
+			uint32_t minZ = CalculateZOrder(min.x, min.y, m_Min, m_InvSize);
+			uint32_t maxZ = CalculateZOrder(max.x, max.y, m_Min, m_InvSize);
+
+			// any vertex inside the triangle must have a z-order within the triangle's bounding box, so walk outwards in both directions
+			for (uint32_t node = b.PrevZ; node != UINT32_MAX && m_Nodes[node].Z >= minZ; node = m_Nodes[node].PrevZ)
+			{
+				if (BlocksEar(node, b, a, c))
+				{
+					return false;
 				}
 			}
+
+			for (uint32_t node = b.NextZ; node != UINT32_MAX && m_Nodes[node].Z <= maxZ; node = m_Nodes[node].NextZ)
+			{
+				if (BlocksEar(node, b, a, c))
+				{
+					return false;
+				}
+			}
+
+			return true;
 		}
 
-		if (triangles.empty())
+	  private:
+		std::vector<TriangulationNode> m_Nodes;
+		std::vector<uint32_t>		  &m_Triangles;
+		uint32_t					   m_Remaining = 0;
+		bool						   m_Hashed	   = false;
+		bool						   m_Reversed  = false;
+		glm::vec2					   m_Min	   = {};
+		float						   m_InvSize   = 0.0f;
+	};
+
+	bool Triangulate(const std::vector<glm::vec2> &polygon, std::vector<uint32_t> &triangles)
+	{
+		if (polygon.size() < 3)
 		{
 			return false;
 		}
 
-		triangles.push_back(indexList[0]);
-		triangles.push_back(indexList[1]);
-		triangles.push_back(indexList[2]);
+		size_t	   startIndex = triangles.size();
+		EarClipper clipper(polygon, triangles);
+
+		if (!clipper.Run() || triangles.size() == startIndex)
+		{
+			return false;
+		}
 
 		return true;
 	}
@@ -317,9 +630,24 @@ namespace Nexus::Utils
 
 		commandList->Begin();
 		commandList->CopyBufferToBuffer(bufferCopy);
+
+		Nexus::Graphics::BufferBarrierDesc barrier = {};
+		barrier.Buffer							   = vertexBuffer;
+		barrier.BeforeAccess					   = Graphics::BarrierAccess::TransferWrite;
+		barrier.AfterAccess						   = Graphics::BarrierAccess::VertexAttributeRead;
+		barrier.BeforeStage						   = Graphics::BarrierPipelineStage::Transfer;
+		barrier.AfterStage						   = Graphics::BarrierPipelineStage::VertexInput;
+		barrier.Offset							   = 0;
+		barrier.Size							   = sizeInBytes;
+		commandList->SubmitBufferBarrier(barrier);
+
 		commandList->End();
-		commandQueue->SubmitCommandLists(&commandList, 1, nullptr);
-		device->WaitForIdle();
+		commandQueue->SubmitCommandListsForFrame(&commandList, 1);
+
+		// the barrier makes the copy visible to every later submission to the queue, so the upload buffer is released once the frame has
+		// completed rather than waiting for the copy here
+		device->GetFrameTracker().DeferDeletion(uploadBuffer);
+		device->GetFrameTracker().DeferDeletion(commandList);
 
 		return vertexBuffer;
 	}	 // namespace Nexus::Utils
@@ -347,9 +675,22 @@ namespace Nexus::Utils
 
 		commandList->Begin();
 		commandList->CopyBufferToBuffer(bufferCopy);
+
+		Nexus::Graphics::BufferBarrierDesc barrier = {};
+		barrier.Buffer							   = indexBuffer;
+		barrier.BeforeAccess					   = Graphics::BarrierAccess::TransferWrite;
+		barrier.AfterAccess						   = Graphics::BarrierAccess::IndexRead;
+		barrier.BeforeStage						   = Graphics::BarrierPipelineStage::Transfer;
+		barrier.AfterStage						   = Graphics::BarrierPipelineStage::IndexInput;
+		barrier.Offset							   = 0;
+		barrier.Size							   = sizeInBytes;
+		commandList->SubmitBufferBarrier(barrier);
+
 		commandList->End();
-		commandQueue->SubmitCommandLists(&commandList, 1, nullptr);
-		device->WaitForIdle();
+		commandQueue->SubmitCommandListsForFrame(&commandList, 1);
+
+		device->GetFrameTracker().DeferDeletion(uploadBuffer);
+		device->GetFrameTracker().DeferDeletion(commandList);
 
 		return indexBuffer;
 	}
@@ -377,9 +718,22 @@ namespace Nexus::Utils
 
 		commandList->Begin();
 		commandList->CopyBufferToBuffer(bufferCopy);
+
+		Nexus::Graphics::BufferBarrierDesc barrier = {};
+		barrier.Buffer							   = uniformBuffer;
+		barrier.BeforeAccess					   = Graphics::BarrierAccess::TransferWrite;
+		barrier.AfterAccess						   = Graphics::BarrierAccess::UniformRead;
+		barrier.BeforeStage						   = Graphics::BarrierPipelineStage::Transfer;
+		barrier.AfterStage						   = Graphics::BarrierPipelineStage::AllCommands;
+		barrier.Offset							   = 0;
+		barrier.Size							   = sizeInBytes;
+		commandList->SubmitBufferBarrier(barrier);
+
 		commandList->End();
-		commandQueue->SubmitCommandLists(&commandList, 1, nullptr);
-		device->WaitForIdle();
+		commandQueue->SubmitCommandListsForFrame(&commandList, 1);
+
+		device->GetFrameTracker().DeferDeletion(uploadBuffer);
+		device->GetFrameTracker().DeferDeletion(commandList);
 
 		return uniformBuffer;
 	}
@@ -417,26 +771,7 @@ namespace Nexus::Utils
 
 	void FlipPixelsVertically(void *pixels, uint32_t width, uint32_t height, Graphics::PixelFormat format)
 	{
-		unsigned char *bufferPointer = (unsigned char *)pixels;
-
-		uint32_t bytesPerPixel	  = Graphics::GetPixelFormatSizeInBytes(format);
-		uint32_t channelsPerPixel = Graphics::GetPixelFormatNumberOfChannels(format);
-		uint32_t bytesPerChannel  = bytesPerPixel / channelsPerPixel;
-
-		for (uint32_t j = 0; j < height / 2; ++j)
-		{
-			for (uint32_t i = 0; i < width; ++i)
-			{
-				for (uint32_t k = 0; k < channelsPerPixel; ++k)
-				{
-					for (uint32_t b = 0; b < bytesPerChannel; ++b)
-					{
-						std::swap(*(bufferPointer + (j * width * bytesPerPixel + i * bytesPerPixel + k * bytesPerChannel + b)),
-								  *(bufferPointer + ((height - 1 - j) * width * bytesPerPixel + i * bytesPerPixel + k * bytesPerChannel + b)));
-					}
-				}
-			}
-		}
+		Graphics::FlipRows(pixels, (size_t)width * Graphics::GetPixelFormatSizeInBytes(format), height);
 	}
 
 }	 // namespace Nexus::Utils
\ No newline at end of file
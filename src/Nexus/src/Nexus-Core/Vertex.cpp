@@ -1,5 +1,7 @@
 #include "Nexus-Core/Vertex.hpp"
 
+#include "Nexus-Core/Graphics/Model.hpp"
+
 namespace Nexus::Graphics
 {
 	VertexBufferElement::VertexBufferElement(ShaderDataType type, const std::string &name)
@@ -53,6 +55,8 @@ namespace Nexus::Graphics
 			case ShaderDataType::R16_UNorm: return 1; break;
 			case ShaderDataType::R16G16_UNorm: return 1 * 2; break;
 			case ShaderDataType::R16G16B16A16_UNorm: return 1 * 4; break;
+			case ShaderDataType::A2B10G10R10_UInt: return 4; break;
+			case ShaderDataType::A2B10G10R10_UNorm: return 4; break;
 			default: return 0; break;
 		}
 	}
@@ -84,49 +88,196 @@ namespace Nexus::Graphics
 		return validIndex;
 	}
 
-	std::vector<VertexPositionTexCoordNormalTangentBitangent> Utilities::GenerateTangentAndBinormals(
-		const std::vector<VertexPositionTexCoordNormal> &vertices)
+	/// @brief Meshes with fewer triangles or vertices than this are processed on the calling thread
+	static constexpr size_t c_TangentChunkSize = 16384;
+
+	/// @brief Splits a range into contiguous chunks and runs them across threads, the calling thread runs the first chunk itself
+	template<typename Func>
+	static void ForEachChunk(size_t count, uint32_t maxThreads, Func &&func)
 	{
-		if (vertices.size() % 3 != 0)
+		uint32_t threadCount = maxThreads > 0 ? maxThreads : std::max(std::thread::hardware_concurrency(), 1u);
+		size_t	 chunkCount	 = std::min<size_t>(threadCount, (count + c_TangentChunkSize - 1) / c_TangentChunkSize);
+
+		if (chunkCount <= 1)
 		{
-			throw std::runtime_error("Attempting to generate normals from a mesh not made of triangles");
+			func(0, count);
+			return;
 		}
 
-		std::vector<VertexPositionTexCoordNormalTangentBitangent> output;
+		size_t						   chunkSize = (count + chunkCount - 1) / chunkCount;
+		std::vector<std::future<void>> tasks	 = {};
+		for (size_t chunk = 1; chunk < chunkCount; chunk++)
+		{
+			size_t begin = std::min(chunk * chunkSize, count);
+			size_t end	 = std::min(begin + chunkSize, count);
+			tasks.push_back(std::async(std::launch::async, [&func, begin, end]() { func(begin, end); }));
+		}
 
-		for (int i = 0; i < vertices.size(); i += 3)
+		func(0, std::min(chunkSize, count));
+		for (std::future<void> &task : tasks) { task.get(); }
+	}
+
+	/// @brief Returns the angle between two edges leaving the same corner of a triangle
+	static float GetCornerAngle(const glm::vec3 &edge1, const glm::vec3 &edge2)
+	{
+		float lengths = glm::length(edge1) * glm::length(edge2);
+		if (lengths <= 0.0f)
 		{
-			glm::vec3 pos1 = vertices[i + 0].Position;
-			glm::vec3 pos2 = vertices[i + 1].Position;
-			glm::vec3 pos3 = vertices[i + 2].Position;
+			return 0.0f;
+		}
+
+		return std::acos(glm::clamp(glm::dot(edge1, edge2) / lengths, -1.0f, 1.0f));
+	}
+
+	/// @brief Removes the part of a vector that points along a normal and normalises the result
+	static glm::vec3 ProjectOntoPlane(const glm::vec3 &vector, const glm::vec3 &normal)
+	{
+		glm::vec3 projected = vector - normal * glm::dot(normal, vector);
+		float	  length	= glm::length(projected);
+		return length > 0.0f ? projected / length : glm::vec3(0.0f);
+	}
+
+	template<typename TVertex>
+	static void GenerateIndexedTangents(std::span<TVertex> vertices, std::span<const uint32_t> indices, uint32_t maxThreads)
+	{
+		if (indices.size() % 3 != 0)
+		{
+			throw std::runtime_error("Attempting to generate tangents from a mesh not made of triangles");
+		}
+
+		for (uint32_t index : indices)
+		{
+			if (index >= vertices.size())
+			{
+				throw std::runtime_error("Attempting to generate tangents from a mesh with an index outside of its vertices");
+			}
+		}
+
+		// each corner of each triangle stores its weighted contribution, so the triangles can be processed in parallel without two
+		// threads ever writing to the same vertex
+		std::vector<glm::vec3> cornerTangents(indices.size());
+		std::vector<glm::vec3> cornerBitangents(indices.size());
 
-			glm::vec2 uv1 = vertices[i + 0].TexCoords;
-			glm::vec2 uv2 = vertices[i + 1].TexCoords;
-			glm::vec2 uv3 = vertices[i + 2].TexCoords;
+		ForEachChunk(indices.size() / 3,
+					 maxThreads,
+					 [&](size_t begin, size_t end)
+					 {
+						 for (size_t triangle = begin; triangle < end; triangle++)
+						 {
+							 const TVertex *corners[3] = {&vertices[indices[triangle * 3 + 0]],
+														  &vertices[indices[triangle * 3 + 1]],
+														  &vertices[indices[triangle * 3 + 2]]};
 
-			glm::vec3 normal1 = vertices[i + 0].Normal;
-			glm::vec3 normal2 = vertices[i + 1].Normal;
-			glm::vec3 normal3 = vertices[i + 2].Normal;
+							 glm::vec3 deltaPos1 = corners[1]->Position - corners[0]->Position;
+							 glm::vec3 deltaPos2 = corners[2]->Position - corners[0]->Position;
+							 glm::vec2 deltaUV1	 = corners[1]->TexCoords - corners[0]->TexCoords;
+							 glm::vec2 deltaUV2	 = corners[2]->TexCoords - corners[0]->TexCoords;
 
-			glm::vec3 deltaPos1 = pos2 - pos1;
-			glm::vec3 deltaPos2 = pos3 - pos2;
+							 // triangles without a usable texture mapping do not contribute, their corners keep a zero weight
+							 float determinant = deltaUV1.x * deltaUV2.y - deltaUV1.y * deltaUV2.x;
+							 if (std::abs(determinant) <= std::numeric_limits<float>::epsilon() * 1e-3f)
+							 {
+								 continue;
+							 }
 
-			glm::vec2 deltaUV1 = uv2 - uv1;
-			glm::vec2 deltaUV2 = uv3 - uv1;
+							 float	   r		 = 1.0f / determinant;
+							 glm::vec3 tangent	 = (deltaPos1 * deltaUV2.y - deltaPos2 * deltaUV1.y) * r;
+							 glm::vec3 bitangent = (deltaPos2 * deltaUV1.x - deltaPos1 * deltaUV2.x) * r;
 
-			float	  r			= 1.0f / (deltaUV1.x * deltaUV2.y - deltaUV1.y * deltaUV2.x);
-			glm::vec3 tangent	= (deltaPos1 * deltaUV2.y - deltaPos2 * deltaUV1.y) * r;
-			glm::vec3 bitangent = (deltaPos2 * deltaUV1.x - deltaPos1 * deltaUV2.x) * r;
+							 for (size_t corner = 0; corner < 3; corner++)
+							 {
+								 const glm::vec3 &position = corners[corner]->Position;
+								 const glm::vec3 &next	   = corners[(corner + 1) % 3]->Position;
+								 const glm::vec3 &previous = corners[(corner + 2) % 3]->Position;
+								 glm::vec3		  normal   = corners[corner]->Normal;
 
-			VertexPositionTexCoordNormalTangentBitangent v1(pos1, uv1, normal1, tangent, bitangent);
-			VertexPositionTexCoordNormalTangentBitangent v2(pos2, uv2, normal2, tangent, bitangent);
-			VertexPositionTexCoordNormalTangentBitangent v3(pos3, uv3, normal3, tangent, bitangent);
+								 float weight							 = GetCornerAngle(next - position, previous - position);
+								 cornerTangents[triangle * 3 + corner]	 = ProjectOntoPlane(tangent, normal) * weight;
+								 cornerBitangents[triangle * 3 + corner] = ProjectOntoPlane(bitangent, normal) * weight;
+							 }
+						 }
+					 });
 
-			output.push_back(v1);
-			output.push_back(v2);
-			output.push_back(v3);
+		// group the corners by the vertex that they use, so that each vertex can sum its corners independently
+		std::vector<uint32_t> cornerOffsets(vertices.size() + 1, 0);
+		for (uint32_t index : indices) { cornerOffsets[index + 1]++; }
+		for (size_t i = 1; i < cornerOffsets.size(); i++) { cornerOffsets[i] += cornerOffsets[i - 1]; }
+
+		std::vector<uint32_t> vertexCorners(indices.size());
+		std::vector<uint32_t> cursors(cornerOffsets.begin(), cornerOffsets.end() - 1);
+		for (uint32_t corner = 0; corner < indices.size(); corner++) { vertexCorners[cursors[indices[corner]]++] = corner; }
+
+		ForEachChunk(vertices.size(),
+					 maxThreads,
+					 [&](size_t begin, size_t end)
+					 {
+						 for (size_t i = begin; i < end; i++)
+						 {
+							 glm::vec3 tangent	 = glm::vec3(0.0f);
+							 glm::vec3 bitangent = glm::vec3(0.0f);
+							 for (uint32_t c = cornerOffsets[i]; c < cornerOffsets[i + 1]; c++)
+							 {
+								 tangent += cornerTangents[vertexCorners[c]];
+								 bitangent += cornerBitangents[vertexCorners[c]];
+							 }
+
+							 TVertex  &vertex = vertices[i];
+							 glm::vec3 normal = glm::length(vertex.Normal) > 0.0f ? glm::normalize(vertex.Normal) : glm::vec3(0.0f, 0.0f, 1.0f);
+							 tangent		  = ProjectOntoPlane(tangent, normal);
+
+							 // vertices that are not used by any mapped triangle still need a valid frame, so any direction along the surface is used
+							 if (tangent == glm::vec3(0.0f))
+							 {
+								 glm::vec3 axis = std::abs(normal.x) < 0.9f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+								 tangent		= ProjectOntoPlane(axis, normal);
+							 }
+
+							 // the bitangent only decides the handedness, its direction is always perpendicular to the normal and tangent
+							 float handedness = glm::dot(glm::cross(normal, tangent), bitangent) < 0.0f ? -1.0f : 1.0f;
+							 vertex.Tangent	  = tangent;
+							 vertex.Bitangent = glm::cross(normal, tangent) * handedness;
+						 }
+					 });
+	}
+
+	std::vector<VertexPositionTexCoordNormalTangentBitangent> Utilities::GenerateTangentAndBinormals(
+		const std::vector<VertexPositionTexCoordNormal> &vertices)
+	{
+		if (vertices.size() % 3 != 0)
+		{
+			throw std::runtime_error("Attempting to generate normals from a mesh not made of triangles");
 		}
 
+		std::vector<uint32_t> indices(vertices.size());
+		std::iota(indices.begin(), indices.end(), 0);
+		return GenerateTangentAndBinormals(vertices, indices);
+	}
+
+	std::vector<VertexPositionTexCoordNormalTangentBitangent> Utilities::GenerateTangentAndBinormals(
+		const std::vector<VertexPositionTexCoordNormal> &vertices,
+		const std::vector<uint32_t>						&indices,
+		uint32_t										 maxThreads)
+	{
+		std::vector<VertexPositionTexCoordNormalTangentBitangent> output;
+		output.reserve(vertices.size());
+		for (const VertexPositionTexCoordNormal &vertex : vertices)
+		{
+			output.emplace_back(vertex.Position, vertex.TexCoords, vertex.Normal, glm::vec3(0.0f), glm::vec3(0.0f));
+		}
+
+		GenerateTangents(output, indices, maxThreads);
 		return output;
 	}
+
+	void Utilities::GenerateTangents(std::span<VertexPositionTexCoordNormalTangentBitangent> vertices,
+									 std::span<const uint32_t>							 indices,
+									 uint32_t											 maxThreads)
+	{
+		GenerateIndexedTangents(vertices, indices, maxThreads);
+	}
+
+	void Utilities::GenerateTangents(MeshData &mesh, uint32_t maxThreads)
+	{
+		GenerateIndexedTangents(std::span<VertexPositionTexCoordNormalColourTangentBitangent>(mesh.vertices), mesh.indices, maxThreads);
+	}
 }	 // namespace Nexus::Graphics
\ No newline at end of file
@@ -13,7 +13,7 @@
 
 namespace Nexus::Graphics
 {
-	CommandListD3D12::CommandListD3D12(GraphicsDeviceD3D12 *device, const CommandListDescription &spec) : CommandList(spec)
+	CommandListD3D12::CommandListD3D12(GraphicsDeviceD3D12 *device, const CommandListDescription &spec) : CommandList(spec), m_Device(device)
 	{
 		auto d3d12Device = device->GetD3D12Device();
 		d3d12Device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&m_CommandAllocator));
@@ -34,6 +34,8 @@ namespace Nexus::Graphics
 
 	CommandListD3D12::~CommandListD3D12()
 	{
+		// the allocator owns the memory of commands that may still be executing
+		m_Device->DeferRelease(m_CommandAllocator, m_CommandList);
 	}
 
 	Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList7> CommandListD3D12::GetCommandList()
@@ -22,6 +22,7 @@ namespace Nexus::Graphics
 		void Close();
 
 	  private:
+		GraphicsDeviceD3D12								  *m_Device			  = nullptr;
 		Microsoft::WRL::ComPtr<ID3D12CommandAllocator>	   m_CommandAllocator = nullptr;
 		Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList7> m_CommandList	  = nullptr;
 	};
@@ -64,7 +64,8 @@ namespace Nexus::Graphics
 
 	DeviceBufferD3D12::~DeviceBufferD3D12()
 	{
-		m_GraphicsDevice->WaitForIdle();
+		// a frame that is still in flight may be using the buffer, so the resource and its memory are kept until that frame has completed
+		m_GraphicsDevice->DeferRelease(m_BufferHandle, m_Allocation);
 	}
 
 	void DeviceBufferD3D12::SetData(const void *data, uint32_t offset, uint32_t size)
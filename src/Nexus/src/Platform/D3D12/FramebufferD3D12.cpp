@@ -18,7 +18,7 @@ namespace Nexus::Graphics
 
 	FramebufferD3D12::~FramebufferD3D12()
 	{
-		Flush();
+		m_Device->DeferRelease(m_ColorDescriptorHeap, m_DepthDescriptorHeap);
 	}
 
 	void FramebufferD3D12::SetFramebufferSpecification(const FramebufferSpecification &spec)
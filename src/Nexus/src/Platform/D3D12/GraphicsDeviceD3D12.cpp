@@ -52,6 +52,9 @@ namespace Nexus::Graphics
 
 	GraphicsDeviceD3D12::~GraphicsDeviceD3D12()
 	{
+		// the pooled readback buffers defer their deletion to the frame tracker, so they are released before it is flushed
+		m_ReadbackBufferPool.Flush();
+		m_FrameTracker.Flush();
 	}
 
 	const std::string GraphicsDeviceD3D12::GetAPIName()
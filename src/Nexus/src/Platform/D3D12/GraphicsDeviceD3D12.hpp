@@ -73,6 +73,13 @@ namespace Nexus::Graphics
 		Microsoft::WRL::ComPtr<IDXGIFactory7> GetDXGIFactory() const;
 		Microsoft::WRL::ComPtr<ID3D12Device9> GetD3D12Device() const;
 
+		/// @brief Keeps D3D12 objects alive until every frame that may still be using them has completed
+		template<typename... Objects>
+		void DeferRelease(Objects... objects)
+		{
+			m_FrameTracker.DeferDeletion(std::make_shared<std::tuple<Objects...>>(std::move(objects)...));
+		}
+
 		void ResourceBarrier(ID3D12GraphicsCommandList7 *cmd,
 							 ID3D12Resource				*resource,
 							 uint32_t					 layer,
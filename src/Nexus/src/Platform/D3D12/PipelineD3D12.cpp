@@ -12,6 +12,7 @@ namespace Nexus::Graphics
 
 	GraphicsPipelineD3D12::GraphicsPipelineD3D12(GraphicsDeviceD3D12 *device, const GraphicsPipelineDescription &description)
 		: GraphicsPipeline(description),
+		  m_Device(device),
 		  m_Description(description)
 	{
 		const auto &resources = GetRequiredShaderResources();
@@ -23,6 +24,7 @@ namespace Nexus::Graphics
 
 	GraphicsPipelineD3D12::~GraphicsPipelineD3D12()
 	{
+		m_Device->DeferRelease(m_RootSignatureBlob, m_RootSignature, m_PipelineStateObject);
 	}
 
 	const GraphicsPipelineDescription &GraphicsPipelineD3D12::GetPipelineDescription() const
@@ -58,7 +60,8 @@ namespace Nexus::Graphics
 	}
 
 	MeshletPipelineD3D12::MeshletPipelineD3D12(GraphicsDeviceD3D12 *device, const MeshletPipelineDescription &description)
-		: MeshletPipeline(description)
+		: MeshletPipeline(description),
+		  m_Device(device)
 	{
 		const auto &resources = GetRequiredShaderResources();
 		D3D12::CreateRootSignature(resources, device->GetD3D12Device(), m_RootSignatureBlob, m_RootSignature, m_DescriptorHandleInfo);
@@ -68,6 +71,7 @@ namespace Nexus::Graphics
 
 	MeshletPipelineD3D12::~MeshletPipelineD3D12()
 	{
+		m_Device->DeferRelease(m_RootSignatureBlob, m_RootSignature, m_PipelineStateObject);
 	}
 
 	Microsoft::WRL::ComPtr<ID3D12RootSignature> MeshletPipelineD3D12::GetRootSignature()
@@ -98,7 +102,8 @@ namespace Nexus::Graphics
 	}
 
 	ComputePipelineD3D12::ComputePipelineD3D12(GraphicsDeviceD3D12 *device, const ComputePipelineDescription &description)
-		: ComputePipeline(description)
+		: ComputePipeline(description),
+		  m_Device(device)
 	{
 		const auto &resources = GetRequiredShaderResources();
 		D3D12::CreateRootSignature(resources, device->GetD3D12Device(), m_RootSignatureBlob, m_RootSignature, m_DescriptorHandleInfo);
@@ -107,6 +112,7 @@ namespace Nexus::Graphics
 
 	ComputePipelineD3D12::~ComputePipelineD3D12()
 	{
+		m_Device->DeferRelease(m_RootSignatureBlob, m_RootSignature, m_PipelineStateObject);
 	}
 
 	void ComputePipelineD3D12::Bind(Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList7> commandList)
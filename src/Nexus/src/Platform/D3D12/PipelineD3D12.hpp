@@ -33,6 +33,7 @@ namespace Nexus::Graphics
 		const D3D12::DescriptorHandleInfo &GetDescriptorHandleInfo() final;
 
 	  private:
+		GraphicsDeviceD3D12		   *m_Device = nullptr;
 		GraphicsPipelineDescription m_Description;
 
 		Microsoft::WRL::ComPtr<ID3DBlob>			m_RootSignatureBlob;
@@ -57,6 +58,7 @@ namespace Nexus::Graphics
 		const D3D12::DescriptorHandleInfo &GetDescriptorHandleInfo() final;
 
 	  private:
+		GraphicsDeviceD3D12		   *m_Device = nullptr;
 		GraphicsPipelineDescription m_Description;
 
 		Microsoft::WRL::ComPtr<ID3DBlob>			m_RootSignatureBlob;
@@ -77,6 +79,7 @@ namespace Nexus::Graphics
 		const D3D12::DescriptorHandleInfo &GetDescriptorHandleInfo() final;
 
 	  private:
+		GraphicsDeviceD3D12						   *m_Device			   = nullptr;
 		Microsoft::WRL::ComPtr<ID3DBlob>			m_RootSignatureBlob;
 		Microsoft::WRL::ComPtr<ID3D12RootSignature> m_RootSignature;
 		Microsoft::WRL::ComPtr<ID3D12PipelineState> m_PipelineStateObject  = nullptr;
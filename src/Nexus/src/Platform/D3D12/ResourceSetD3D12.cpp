@@ -91,6 +91,11 @@ namespace Nexus::Graphics
 		}
 	}
 
+	ResourceSetD3D12::~ResourceSetD3D12()
+	{
+		m_Device->DeferRelease(m_SamplerDescriptorHeap, m_SRV_UAV_CBV_DescriptorHeap);
+	}
+
 	void ResourceSetD3D12::WriteStorageBuffer(StorageBufferView storageBuffer, const std::string &name)
 	{
 		auto d3d12Device = m_Device->GetD3D12Device();
@@ -13,6 +13,7 @@ namespace Nexus::Graphics
 	{
 	  public:
 		ResourceSetD3D12(Ref<Pipeline> pipeline, GraphicsDeviceD3D12 *device);
+		virtual ~ResourceSetD3D12();
 		virtual void WriteStorageBuffer(StorageBufferView storageBuffer, const std::string &name) override;
 		virtual void WriteUniformBuffer(UniformBufferView uniformBuffer, const std::string &name) override;
 		virtual void WriteCombinedImageSampler(Ref<Texture> texture, Ref<Sampler> sampler, const std::string &name) override;
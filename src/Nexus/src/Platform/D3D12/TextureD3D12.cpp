@@ -64,6 +64,7 @@ namespace Nexus::Graphics
 
 	TextureD3D12::~TextureD3D12()
 	{
+		m_Device->DeferRelease(m_Texture, m_Allocation);
 	}
 
 	TextureLayout TextureD3D12::GetTextureLayout(uint32_t arrayLayer, uint32_t mipLevel) const
@@ -14,6 +14,7 @@ namespace Nexus::Graphics
 
 	TimingQueryD3D12::~TimingQueryD3D12()
 	{
+		m_Device->DeferRelease(m_QueryHeap, m_ReadbackBuffer);
 	}
 
 	void TimingQueryD3D12::Resolve()
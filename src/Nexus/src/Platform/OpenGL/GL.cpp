@@ -883,21 +883,21 @@ namespace Nexus::GL
 				break;
 
 			case Graphics::ShaderDataType::R16_SNorm:
-				baseType	   = GL_BYTE;
+				baseType	   = GL_SHORT;
 				componentCount = 1;
 				normalized	   = true;
 				primitiveType  = GLPrimitiveType::Float;
 				break;
 
 			case Graphics::ShaderDataType::R16G16_SNorm:
-				baseType	   = GL_BYTE;
+				baseType	   = GL_SHORT;
 				componentCount = 2;
 				normalized	   = true;
 				primitiveType  = GLPrimitiveType::Float;
 				break;
 
 			case Graphics::ShaderDataType::R16G16B16A16_SNorm:
-				baseType	   = GL_BYTE;
+				baseType	   = GL_SHORT;
 				componentCount = 4;
 				normalized	   = true;
 				primitiveType  = GLPrimitiveType::Float;
@@ -925,19 +925,19 @@ namespace Nexus::GL
 				break;
 
 			case Graphics::ShaderDataType::R8_SNorm:
-				baseType	   = GL_SHORT;
+				baseType	   = GL_BYTE;
 				componentCount = 1;
 				normalized	   = true;
 				primitiveType  = GLPrimitiveType::Float;
 				break;
 			case Graphics::ShaderDataType::R8G8_SNorm:
-				baseType	   = GL_SHORT;
+				baseType	   = GL_BYTE;
 				componentCount = 2;
 				normalized	   = true;
 				primitiveType  = GLPrimitiveType::Float;
 				break;
 			case Graphics::ShaderDataType::R8G8B8A8_SNorm:
-				baseType	   = GL_SHORT;
+				baseType	   = GL_BYTE;
 				componentCount = 4;
 				normalized	   = true;
 				primitiveType  = GLPrimitiveType::Float;
@@ -1012,10 +1012,10 @@ namespace Nexus::GL
 				break;
 
 			case Graphics::ShaderDataType::A2B10G10R10_UNorm:
-				baseType	   = GL_INT_2_10_10_10_REV;
+				baseType	   = GL_UNSIGNED_INT_2_10_10_10_REV;
 				componentCount = 4;
 				normalized	   = true;
-				primitiveType  = GLPrimitiveType::Int;
+				primitiveType  = GLPrimitiveType::Float;
 				break;
 
 			case Graphics::ShaderDataType::A2B10G10R10_UInt:
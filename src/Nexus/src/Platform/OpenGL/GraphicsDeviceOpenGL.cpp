@@ -55,6 +55,8 @@ namespace Nexus::Graphics
 
 	GraphicsDeviceOpenGL::~GraphicsDeviceOpenGL()
 	{
+		m_ReadbackBufferPool.Flush();
+		m_FrameTracker.Flush();
 	}
 
 	const std::string GraphicsDeviceOpenGL::GetAPIName()
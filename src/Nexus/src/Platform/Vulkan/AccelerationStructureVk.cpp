@@ -31,11 +31,18 @@ namespace Nexus::Graphics
 
 	AccelerationStructureVk::~AccelerationStructureVk()
 	{
-		const GladVulkanContext &context = m_Device->GetVulkanContext();
-		if (context.DestroyAccelerationStructureKHR)
-		{
-			context.DestroyAccelerationStructureKHR(m_Device->GetVkDevice(), m_Handle, nullptr);
-		}
+		GraphicsDeviceVk		  *device = m_Device;
+		VkAccelerationStructureKHR handle = m_Handle;
+
+		m_Device->DeferDestruction(
+			[device, handle]()
+			{
+				const GladVulkanContext &context = device->GetVulkanContext();
+				if (context.DestroyAccelerationStructureKHR)
+				{
+					context.DestroyAccelerationStructureKHR(device->GetVkDevice(), handle, nullptr);
+				}
+			});
 	}
 
 	const AccelerationStructureDescription &AccelerationStructureVk::GetDescription() const
@@ -688,6 +688,11 @@ namespace Nexus::Graphics
 
 	void CommandExecutorVk::ExecuteCommand(const CopyTextureToTextureCommand &command, GraphicsDevice *device)
 	{
+		// copies cannot be recorded while rendering, e.g. when copying a framebuffer that has just been drawn to, so rendering is
+		// restarted after the copy in the same way as it is after a barrier
+		bool wasRendering = m_Rendering;
+		StopRendering();
+
 		GraphicsDeviceVk *deviceVk	 = (GraphicsDeviceVk *)device;
 		Ref<TextureVk>	  srcTexture = std::dynamic_pointer_cast<TextureVk>(command.TextureCopy.Source);
 		Ref<TextureVk>	  dstTexture = std::dynamic_pointer_cast<TextureVk>(command.TextureCopy.Destination);
@@ -776,6 +781,11 @@ namespace Nexus::Graphics
 									 &copyRegion);
 			}
 		}
+
+		if (wasRendering)
+		{
+			ExecuteCommand(m_CurrentRenderTarget, device);
+		}
 	}
 
 	void CommandExecutorVk::ExecuteCommand(const BeginDebugGroupCommand &command, GraphicsDevice *device)
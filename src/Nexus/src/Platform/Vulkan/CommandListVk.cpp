@@ -55,10 +55,19 @@ namespace Nexus::Graphics
 
 	CommandListVk::~CommandListVk()
 	{
-		const GladVulkanContext &context = m_Device->GetVulkanContext();
+		// the command buffers may still be executing, so they are only freed once the frames that submitted them have completed
+		GraphicsDeviceVk							 *device		 = m_Device;
+		VkCommandPool								  commandPool	 = m_CommandPool;
+		std::array<VkCommandBuffer, FRAMES_IN_FLIGHT> commandBuffers = {};
+		std::copy(std::begin(m_CommandBuffers), std::end(m_CommandBuffers), commandBuffers.begin());
 
-		for (int i = 0; i < FRAMES_IN_FLIGHT; i++) { context.FreeCommandBuffers(m_Device->GetVkDevice(), m_CommandPool, 1, &m_CommandBuffers[i]); }
-		context.DestroyCommandPool(m_Device->GetVkDevice(), m_CommandPool, nullptr);
+		m_Device->DeferDestruction(
+			[device, commandPool, commandBuffers]()
+			{
+				const GladVulkanContext &context = device->GetVulkanContext();
+				context.FreeCommandBuffers(device->GetVkDevice(), commandPool, (uint32_t)commandBuffers.size(), commandBuffers.data());
+				context.DestroyCommandPool(device->GetVkDevice(), commandPool, nullptr);
+			});
 	}
 
 	VkCommandBuffer &CommandListVk::GetCurrentCommandBuffer()
@@ -18,7 +18,10 @@ namespace Nexus::Graphics
 
 	DeviceBufferVk::~DeviceBufferVk()
 	{
-		vmaDestroyBuffer(m_Device->GetAllocator(), m_Buffer.Buffer, m_Buffer.Allocation);
+		// a frame that is still in flight may be using the buffer, so it is destroyed once that frame has completed
+		GraphicsDeviceVk   *device = m_Device;
+		Vk::AllocatedBuffer	buffer = m_Buffer;
+		m_Device->DeferDestruction([device, buffer]() { vmaDestroyBuffer(device->GetAllocator(), buffer.Buffer, buffer.Allocation); });
 	}
 
 	void DeviceBufferVk::SetData(const void *data, uint32_t offset, uint32_t size)
@@ -13,9 +13,17 @@ namespace Nexus::Graphics
 
 	FramebufferVk::~FramebufferVk()
 	{
-		const GladVulkanContext &context = m_Device->GetVulkanContext();
-		context.DestroyFramebuffer(m_Device->GetVkDevice(), m_Framebuffer, nullptr);
-		context.DestroyRenderPass(m_Device->GetVkDevice(), m_RenderPass, nullptr);
+		GraphicsDeviceVk *device	  = m_Device;
+		VkFramebuffer	  framebuffer = m_Framebuffer;
+		VkRenderPass	  renderPass  = m_RenderPass;
+
+		m_Device->DeferDestruction(
+			[device, framebuffer, renderPass]()
+			{
+				const GladVulkanContext &context = device->GetVulkanContext();
+				context.DestroyFramebuffer(device->GetVkDevice(), framebuffer, nullptr);
+				context.DestroyRenderPass(device->GetVkDevice(), renderPass, nullptr);
+			});
 	}
 
 	const FramebufferSpecification FramebufferVk::GetFramebufferSpecification()
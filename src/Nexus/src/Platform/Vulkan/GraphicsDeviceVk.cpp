@@ -45,6 +45,11 @@ namespace Nexus::Graphics
 
 	GraphicsDeviceVk::~GraphicsDeviceVk()
 	{
+		// resources that are waiting for a frame to complete have to be released before the allocator that owns their memory, the pooled
+		// readback buffers are released first as destroying them defers their deletion to the frame tracker
+		m_ReadbackBufferPool.Flush();
+		m_FrameTracker.Flush();
+
 		// cleanup allocators
 		{
 			vmaDestroyAllocator(m_Allocator);
@@ -747,6 +752,12 @@ namespace Nexus::Graphics
 		return m_Context;
 	}
 
+	void GraphicsDeviceVk::DeferDestruction(std::function<void()> destroy)
+	{
+		// the tracker only holds shared pointers, so the function is run by the deleter of an empty one
+		m_FrameTracker.DeferDeletion(std::shared_ptr<void>(nullptr, [destroy = std::move(destroy)](void *) { destroy(); }));
+	}
+
 	uint32_t GraphicsDeviceVk::FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties, std::shared_ptr<PhysicalDeviceVk> physicalDevice)
 	{
 		VkPhysicalDeviceMemoryProperties memProperties;
@@ -94,6 +94,9 @@ namespace Nexus::Graphics
 
 		const GladVulkanContext &GetVulkanContext() const;
 
+		/// @brief Runs a function that destroys Vulkan objects once every frame that may still be using them has completed
+		void DeferDestruction(std::function<void()> destroy);
+
 		// vulkan functions
 	  private:
 		virtual Ref<ShaderModule> CreateShaderModule(const ShaderModuleSpecification &moduleSpec) override;
@@ -8,6 +8,27 @@
 
 namespace Nexus::Graphics
 {
+	void PipelineVk::DeferDestruction(GraphicsDeviceVk *device, std::vector<VkPipeline> pipelines)
+	{
+		VkPipelineLayout				   pipelineLayout		= m_PipelineLayout;
+		std::vector<VkDescriptorSetLayout> descriptorSetLayouts = m_DescriptorSetLayouts;
+
+		device->DeferDestruction(
+			[device, pipelines = std::move(pipelines), pipelineLayout, descriptorSetLayouts]()
+			{
+				const GladVulkanContext &context = device->GetVulkanContext();
+
+				for (VkPipeline pipeline : pipelines) { context.DestroyPipeline(device->GetVkDevice(), pipeline, nullptr); }
+
+				context.DestroyPipelineLayout(device->GetVkDevice(), pipelineLayout, nullptr);
+
+				for (VkDescriptorSetLayout descriptorSetLayout : descriptorSetLayouts)
+				{
+					context.DestroyDescriptorSetLayout(device->GetVkDevice(), descriptorSetLayout, nullptr);
+				}
+			});
+	}
+
 	GraphicsPipelineVk::GraphicsPipelineVk(const GraphicsPipelineDescription &description, GraphicsDeviceVk *graphicsDevice)
 		: GraphicsPipeline(description),
 		  m_GraphicsDevice(graphicsDevice)
@@ -20,16 +41,9 @@ namespace Nexus::Graphics
 
 	GraphicsPipelineVk::~GraphicsPipelineVk()
 	{
-		const GladVulkanContext &context = m_GraphicsDevice->GetVulkanContext();
-
-		for (const auto &[renderPass, pipeline] : m_Pipelines) { context.DestroyPipeline(m_GraphicsDevice->GetVkDevice(), pipeline, nullptr); }
-
-		context.DestroyPipelineLayout(m_GraphicsDevice->GetVkDevice(), m_PipelineLayout, nullptr);
-
-		for (const auto &descriptorSetLayout : m_DescriptorSetLayouts)
-		{
-			context.DestroyDescriptorSetLayout(m_GraphicsDevice->GetVkDevice(), descriptorSetLayout, nullptr);
-		}
+		std::vector<VkPipeline> pipelines = {};
+		for (const auto &[renderPass, pipeline] : m_Pipelines) { pipelines.push_back(pipeline); }
+		DeferDestruction(m_GraphicsDevice, std::move(pipelines));
 	}
 
 	const GraphicsPipelineDescription &GraphicsPipelineVk::GetPipelineDescription() const
@@ -138,16 +152,9 @@ namespace Nexus::Graphics
 
 	MeshletPipelineVk::~MeshletPipelineVk()
 	{
-		const GladVulkanContext &context = m_GraphicsDevice->GetVulkanContext();
-
-		for (const auto &[renderPass, pipeline] : m_Pipelines) { context.DestroyPipeline(m_GraphicsDevice->GetVkDevice(), pipeline, nullptr); }
-
-		context.DestroyPipelineLayout(m_GraphicsDevice->GetVkDevice(), m_PipelineLayout, nullptr);
-
-		for (const auto &descriptorSetLayout : m_DescriptorSetLayouts)
-		{
-			context.DestroyDescriptorSetLayout(m_GraphicsDevice->GetVkDevice(), descriptorSetLayout, nullptr);
-		}
+		std::vector<VkPipeline> pipelines = {};
+		for (const auto &[renderPass, pipeline] : m_Pipelines) { pipelines.push_back(pipeline); }
+		DeferDestruction(m_GraphicsDevice, std::move(pipelines));
 	}
 
 	VkPipelineLayout MeshletPipelineVk::GetPipelineLayout()
@@ -262,14 +269,7 @@ namespace Nexus::Graphics
 
 	ComputePipelineVk::~ComputePipelineVk()
 	{
-		const GladVulkanContext &context = m_GraphicsDevice->GetVulkanContext();
-
-		context.DestroyPipelineLayout(m_GraphicsDevice->GetVkDevice(), m_PipelineLayout, nullptr);
-
-		for (const auto &descriptorSetLayout : m_DescriptorSetLayouts)
-		{
-			context.DestroyDescriptorSetLayout(m_GraphicsDevice->GetVkDevice(), descriptorSetLayout, nullptr);
-		}
+		DeferDestruction(m_GraphicsDevice, {m_Pipeline});
 	}
 
 	void ComputePipelineVk::Bind(VkCommandBuffer cmd, VkRenderPass renderPass)
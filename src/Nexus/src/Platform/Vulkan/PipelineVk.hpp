@@ -33,6 +33,11 @@ namespace Nexus::Graphics
 			return m_PipelineLayout;
 		}
 
+	  protected:
+		/// @brief Destroys the pipelines, the pipeline layout and the descriptor set layouts once the frames that may be using them have
+		/// completed
+		void DeferDestruction(GraphicsDeviceVk *device, std::vector<VkPipeline> pipelines);
+
 	  protected:
 		std::vector<VkDescriptorSetLayout>	 m_DescriptorSetLayouts = {};
 		std::map<VkDescriptorType, uint32_t> m_DescriptorCounts;
@@ -65,8 +65,11 @@ namespace Nexus::Graphics
 
 	ResourceSetVk::~ResourceSetVk()
 	{
-		const GladVulkanContext &context = m_Device->GetVulkanContext();
-		context.DestroyDescriptorPool(m_Device->GetVkDevice(), m_DescriptorPool, nullptr);
+		GraphicsDeviceVk *device		 = m_Device;
+		VkDescriptorPool  descriptorPool = m_DescriptorPool;
+
+		m_Device->DeferDestruction([device, descriptorPool]()
+								   { device->GetVulkanContext().DestroyDescriptorPool(device->GetVkDevice(), descriptorPool, nullptr); });
 	}
 
 	void ResourceSetVk::WriteStorageBuffer(StorageBufferView storageBuffer, const std::string &name)
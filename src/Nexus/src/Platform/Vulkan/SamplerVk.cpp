@@ -51,8 +51,9 @@ namespace Nexus::Graphics
 
 	SamplerVk::~SamplerVk()
 	{
-		const GladVulkanContext &context = m_Device->GetVulkanContext();
-		context.DestroySampler(m_Device->GetVkDevice(), m_Sampler, nullptr);
+		GraphicsDeviceVk *device  = m_Device;
+		VkSampler		  sampler = m_Sampler;
+		m_Device->DeferDestruction([device, sampler]() { device->GetVulkanContext().DestroySampler(device->GetVkDevice(), sampler, nullptr); });
 	}
 
 	const SamplerDescription &SamplerVk::GetSamplerSpecification()
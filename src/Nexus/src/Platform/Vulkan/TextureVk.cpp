@@ -106,9 +106,18 @@ namespace Nexus::Graphics
 
 	TextureVk::~TextureVk()
 	{
-		const GladVulkanContext &context = m_GraphicsDevice->GetVulkanContext();
-		context.DestroyImageView(m_GraphicsDevice->GetVkDevice(), m_ImageView, nullptr);
-		vmaDestroyImage(m_GraphicsDevice->GetAllocator(), m_Image, m_Allocation);
+		GraphicsDeviceVk *device	 = m_GraphicsDevice;
+		VkImage			  image		 = m_Image;
+		VkImageView		  imageView	 = m_ImageView;
+		VmaAllocation	  allocation = m_Allocation;
+
+		m_GraphicsDevice->DeferDestruction(
+			[device, image, imageView, allocation]()
+			{
+				const GladVulkanContext &context = device->GetVulkanContext();
+				context.DestroyImageView(device->GetVkDevice(), imageView, nullptr);
+				vmaDestroyImage(device->GetAllocator(), image, allocation);
+			});
 	}
 
 	VkImage TextureVk::GetImage()
@@ -18,8 +18,9 @@ namespace Nexus::Graphics
 
 	TimingQueryVk::~TimingQueryVk()
 	{
-		const GladVulkanContext &context = m_Device->GetVulkanContext();
-		context.DestroyQueryPool(m_Device->GetVkDevice(), m_QueryPool, nullptr);
+		GraphicsDeviceVk *device	= m_Device;
+		VkQueryPool		  queryPool = m_QueryPool;
+		m_Device->DeferDestruction([device, queryPool]() { device->GetVulkanContext().DestroyQueryPool(device->GetVkDevice(), queryPool, nullptr); });
 	}
 
 	void TimingQueryVk::Resolve()
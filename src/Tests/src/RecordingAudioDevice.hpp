@@ -0,0 +1,289 @@
+#pragma once
+
+#include "Nexus-Core/Audio/AudioDevice.hpp"
+
+/// @brief An audio buffer that keeps a copy of the samples it was given, so tests can inspect what a stream decoded
+class RecordingAudioBuffer : public Nexus::Audio::AudioBuffer
+{
+  public:
+	void SetData(const void *const data, size_t size, Nexus::Audio::AudioFormat format, size_t frequency) override
+	{
+		const float *samples = static_cast<const float *>(data);
+		Samples.assign(samples, samples + size / sizeof(float));
+		Format	  = format;
+		Frequency = frequency;
+	}
+
+	size_t GetFrequency() const override
+	{
+		return Frequency;
+	}
+
+	size_t GetBits() const override
+	{
+		return 32;
+	}
+
+	size_t GetChannels() const override
+	{
+		return Format == Nexus::Audio::AudioFormat::MonoFloat32 ? 1 : 2;
+	}
+
+	size_t GetSize() const override
+	{
+		return Samples.size() * sizeof(float);
+	}
+
+	std::vector<float>		  Samples	= {};
+	Nexus::Audio::AudioFormat Format	= Nexus::Audio::AudioFormat::MonoFloat32;
+	size_t					  Frequency = 0;
+};
+
+/// @brief A source that never finishes playing its buffers, so a stream fills every buffer once and then waits
+class RecordingAudioSource : public Nexus::Audio::AudioSource
+{
+  public:
+	void SetPitch(float pitch) override
+	{
+	}
+
+	void SetGain(float gain) override
+	{
+	}
+
+	void SetMaxDistance(float maxDistance) override
+	{
+	}
+
+	void SetRolloffFactor(float rolloff) override
+	{
+	}
+
+	void SetReferenceDistance(float reference) override
+	{
+	}
+
+	void SetMinGain(float minGain) override
+	{
+	}
+
+	void SetMaxGain(float maxGain) override
+	{
+	}
+
+	void SetConeOuterGain(float outerGain) override
+	{
+	}
+
+	void SetConeInnerAngle(float innerAngle) override
+	{
+	}
+
+	void SetConeOuterAngle(float outerAngle) override
+	{
+	}
+
+	void SetPosition(const glm::vec3 &position) override
+	{
+	}
+
+	void SetVelocity(const glm::vec3 &velocity) override
+	{
+	}
+
+	void SetDirection(const glm::vec3 &direction) override
+	{
+	}
+
+	void SetIsRelative(bool isRelative) override
+	{
+	}
+
+	void SetIsLooping(bool isLooping) override
+	{
+	}
+
+	void SetPlaybackPositionInSeconds(float seconds) override
+	{
+	}
+
+	void SetPlaybackPositionInSamples(float samples) override
+	{
+	}
+
+	void SetPlaybackPositionInBytes(float bytes) override
+	{
+	}
+
+	void SetStaticSourceBuffer(Nexus::Ref<Nexus::Audio::AudioBuffer> buffer) override
+	{
+	}
+
+	void QueueBuffer(Nexus::Ref<Nexus::Audio::AudioBuffer> buffer) override
+	{
+		Queued.push_back(buffer);
+	}
+
+	void UnqueueBuffer(Nexus::Ref<Nexus::Audio::AudioBuffer> buffer) override
+	{
+		std::erase(Queued, buffer);
+	}
+
+	void ClearAllBuffers() override
+	{
+		Queued.clear();
+	}
+
+	float GetPitch() const override
+	{
+		return 1.0f;
+	}
+
+	float GetGain() const override
+	{
+		return 1.0f;
+	}
+
+	float GetMaxDistance() const override
+	{
+		return 0.0f;
+	}
+
+	float GetRolloffFactor() const override
+	{
+		return 0.0f;
+	}
+
+	float GetReferenceDistance() const override
+	{
+		return 0.0f;
+	}
+
+	float GetMinGain() const override
+	{
+		return 0.0f;
+	}
+
+	float GetMaxGain() const override
+	{
+		return 1.0f;
+	}
+
+	float GetConeOuterGain() const override
+	{
+		return 0.0f;
+	}
+
+	float GetConeInnerAngle() const override
+	{
+		return 0.0f;
+	}
+
+	float GetConeOuterAngle() const override
+	{
+		return 0.0f;
+	}
+
+	glm::vec3 GetPosition() const override
+	{
+		return {};
+	}
+
+	glm::vec3 GetVelocity() const override
+	{
+		return {};
+	}
+
+	glm::vec3 GetDirection() const override
+	{
+		return {};
+	}
+
+	bool GetIsRelative() const override
+	{
+		return false;
+	}
+
+	Nexus::Audio::SourceType GetSourceType() const override
+	{
+		return Nexus::Audio::SourceType::Streaming;
+	}
+
+	bool GetIsLooping() const override
+	{
+		return false;
+	}
+
+	float GetPlaybackPositionInSeconds() const override
+	{
+		return 0.0f;
+	}
+
+	float GetPlaybackPositionInSamples() const override
+	{
+		return 0.0f;
+	}
+
+	float GetPlaybackPositionInBytes() const override
+	{
+		return 0.0f;
+	}
+
+	Nexus::Ref<Nexus::Audio::AudioBuffer> GetStaticSourceBuffer() const override
+	{
+		return nullptr;
+	}
+
+	Nexus::Audio::SourceState GetSourceState() const override
+	{
+		return Nexus::Audio::SourceState::Playing;
+	}
+
+	size_t GetNumQueuedBuffers() const override
+	{
+		return Queued.size();
+	}
+
+	size_t GetNumProcessedBuffers() const override
+	{
+		return 0;
+	}
+
+	std::vector<Nexus::Ref<Nexus::Audio::AudioBuffer>> Queued = {};
+};
+
+/// @brief A device that creates recording buffers and sources and ignores playback commands
+class RecordingAudioDevice : public Nexus::Audio::AudioDevice
+{
+  public:
+	Nexus::Audio::AudioAPI GetAPI() override
+	{
+		return Nexus::Audio::AudioAPI::OpenAL;
+	}
+
+	Nexus::Ref<Nexus::Audio::AudioBuffer> CreateAudioBuffer() override
+	{
+		return Nexus::CreateRef<RecordingAudioBuffer>();
+	}
+
+	Nexus::Ref<Nexus::Audio::AudioSource> CreateAudioSource() override
+	{
+		return Nexus::CreateRef<RecordingAudioSource>();
+	}
+
+	void Play(Nexus::Ref<Nexus::Audio::AudioSource> source) override
+	{
+	}
+
+	void Pause(Nexus::Ref<Nexus::Audio::AudioSource> source) override
+	{
+	}
+
+	void Stop(Nexus::Ref<Nexus::Audio::AudioSource> source) override
+	{
+	}
+
+	void Rewind(Nexus::Ref<Nexus::Audio::AudioSource> source) override
+	{
+	}
+};
@@ -3,102 +3,2681 @@
 #include "Nexus-Core/Graphics/Circle.hpp"
 #include "Nexus-Core/Utils/Utils.hpp"
 
+#include "Nexus-Core/Audio/AudioMixer.hpp"
+#include "Nexus-Core/Audio/AudioStream.hpp"
+#include "Nexus-Core/Audio/SampleConversion.hpp"
+#include "Nexus-Core/ECS/Components.hpp"
+#include "Nexus-Core/ECS/Registry.hpp"
+#include "Nexus-Core/Runtime/BinaryScene.hpp"
+#include "Nexus-Core/Runtime/LoadOperation.hpp"
+#include "Nexus-Core/ECS/TransformHierarchy.hpp"
 #include "Nexus-Core/Events/EventHandler.hpp"
+#include "Nexus-Core/Renderer/BoundingVolumeHierarchy.hpp"
+#include "Nexus-Core/Renderer/RenderGraph.hpp"
+#include "Nexus-Core/Graphics/FrameTracker.hpp"
+#include "Nexus-Core/Renderer/RenderThread.hpp"
+#include "Nexus-Core/Timings/Profiler.hpp"
+#include "Nexus-Core/Graphics/TimingQuery.hpp"
+#include "Nexus-Core/Logging/LogSink.hpp"
+#include "Nexus-Core/Graphics/Model.hpp"
+#include "Nexus-Core/Graphics/MeshOptimizer.hpp"
+#include "Nexus-Core/Graphics/MeshSimplifier.hpp"
+#include "Nexus-Core/Graphics/VertexQuantization.hpp"
+#include "Nexus-Core/Graphics/MeshletBuilder.hpp"
+#include "Nexus-Core/Graphics/CatmullRom.hpp"
+#include "Nexus-Core/Graphics/PixelConversion.hpp"
+#include "Nexus-Core/Graphics/TextureStreamer.hpp"
+#include "Nexus-Core/Renderer/Renderer3D.hpp"
 
 #include "Nexus-Core/Graphics/GraphicsDevice.hpp"
 #include "Nexus-Core/Graphics/IGraphicsAPI.hpp"
 
+#include "RecordingAudioDevice.hpp"
+
+#include "stb_image_write.h"
+
 TEST(Point2D, To)
 {
-	Nexus::Point2D<int>	  value(5, 7);
-	Nexus::Point2D<float> result = value.To<float>();
+	Nexus::Point2D<int>	  value(5, 7);
+	Nexus::Point2D<float> result = value.To<float>();
+
+	EXPECT_EQ(result.X, 5.0f);
+	EXPECT_EQ(result.Y, 7.0f);
+}
+
+TEST(Point2D, Deconstruct)
+{
+	Nexus::Point2D<int> value(5, 7);
+
+	int x, y;
+	value.Deconstruct(&x, &y);
+
+	EXPECT_EQ(value.X, x);
+	EXPECT_EQ(value.Y, y);
+}
+
+TEST(Point3D, To)
+{
+	Nexus::Point3D<int>	  value(5, 7, 2);
+	Nexus::Point3D<float> result = value.To<float>();
+
+	EXPECT_EQ(result.X, 5.0f);
+	EXPECT_EQ(result.Y, 7.0f);
+	EXPECT_EQ(result.Z, 2.0f);
+}
+
+TEST(Point3D, Deconstruct)
+{
+	Nexus::Point3D<int> value(5, 7, 2);
+
+	int x, y, z;
+	value.Deconstruct(&x, &y, &z);
+
+	EXPECT_EQ(value.X, x);
+	EXPECT_EQ(value.Y, y);
+	EXPECT_EQ(value.Z, z);
+}
+
+TEST(Circle, To)
+{
+	const Nexus::Graphics::Circle<int> c(Nexus::Point2D<int>(50, 50), 25);
+	Nexus::Graphics::Circle<float>	   result = c.To<float>();
+
+	EXPECT_EQ(result.GetPosition().X, 50.0f);
+	EXPECT_EQ(result.GetPosition().Y, 50.0f);
+}
+
+TEST(Circle, ContainsValid)
+{
+	Nexus::Graphics::Circle<int> c(Nexus::Point2D<int>(50, 50), 25.0f);
+	bool						 result = c.Contains(Nexus::Point2D<int>(50, 50));
+
+	EXPECT_EQ(result, true);
+}
+
+TEST(Circle, ContainsInvalid)
+{
+	Nexus::Graphics::Circle<int> c(Nexus::Point2D<int>(50, 50), 25.0f);
+	bool						 result = c.Contains(Nexus::Point2D<int>(20, 50));
+
+	EXPECT_EQ(result, false);
+}
+
+TEST(Circle, Deconstruct)
+{
+	Nexus::Graphics::Circle<int> c(Nexus::Point2D<int>(50, 50), 25.0f);
+
+	int x, y, radius;
+	c.Deconstruct(&x, &y, &radius);
+
+	EXPECT_EQ(x, 50);
+	EXPECT_EQ(y, 50);
+	EXPECT_EQ(radius, 25);
+}
+
+TEST(ScopedEvent, Behaviour)
+{
+	Nexus::EventHandler<> eventHandler;
+
+	EXPECT_EQ(eventHandler.GetDelegateCount(), 0);
+
+	{
+		Nexus::ScopedEvent<> event(&eventHandler, []() {});
+		EXPECT_EQ(eventHandler.GetDelegateCount(), 1);
+	}
+
+	EXPECT_EQ(eventHandler.GetDelegateCount(), 0);
+}
+
+TEST(EventHandler, BindAndUnbindDuringInvoke)
+{
+	Nexus::EventHandler<int> eventHandler;
+	std::vector<int>		 calls;
+
+	Nexus::EventID first = 0, second = 0;
+	first = eventHandler.Bind(
+		[&](int value)
+		{
+			calls.push_back(1);
+
+			// unbinding the running function and binding a new one must not disturb the current invocation
+			eventHandler.Unbind(first);
+			eventHandler.Bind([&](int) { calls.push_back(3); });
+		});
+	second = eventHandler.Bind([&](int value) { calls.push_back(2); });
+
+	eventHandler.Invoke(0);
+	EXPECT_EQ(calls, std::vector<int>({1, 2}));
+	EXPECT_EQ(eventHandler.GetDelegateCount(), 2);
+
+	calls.clear();
+	eventHandler.Invoke(0);
+	EXPECT_EQ(calls, std::vector<int>({2, 3}));
+
+	// IDs are never reused, so unbinding a stale ID has no effect on the function that now occupies its slot
+	eventHandler.Unbind(first);
+	eventHandler.Unbind(second);
+	EXPECT_EQ(eventHandler.GetDelegateCount(), 1);
+
+	Nexus::EventID third = eventHandler.Bind([](int) {});
+	EXPECT_NE(third, first);
+	EXPECT_NE(third, second);
+	eventHandler.Unbind(second);
+	EXPECT_EQ(eventHandler.GetDelegateCount(), 2);
+}
+
+TEST(EventHandler, DispatchQueuedFromThreads)
+{
+	Nexus::EventHandler<int> eventHandler;
+	int64_t					 total = 0;
+	eventHandler.Bind([&](int value) { total += value; });
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; t++)
+	{
+		threads.emplace_back(
+			[&]()
+			{
+				for (int i = 1; i <= 1000; i++) { eventHandler.Enqueue(i); }
+			});
+	}
+
+	for (std::thread &thread : threads) { thread.join(); }
+
+	EXPECT_EQ(total, 0);
+	EXPECT_EQ(eventHandler.DispatchQueued(), 4000);
+	EXPECT_EQ(total, 4 * 500500);
+	EXPECT_EQ(eventHandler.DispatchQueued(), 0);
+}
+
+TEST(EventHandler, ReusesDispatchedEventsForLaterQueues)
+{
+	Nexus::EventHandler<std::string> eventHandler;
+	std::vector<std::string>		 received;
+	eventHandler.Bind([&](const std::string &value) { received.push_back(value); });
+
+	// the pool keeps a bounded number of the dispatched events, the rest are freed
+	for (int i = 0; i < 100; i++) { eventHandler.Enqueue(std::to_string(i)); }
+	EXPECT_EQ(eventHandler.GetPooledEventCount(), 0);
+	EXPECT_EQ(eventHandler.DispatchQueued(), 100);
+	size_t pooled = eventHandler.GetPooledEventCount();
+	EXPECT_GT(pooled, 0);
+	EXPECT_LT(pooled, 100);
+
+	// queuing takes events from the pool, and reused events carry their new arguments in order
+	received.clear();
+	eventHandler.Enqueue("first");
+	eventHandler.Enqueue("second");
+	EXPECT_EQ(eventHandler.GetPooledEventCount(), pooled - 2);
+	EXPECT_EQ(eventHandler.DispatchQueued(), 2);
+	EXPECT_EQ(received, std::vector<std::string>({"first", "second"}));
+	EXPECT_EQ(eventHandler.GetPooledEventCount(), pooled);
+}
+
+float CalculateTriangulatedArea(const std::vector<glm::vec2> &polygon, const std::vector<uint32_t> &indices)
+{
+	float area = 0.0f;
+	for (size_t i = 0; i < indices.size(); i += 3)
+	{
+		glm::vec2 a = polygon[indices[i]];
+		glm::vec2 b = polygon[indices[i + 1]];
+		glm::vec2 c = polygon[indices[i + 2]];
+		area += glm::abs(Nexus::Utils::Cross(b - a, c - a)) * 0.5f;
+	}
+	return area;
+}
+
+TEST(Triangulate, ConcavePolygon)
+{
+	// an L shape, the reflex corner at (5, 5) must not be covered by an ear
+	std::vector<glm::vec2> polygon = {{0.0f, 0.0f}, {10.0f, 0.0f}, {10.0f, 5.0f}, {5.0f, 5.0f}, {5.0f, 10.0f}, {0.0f, 10.0f}};
+
+	for (int i = 0; i < 2; i++)
+	{
+		std::vector<uint32_t> indices;
+		EXPECT_TRUE(Nexus::Utils::Triangulate(polygon, indices));
+		EXPECT_EQ(indices.size(), (polygon.size() - 2) * 3);
+		EXPECT_NEAR(CalculateTriangulatedArea(polygon, indices), 75.0f, 0.001f);
+
+		std::reverse(polygon.begin(), polygon.end());
+	}
+}
+
+TEST(Triangulate, LargePolygon)
+{
+	std::vector<glm::vec2> polygon;
+	const size_t		   vertexCount = 20'000;
+
+	for (size_t i = 0; i < vertexCount; i++)
+	{
+		float angle	 = glm::two_pi<float>() * (float)i / (float)vertexCount;
+		float radius = 100.0f + 20.0f * std::sin(angle * 7.0f);
+		polygon.push_back({radius * std::cos(angle), radius * std::sin(angle)});
+	}
+
+	std::vector<uint32_t> indices;
+	EXPECT_TRUE(Nexus::Utils::Triangulate(polygon, indices));
+
+	// collinear vertices are removed before clipping, so there can be slightly fewer triangles than a fan would produce
+	EXPECT_LE(indices.size(), (vertexCount - 2) * 3);
+
+	float expectedArea = Nexus::Utils::FindSignedPolygonArea(polygon);
+	EXPECT_NEAR(CalculateTriangulatedArea(polygon, indices), expectedArea, expectedArea * 0.0001f);
+}
+
+TEST(SutherlandHodgman, ClipsAgainstEitherWinding)
+{
+	std::vector<glm::vec2> subject = {{0.0f, 0.0f}, {10.0f, 0.0f}, {10.0f, 10.0f}, {0.0f, 10.0f}};
+	std::vector<glm::vec2> clip	   = {{5.0f, 5.0f}, {15.0f, 5.0f}, {15.0f, 15.0f}, {5.0f, 15.0f}};
+
+	std::vector<glm::vec2> clockwiseResult = Nexus::Utils::SutherlandHodgman(subject, clip);
+	std::reverse(clip.begin(), clip.end());
+	std::vector<glm::vec2> counterClockwiseResult = Nexus::Utils::SutherlandHodgman(subject, clip);
+
+	EXPECT_EQ(clockwiseResult.size(), 4);
+	EXPECT_EQ(clockwiseResult, counterClockwiseResult);
+	EXPECT_NEAR(Nexus::Utils::FindPolygonArea(clockwiseResult), 25.0f, 0.001f);
+}
+
+TEST(SampleConversion, Int16RoundTrip)
+{
+	// an odd length exercises both the vectorised loop and the scalar tail
+	std::vector<float> samples;
+	for (int i = -32767; i <= 32767; i += 13) { samples.push_back((float)i / 32767.0f); }
+	samples.push_back(2.0f);
+	samples.push_back(-2.0f);
+
+	std::vector<int16_t> converted(samples.size());
+	Nexus::Audio::ConvertFloatToInt16(samples, converted.data());
+
+	for (size_t i = 0; i < samples.size() - 2; i++) { EXPECT_EQ(converted[i], -32767 + (int)i * 13); }
+	EXPECT_EQ(converted[samples.size() - 2], 32767);
+	EXPECT_EQ(converted[samples.size() - 1], -32767);
+
+	// dither never moves a sample by more than one step and the same seed always produces the same output
+	std::vector<int16_t> dithered(samples.size()), ditheredAgain(samples.size());
+	Nexus::Audio::ConvertFloatToInt16(samples, dithered.data(), Nexus::Audio::DitherMode::Triangular, 42);
+	Nexus::Audio::ConvertFloatToInt16(samples, ditheredAgain.data(), Nexus::Audio::DitherMode::Triangular, 42);
+
+	EXPECT_EQ(dithered, ditheredAgain);
+	for (size_t i = 0; i < samples.size(); i++) { EXPECT_LE(std::abs(dithered[i] - converted[i]), 1); }
+}
+
+TEST(SampleConversion, UInt8AndInterleave)
+{
+	std::vector<float> left	 = {-1.0f, -0.5f, 0.0f, 0.5f, 1.0f};
+	std::vector<float> right = {1.0f, 0.5f, 0.0f, -0.5f, -1.0f};
+
+	const float		  *channels[] = {left.data(), right.data()};
+	std::vector<float> interleaved(left.size() * 2);
+	Nexus::Audio::InterleaveChannels(channels, 2, left.size(), interleaved.data());
+
+	for (size_t i = 0; i < left.size(); i++)
+	{
+		EXPECT_EQ(interleaved[i * 2], left[i]);
+		EXPECT_EQ(interleaved[i * 2 + 1], right[i]);
+	}
+
+	std::vector<uint8_t> converted = Nexus::Audio::ConvertSamples(interleaved, Nexus::Audio::AudioFormat::Stereo8, Nexus::Audio::DitherMode::None);
+	std::vector<uint8_t> expected  = {1, 255, 64, 192, 128, 128, 192, 64, 255, 1};
+	EXPECT_EQ(converted, expected);
+}
+
+TEST(AudioMixer, MixesVoicesThroughBuses)
+{
+	Nexus::Audio::AudioMixerDescription description = {};
+	description.BusCount							= 2;
+	Nexus::Audio::AudioMixer mixer(description, Nexus::CreateScope<Nexus::Audio::NullAudioOutput>(48000, 256));
+
+	Nexus::Ref<Nexus::Audio::AudioClip> clip = Nexus::CreateRef<Nexus::Audio::AudioClip>();
+	clip->Samples							 = std::vector<float>(100, 0.5f);
+
+	Nexus::Audio::VoiceDescription voiceDescription = {};
+	voiceDescription.Bus							= 1;
+	voiceDescription.Pan							= -1.0f;
+
+	mixer.SetBusGain(0, 0.5f);
+	mixer.SetBusGain(1, 0.5f);
+	Nexus::Audio::VoiceHandle voice = mixer.Play(clip, voiceDescription);
+	EXPECT_TRUE(mixer.IsPlaying(voice));
+
+	std::vector<float> output(128 * 2);
+	mixer.Mix(output);
+
+	for (size_t frame = 0; frame < 128; frame++)
+	{
+		EXPECT_NEAR(output[frame * 2], frame < 100 ? 0.125f : 0.0f, 0.0001f);
+		EXPECT_NEAR(output[frame * 2 + 1], 0.0f, 0.0001f);
+	}
+
+	// the voice has played to the end, so its slot has been returned to the pool
+	EXPECT_FALSE(mixer.IsPlaying(voice));
+	EXPECT_EQ(mixer.GetActiveVoiceCount(), 0);
+
+	mixer.Update();
+	EXPECT_EQ(static_cast<Nexus::Audio::NullAudioOutput *>(mixer.GetOutput())->GetFramesSubmitted(), 256);
+}
+
+TEST(AudioMixer, StealsLowestPriorityVoice)
+{
+	Nexus::Audio::AudioMixerDescription description = {};
+	description.MaxVoices							= 2;
+	Nexus::Audio::AudioMixer mixer(description, Nexus::CreateScope<Nexus::Audio::NullAudioOutput>(48000, 256));
+
+	Nexus::Ref<Nexus::Audio::AudioClip> clip = Nexus::CreateRef<Nexus::Audio::AudioClip>();
+	clip->Samples							 = std::vector<float>(48000, 0.0f);
+
+	Nexus::Audio::VoiceHandle important = mixer.Play(clip, {.Priority = 1});
+	Nexus::Audio::VoiceHandle oldest	= mixer.Play(clip, {.Priority = 0});
+	Nexus::Audio::VoiceHandle newest	= mixer.Play(clip, {.Priority = 0});
+
+	EXPECT_TRUE(mixer.IsPlaying(important));
+	EXPECT_FALSE(mixer.IsPlaying(oldest));
+	EXPECT_TRUE(mixer.IsPlaying(newest));
+
+	// a voice cannot replace one with a higher priority than its own
+	EXPECT_FALSE(mixer.Play(clip, {.Priority = -1}).IsValid());
+	EXPECT_TRUE(mixer.IsPlaying(newest));
+
+	// stolen slots are reused, but handles to the previous voice stay invalid
+	Nexus::Audio::VoiceHandle urgent = mixer.Play(clip, {.Priority = 5});
+	EXPECT_TRUE(mixer.IsPlaying(urgent));
+	EXPECT_FALSE(mixer.IsPlaying(newest));
+	EXPECT_EQ(urgent.Index, newest.Index);
+	EXPECT_EQ(mixer.GetActiveVoiceCount(), 2);
+}
+
+void WriteWavFile(const std::filesystem::path &path, const std::vector<int16_t> &samples, uint16_t channels, uint32_t sampleRate)
+{
+	const uint32_t dataSize	  = (uint32_t)(samples.size() * sizeof(int16_t));
+	const uint32_t riffSize	  = 36 + dataSize;
+	const uint32_t formatSize = 16;
+	const uint16_t encoding	  = 1;
+	const uint32_t byteRate	  = sampleRate * channels * sizeof(int16_t);
+	const uint16_t blockAlign = channels * sizeof(int16_t);
+	const uint16_t bits		  = 16;
+
+	std::ofstream file(path, std::ios::binary);
+	file.write("RIFF", 4).write(reinterpret_cast<const char *>(&riffSize), 4).write("WAVE", 4);
+	file.write("fmt ", 4).write(reinterpret_cast<const char *>(&formatSize), 4);
+	file.write(reinterpret_cast<const char *>(&encoding), 2).write(reinterpret_cast<const char *>(&channels), 2);
+	file.write(reinterpret_cast<const char *>(&sampleRate), 4).write(reinterpret_cast<const char *>(&byteRate), 4);
+	file.write(reinterpret_cast<const char *>(&blockAlign), 2).write(reinterpret_cast<const char *>(&bits), 2);
+	file.write("data", 4).write(reinterpret_cast<const char *>(&dataSize), 4);
+	file.write(reinterpret_cast<const char *>(samples.data()), dataSize);
+}
+
+TEST(AudioStream, LoopsShortFilesWithinAChunk)
+{
+	// three stereo frames are shorter than a single chunk, so the file is rewound several times while each chunk is decoded
+	std::filesystem::path path = std::filesystem::temp_directory_path() / "NexusAudioStreamTest.wav";
+	WriteWavFile(path, {1024, -1024, 2048, -2048, 4096, -4096}, 2, 22050);
+
+	Nexus::Scope<Nexus::Audio::AudioStreamDecoder> decoder = Nexus::Audio::AudioStreamDecoder::Create(path.string());
+	decoder->Open();
+	EXPECT_EQ(decoder->GetChannelCount(), 2);
+	EXPECT_EQ(decoder->GetSampleRate(), 22050);
+	decoder.reset();
+
+	RecordingAudioDevice device;
+	{
+		Nexus::Audio::AudioStreamDescription description = {};
+		description.Filepath							 = path.string();
+		description.BufferCount							 = 2;
+		description.FramesPerBuffer						 = 8;
+		description.Looping								 = true;
+
+		Nexus::Audio::AudioStream stream(description, &device);
+		stream.Play();
+
+		RecordingAudioSource *source = static_cast<RecordingAudioSource *>(stream.GetSource().get());
+		auto				  start	 = std::chrono::steady_clock::now();
+		while (source->Queued.size() < 2 && std::chrono::steady_clock::now() - start < std::chrono::seconds(5)) { stream.Update(); }
+		ASSERT_EQ(source->Queued.size(), 2);
+
+		// the frames carry on from where the previous chunk stopped, wrapping around at the end of the file
+		const float frames[] = {1024.0f / 32768.0f, 2048.0f / 32768.0f, 4096.0f / 32768.0f};
+		for (size_t chunk = 0; chunk < 2; chunk++)
+		{
+			const RecordingAudioBuffer *buffer = static_cast<const RecordingAudioBuffer *>(source->Queued[chunk].get());
+			EXPECT_EQ(buffer->Format, Nexus::Audio::AudioFormat::StereoFloat32);
+			EXPECT_EQ(buffer->Frequency, 22050);
+			ASSERT_EQ(buffer->Samples.size(), 16);
+
+			for (size_t frame = 0; frame < 8; frame++)
+			{
+				float expected = frames[(chunk * 8 + frame) % 3];
+				EXPECT_FLOAT_EQ(buffer->Samples[frame * 2], expected);
+				EXPECT_FLOAT_EQ(buffer->Samples[frame * 2 + 1], -expected);
+			}
+		}
+	}
+
+	std::filesystem::remove(path);
+}
+
+TEST(Registry, RemovingComponentKeepsOtherHandlesValid)
+{
+	Nexus::ECS::Registry registry;
+
+	std::vector<Nexus::GUID> entities;
+	for (int i = 0; i < 4; i++)
+	{
+		entities.push_back(Nexus::GUID((uint64_t)i + 1));
+		registry.AddComponent<int>(entities.back(), i * 10);
+	}
+
+	std::vector<Nexus::ECS::ComponentPtr> removed = registry.GetAllComponents(entities[0]);
+	ASSERT_EQ(removed.size(), 1);
+	registry.RemoveComponent(entities[0], removed[0].typeName, removed[0].handle);
+
+	// the last component is moved into the removed component's place, but every entity still sees its own data
+	EXPECT_EQ(registry.GetComponent<int>(entities[0]), nullptr);
+	EXPECT_EQ(registry.GetRawComponent(removed[0]), nullptr);
+	for (int i = 1; i < 4; i++) { EXPECT_EQ(*registry.GetComponent<int>(entities[i]), i * 10); }
+
+	// the freed slot is reused by the next component, but the old handle must not resolve to it
+	registry.AddComponent<int>(entities[0], 99);
+	EXPECT_EQ(*registry.GetComponent<int>(entities[0]), 99);
+	EXPECT_EQ(registry.GetRawComponent(removed[0]), nullptr);
+	EXPECT_EQ(registry.GetAllComponents(entities[0])[0].handle.Index, removed[0].handle.Index);
+
+	// removing through an entity that does not own the component does nothing
+	registry.RemoveComponent(entities[1], removed[0].typeName, registry.GetAllComponents(entities[2])[0].handle);
+	EXPECT_EQ(*registry.GetComponent<int>(entities[2]), 20);
+}
+
+/// @brief A trivially copyable component, these are blitted in binary scenes
+TEST(Registry, AppendingComponentArraysChecksTheirType)
+{
+	Nexus::ECS::Registry registry;
+	Nexus::GUID			 entity((uint64_t)1);
+	registry.AddComponent<int>(entity, 1);
+
+	std::vector<Nexus::GUID> owners			  = {entity};
+	std::vector<size_t>		 hierarchyIndices = {1};
+
+	// an array of floats must not be treated as the existing array of ints, or as a new array under the name of another type
+	Nexus::Scope<Nexus::ECS::ComponentArray<float>> floats = Nexus::CreateScope<Nexus::ECS::ComponentArray<float>>();
+	floats->AddComponent(2.0f);
+	EXPECT_THROW(registry.AddComponentArray(typeid(int).name(), std::move(floats), owners, hierarchyIndices), std::runtime_error);
+
+	floats = Nexus::CreateScope<Nexus::ECS::ComponentArray<float>>();
+	floats->AddComponent(2.0f);
+	EXPECT_THROW(registry.AddComponentArray(typeid(double).name(), std::move(floats), owners, hierarchyIndices), std::runtime_error);
+
+	Nexus::Scope<Nexus::ECS::ComponentArray<int>> ints = Nexus::CreateScope<Nexus::ECS::ComponentArray<int>>();
+	ints->AddComponent(2);
+	registry.AddComponentArray(typeid(int).name(), std::move(ints), owners, hierarchyIndices);
+	EXPECT_EQ(*registry.GetComponent<int>(entity, 1), 2);
+}
+
+struct BinarySceneVelocity
+{
+	float X = 0.0f;
+	float Y = 0.0f;
+
+	friend std::ostream &operator<<(std::ostream &os, const BinarySceneVelocity &velocity)
+	{
+		return os << velocity.X << " " << velocity.Y;
+	}
+
+	friend std::istream &operator>>(std::istream &is, BinarySceneVelocity &velocity)
+	{
+		return is >> velocity.X >> velocity.Y;
+	}
+};
+
+/// @brief A component that owns memory, these are written using their stream operators in binary scenes
+struct BinarySceneTag
+{
+	std::string Text = {};
+
+	friend std::ostream &operator<<(std::ostream &os, const BinarySceneTag &tag)
+	{
+		return os << std::quoted(tag.Text);
+	}
+
+	friend std::istream &operator>>(std::istream &is, BinarySceneTag &tag)
+	{
+		return is >> std::quoted(tag.Text);
+	}
+};
+
+namespace YAML
+{
+	template<>
+	struct convert<BinarySceneVelocity>
+	{
+		static Node encode(const BinarySceneVelocity &rhs)
+		{
+			Node node;
+			node["X"] = rhs.X;
+			node["Y"] = rhs.Y;
+			return node;
+		}
+
+		static bool decode(const Node &node, BinarySceneVelocity &rhs)
+		{
+			rhs.X = node["X"].as<float>();
+			rhs.Y = node["Y"].as<float>();
+			return true;
+		}
+	};
+
+	template<>
+	struct convert<BinarySceneTag>
+	{
+		static Node encode(const BinarySceneTag &rhs)
+		{
+			Node node;
+			node["Text"] = rhs.Text;
+			return node;
+		}
+
+		static bool decode(const Node &node, BinarySceneTag &rhs)
+		{
+			rhs.Text = node["Text"].as<std::string>();
+			return true;
+		}
+	};
+}	 // namespace YAML
+
+std::map<std::string, Nexus::ECS::ComponentStorage> GetBinarySceneComponents()
+{
+	Nexus::ECS::ComponentRegistry &componentRegistry = Nexus::ECS::ComponentRegistry::GetRegistry();
+	componentRegistry.RegisterComponent<BinarySceneVelocity>("Velocity", {});
+	componentRegistry.RegisterComponent<BinarySceneTag>("Tag", {});
+	return componentRegistry.GetRegisteredComponents();
+}
+
+TEST(BinaryScene, RoundTripPreservesEntitiesAndComponents)
+{
+	std::map<std::string, Nexus::ECS::ComponentStorage> components = GetBinarySceneComponents();
+	std::filesystem::path								directory  = std::filesystem::temp_directory_path();
+	std::string											filepath   = (directory / "NexusBinarySceneTest.scenebin").string();
+
+	Nexus::ECS::Registry source;
+	for (uint64_t i = 1; i <= 100; i++)
+	{
+		source.AddEntity(Nexus::Entity(Nexus::GUID(i), "Entity " + std::to_string(i)));
+		source.AddComponent<BinarySceneVelocity>(Nexus::GUID(i), BinarySceneVelocity {.X = (float)i, .Y = -(float)i});
+	}
+
+	// an empty string and a string with spaces both need to survive the stream operators
+	source.AddComponent<BinarySceneTag>(Nexus::GUID(3), BinarySceneTag {.Text = "first tag"});
+	source.AddComponent<BinarySceneTag>(Nexus::GUID(3), BinarySceneTag {.Text = ""});
+	source.AddComponent<BinarySceneTag>(Nexus::GUID(7), BinarySceneTag {.Text = "other"});
+
+	Nexus::BinaryScene::SceneDescription description = {.Name = "Test Scene", .ClearColour = glm::vec4(0.1f, 0.2f, 0.3f, 1.0f)};
+	Nexus::BinaryScene::Write(filepath, description, source, components);
+
+	Nexus::ECS::Registry				 loaded;
+	Nexus::BinaryScene::SceneDescription loadedDescription = Nexus::BinaryScene::Read(filepath, loaded, components);
+	EXPECT_EQ(loadedDescription.Name, "Test Scene");
+	EXPECT_EQ(loadedDescription.ClearColour.y, 0.2f);
+
+	ASSERT_EQ(loaded.GetEntities().size(), 100);
+	EXPECT_EQ(loaded.GetEntities()[41].Name, "Entity 42");
+	for (uint64_t i = 1; i <= 100; i++)
+	{
+		BinarySceneVelocity *velocity = loaded.GetComponent<BinarySceneVelocity>(Nexus::GUID(i));
+		ASSERT_NE(velocity, nullptr);
+		EXPECT_EQ(velocity->X, (float)i);
+		EXPECT_EQ(velocity->Y, -(float)i);
+	}
+
+	std::vector<BinarySceneTag *> tags = loaded.GetComponentVector<BinarySceneTag>(Nexus::GUID(3));
+	ASSERT_EQ(tags.size(), 2);
+	EXPECT_EQ(tags[0]->Text, "first tag");
+	EXPECT_EQ(tags[1]->Text, "");
+	EXPECT_EQ(loaded.GetComponent<BinarySceneTag>(Nexus::GUID(7))->Text, "other");
+	EXPECT_EQ(loaded.GetAllComponents(Nexus::GUID(3)).size(), 3);
+
+	// loaded components can be removed and added like any others
+	Nexus::ECS::ComponentHandle handle = loaded.GetAllComponents(Nexus::GUID(1))[0].handle;
+	loaded.RemoveComponent(Nexus::GUID(1), typeid(BinarySceneVelocity).name(), handle);
+	EXPECT_EQ(loaded.GetComponent<BinarySceneVelocity>(Nexus::GUID(1)), nullptr);
+	EXPECT_EQ(loaded.GetComponent<BinarySceneVelocity>(Nexus::GUID(100))->X, 100.0f);
+
+	// a truncated file is rejected rather than read out of bounds
+	std::filesystem::resize_file(filepath, std::filesystem::file_size(filepath) - 20);
+	Nexus::ECS::Registry truncated;
+	EXPECT_THROW(Nexus::BinaryScene::Read(filepath, truncated, components), std::runtime_error);
+
+	std::filesystem::remove(filepath);
+}
+
+TEST(BinaryScene, ConvertsYamlScenes)
+{
+	std::map<std::string, Nexus::ECS::ComponentStorage> components	   = GetBinarySceneComponents();
+	std::filesystem::path								directory	   = std::filesystem::temp_directory_path();
+	std::string											yamlFilepath   = (directory / "NexusBinarySceneTest.scene").string();
+	std::string											binaryFilepath = (directory / "NexusBinarySceneTest.scenebin").string();
+
+	std::ofstream(yamlFilepath) << R"(Scene: Converted
+Environment:
+  ClearColour: [0.5, 0.5, 0.5, 1]
+  Cubemap: ""
+Entities:
+  - Entity: 12
+    Name: Player
+    Components:
+      - Name: Velocity
+        HierarchyIndex: 0
+        Data: {X: 1.5, Y: 2}
+      - Name: Tag
+        HierarchyIndex: 1
+        Data: {Text: player one}
+)";
+
+	Nexus::BinaryScene::ConvertYamlToBinary(yamlFilepath, binaryFilepath, components);
+
+	Nexus::ECS::Registry				 registry;
+	Nexus::BinaryScene::SceneDescription description = Nexus::BinaryScene::Read(binaryFilepath, registry, components);
+	EXPECT_EQ(description.Name, "Converted");
+	ASSERT_EQ(registry.GetEntities().size(), 1);
+	EXPECT_EQ(registry.GetEntities()[0].Name, "Player");
+	EXPECT_EQ(registry.GetComponent<BinarySceneVelocity>(Nexus::GUID(12))->X, 1.5f);
+	EXPECT_EQ(registry.GetComponent<BinarySceneTag>(Nexus::GUID(12))->Text, "player one");
+
+	std::filesystem::remove(yamlFilepath);
+	std::filesystem::remove(binaryFilepath);
+}
+
+void ExpectMatricesNear(const glm::mat4 &a, const glm::mat4 &b)
+{
+	for (int column = 0; column < 4; column++)
+	{
+		for (int row = 0; row < 4; row++) { EXPECT_NEAR(a[column][row], b[column][row], 1e-5f); }
+	}
+}
+
+TEST(Components, ReadPathsWithAndWithoutQuotes)
+{
+	// paths with spaces are quoted so that they survive the stream operators
+	Nexus::ModelRenderer source = {.FilePath = "Assets/Models/Old Crate.obj"};
+	std::stringstream	 stream;
+	stream << source;
+
+	Nexus::ModelRenderer quoted = {};
+	stream >> quoted;
+	EXPECT_EQ(quoted.FilePath, source.FilePath);
+
+	// paths that were written before they were quoted are still read
+	Nexus::ModelRenderer unquoted = {};
+	std::istringstream("Assets/Models/Crate.obj") >> unquoted;
+	EXPECT_EQ(unquoted.FilePath, "Assets/Models/Crate.obj");
+}
+
+TEST(TransformHierarchy, ComposeTransformsMatchesSeparateMatrices)
+{
+	// seven transforms cover both the batched path and the remainder
+	std::vector<Nexus::ECS::LocalTransform> transforms;
+	for (int i = 0; i < 7; i++)
+	{
+		glm::quat rotation = glm::angleAxis(0.3f * i, glm::normalize(glm::vec3(1.0f, (float)i, 2.0f)));
+		transforms.push_back({.Position = glm::vec3(i, -i, 2.0f * i), .Rotation = rotation, .Scale = glm::vec3(1.0f + i, 0.5f, 2.0f)});
+	}
+
+	std::vector<glm::mat4> matrices(transforms.size());
+	Nexus::ECS::ComposeTransforms(transforms, matrices.data());
+
+	for (size_t i = 0; i < transforms.size(); i++)
+	{
+		glm::mat4 expected = glm::translate(glm::mat4(1.0f), transforms[i].Position) * glm::mat4_cast(transforms[i].Rotation) *
+							 glm::scale(glm::mat4(1.0f), transforms[i].Scale);
+		ExpectMatricesNear(matrices[i], expected);
+		ExpectMatricesNear(Nexus::ECS::ComposeTransform(transforms[i]), expected);
+	}
+}
+
+TEST(TransformHierarchy, OnlyDirtySubtreesAreRecomputed)
+{
+	Nexus::ECS::TransformHierarchy hierarchy;
+
+	Nexus::ECS::TransformNode root	 = hierarchy.Create({.Position = glm::vec3(1.0f, 0.0f, 0.0f)});
+	Nexus::ECS::TransformNode child	 = hierarchy.Create({.Position = glm::vec3(0.0f, 2.0f, 0.0f)}, root);
+	Nexus::ECS::TransformNode leaf	 = hierarchy.Create({.Scale = glm::vec3(3.0f)}, child);
+	Nexus::ECS::TransformNode other	 = hierarchy.Create({.Position = glm::vec3(0.0f, 0.0f, 5.0f)});
+	Nexus::ECS::TransformNode second = hierarchy.Create({}, root);
+
+	EXPECT_EQ(hierarchy.Update(), 5);
+	EXPECT_EQ(hierarchy.Update(), 0);
+	ExpectMatricesNear(hierarchy.GetWorldMatrix(leaf),
+					   hierarchy.GetLocalMatrix(root) * hierarchy.GetLocalMatrix(child) * hierarchy.GetLocalMatrix(leaf));
+
+	// changing a leaf only recomputes that leaf, changing the root recomputes its whole subtree but not the other root
+	hierarchy.SetLocalPosition(leaf, glm::vec3(0.0f, 0.0f, 1.0f));
+	EXPECT_EQ(hierarchy.Update(), 1);
+
+	hierarchy.SetLocalRotation(root, glm::angleAxis(1.0f, glm::vec3(0.0f, 1.0f, 0.0f)));
+	hierarchy.SetLocalScale(leaf, glm::vec3(2.0f));
+	EXPECT_EQ(hierarchy.Update(), 4);
+	ExpectMatricesNear(hierarchy.GetWorldMatrix(leaf),
+					   hierarchy.GetLocalMatrix(root) * hierarchy.GetLocalMatrix(child) * hierarchy.GetLocalMatrix(leaf));
+
+	// reparenting keeps the local transform and moves the world matrix of the subtree
+	hierarchy.SetParent(child, other);
+	EXPECT_EQ(hierarchy.GetParent(child), other);
+	EXPECT_EQ(hierarchy.Update(), 2);
+	ExpectMatricesNear(hierarchy.GetWorldMatrix(leaf),
+					   hierarchy.GetLocalMatrix(other) * hierarchy.GetLocalMatrix(child) * hierarchy.GetLocalMatrix(leaf));
+	EXPECT_THROW(hierarchy.SetParent(other, leaf), std::runtime_error);
+
+	// destroying a node destroys its descendants, and handles to them stay invalid after their slots are reused
+	hierarchy.Destroy(other);
+	EXPECT_FALSE(hierarchy.IsAlive(child));
+	EXPECT_FALSE(hierarchy.IsAlive(leaf));
+	EXPECT_EQ(hierarchy.GetNodeCount(), 2);
+
+	Nexus::ECS::TransformNode reused = hierarchy.Create({}, second);
+	EXPECT_FALSE(hierarchy.IsAlive(leaf));
+	EXPECT_TRUE(hierarchy.IsAlive(reused));
+	EXPECT_EQ(hierarchy.GetParent(reused), second);
+	EXPECT_EQ(hierarchy.Update(), 1);
+	ExpectMatricesNear(hierarchy.GetWorldMatrix(reused), hierarchy.GetWorldMatrix(root));
+}
+
+TEST(TransformHierarchy, StructuralChangesKeepWorldMatricesConsistent)
+{
+	Nexus::ECS::TransformHierarchy		   hierarchy;
+	std::vector<Nexus::ECS::TransformNode> nodes = {};
+	std::mt19937						   random(5);
+
+	// nodes are created under random parents, reparented and destroyed, so most changes break the depth-first order between updates
+	for (int step = 0; step < 2000; step++)
+	{
+		std::erase_if(nodes, [&](Nexus::ECS::TransformNode node) { return !hierarchy.IsAlive(node); });
+		Nexus::ECS::TransformNode target = nodes.empty() ? Nexus::ECS::TransformNode {} : nodes[random() % nodes.size()];
+
+		uint32_t action = random() % 10;
+		if (action < 6 || nodes.size() < 4)
+		{
+			Nexus::ECS::LocalTransform transform = {.Position = glm::vec3((float)(random() % 5), 1.0f, (float)(random() % 3)),
+													.Rotation = glm::angleAxis(0.1f * (float)(random() % 10), glm::vec3(0.0f, 1.0f, 0.0f))};
+			nodes.push_back(hierarchy.Create(transform, random() % 4 == 0 ? Nexus::ECS::TransformNode {} : target));
+		}
+		else if (action < 9)
+		{
+			Nexus::ECS::TransformNode parent = random() % 4 == 0 ? Nexus::ECS::TransformNode {} : nodes[random() % nodes.size()];
+			if (!parent.IsValid() || !hierarchy.IsDescendant(parent, target))
+			{
+				hierarchy.SetParent(target, parent);
+				EXPECT_EQ(hierarchy.GetParent(target), parent);
+			}
+		}
+		else
+		{
+			hierarchy.Destroy(target);
+		}
+
+		if (step % 50 == 0)
+		{
+			hierarchy.Update();
+		}
+	}
+
+	hierarchy.Update();
+	std::erase_if(nodes, [&](Nexus::ECS::TransformNode node) { return !hierarchy.IsAlive(node); });
+	EXPECT_EQ(hierarchy.GetNodeCount(), nodes.size());
+
+	for (Nexus::ECS::TransformNode node : nodes)
+	{
+		glm::mat4 expected = hierarchy.GetLocalMatrix(node);
+		for (Nexus::ECS::TransformNode parent = hierarchy.GetParent(node); parent.IsValid(); parent = hierarchy.GetParent(parent))
+		{
+			expected = hierarchy.GetLocalMatrix(parent) * expected;
+		}
+
+		ExpectMatricesNear(hierarchy.GetWorldMatrix(node), expected);
+	}
+}
+
+TEST(LoadOperation, RunsMainThreadWorkInSlices)
+{
+	std::vector<int> order;
+
+	Nexus::LoadOperation operation;
+	operation.Start(
+		[&](Nexus::LoadOperation &op)
+		{
+			op.AddWork(1);
+
+			for (int i = 0; i < 4; i++)
+			{
+				op.EnqueueMainThreadWork(
+					[&, i]()
+					{
+						order.push_back(i);
+						std::this_thread::sleep_for(std::chrono::milliseconds(2));
+					});
+			}
+
+			op.CompleteWork();
+		});
+
+	// a zero budget still runs one item each update, so the load always moves forward
+	while (order.empty()) { operation.Update(Nexus::TimeSpan::FromMilliseconds(0)); }
+	EXPECT_EQ(order.size(), 1);
+	EXPECT_EQ(operation.GetStatus(), Nexus::LoadStatus::Loading);
+
+	float progress = operation.GetProgress();
+	EXPECT_GT(progress, 0.0f);
+	EXPECT_LT(progress, 1.0f);
+
+	EXPECT_EQ(operation.Wait(), Nexus::LoadStatus::Completed);
+	EXPECT_EQ(order, std::vector<int>({0, 1, 2, 3}));
+	EXPECT_EQ(operation.GetProgress(), 1.0f);
+}
+
+TEST(LoadOperation, CancellationAndFailure)
+{
+	std::atomic<bool> release  = false;
+	int				  executed = 0;
+
+	Nexus::LoadOperation cancelled;
+	cancelled.Start(
+		[&](Nexus::LoadOperation &op)
+		{
+			op.EnqueueMainThreadWork([&]() { executed++; });
+			while (!release) { std::this_thread::yield(); }
+			op.EnqueueMainThreadWork([&]() { executed++; });
+		});
+
+	// work that was queued before cancelling is discarded, and nothing can be queued after
+	cancelled.Cancel();
+	release = true;
+	EXPECT_EQ(cancelled.Wait(), Nexus::LoadStatus::Cancelled);
+	EXPECT_EQ(executed, 0);
+
+	Nexus::LoadOperation failed;
+	failed.Start(
+		[](Nexus::LoadOperation &op)
+		{
+			op.EnqueueMainThreadWork([]() { throw std::runtime_error("Missing texture"); });
+			op.EnqueueMainThreadWork([]() { FAIL() << "Work after a failure should not run"; });
+		});
+
+	EXPECT_EQ(failed.Wait(), Nexus::LoadStatus::Failed);
+	EXPECT_EQ(failed.GetError(), "Missing texture");
+
+	// anything else that main thread work throws also fails the operation instead of escaping from Update
+	Nexus::LoadOperation unknown;
+	unknown.Start([](Nexus::LoadOperation &op) { op.EnqueueMainThreadWork([]() { throw 42; }); });
+
+	EXPECT_EQ(unknown.Wait(), Nexus::LoadStatus::Failed);
+	EXPECT_EQ(unknown.GetError(), "Unknown error");
+}
+
+TEST(Frustum, ClassifiesBoxes)
+{
+	// an identity matrix gives a frustum covering -1 to 1 on each axis, and scaling it by half doubles that
+	Nexus::Graphics::Frustum identity(glm::mat4(1.0f));
+	EXPECT_EQ(identity.Test({.Min = glm::vec3(-0.5f), .Max = glm::vec3(0.5f)}), Nexus::Graphics::FrustumTest::Inside);
+	EXPECT_EQ(identity.Test({.Min = glm::vec3(0.5f), .Max = glm::vec3(1.5f)}), Nexus::Graphics::FrustumTest::Intersecting);
+	EXPECT_EQ(identity.Test({.Min = glm::vec3(-0.5f, 2.0f, -0.5f), .Max = glm::vec3(0.5f, 3.0f, 0.5f)}), Nexus::Graphics::FrustumTest::Outside);
+	EXPECT_EQ(identity.Test({.Min = glm::vec3(-0.5f, -0.5f, -3.0f), .Max = glm::vec3(0.5f, 0.5f, -2.0f)}), Nexus::Graphics::FrustumTest::Outside);
+
+	Nexus::Graphics::Frustum scaled(glm::scale(glm::mat4(1.0f), glm::vec3(0.5f)));
+	EXPECT_EQ(scaled.Test({.Min = glm::vec3(0.5f), .Max = glm::vec3(1.5f)}), Nexus::Graphics::FrustumTest::Inside);
+	EXPECT_EQ(scaled.Test({.Min = glm::vec3(1.5f), .Max = glm::vec3(2.5f)}), Nexus::Graphics::FrustumTest::Intersecting);
+
+	// a default frustum contains everything
+	Nexus::Graphics::Frustum everything;
+	EXPECT_EQ(everything.Test({.Min = glm::vec3(-1000.0f), .Max = glm::vec3(1000.0f)}), Nexus::Graphics::FrustumTest::Inside);
+}
+
+TEST(BoundingVolumeHierarchy, QueriesMatchBruteForce)
+{
+	std::mt19937						  rng(7);
+	std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+	std::uniform_real_distribution<float> size(0.1f, 2.0f);
+
+	auto randomBox = [&]()
+	{
+		glm::vec3 min = glm::vec3(position(rng), position(rng), position(rng));
+		return Nexus::Graphics::BoundingBox {.Min = min, .Max = min + glm::vec3(size(rng), size(rng), size(rng))};
+	};
+
+	Nexus::Graphics::BoundingVolumeHierarchy hierarchy;
+	std::map<uint32_t, uint32_t>			 proxies;
+	for (uint32_t i = 0; i < 2000; i++) { proxies[i] = hierarchy.Insert(randomBox(), i); }
+
+	// small movements stay inside the enlarged box and leave the tree alone, while large ones reinsert the leaf
+	Nexus::Graphics::BoundingBox nudged = hierarchy.GetFatBounds(proxies[0]).Inflate(-0.15f);
+	EXPECT_FALSE(hierarchy.Move(proxies[0], nudged));
+
+	for (uint32_t i = 0; i < 2000; i += 2) { hierarchy.Move(proxies[i], randomBox()); }
+	for (uint32_t i = 0; i < 2000; i += 3)
+	{
+		hierarchy.Remove(proxies[i]);
+		proxies.erase(i);
+	}
+
+	EXPECT_EQ(hierarchy.GetProxyCount(), proxies.size());
+	EXPECT_LE(hierarchy.GetHeight(), 2 * (uint32_t)std::ceil(std::log2((double)proxies.size())));
+
+	Nexus::Graphics::BoundingBox region	 = {.Min = glm::vec3(-20.0f), .Max = glm::vec3(10.0f, 30.0f, 5.0f)};
+	Nexus::Graphics::Frustum	 frustum = Nexus::Graphics::Frustum(glm::scale(glm::mat4(1.0f), glm::vec3(1.0f / 25.0f)));
+
+	std::vector<uint32_t> expectedBox;
+	std::vector<uint32_t> expectedFrustum;
+	for (const auto &[userData, proxy] : proxies)
+	{
+		const Nexus::Graphics::BoundingBox &bounds = hierarchy.GetFatBounds(proxy);
+		EXPECT_EQ(hierarchy.GetUserData(proxy), userData);
+
+		if (bounds.Overlaps(region))
+		{
+			expectedBox.push_back(userData);
+		}
+
+		if (frustum.Intersects(bounds))
+		{
+			expectedFrustum.push_back(userData);
+		}
+	}
+
+	std::vector<uint32_t> foundBox;
+	std::vector<uint32_t> foundFrustum;
+	hierarchy.Query(region, foundBox);
+	hierarchy.Query(frustum, foundFrustum);
+	std::sort(foundBox.begin(), foundBox.end());
+	std::sort(foundFrustum.begin(), foundFrustum.end());
+
+	EXPECT_FALSE(expectedBox.empty());
+	EXPECT_LT(expectedFrustum.size(), proxies.size());
+	EXPECT_EQ(foundBox, expectedBox);
+	EXPECT_EQ(foundFrustum, expectedFrustum);
+}
+
+TEST(RenderGraph, CullsUnusedPasses)
+{
+	using namespace Nexus::Graphics;
+
+	TextureDescription description = {};
+	description.Width			   = 64;
+	description.Height			   = 64;
+
+	RenderGraph			graph(nullptr);
+	RenderGraphResource output = graph.ImportRenderTarget("Output");
+	RenderGraphResource unused;
+
+	graph.AddPass(
+		"Unused",
+		[&](RenderGraphBuilder &builder)
+		{
+			unused = builder.CreateTexture("Unused", description);
+			builder.Write(unused, RenderGraphAccess::ColourAttachment);
+		},
+		nullptr);
+	graph.AddPass(
+		"Readback",
+		[&](RenderGraphBuilder &builder) { builder.SetSideEffects(); },
+		nullptr);
+	graph.AddPass(
+		"Present",
+		[&](RenderGraphBuilder &builder) { builder.Write(output, RenderGraphAccess::ColourAttachment); },
+		nullptr);
+	graph.Compile();
+
+	const std::vector<RenderGraphCompiledPass> &passes = graph.GetCompiledPasses();
+	ASSERT_EQ(passes.size(), 2);
+	EXPECT_EQ(passes[0].Name, "Readback");
+	EXPECT_EQ(passes[1].Name, "Present");
+	EXPECT_EQ(graph.GetStatistics().DeclaredPasses, 3);
+	EXPECT_EQ(graph.GetStatistics().TransientResources, 0);
+
+	// a transient resource cannot be read before something has written to it
+	graph.Reset();
+	graph.AddPass(
+		"Read",
+		[&](RenderGraphBuilder &builder)
+		{
+			RenderGraphResource texture = builder.CreateTexture("Texture", description);
+			builder.Read(texture, RenderGraphAccess::ShaderRead);
+			builder.SetSideEffects();
+		},
+		nullptr);
+	EXPECT_THROW(graph.Compile(), std::runtime_error);
+}
+
+TEST(RenderGraph, AliasesTransientResourcesAndPlacesBarriers)
+{
+	using namespace Nexus::Graphics;
+
+	TextureDescription description = {};
+	description.Width			   = 1280;
+	description.Height			   = 720;
+
+	RenderGraph						 graph(nullptr);
+	RenderGraphResource				 output = graph.ImportRenderTarget("Output");
+	std::vector<RenderGraphResource> textures(3);
+
+	// each pass reads the texture written by the previous pass and writes a new one, so only neighbouring textures are alive together
+	for (size_t i = 0; i <= textures.size(); i++)
+	{
+		graph.AddPass(
+			"Pass " + std::to_string(i),
+			[&, i](RenderGraphBuilder &builder)
+			{
+				if (i > 0)
+				{
+					builder.Read(textures[i - 1], RenderGraphAccess::ShaderRead);
+				}
+
+				if (i < textures.size())
+				{
+					textures[i] = builder.CreateTexture("Texture " + std::to_string(i), description);
+					builder.Write(textures[i], RenderGraphAccess::ColourAttachment);
+				}
+				else
+				{
+					builder.Write(output, RenderGraphAccess::ColourAttachment);
+				}
+			},
+			nullptr);
+	}
+	graph.Compile();
+
+	EXPECT_EQ(graph.GetStatistics().TransientResources, 3);
+	EXPECT_EQ(graph.GetStatistics().PhysicalResources, 2);
+	EXPECT_EQ(graph.GetPhysicalResource(textures[0]), graph.GetPhysicalResource(textures[2]));
+	EXPECT_NE(graph.GetPhysicalResource(textures[0]), graph.GetPhysicalResource(textures[1]));
+
+	const std::vector<RenderGraphCompiledPass> &passes = graph.GetCompiledPasses();
+	ASSERT_EQ(passes.size(), 4);
+
+	const RenderGraphBarrier *readBarrier = nullptr;
+	for (const RenderGraphBarrier &barrier : passes[1].Barriers)
+	{
+		if (barrier.Resource.Index == textures[0].Index)
+		{
+			readBarrier = &barrier;
+		}
+	}
+
+	ASSERT_NE(readBarrier, nullptr);
+	EXPECT_EQ(readBarrier->Layout, TextureLayout::ShaderReadOnlyOptimal);
+	EXPECT_EQ(readBarrier->BeforeAccess, BarrierAccess::ColourAttachmentWrite);
+	EXPECT_EQ(readBarrier->AfterAccess, BarrierAccess::ShaderRead);
+
+	// the third texture reuses the memory of the first, so it has to wait for the first texture to have been read
+	const RenderGraphBarrier &aliasBarrier = passes[2].Barriers.back();
+	EXPECT_EQ(aliasBarrier.Resource.Index, textures[2].Index);
+	EXPECT_EQ(aliasBarrier.Layout, TextureLayout::ColourAttachmentOptimal);
+	EXPECT_EQ(aliasBarrier.BeforeAccess, BarrierAccess::ShaderRead);
+
+	// compiling the next frame reuses the same physical resources rather than adding more
+	graph.Compile();
+	EXPECT_EQ(graph.GetStatistics().PhysicalResources, 2);
+}
+
+TEST(RenderGraph, ReadingAndWritingOnFirstUseAllocatesTheResource)
+{
+	using namespace Nexus::Graphics;
+
+	TextureDescription description = {};
+	description.Width			   = 256;
+	description.Height			   = 256;
+
+	RenderGraph			graph(nullptr);
+	RenderGraphResource output	= graph.ImportRenderTarget("Output");
+	RenderGraphResource texture = {};
+
+	// blending into a texture that has just been created loads its previous contents, so the first pass both reads and writes it
+	graph.AddPass(
+		"Accumulate",
+		[&](RenderGraphBuilder &builder)
+		{
+			texture = builder.CreateTexture("Accumulation", description);
+			builder.Read(texture, RenderGraphAccess::ColourAttachment);
+			builder.Write(texture, RenderGraphAccess::ColourAttachment);
+		},
+		nullptr);
+
+	graph.AddPass(
+		"Resolve",
+		[&](RenderGraphBuilder &builder)
+		{
+			builder.Read(texture, RenderGraphAccess::ShaderRead);
+			builder.Write(output, RenderGraphAccess::ColourAttachment);
+		},
+		nullptr);
+
+	ASSERT_NO_THROW(graph.Compile());
+	EXPECT_EQ(graph.GetStatistics().TransientResources, 1);
+	EXPECT_EQ(graph.GetStatistics().PhysicalResources, 1);
+	EXPECT_NE(graph.GetPhysicalResource(texture), UINT32_MAX);
+
+	const std::vector<RenderGraphCompiledPass> &passes = graph.GetCompiledPasses();
+	ASSERT_EQ(passes.size(), 2);
+	ASSERT_EQ(passes[0].Barriers.size(), 1);
+	EXPECT_EQ(passes[0].Barriers[0].Layout, TextureLayout::ColourAttachmentOptimal);
+	EXPECT_EQ(passes[0].Barriers[0].AfterAccess, BarrierAccess::ColourAttachmentWrite);
+
+	// a resource that is only read by its first pass has nothing to read from
+	RenderGraph			unwritten(nullptr);
+	RenderGraphResource target = unwritten.ImportRenderTarget("Output");
+	unwritten.AddPass(
+		"Sample",
+		[&](RenderGraphBuilder &builder)
+		{
+			builder.Read(builder.CreateTexture("Empty", description), RenderGraphAccess::ShaderRead);
+			builder.Write(target, RenderGraphAccess::ColourAttachment);
+		},
+		nullptr);
+
+	EXPECT_THROW(unwritten.Compile(), std::runtime_error);
+}
+
+TEST(FrameTracker, DefersDeletionUntilFrameSlotIsReused)
+{
+	Nexus::Graphics::FrameTracker tracker(nullptr, 3);
+	EXPECT_EQ(tracker.GetFrameIndex(), 0);
+
+	std::shared_ptr<int> resource = std::make_shared<int>(7);
+	std::weak_ptr<int>	 observer = resource;
+	tracker.DeferDeletion(std::move(resource));
+
+	// the resource stays alive while the frames that were recorded after it are in flight
+	tracker.BeginFrame();
+	tracker.BeginFrame();
+	EXPECT_EQ(tracker.GetFrameIndex(), 2);
+	EXPECT_FALSE(observer.expired());
+
+	tracker.BeginFrame();
+	EXPECT_EQ(tracker.GetFrameIndex(), 0);
+	EXPECT_EQ(tracker.GetFrameNumber(), 3);
+	EXPECT_TRUE(observer.expired());
+
+	tracker.DeferDeletion(std::make_shared<int>(8));
+	tracker.Flush();
+
+	Nexus::Graphics::PerFrame<int> values(tracker.GetFramesInFlight(), [](uint32_t frame) { return (int)frame * 10; });
+	tracker.BeginFrame();
+	EXPECT_EQ(values.Get(tracker), 10);
+	EXPECT_EQ(values.GetCount(), 3);
+
+	EXPECT_THROW(tracker.AcquireFence(), std::runtime_error);
+}
+
+TEST(RenderThread, RendersPacketsInOrderWithBoundedLatency)
+{
+	struct TestPacket : public Nexus::Graphics::FramePacket
+	{
+		int Value = 0;
+	};
+
+	std::mutex		 mutex;
+	std::vector<int> rendered;
+	std::atomic<int> maxAhead = 0;
+
+	std::unique_ptr<Nexus::Graphics::RenderThread> thread = nullptr;
+	thread = std::make_unique<Nexus::Graphics::RenderThread>(
+		[&](const Nexus::Graphics::FramePacket &packet)
+		{
+			// the producer can only be running the frames that are queued behind this one
+			int ahead = (int)(thread->GetSubmittedFrameCount() - packet.FrameNumber);
+			maxAhead  = std::max(maxAhead.load(), ahead);
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+			std::unique_lock<std::mutex> lock(mutex);
+			rendered.push_back(static_cast<const TestPacket &>(packet).Value);
+		},
+		2);
+
+	for (int i = 0; i < 20; i++)
+	{
+		std::unique_ptr<TestPacket> packet = std::make_unique<TestPacket>();
+		packet->Value					   = i;
+		thread->Submit(std::move(packet));
+	}
+
+	thread->WaitForIdle();
+	EXPECT_EQ(thread->GetRenderedFrameCount(), 20);
+	EXPECT_LE(maxAhead.load(), 2);
+
+	ASSERT_EQ(rendered.size(), 20);
+	for (int i = 0; i < 20; i++) { EXPECT_EQ(rendered[i], i); }
+}
+
+TEST(RenderThread, RethrowsRenderErrorsOnTheProducer)
+{
+	Nexus::Graphics::RenderThread thread([](const Nexus::Graphics::FramePacket &packet)
+										 { throw std::runtime_error("Failed to render"); });
+
+	thread.Submit(std::make_unique<Nexus::Graphics::FramePacket>());
+	EXPECT_THROW(thread.WaitForIdle(), std::runtime_error);
+	EXPECT_NO_THROW(thread.WaitForIdle());
+	EXPECT_THROW(thread.Submit(nullptr), std::runtime_error);
+}
+
+TEST(Profiler, CollectsScopesFromEveryThread)
+{
+	Nexus::Timings::Profiler &profiler = Nexus::Timings::Profiler::Get();
+	profiler.Flush();
+	profiler.Reset();
+
+	auto recordScopes = []()
+	{
+		for (int i = 0; i < 100; i++) { Nexus::Timings::ProfileScope scope(i % 2 == 0 ? "Even" : "Odd"); }
+	};
+
+	std::thread first(recordScopes);
+	std::thread second(recordScopes);
+	recordScopes();
+	first.join();
+	second.join();
+
+	profiler.Flush();
+	ASSERT_EQ(profiler.GetEvents().size(), 300);
+	EXPECT_EQ(profiler.GetResults().size(), 300);
+
+	std::set<uint32_t> threads;
+	for (const Nexus::Timings::ProfileEvent &event : profiler.GetEvents())
+	{
+		EXPECT_LE(event.Begin, event.End);
+		threads.insert(event.ThreadId);
+	}
+	EXPECT_EQ(threads.size(), 3);
+
+	// the binary format round trips, with names shared between events
+	Nexus::Timings::ProfileCapture capture = profiler.CreateCapture();
+	EXPECT_EQ(capture.Names.size(), 2);
+
+	std::stringstream binary;
+	capture.WriteBinary(binary);
+	Nexus::Timings::ProfileCapture loaded = Nexus::Timings::ProfileCapture::ReadBinary(binary);
+	ASSERT_EQ(loaded.Events.size(), capture.Events.size());
+	EXPECT_EQ(loaded.Names, capture.Names);
+	EXPECT_EQ(loaded.Events.back().End, capture.Events.back().End);
+	EXPECT_DOUBLE_EQ(loaded.TicksPerSecond, capture.TicksPerSecond);
+
+	std::stringstream trace;
+	capture.WriteChromeTrace(trace);
+	EXPECT_NE(trace.str().find("\"name\":\"Even\",\"ph\":\"X\""), std::string::npos);
+
+	std::stringstream invalid("not a capture");
+	EXPECT_THROW(Nexus::Timings::ProfileCapture::ReadBinary(invalid), std::runtime_error);
+
+	profiler.Reset();
+}
+
+TEST(Profiler, ReusesTheBuffersOfExitedThreadsOnceFlushed)
+{
+	Nexus::Timings::Profiler &profiler = Nexus::Timings::Profiler::Get();
+	profiler.Flush();
+	profiler.Reset();
+
+	auto recordScope = []() { Nexus::Timings::ProfileScope scope("Thread"); };
+
+	size_t bufferCount = profiler.GetThreadBufferCount();
+	for (int i = 0; i < 8; i++)
+	{
+		std::thread thread(recordScope);
+		thread.join();
+		profiler.Flush();
+	}
+	EXPECT_LE(profiler.GetThreadBufferCount() - bufferCount, 1);
+	EXPECT_EQ(profiler.GetEvents().size(), 8);
+	profiler.Reset();
+
+	// a buffer that still holds events is not handed to the next thread, so nothing recorded before a thread exits is lost
+	std::thread first(recordScope);
+	first.join();
+	std::thread second(recordScope);
+	second.join();
+	profiler.Flush();
+
+	ASSERT_EQ(profiler.GetEvents().size(), 2);
+	EXPECT_NE(profiler.GetEvents()[0].ThreadId, profiler.GetEvents()[1].ThreadId);
+	profiler.Reset();
+}
+
+TEST(Profiler, DropsEventsWhenAThreadBufferIsFullAndRecordsGpuTimes)
+{
+	class FixedTimingQuery : public Nexus::Graphics::TimingQuery
+	{
+	  public:
+		void Resolve() override
+		{
+		}
+
+		float GetElapsedMilliseconds() override
+		{
+			return 2.0f;
+		}
+	};
+
+	Nexus::Timings::Profiler &profiler = Nexus::Timings::Profiler::Get();
+	profiler.Flush();
+	profiler.Reset();
+
+	uint64_t dropped = profiler.GetDroppedEventCount();
+	for (uint32_t i = 0; i < Nexus::Timings::Profiler::c_ThreadBufferCapacity + 10; i++) { profiler.Record("Full", i, i + 1); }
+	EXPECT_EQ(profiler.GetDroppedEventCount() - dropped, 10);
+
+	profiler.Flush();
+	EXPECT_EQ(profiler.GetEvents().size(), Nexus::Timings::Profiler::c_ThreadBufferCapacity);
+	profiler.Reset();
+
+	FixedTimingQuery query;
+	uint64_t		 submitted = Nexus::Timings::Profiler::GetTicks();
+	profiler.RecordGpu("Draw", query, submitted);
+	profiler.Flush();
+
+	ASSERT_EQ(profiler.GetEvents().size(), 1);
+	const Nexus::Timings::ProfileEvent &event = profiler.GetEvents()[0];
+	EXPECT_EQ(event.ThreadId, Nexus::Timings::Profiler::c_GpuThreadId);
+	EXPECT_EQ(event.Begin, submitted);
+	EXPECT_NEAR(profiler.GetResults()[0].Time.GetMilliseconds<double>(), 2.0, 0.01);
+
+	profiler.Reset();
+}
+
+class CapturingLogSink : public Nexus::LogSink
+{
+  public:
+	void Write(std::span<const Nexus::Log> logs) override
+	{
+		Batches++;
+		Logs.insert(Logs.end(), logs.begin(), logs.end());
+	}
+
+	std::vector<Nexus::Log> Logs	= {};
+	uint32_t				Batches = 0;
+};
+
+TEST(Logger, WritesLogsFromManyThreadsInBatches)
+{
+	std::shared_ptr<CapturingLogSink> sink = std::make_shared<CapturingLogSink>();
+
+	Nexus::Logger logger(100);
+	logger.AddSink(sink);
+	logger.SetLevel(Nexus::Severity::Info);
+
+	std::vector<std::thread> threads;
+	for (int thread = 0; thread < 4; thread++)
+	{
+		threads.emplace_back(
+			[&, thread]()
+			{
+				for (int i = 0; i < 200; i++)
+				{
+					logger.Write(Nexus::Severity::Info, std::source_location::current(), "{} {}", thread, i);
+					logger.LogDebug("Filtered out");
+				}
+			});
+	}
+
+	for (std::thread &thread : threads) { thread.join(); }
+	logger.Flush();
+
+	// every thread's logs arrive in the order that the thread wrote them
+	ASSERT_EQ(sink->Logs.size(), 800);
+	EXPECT_LT(sink->Batches, 800);
+	std::array<int, 4> next = {};
+	for (const Nexus::Log &log : sink->Logs)
+	{
+		int thread = 0, index = 0;
+		std::istringstream(log.Message) >> thread >> index;
+		EXPECT_EQ(index, next[thread]++);
+		EXPECT_EQ(log.MessageSeverity, Nexus::Severity::Info);
+	}
+
+	// only the most recent logs are kept in memory
+	std::vector<Nexus::Log> history = logger.GetLogs();
+	ASSERT_EQ(history.size(), 100);
+	EXPECT_EQ(history.back().Message, sink->Logs.back().Message);
+}
+
+TEST(Logger, WritesLogsOnTheCallingThreadOnceStopped)
+{
+	std::shared_ptr<CapturingLogSink> sink = std::make_shared<CapturingLogSink>();
+
+	Nexus::Logger logger;
+	logger.AddSink(sink);
+	logger.LogInfo("Queued");
+	logger.Stop();
+	ASSERT_EQ(sink->Logs.size(), 1);
+
+	// the background thread has been joined, so the log has to be written before the call returns
+	logger.LogError("After stopping");
+	ASSERT_EQ(sink->Logs.size(), 2);
+	EXPECT_EQ(sink->Logs.back().Message, "After stopping");
+
+	logger.Flush();
+	logger.Stop();
+	EXPECT_EQ(logger.GetLogs().size(), 2);
+}
+
+TEST(Logger, OrdersDebugBelowTheExistingSeverities)
+{
+	// the existing severities keep their values, so levels that were stored as integers still mean the same thing
+	EXPECT_EQ((int)Nexus::Severity::Info, 0);
+	EXPECT_EQ((int)Nexus::Severity::Warning, 1);
+	EXPECT_EQ((int)Nexus::Severity::Error, 2);
+	EXPECT_STREQ(Nexus::GetSeverityName(Nexus::Severity::Debug), "DEBUG");
+
+	Nexus::Logger logger;
+	EXPECT_TRUE(logger.ShouldLog(Nexus::Severity::Debug));
+
+	logger.SetLevel(Nexus::Severity::Info);
+	EXPECT_FALSE(logger.ShouldLog(Nexus::Severity::Debug));
+	EXPECT_TRUE(logger.ShouldLog(Nexus::Severity::Info));
+
+	logger.SetLevel(Nexus::Severity::Warning);
+	EXPECT_FALSE(logger.ShouldLog(Nexus::Severity::Info));
+	EXPECT_TRUE(logger.ShouldLog(Nexus::Severity::Error));
+	logger.Stop();
+}
+
+TEST(Logger, RotatesLogFiles)
+{
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / "NexusLoggerTest";
+	std::filesystem::remove_all(directory);
+	std::filesystem::path path = directory / "Test.log";
+
+	{
+		Nexus::Logger logger;
+		logger.AddSink(std::make_shared<Nexus::RotatingFileLogSink>(path, 256, 2));
+		for (int i = 0; i < 50; i++) { logger.LogWarning("Message " + std::to_string(i)); }
+	}
+
+	EXPECT_TRUE(std::filesystem::exists(path));
+	EXPECT_TRUE(std::filesystem::exists(path.string() + ".1"));
+	EXPECT_TRUE(std::filesystem::exists(path.string() + ".2"));
+	EXPECT_FALSE(std::filesystem::exists(path.string() + ".3"));
+	EXPECT_LE(std::filesystem::file_size(path.string() + ".1"), 256);
+
+	// the newest message is in the current file
+	std::ifstream file(path);
+	std::string	  contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	EXPECT_NE(contents.find("[WARNING]"), std::string::npos);
+	EXPECT_NE(contents.find("Message 49\n"), std::string::npos);
+
+	file.close();
+	std::filesystem::remove_all(directory);
+}
+
+TEST(Tangents, MatchReferenceFramesOnIndexedMeshes)
+{
+	using namespace Nexus::Graphics;
+
+	// a quad in the XY plane whose texture coordinates follow X and Y, with its right half mirrored horizontally
+	std::vector<VertexPositionTexCoordNormal> vertices = {{{0, 0, 0}, {0, 0}, {0, 0, 1}},
+														  {{1, 0, 0}, {1, 0}, {0, 0, 1}},
+														  {{1, 1, 0}, {1, 1}, {0, 0, 1}},
+														  {{0, 1, 0}, {0, 1}, {0, 0, 1}},
+														  {{2, 0, 0}, {0, 0}, {0, 0, 1}},
+														  {{2, 1, 0}, {0, 1}, {0, 0, 1}}};
+	std::vector<uint32_t>					  indices  = {0, 1, 2, 2, 3, 0, 1, 4, 5, 5, 2, 1};
+
+	std::vector<VertexPositionTexCoordNormalTangentBitangent> output = Utilities::GenerateTangentAndBinormals(vertices, indices);
+	ASSERT_EQ(output.size(), vertices.size());
+
+	for (uint32_t i : {0, 3})
+	{
+		EXPECT_NEAR(glm::distance(output[i].Tangent, glm::vec3(1, 0, 0)), 0.0f, 1e-5f);
+		EXPECT_NEAR(glm::distance(output[i].Bitangent, glm::vec3(0, 1, 0)), 0.0f, 1e-5f);
+	}
+
+	for (uint32_t i : {4, 5})
+	{
+		EXPECT_NEAR(glm::distance(output[i].Tangent, glm::vec3(-1, 0, 0)), 0.0f, 1e-5f);
+		EXPECT_NEAR(glm::distance(output[i].Bitangent, glm::vec3(0, 1, 0)), 0.0f, 1e-5f);
+	}
+
+	// a cylinder mapped around its circumference, whose tangents should follow the direction of increasing U
+	const uint32_t segments = 32;
+	MeshData	   cylinder = {};
+	for (uint32_t ring = 0; ring < 2; ring++)
+	{
+		for (uint32_t segment = 0; segment <= segments; segment++)
+		{
+			float	  angle	 = glm::two_pi<float>() * segment / segments;
+			glm::vec3 normal = glm::vec3(std::cos(angle), 0.0f, std::sin(angle));
+
+			VertexPositionTexCoordNormalColourTangentBitangent vertex;
+			vertex.Position	 = normal + glm::vec3(0.0f, (float)ring, 0.0f);
+			vertex.TexCoords = glm::vec2((float)segment / segments, (float)ring);
+			vertex.Normal	 = normal;
+			cylinder.vertices.push_back(vertex);
+		}
+	}
+
+	for (uint32_t segment = 0; segment < segments; segment++)
+	{
+		uint32_t bottom = segment, top = segment + segments + 1;
+		cylinder.indices.insert(cylinder.indices.end(), {bottom, top, bottom + 1, bottom + 1, top, top + 1});
+	}
+
+	Utilities::GenerateTangents(cylinder);
+	EXPECT_EQ(cylinder.vertices.size(), (segments + 1) * 2);
+
+	for (const VertexPositionTexCoordNormalColourTangentBitangent &vertex : cylinder.vertices)
+	{
+		float	  angle		= glm::two_pi<float>() * vertex.TexCoords.x;
+		glm::vec3 reference = glm::vec3(-std::sin(angle), 0.0f, std::cos(angle));
+		EXPECT_GT(glm::dot(vertex.Tangent, reference), 0.999f);
+		EXPECT_NEAR(glm::dot(vertex.Tangent, vertex.Normal), 0.0f, 1e-5f);
+		EXPECT_NEAR(std::abs(glm::dot(vertex.Bitangent, glm::vec3(0, 1, 0))), 1.0f, 1e-4f);
+	}
+}
+
+TEST(Tangents, ParallelGenerationMatchesSingleThreaded)
+{
+	using namespace Nexus::Graphics;
+
+	// a wavy grid that is large enough to be split across threads
+	const uint32_t							  size	   = 256;
+	std::vector<VertexPositionTexCoordNormal> vertices = {};
+	std::vector<uint32_t>					  indices  = {};
+	for (uint32_t y = 0; y <= size; y++)
+	{
+		for (uint32_t x = 0; x <= size; x++)
+		{
+			float	  height = std::sin(x * 0.1f) * std::cos(y * 0.1f);
+			glm::vec3 normal = glm::normalize(glm::vec3(-std::cos(x * 0.1f) * std::cos(y * 0.1f) * 0.1f, 1.0f, 0.0f));
+			vertices.push_back({{(float)x, height, (float)y}, {(float)x / size, (float)y / size}, normal});
+		}
+	}
+
+	for (uint32_t y = 0; y < size; y++)
+	{
+		for (uint32_t x = 0; x < size; x++)
+		{
+			uint32_t i = y * (size + 1) + x;
+			indices.insert(indices.end(), {i, i + size + 1, i + 1, i + 1, i + size + 1, i + size + 2});
+		}
+	}
+
+	std::vector<VertexPositionTexCoordNormalTangentBitangent> serial	 = Utilities::GenerateTangentAndBinormals(vertices, indices, 1);
+	std::vector<VertexPositionTexCoordNormalTangentBitangent> parallel = Utilities::GenerateTangentAndBinormals(vertices, indices, 8);
+
+	ASSERT_EQ(serial.size(), parallel.size());
+	for (size_t i = 0; i < serial.size(); i++)
+	{
+		ASSERT_EQ(serial[i].Tangent, parallel[i].Tangent);
+		ASSERT_EQ(serial[i].Bitangent, parallel[i].Bitangent);
+	}
+
+	// the second edge of a triangle is measured from its first vertex
+	std::vector<VertexPositionTexCoordNormalTangentBitangent> triangle =
+		Utilities::GenerateTangentAndBinormals({{{0, 0, 0}, {0, 0}, {0, 0, 1}}, {{1, 0, 0}, {1, 0}, {0, 0, 1}}, {{0, 1, 0}, {0, 1}, {0, 0, 1}}});
+	EXPECT_NEAR(glm::distance(triangle[2].Bitangent, glm::vec3(0, 1, 0)), 0.0f, 1e-5f);
+
+	EXPECT_THROW(Utilities::GenerateTangentAndBinormals(vertices, {0, 1, (uint32_t)vertices.size()}), std::runtime_error);
+}
+
+Nexus::Graphics::MeshData CreateSphereMeshData(float radius, uint32_t rings, uint32_t segments)
+{
+	Nexus::Graphics::MeshData sphere = {};
+	for (uint32_t ring = 0; ring <= rings; ring++)
+	{
+		for (uint32_t segment = 0; segment <= segments; segment++)
+		{
+			float	  theta	 = glm::pi<float>() * ring / rings;
+			float	  phi	 = glm::two_pi<float>() * segment / segments;
+			glm::vec3 normal = glm::vec3(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+
+			Nexus::Graphics::VertexPositionTexCoordNormalColourTangentBitangent vertex;
+			vertex.Position	 = normal * radius;
+			vertex.TexCoords = glm::vec2((float)segment / segments, (float)ring / rings);
+			vertex.Normal	 = normal;
+			sphere.vertices.push_back(vertex);
+		}
+	}
+
+	for (uint32_t ring = 0; ring < rings; ring++)
+	{
+		for (uint32_t segment = 0; segment < segments; segment++)
+		{
+			uint32_t i = ring * (segments + 1) + segment;
+			sphere.indices.insert(sphere.indices.end(), {i, i + segments + 1, i + 1, i + 1, i + segments + 1, i + segments + 2});
+		}
+	}
+
+	return sphere;
+}
+
+/// @brief Returns the triangles of a mesh by position, each rotated to start at its smallest corner so that the winding is kept
+std::vector<std::array<float, 9>> GetSortedTriangles(const Nexus::Graphics::MeshData &mesh)
+{
+	std::vector<std::array<float, 9>> triangles = {};
+	for (size_t i = 0; i < mesh.indices.size(); i += 3)
+	{
+		std::array<std::array<float, 3>, 3> corners = {};
+		for (size_t corner = 0; corner < 3; corner++)
+		{
+			const glm::vec3 &position = mesh.vertices[mesh.indices[i + corner]].Position;
+			corners[corner]			  = {position.x, position.y, position.z};
+		}
+
+		std::rotate(corners.begin(), std::min_element(corners.begin(), corners.end()), corners.end());
+
+		std::array<float, 9> triangle = {};
+		for (size_t corner = 0; corner < 3; corner++) { std::copy(corners[corner].begin(), corners[corner].end(), triangle.begin() + corner * 3); }
+		triangles.push_back(triangle);
+	}
+
+	std::sort(triangles.begin(), triangles.end());
+	return triangles;
+}
+
+TEST(MeshOptimizer, ImprovesShuffledTriangleSoup)
+{
+	using namespace Nexus::Graphics;
+
+	// a sphere drawn as a triangle soup in a random order, which is the worst case for both caches
+	MeshData			  sphere = CreateSphereMeshData(1.0f, 64, 64);
+	std::vector<uint32_t> triangles(sphere.indices.size() / 3);
+	std::iota(triangles.begin(), triangles.end(), 0);
+	std::shuffle(triangles.begin(), triangles.end(), std::mt19937(42));
+
+	MeshData soup = {};
+	for (uint32_t triangle : triangles)
+	{
+		for (uint32_t corner = 0; corner < 3; corner++)
+		{
+			soup.indices.push_back((uint32_t)soup.vertices.size());
+			soup.vertices.push_back(sphere.vertices[sphere.indices[triangle * 3 + corner]]);
+		}
+	}
+
+	std::vector<std::array<float, 9>> expectedTriangles = GetSortedTriangles(soup);
+
+	MeshOptimizationReport report = MeshOptimizer::OptimizeMesh(soup);
+	EXPECT_EQ(report.VerticesBefore, sphere.indices.size());
+	EXPECT_EQ(report.VerticesAfter, sphere.vertices.size());
+	EXPECT_FLOAT_EQ(report.Before.ACMR, 3.0f);
+	EXPECT_FLOAT_EQ(report.Before.ATVR, 1.0f);
+
+	EXPECT_LT(report.After.ACMR, 0.8f);
+	EXPECT_LT(report.After.ATVR, 1.6f);
+	EXPECT_LT(report.After.OverfetchRatio, 1.5f);
+	EXPECT_EQ(GetSortedTriangles(soup), expectedTriangles);
+
+	// the original sphere shares its vertices but draws them ring by ring, which a 16 entry cache cannot hold
+	MeshStatistics sphereBefore = MeshOptimizer::AnalyzeMesh(sphere);
+	MeshOptimizer::OptimizeMesh(sphere);
+	MeshStatistics sphereAfter = MeshOptimizer::AnalyzeMesh(sphere);
+	EXPECT_LT(sphereAfter.ACMR, sphereBefore.ACMR);
+	EXPECT_LT(sphereAfter.ATVR, sphereBefore.ATVR);
+
+	MeshData invalid = {.vertices = soup.vertices, .indices = {0, 1}};
+	EXPECT_THROW(MeshOptimizer::OptimizeVertexCache(invalid), std::runtime_error);
+}
+
+TEST(MeshOptimizer, DrawsOuterSurfacesBeforeInnerOnes)
+{
+	using namespace Nexus::Graphics;
+
+	// a sphere inside another sphere, with the hidden inner sphere listed first
+	MeshData inner = CreateSphereMeshData(0.5f, 24, 24);
+	MeshData outer = CreateSphereMeshData(1.0f, 24, 24);
+
+	MeshData mesh = inner;
+	for (uint32_t index : outer.indices) { mesh.indices.push_back(index + (uint32_t)inner.vertices.size()); }
+	mesh.vertices.insert(mesh.vertices.end(), outer.vertices.begin(), outer.vertices.end());
+
+	std::vector<std::array<float, 9>> expectedTriangles = GetSortedTriangles(mesh);
+
+	MeshOptimizer::OptimizeVertexCache(mesh);
+	MeshStatistics cacheOptimized = MeshOptimizer::AnalyzeMesh(mesh);
+
+	MeshOptimizer::OptimizeOverdraw(mesh);
+	MeshStatistics overdrawOptimized = MeshOptimizer::AnalyzeMesh(mesh);
+
+	EXPECT_LE(overdrawOptimized.ACMR, cacheOptimized.ACMR * MeshOptimizer::c_DefaultOverdrawThreshold + 0.01f);
+	EXPECT_EQ(GetSortedTriangles(mesh), expectedTriangles);
+
+	size_t outerTriangles = outer.indices.size() / 3;
+	for (size_t i = 0; i < mesh.indices.size() / 3; i++)
+	{
+		float distance = glm::length(mesh.vertices[mesh.indices[i * 3]].Position);
+		ASSERT_EQ(distance > 0.75f, i < outerTriangles) << "Triangle " << i;
+	}
+}
+
+TEST(MeshSimplifier, ReducesToTheTriangleBudgetWithinTheErrorBound)
+{
+	using namespace Nexus::Graphics;
+
+	MeshData sphere = CreateSphereMeshData(1.0f, 32, 32);
+	MeshOptimizer::DeduplicateVertices(sphere);
+
+	size_t	budget = sphere.indices.size() / 4 / 3 * 3;
+	MeshLod lod	   = MeshSimplifier::Simplify(sphere, budget);
+	EXPECT_LE(lod.Indices.size(), budget);
+	EXPECT_GT(lod.Error, 0.0f);
+
+	// the distance from the simplified surface to the sphere is measured at points spread over each of its triangles
+	float deviation = 0.0f;
+	for (size_t i = 0; i < lod.Indices.size(); i += 3)
+	{
+		glm::vec3 p0 = sphere.vertices[lod.Indices[i + 0]].Position;
+		glm::vec3 p1 = sphere.vertices[lod.Indices[i + 1]].Position;
+		glm::vec3 p2 = sphere.vertices[lod.Indices[i + 2]].Position;
+
+		for (uint32_t a = 0; a <= 8; a++)
+		{
+			for (uint32_t b = 0; a + b <= 8; b++)
+			{
+				glm::vec3 point = p0 + (p1 - p0) * (a / 8.0f) + (p2 - p0) * (b / 8.0f);
+				deviation		= std::max(deviation, 1.0f - glm::length(point));
+			}
+		}
+	}
+	EXPECT_LE(deviation, lod.Error);
+
+	// a tighter bound stops the simplification before the budget is reached
+	MeshLod bounded = MeshSimplifier::Simplify(sphere, 0, 0.02f);
+	EXPECT_LE(bounded.Error, 0.02f);
+	EXPECT_GT(bounded.Indices.size(), lod.Indices.size());
+	EXPECT_LT(bounded.Indices.size(), sphere.indices.size());
+
+	// a flat grid collapses down to its border without any error
+	MeshData grid = {};
+	for (uint32_t y = 0; y <= 16; y++)
+	{
+		for (uint32_t x = 0; x <= 16; x++)
+		{
+			VertexPositionTexCoordNormalColourTangentBitangent vertex;
+			vertex.Position = glm::vec3((float)x, 0.0f, (float)y);
+			vertex.Normal	= glm::vec3(0.0f, 1.0f, 0.0f);
+			grid.vertices.push_back(vertex);
+		}
+	}
+
+	for (uint32_t y = 0; y < 16; y++)
+	{
+		for (uint32_t x = 0; x < 16; x++)
+		{
+			uint32_t i = y * 17 + x;
+			grid.indices.insert(grid.indices.end(), {i, i + 17, i + 1, i + 1, i + 17, i + 18});
+		}
+	}
+
+	MeshLod flat = MeshSimplifier::Simplify(grid, 0);
+	EXPECT_FLOAT_EQ(flat.Error, 0.0f);
+	EXPECT_LT(flat.Indices.size(), grid.indices.size() / 4);
+}
+
+TEST(MeshSimplifier, GeneratesDeterministicLodChains)
+{
+	using namespace Nexus::Graphics;
+
+	MeshData sphere = CreateSphereMeshData(1.0f, 48, 48);
+	MeshOptimizer::DeduplicateVertices(sphere);
+
+	MeshData copy = sphere;
+	MeshSimplifier::GenerateLods(sphere);
+	MeshSimplifier::GenerateLods(copy);
+
+	ASSERT_GE(sphere.lods.size(), 2u);
+	ASSERT_EQ(sphere.lods.size(), copy.lods.size());
+
+	size_t previousIndexCount = sphere.indices.size();
+	float  previousError	  = 0.0f;
+	for (size_t i = 0; i < sphere.lods.size(); i++)
+	{
+		EXPECT_EQ(sphere.lods[i].Indices, copy.lods[i].Indices);
+		EXPECT_LE(sphere.lods[i].Indices.size(), previousIndexCount / 2 / 3 * 3);
+		EXPECT_GE(sphere.lods[i].Error, previousError);
+
+		previousIndexCount = sphere.lods[i].Indices.size();
+		previousError	   = sphere.lods[i].Error;
+	}
+}
+
+TEST(MeshSimplifier, SelectsLodsWithHysteresis)
+{
+	using namespace Nexus::Graphics;
+
+	std::vector<MeshLodRange> lods = {{.IndexStart = 0, .IndexCount = 3000, .Error = 0.0f},
+									  {.IndexStart = 3000, .IndexCount = 1500, .Error = 0.01f},
+									  {.IndexStart = 4500, .IndexCount = 750, .Error = 0.1f}};
+	Mesh					  mesh(nullptr, nullptr, Material {}, "Mesh", {}, lods);
+
+	LodSelectionSettings settings = {.MaxScreenSpaceError = 1.0f, .Hysteresis = 0.25f};
+
+	// close to the camera an error of 0.01 covers several pixels, far away even the coarsest level fits within a pixel
+	EXPECT_EQ(mesh.SelectLod(1000.0f, 0, settings), 0u);
+	EXPECT_EQ(mesh.SelectLod(50.0f, 0, settings), 1u);
+	EXPECT_EQ(mesh.SelectLod(5.0f, 0, settings), 2u);
+
+	// at 9 pixels per unit the coarsest level has an error of 0.9 pixels, which is only used once it is already being drawn
+	EXPECT_EQ(mesh.SelectLod(9.0f, 1, settings), 1u);
+	EXPECT_EQ(mesh.SelectLod(9.0f, 2, settings), 2u);
+	EXPECT_EQ(mesh.SelectLod(11.0f, 2, settings), 1u);
+}
+
+TEST(VertexQuantization, OctahedralEncodingRoundTripsDirections)
+{
+	using namespace Nexus::Graphics;
+
+	std::vector<glm::vec3> directions = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}, {1, -1, -1}};
+
+	std::mt19937						  random(42);
+	std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+	while (directions.size() < 100000)
+	{
+		glm::vec3 direction = glm::vec3(distribution(random), distribution(random), distribution(random));
+		if (glm::length(direction) > 0.01f)
+		{
+			directions.push_back(direction);
+		}
+	}
+
+	float maxError = 0.0f;
+	for (const glm::vec3 &direction : directions)
+	{
+		glm::vec3 decoded = VertexQuantization::DecodeOctahedral(VertexQuantization::EncodeOctahedral(direction));
+		maxError		  = std::max(maxError, glm::length(decoded - glm::normalize(direction)));
+	}
+
+	// 16 bit octahedral coordinates are accurate to roughly 0.003 degrees
+	EXPECT_LT(maxError, 6e-5f);
+
+	// a missing direction decodes to a valid one instead of NaN
+	EXPECT_EQ(VertexQuantization::DecodeOctahedral(VertexQuantization::EncodeOctahedral(glm::vec3(0.0f))), glm::vec3(0.0f, 0.0f, 1.0f));
+}
+
+TEST(VertexQuantization, RoundTripsMeshVerticesWithinTheirPrecision)
+{
+	using namespace Nexus::Graphics;
+
+	EXPECT_EQ(sizeof(VertexPositionTexCoordNormalColourTangentBitangent), 3 * sizeof(VertexQuantizedPositionTexCoordNormalColourTangent));
+	EXPECT_EQ(VertexQuantizedPositionTexCoordNormalColourTangent::GetLayout().GetStride(),
+			  sizeof(VertexQuantizedPositionTexCoordNormalColourTangent));
+	EXPECT_EQ(VertexQuantizedPositionTexCoordNormalColourTangent::GetLayout().GetElement(4).Offset,
+			  offsetof(VertexQuantizedPositionTexCoordNormalColourTangent, Colour));
+
+	MeshData mesh = CreateSphereMeshData(10.0f, 32, 32);
+	Utilities::GenerateTangents(mesh);
+
+	std::mt19937						  random(7);
+	std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+	for (size_t i = 0; i < mesh.vertices.size(); i++)
+	{
+		VertexPositionTexCoordNormalColourTangentBitangent &vertex = mesh.vertices[i];
+		vertex.Position += glm::vec3(100.0f, -20.0f, 5.0f);
+		vertex.TexCoords *= 4.0f;
+		vertex.Colour = glm::vec4(distribution(random), distribution(random), distribution(random), distribution(random));
+
+		// mirror the texture coordinates of every other vertex
+		if (i % 2 == 1)
+		{
+			vertex.Bitangent = -vertex.Bitangent;
+		}
+	}
+
+	VertexDequantization											 dequantization = VertexQuantization::CalculateDequantization(mesh);
+	std::vector<VertexQuantizedPositionTexCoordNormalColourTangent> quantized	    = VertexQuantization::QuantizeVertices(mesh, dequantization);
+	ASSERT_EQ(quantized.size(), mesh.vertices.size());
+
+	// each value can be up to half a step away from the original, with some room for rounding in floating point
+	glm::vec3 positionStep = dequantization.PositionScale / 32767.0f;
+	glm::vec2 texCoordStep = dequantization.TexCoordScale / 65535.0f;
+	for (size_t i = 0; i < mesh.vertices.size(); i++)
+	{
+		const VertexPositionTexCoordNormalColourTangentBitangent &original = mesh.vertices[i];
+		VertexPositionTexCoordNormalColourTangentBitangent		  decoded  = VertexQuantization::DequantizeVertex(quantized[i], dequantization);
+
+		for (int axis = 0; axis < 3; axis++) { EXPECT_LE(std::abs(decoded.Position[axis] - original.Position[axis]), positionStep[axis] * 0.6f); }
+		for (int axis = 0; axis < 2; axis++) { EXPECT_LE(std::abs(decoded.TexCoords[axis] - original.TexCoords[axis]), texCoordStep[axis] * 0.6f); }
+		for (int channel = 0; channel < 4; channel++) { EXPECT_LE(std::abs(decoded.Colour[channel] - original.Colour[channel]), 0.6f / 255.0f); }
+
+		EXPECT_LT(glm::length(decoded.Normal - glm::normalize(original.Normal)), 6e-5f);
+		EXPECT_LT(glm::length(decoded.Tangent - glm::normalize(original.Tangent)), 6e-5f);
+		EXPECT_LT(glm::length(decoded.Bitangent - glm::normalize(original.Bitangent)), 1e-3f);
+	}
+}
+
+TEST(MeshletBuilder, CoversEveryTriangleWithinTheLimits)
+{
+	using namespace Nexus::Graphics;
+
+	MeshData sphere = CreateSphereMeshData(1.0f, 64, 64);
+	MeshOptimizer::OptimizeMesh(sphere);
+
+	for (auto [maxVertices, maxTriangles] : {std::pair<uint32_t, uint32_t> {64, 124}, std::pair<uint32_t, uint32_t> {32, 40}})
+	{
+		MeshletData meshlets = MeshletBuilder::BuildMeshlets(sphere, maxVertices, maxTriangles);
+		ASSERT_EQ(meshlets.Meshlets.size(), meshlets.Bounds.size());
+
+		// rebuilding the index buffer from the meshlets gives back every triangle with the same winding
+		MeshData rebuilt = {.vertices = sphere.vertices};
+		for (const Meshlet &meshlet : meshlets.Meshlets)
+		{
+			EXPECT_GT(meshlet.TriangleCount, 0u);
+			EXPECT_LE(meshlet.VertexCount, maxVertices);
+			EXPECT_LE(meshlet.TriangleCount, maxTriangles);
+
+			for (uint32_t i = 0; i < meshlet.TriangleCount; i++)
+			{
+				for (uint32_t corner : MeshletBuilder::UnpackTriangle(meshlets.Triangles[meshlet.TriangleOffset + i]))
+				{
+					ASSERT_LT(corner, meshlet.VertexCount);
+					rebuilt.indices.push_back(meshlets.VertexIndices[meshlet.VertexOffset + corner]);
+				}
+			}
+		}
+		EXPECT_EQ(GetSortedTriangles(rebuilt), GetSortedTriangles(sphere));
+
+		// away from its poles a UV sphere shares each vertex between six triangles, so well clustered meshlets need far fewer vertices than
+		// three per triangle
+		float verticesPerTriangle = (float)meshlets.VertexIndices.size() / (float)meshlets.Triangles.size();
+		float averageTriangles	  = (float)meshlets.Triangles.size() / (float)meshlets.Meshlets.size();
+		EXPECT_LT(verticesPerTriangle, 0.9f);
+		EXPECT_GT(averageTriangles, maxTriangles * 0.5f);
+	}
+
+	EXPECT_THROW(MeshletBuilder::BuildMeshlets(sphere, 257, 124), std::runtime_error);
+	EXPECT_THROW(MeshletBuilder::BuildMeshlets(sphere, 64, 0), std::runtime_error);
+	EXPECT_TRUE(MeshletBuilder::BuildMeshlets(MeshData {}).Meshlets.empty());
+}
+
+TEST(MeshletBuilder, BoundsContainVerticesAndConesOnlyCullBackfacingMeshlets)
+{
+	using namespace Nexus::Graphics;
+
+	MeshData sphere = CreateSphereMeshData(1.0f, 64, 64);
+	MeshOptimizer::OptimizeMesh(sphere);
+	MeshletData meshlets = MeshletBuilder::BuildMeshlets(sphere);
+
+	std::mt19937						  random(3);
+	std::uniform_real_distribution<float> distribution(-4.0f, 4.0f);
+	std::vector<glm::vec3>				  cameras = {glm::vec3(0.0f, 0.0f, 3.0f)};
+	while (cameras.size() < 64)
+	{
+		cameras.push_back(glm::vec3(distribution(random), distribution(random), distribution(random)));
+	}
+
+	size_t culled = 0;
+	for (size_t i = 0; i < meshlets.Meshlets.size(); i++)
+	{
+		const Meshlet		&meshlet = meshlets.Meshlets[i];
+		const MeshletBounds &bounds	 = meshlets.Bounds[i];
+
+		for (uint32_t j = 0; j < meshlet.VertexCount; j++)
+		{
+			glm::vec3 position = sphere.vertices[meshlets.VertexIndices[meshlet.VertexOffset + j]].Position;
+			EXPECT_LE(glm::distance(position, glm::vec3(bounds.Sphere)), bounds.Sphere.w * 1.0001f);
+		}
+
+		// a meshlet is only culled when the camera is behind the plane of every one of its triangles
+		for (const glm::vec3 &camera : cameras)
+		{
+			if (!MeshletBuilder::IsBackfacing(bounds, camera))
+			{
+				continue;
+			}
+
+			culled += camera == cameras[0] ? 1 : 0;
+			for (uint32_t j = 0; j < meshlet.TriangleCount; j++)
+			{
+				std::array<uint32_t, 3> triangle = MeshletBuilder::UnpackTriangle(meshlets.Triangles[meshlet.TriangleOffset + j]);
+				glm::vec3				p0		 = sphere.vertices[meshlets.VertexIndices[meshlet.VertexOffset + triangle[0]]].Position;
+				glm::vec3				p1		 = sphere.vertices[meshlets.VertexIndices[meshlet.VertexOffset + triangle[1]]].Position;
+				glm::vec3				p2		 = sphere.vertices[meshlets.VertexIndices[meshlet.VertexOffset + triangle[2]]].Position;
+				EXPECT_LE(glm::dot(camera - p0, glm::cross(p1 - p0, p2 - p0)), 1e-5f);
+			}
+		}
+	}
+
+	// two thirds of the sphere faces away from a camera at this distance, the meshlets near the silhouette are kept since their cones are
+	// conservative
+	EXPECT_GT(culled, meshlets.Meshlets.size() / 8);
+
+	// the frustum of the identity matrix is the cube from -1 to 1, so a meshlet moved out of it is culled even when it faces the camera
+	Frustum		  frustum(glm::mat4(1.0f));
+	MeshletBounds bounds = {.Sphere = glm::vec4(0.0f, 0.0f, 0.0f, 0.5f)};
+	EXPECT_TRUE(MeshletBuilder::IsVisible(bounds, frustum, glm::vec3(0.0f, 0.0f, 3.0f)));
+	bounds.Sphere = glm::vec4(1.4f, 0.0f, 0.0f, 0.5f);
+	EXPECT_TRUE(MeshletBuilder::IsVisible(bounds, frustum, glm::vec3(0.0f, 0.0f, 3.0f)));
+	bounds.Sphere = glm::vec4(1.6f, 0.0f, 0.0f, 0.5f);
+	EXPECT_FALSE(MeshletBuilder::IsVisible(bounds, frustum, glm::vec3(0.0f, 0.0f, 3.0f)));
+}
+
+TEST(Renderer3D, BatchesVisibleInstancesByMeshAndLod)
+{
+	using namespace Nexus::Graphics;
+
+	std::vector<MeshLodRange> lods		= {{.IndexStart = 0, .IndexCount = 300}, {.IndexStart = 300, .IndexCount = 90}};
+	Nexus::Ref<Mesh>		  first		= Nexus::CreateRef<Mesh>(nullptr, nullptr, Material {}, "First", BoundingBox {}, lods);
+	Nexus::Ref<Mesh>		  second	= Nexus::CreateRef<Mesh>(nullptr, nullptr, Material {}, "Second", BoundingBox {}, lods);
+	Nexus::Ref<Mesh>		  quantized = Nexus::CreateRef<Mesh>(nullptr, nullptr, Material {}, "Quantized", BoundingBox {}, lods);
+	quantized->SetVertexDequantization(VertexDequantization {});
+
+	// the instances of each mesh are interleaved, as they would be when several copies of a model are submitted
+	std::vector<MeshInstance> instances = {};
+	std::vector<uint32_t>	  visible	= {};
+	for (uint32_t i = 0; i < 30; i++)
+	{
+		for (const Nexus::Ref<Mesh> &mesh : {quantized, first, second})
+		{
+			visible.push_back((uint32_t)instances.size());
+			instances.push_back({.Mesh = mesh, .Lod = i % 3 == 0 ? 1u : 0u});
+		}
+	}
+
+	std::vector<MeshDrawBatch> batches = {};
+	BuildMeshDrawBatches(instances, visible, batches);
+	ASSERT_EQ(batches.size(), 6u);
+	ASSERT_EQ(visible.size(), instances.size());
+
+	// every visible instance is drawn by exactly one batch that matches its mesh and level of detail
+	uint32_t nextInstance = 0;
+	for (const MeshDrawBatch &batch : batches)
+	{
+		EXPECT_EQ(batch.FirstInstance, nextInstance);
+		EXPECT_EQ(batch.InstanceCount, batch.Lod == 0 ? 20u : 10u);
+		for (uint32_t i = batch.FirstInstance; i < batch.FirstInstance + batch.InstanceCount; i++)
+		{
+			EXPECT_EQ(instances[visible[i]].Mesh, batch.Mesh);
+			EXPECT_EQ(instances[visible[i]].Lod, batch.Lod);
+		}
+		nextInstance += batch.InstanceCount;
+	}
+	EXPECT_EQ(nextInstance, visible.size());
+
+	// the quantized mesh uses a different pipeline, so its batches come after the others instead of between them
+	EXPECT_EQ(batches[4].Mesh, quantized);
+	EXPECT_EQ(batches[5].Mesh, quantized);
+}
+
+TEST(Renderer3D, DrawsEachMeshOfAQuantizedModelWithItsOwnDequantization)
+{
+	using namespace Nexus::Graphics;
+
+	// the meshes of one model are quantized against their own bounds, so sharing one set of uniforms between them decodes all but one
+	// of them wrongly
+	std::vector<MeshLodRange> lods	 = {{.IndexStart = 0, .IndexCount = 300}};
+	Nexus::Ref<Mesh>		  body	 = Nexus::CreateRef<Mesh>(nullptr, nullptr, Material {}, "Body", BoundingBox {}, lods);
+	Nexus::Ref<Mesh>		  wheels = Nexus::CreateRef<Mesh>(nullptr, nullptr, Material {}, "Wheels", BoundingBox {}, lods);
+	body->SetVertexDequantization(VertexDequantization {.PositionOffset = glm::vec3(0.0f, 1.0f, 0.0f), .PositionScale = glm::vec3(4.0f)});
+	wheels->SetVertexDequantization(VertexDequantization {.PositionOffset = glm::vec3(0.0f), .PositionScale = glm::vec3(0.5f)});
+
+	std::vector<MeshInstance> instances = {};
+	std::vector<uint32_t>	  visible	= {};
+	for (uint32_t copy = 0; copy < 3; copy++)
+	{
+		for (const Nexus::Ref<Mesh> &mesh : {body, wheels})
+		{
+			visible.push_back((uint32_t)instances.size());
+			instances.push_back({.Mesh = mesh, .Guid = Nexus::GUID(copy + 1)});
+		}
+	}
+
+	std::vector<MeshDrawBatch> batches = {};
+	BuildMeshDrawBatches(instances, visible, batches);
+	ASSERT_EQ(batches.size(), 2u);
+
+	// each batch draws a single mesh, whose dequantization is what the renderer writes into that mesh's uniforms
+	std::set<Mesh *> drawn = {};
+	for (const MeshDrawBatch &batch : batches)
+	{
+		EXPECT_EQ(batch.InstanceCount, 3u);
+		drawn.insert(batch.Mesh.get());
+		for (uint32_t i = batch.FirstInstance; i < batch.FirstInstance + batch.InstanceCount; i++)
+		{
+			EXPECT_EQ(instances[visible[i]].Mesh, batch.Mesh);
+		}
+
+		const VertexDequantization &dequantization = *batch.Mesh->GetVertexDequantization();
+		ModelMeshUniforms			uniforms	   = CreateModelMeshUniforms(*batch.Mesh);
+		EXPECT_EQ(uniforms.PositionOffset, glm::vec4(dequantization.PositionOffset, 0.0f));
+		EXPECT_EQ(uniforms.PositionScale, glm::vec4(dequantization.PositionScale, 0.0f));
+	}
+	EXPECT_EQ(drawn.size(), 2u);
+
+	EXPECT_EQ(CreateModelMeshUniforms(*body).PositionOffset, glm::vec4(0.0f, 1.0f, 0.0f, 0.0f));
+	EXPECT_EQ(CreateModelMeshUniforms(*body).PositionScale, glm::vec4(4.0f, 4.0f, 4.0f, 0.0f));
+	EXPECT_EQ(CreateModelMeshUniforms(*wheels).PositionOffset, glm::vec4(0.0f));
+	EXPECT_EQ(CreateModelMeshUniforms(*wheels).PositionScale, glm::vec4(0.5f, 0.5f, 0.5f, 0.0f));
+
+	// meshes that are not quantized are decoded with an identity dequantization
+	Nexus::Ref<Mesh> plain = Nexus::CreateRef<Mesh>(nullptr, nullptr, Material {}, "Plain", BoundingBox {}, lods);
+	EXPECT_EQ(CreateModelMeshUniforms(*plain).PositionOffset, glm::vec4(0.0f));
+	EXPECT_EQ(CreateModelMeshUniforms(*plain).PositionScale, glm::vec4(1.0f, 1.0f, 1.0f, 0.0f));
+}
+
+TEST(CatmullRom, UniformSplineMatchesTheClassicFormula)
+{
+	using namespace Nexus::Graphics;
 
-	EXPECT_EQ(result.X, 5.0f);
-	EXPECT_EQ(result.Y, 7.0f);
+	std::vector<Nexus::Point2D<float>> points = {{100, 410}, {400, 310}, {700, 480}, {1000, 410}, {1200, 100}, {900, 50}};
+
+	for (bool looped : {false, true})
+	{
+		CatmullRom<float> spline;
+		spline.SetPoints(points);
+		spline.SetLooped(looped);
+		ASSERT_EQ(spline.GetNumberOfSegments(), looped ? points.size() : points.size() - 3);
+
+		for (float t = 0.0f; t < (float)spline.GetNumberOfSegments(); t += 0.01f)
+		{
+			// the formula that the spline used before it was converted into polynomials
+			size_t p1 = looped ? (size_t)t : (size_t)t + 1;
+			size_t p0 = (p1 + points.size() - 1) % points.size();
+			size_t p2 = (p1 + 1) % points.size();
+			size_t p3 = (p1 + 2) % points.size();
+			float  u  = t - (float)(size_t)t;
+
+			float q1 = -u * u * u + 2 * u * u - u;
+			float q2 = 3 * u * u * u - 5 * u * u + 2;
+			float q3 = -3 * u * u * u + 4 * u * u + u;
+			float q4 = u * u * u - u * u;
+
+			Nexus::Point2D<float> point = spline.GetPoint(t);
+			EXPECT_NEAR(point.X, (points[p0].X * q1 + points[p1].X * q2 + points[p2].X * q3 + points[p3].X * q4) / 2, 1e-3f);
+			EXPECT_NEAR(point.Y, (points[p0].Y * q1 + points[p1].Y * q2 + points[p2].Y * q3 + points[p3].Y * q4) / 2, 1e-3f);
+		}
+	}
 }
 
-TEST(Point2D, Deconstruct)
+TEST(CatmullRom, NonUniformSplinesInterpolateWithoutOvershooting)
 {
-	Nexus::Point2D<int> value(5, 7);
+	using namespace Nexus::Graphics;
 
-	int x, y;
-	value.Deconstruct(&x, &y);
+	// points along a line with very uneven spacing make the uniform spline double back on itself
+	std::vector<Nexus::Point2D<double>> points = {{0, 0}, {10, 0}, {10.5, 0.5}, {20, 0}, {30, 0}};
 
-	EXPECT_EQ(value.X, x);
-	EXPECT_EQ(value.Y, y);
+	for (CatmullRomParameterization parameterization :
+		 {CatmullRomParameterization::Uniform, CatmullRomParameterization::Centripetal, CatmullRomParameterization::Chordal})
+	{
+		CatmullRom<double> spline;
+		spline.SetParameterization(parameterization);
+		spline.SetPoints(points);
+
+		double minX = std::numeric_limits<double>::max();
+		double maxX = std::numeric_limits<double>::lowest();
+		for (size_t segment = 0; segment < spline.GetNumberOfSegments(); segment++)
+		{
+			EXPECT_NEAR(spline.GetPoint((double)segment).X, points[segment + 1].X, 1e-9);
+			EXPECT_NEAR(spline.GetPoint((double)segment).Y, points[segment + 1].Y, 1e-9);
+		}
+
+		for (double t = 0.0; t <= 1.0; t += 0.001)
+		{
+			minX = std::min(minX, spline.GetPoint(t).X);
+			maxX = std::max(maxX, spline.GetPoint(t).X);
+		}
+
+		bool overshoots = minX < points[1].X - 1e-9 || maxX > points[2].X + 1e-9;
+		EXPECT_EQ(overshoots, parameterization == CatmullRomParameterization::Uniform);
+	}
 }
 
-TEST(Point3D, To)
+TEST(CatmullRom, BatchedEvaluationMatchesSinglePoints)
 {
-	Nexus::Point3D<int>	  value(5, 7, 2);
-	Nexus::Point3D<float> result = value.To<float>();
+	using namespace Nexus::Graphics;
 
-	EXPECT_EQ(result.X, 5.0f);
-	EXPECT_EQ(result.Y, 7.0f);
-	EXPECT_EQ(result.Z, 2.0f);
+	std::vector<Nexus::Point3D<float>>	  points = {};
+	std::mt19937						  random(11);
+	std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+	for (size_t i = 0; i < 12; i++) { points.push_back({distribution(random), distribution(random), distribution(random)}); }
+
+	CatmullRom<float, 3> spline;
+	spline.SetParameterization(CatmullRomParameterization::Centripetal);
+	spline.SetPoints(points);
+
+	// the count is not a multiple of four and some parameters are outside of the spline, so every path of the batch is used
+	std::uniform_real_distribution<float> parameter(-1.0f, (float)spline.GetNumberOfSegments() + 1.0f);
+	std::vector<float>					  parameters(1003);
+	for (float &t : parameters) { t = parameter(random); }
+	parameters[0] = (float)spline.GetNumberOfSegments();
+
+	// NaN parameters are evaluated at the start of the spline, both in the vectorised lanes and in the scalar remainder
+	parameters[1]	 = std::numeric_limits<float>::quiet_NaN();
+	parameters[1002] = std::numeric_limits<float>::quiet_NaN();
+
+	std::vector<Nexus::Point3D<float>> batchPoints(parameters.size());
+	std::vector<Nexus::Point3D<float>> batchDerivatives(parameters.size());
+	spline.EvaluatePoints(parameters, batchPoints);
+	spline.EvaluateDerivatives(parameters, batchDerivatives);
+
+	for (size_t i = 0; i < parameters.size(); i++)
+	{
+		Nexus::Point3D<float> point		 = spline.GetPoint(parameters[i]);
+		Nexus::Point3D<float> derivative = spline.GetDerivative(parameters[i]);
+		EXPECT_NEAR(batchPoints[i].X, point.X, 1e-4f);
+		EXPECT_NEAR(batchPoints[i].Y, point.Y, 1e-4f);
+		EXPECT_NEAR(batchPoints[i].Z, point.Z, 1e-4f);
+		EXPECT_NEAR(batchDerivatives[i].X, derivative.X, 1e-4f);
+		EXPECT_NEAR(batchDerivatives[i].Y, derivative.Y, 1e-4f);
+		EXPECT_NEAR(batchDerivatives[i].Z, derivative.Z, 1e-4f);
+	}
+
+	EXPECT_NEAR(batchPoints[1].X, points[1].X, 1e-4f);
+	EXPECT_NEAR(batchPoints[1002].X, points[1].X, 1e-4f);
+
+	// the derivatives match central differences of the same spline in double precision
+	std::vector<Nexus::Point3D<double>> doublePoints = {};
+	for (const Nexus::Point3D<float> &point : points) { doublePoints.push_back(point.To<double>()); }
+
+	CatmullRom<double, 3> doubleSpline;
+	doubleSpline.SetParameterization(CatmullRomParameterization::Centripetal);
+	doubleSpline.SetPoints(doublePoints);
+	for (double t = 0.05; t < (double)doubleSpline.GetNumberOfSegments() - 0.05; t += 0.1)
+	{
+		const double		   h	  = 1e-5;
+		Nexus::Point3D<double> before = doubleSpline.GetPoint(t - h);
+		Nexus::Point3D<double> after  = doubleSpline.GetPoint(t + h);
+		Nexus::Point3D<double> first  = doubleSpline.GetDerivative(t);
+		Nexus::Point3D<double> second = doubleSpline.GetSecondDerivative(t);
+		Nexus::Point3D<double> slopeA = doubleSpline.GetDerivative(t - h);
+		Nexus::Point3D<double> slopeB = doubleSpline.GetDerivative(t + h);
+		EXPECT_NEAR(first.X, (after.X - before.X) / (2 * h), 1e-5);
+		EXPECT_NEAR(first.Y, (after.Y - before.Y) / (2 * h), 1e-5);
+		EXPECT_NEAR(first.Z, (after.Z - before.Z) / (2 * h), 1e-5);
+		EXPECT_NEAR(second.X, (slopeB.X - slopeA.X) / (2 * h), 1e-4);
+		EXPECT_NEAR(second.Y, (slopeB.Y - slopeA.Y) / (2 * h), 1e-4);
+		EXPECT_NEAR(second.Z, (slopeB.Z - slopeA.Z) / (2 * h), 1e-4);
+	}
 }
 
-TEST(Point3D, Deconstruct)
+TEST(CatmullRom, ArcLengthParameterizationMovesAtConstantSpeed)
 {
-	Nexus::Point3D<int> value(5, 7, 2);
+	using namespace Nexus::Graphics;
 
-	int x, y, z;
-	value.Deconstruct(&x, &y, &z);
+	// a loop around uneven points, so that the parameter moves at a very different speed in each segment
+	std::vector<Nexus::Point3D<double>> points = {{10, 0, 0}, {3, 1, 7}, {0, 2, 10}, {-9, 0, 2}, {-6, -1, -8}, {0, 0, -10}, {8, 3, -5}};
 
-	EXPECT_EQ(value.X, x);
-	EXPECT_EQ(value.Y, y);
-	EXPECT_EQ(value.Z, z);
+	CatmullRom<double, 3> spline;
+	spline.SetParameterization(CatmullRomParameterization::Centripetal);
+	spline.SetLooped(true);
+	spline.SetPoints(points);
+
+	// the length measured by summing very short chords
+	const size_t		   steps		= 200000;
+	double				   chordLength	= 0.0;
+	std::vector<double>	   lengths		= {0.0};
+	Nexus::Point3D<double> previous		= spline.GetPoint(0.0);
+	double				   segmentCount = (double)spline.GetNumberOfSegments();
+	for (size_t i = 1; i <= steps; i++)
+	{
+		Nexus::Point3D<double> point = spline.GetPoint(segmentCount * (double)i / (double)steps);
+		chordLength += std::sqrt(std::pow(point.X - previous.X, 2) + std::pow(point.Y - previous.Y, 2) + std::pow(point.Z - previous.Z, 2));
+		lengths.push_back(chordLength);
+		previous = point;
+	}
+	EXPECT_NEAR(spline.GetLength(), chordLength, chordLength * 1e-6);
+
+	// the parameter found for a distance is the one whose measured length is that distance
+	for (size_t i = 0; i <= steps; i += 997)
+	{
+		double expected = segmentCount * (double)i / (double)steps;
+		EXPECT_NEAR(spline.GetParameterAtDistance(lengths[i]), expected, 1e-5);
+	}
+
+	EXPECT_DOUBLE_EQ(spline.GetParameterAtDistance(-1.0), 0.0);
+	EXPECT_DOUBLE_EQ(spline.GetParameterAtDistance(spline.GetLength() * 2.0), segmentCount);
 }
 
-TEST(Circle, To)
+TEST(PixelConversion, FlipSwizzleExpandAndPremultiplyMatchTheReference)
 {
-	const Nexus::Graphics::Circle<int> c(Nexus::Point2D<int>(50, 50), 25);
-	Nexus::Graphics::Circle<float>	   result = c.To<float>();
+	using namespace Nexus::Graphics;
 
-	EXPECT_EQ(result.GetPosition().X, 50.0f);
-	EXPECT_EQ(result.GetPosition().Y, 50.0f);
+	// odd sizes leave pixels for the scalar tail after the vectorised loops
+	const uint32_t					   width = 37, height = 9;
+	std::mt19937					   random(3);
+	std::uniform_int_distribution<int> byte(0, 255);
+	std::vector<uint8_t>			   pixels((size_t)width * height * 4);
+	for (uint8_t &value : pixels) { value = (uint8_t)byte(random); }
+
+	std::vector<uint8_t> flipped = pixels;
+	FlipRows(flipped.data(), width * 4, height);
+	for (uint32_t row = 0; row < height; row++)
+	{
+		EXPECT_TRUE(std::equal(flipped.begin() + row * width * 4,
+							   flipped.begin() + (row + 1) * width * 4,
+							   pixels.begin() + (height - 1 - row) * width * 4));
+	}
+
+	size_t				 pixelCount = (size_t)width * height;
+	std::vector<uint8_t> swapped(pixels.size());
+	SwapRedAndBlue(pixels.data(), swapped.data(), pixelCount);
+	for (size_t i = 0; i < pixelCount; i++)
+	{
+		EXPECT_EQ(swapped[i * 4], pixels[i * 4 + 2]);
+		EXPECT_EQ(swapped[i * 4 + 1], pixels[i * 4 + 1]);
+		EXPECT_EQ(swapped[i * 4 + 2], pixels[i * 4]);
+		EXPECT_EQ(swapped[i * 4 + 3], pixels[i * 4 + 3]);
+	}
+
+	// converting in place gives the same result
+	std::vector<uint8_t> swappedInPlace = pixels;
+	SwapRedAndBlue(swappedInPlace.data(), swappedInPlace.data(), pixelCount);
+	EXPECT_EQ(swappedInPlace, swapped);
+
+	std::vector<uint8_t> expanded(pixelCount * 4);
+	ExpandRGBToRGBA(pixels.data(), expanded.data(), pixelCount, 200);
+	for (size_t i = 0; i < pixelCount; i++)
+	{
+		EXPECT_EQ(expanded[i * 4], pixels[i * 3]);
+		EXPECT_EQ(expanded[i * 4 + 1], pixels[i * 3 + 1]);
+		EXPECT_EQ(expanded[i * 4 + 2], pixels[i * 3 + 2]);
+		EXPECT_EQ(expanded[i * 4 + 3], 200);
+	}
+
+	// every pair of colour and alpha is rounded to the nearest value
+	std::vector<uint8_t> opaque = {};
+	for (uint32_t alpha = 0; alpha < 256; alpha++)
+	{
+		for (uint32_t colour = 0; colour < 256; colour++)
+		{
+			opaque.insert(opaque.end(), {(uint8_t)colour, (uint8_t)(255 - colour), (uint8_t)(colour / 2), (uint8_t)alpha});
+		}
+	}
+
+	std::vector<uint8_t> premultiplied(opaque.size());
+	PremultiplyAlpha(opaque.data(), premultiplied.data(), opaque.size() / 4);
+	for (size_t i = 0; i < opaque.size(); i++)
+	{
+		uint32_t alpha	  = opaque[i | 3];
+		uint32_t expected = (i & 3) == 3 ? alpha : (2 * opaque[i] * alpha + 255) / 510;
+		ASSERT_EQ(premultiplied[i], expected);
+	}
 }
 
-TEST(Circle, ContainsValid)
+TEST(PixelConversion, SRGBEncodingRoundsAndRoundTrips)
 {
-	Nexus::Graphics::Circle<int> c(Nexus::Point2D<int>(50, 50), 25.0f);
-	bool						 result = c.Contains(Nexus::Point2D<int>(50, 50));
+	using namespace Nexus::Graphics;
 
-	EXPECT_EQ(result, true);
+	auto decode = [](double value) { return value <= 0.04045 ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4); };
+	auto encode = [](double value) { return value <= 0.0031308 ? value * 12.92 : 1.055 * std::pow(value, 1.0 / 2.4) - 0.055; };
+
+	std::vector<uint8_t> values = {};
+	for (uint32_t i = 0; i < 256; i++) { values.insert(values.end(), {(uint8_t)i, (uint8_t)(255 - i), (uint8_t)i, (uint8_t)i}); }
+
+	std::vector<float> linear(values.size());
+	ConvertSRGBToLinear(values.data(), linear.data(), 256);
+	for (size_t i = 0; i < values.size(); i++)
+	{
+		float expected = (i & 3) == 3 ? (float)values[i] / 255.0f : (float)decode((double)values[i] / 255.0);
+		ASSERT_EQ(linear[i], expected);
+	}
+
+	// every 8 bit value is encoded back to itself
+	std::vector<uint8_t> encoded(values.size());
+	ConvertLinearToSRGB(linear.data(), encoded.data(), 256);
+	EXPECT_EQ(encoded, values);
+
+	// any linear value is encoded to within one of the correctly rounded value
+	std::vector<float> sweep = {};
+	for (uint32_t i = 0; i <= 400000; i++) { sweep.push_back((float)i / 400000.0f); }
+	sweep.insert(sweep.end(), {-1.0f, 2.0f, std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity()});
+	while (sweep.size() % 4 != 0) { sweep.push_back(0.5f); }
+
+	std::vector<uint8_t> sweepEncoded(sweep.size());
+	ConvertLinearToSRGB(sweep.data(), sweepEncoded.data(), sweep.size() / 4);
+
+	size_t exact = 0;
+	for (size_t i = 0; i < sweep.size(); i++)
+	{
+		double clamped	= std::isnan(sweep[i]) ? 0.0 : std::clamp((double)sweep[i], 0.0, 1.0);
+		double expected = std::round(((i & 3) == 3 ? clamped : encode(clamped)) * 255.0);
+		ASSERT_LE(std::abs(sweepEncoded[i] - expected), 1.0) << sweep[i];
+		exact += sweepEncoded[i] == expected ? 1 : 0;
+	}
+	EXPECT_GT((double)exact / (double)sweep.size(), 0.99);
 }
 
-TEST(Circle, ContainsInvalid)
+TEST(PixelConversion, HalfConversionRoundsToNearestEven)
 {
-	Nexus::Graphics::Circle<int> c(Nexus::Point2D<int>(50, 50), 25.0f);
-	bool						 result = c.Contains(Nexus::Point2D<int>(20, 50));
+	using namespace Nexus::Graphics;
 
-	EXPECT_EQ(result, false);
+	// every half converts to a float and back to itself, except NaNs which all become the same quiet NaN
+	std::vector<uint16_t> halves(65536);
+	std::iota(halves.begin(), halves.end(), (uint16_t)0);
+
+	std::vector<float> floats(halves.size());
+	ConvertHalfToFloat(halves, floats.data());
+
+	std::vector<uint16_t> roundTrip(halves.size());
+	ConvertFloatToHalf(floats, roundTrip.data());
+	for (uint32_t i = 0; i < 65536; i++)
+	{
+		bool	 isNaN	  = (i & 0x7C00) == 0x7C00 && (i & 0x3FF) != 0;
+		uint16_t expected = isNaN ? (uint16_t)((i & 0x8000) | 0x7E00) : (uint16_t)i;
+		ASSERT_EQ(roundTrip[i], expected);
+		ASSERT_EQ(std::isnan(floats[i]), isNaN);
+	}
+
+	EXPECT_EQ(floats[0x3C00], 1.0f);
+	EXPECT_EQ(floats[0xC000], -2.0f);
+	EXPECT_EQ(floats[0x7BFF], 65504.0f);
+	EXPECT_EQ(floats[0x0001], std::ldexp(1.0f, -24));
+
+	std::vector<float> values = {1.0f + std::ldexp(1.0f, -11),
+								 1.0f + 3.0f * std::ldexp(1.0f, -11),
+								 65519.0f,
+								 65520.0f,
+								 std::ldexp(1.0f, -25),
+								 std::ldexp(1.5f, -25),
+								 -std::numeric_limits<float>::infinity(),
+								 1e-30f};
+	std::vector<uint16_t> converted(values.size());
+	ConvertFloatToHalf(values, converted.data());
+	EXPECT_EQ(converted, (std::vector<uint16_t> {0x3C00, 0x3C02, 0x7BFF, 0x7C00, 0x0000, 0x0001, 0xFC00, 0x0000}));
+
+	// random floats become the nearest half
+	std::mt19937						  random(9);
+	std::uniform_real_distribution<float> exponent(-26.0f, 15.9f);
+	std::vector<float>					  randomValues(10001);
+	for (float &value : randomValues) { value = std::exp2(exponent(random)) * (random() % 2 ? 1.0f : -1.0f); }
+
+	std::vector<uint16_t> randomHalves(randomValues.size());
+	ConvertFloatToHalf(randomValues, randomHalves.data());
+	for (size_t i = 0; i < randomValues.size(); i++)
+	{
+		uint16_t magnitude = randomHalves[i] & 0x7FFF;
+		double	 error	   = std::abs(std::abs((double)randomValues[i]) - (double)floats[magnitude]);
+		if (magnitude < 0x7C00)
+		{
+			EXPECT_LE(error, std::abs(std::abs((double)randomValues[i]) - (double)floats[magnitude + 1]));
+		}
+		if (magnitude > 0)
+		{
+			EXPECT_LE(error, std::abs(std::abs((double)randomValues[i]) - (double)floats[magnitude - 1]));
+		}
+	}
 }
 
-TEST(Circle, Deconstruct)
+TEST(PixelConversion, BatchedConversionsMatchOnePixelAtATime)
 {
-	Nexus::Graphics::Circle<int> c(Nexus::Point2D<int>(50, 50), 25.0f);
+	using namespace Nexus::Graphics;
 
-	int x, y, radius;
-	c.Deconstruct(&x, &y, &radius);
+	// converting one pixel at a time only uses the scalar code, so this compares the vectorised paths against it byte for byte
+	const size_t						  pixelCount = 1003;
+	std::mt19937						  random(5);
+	std::uniform_int_distribution<int>	  byte(0, 255);
+	std::uniform_real_distribution<float> value(-0.1f, 1.1f);
 
-	EXPECT_EQ(x, 50);
-	EXPECT_EQ(y, 50);
-	EXPECT_EQ(radius, 25);
+	std::vector<uint8_t> pixels(pixelCount * 4);
+	std::vector<float>	 linear(pixelCount * 4);
+	for (uint8_t &pixel : pixels) { pixel = (uint8_t)byte(random); }
+	for (float &channel : linear) { channel = value(random) * (random() % 8 == 0 ? 70000.0f : 1.0f); }
+
+	std::vector<uint8_t> batch(pixelCount * 4), single(pixelCount * 4);
+
+	SwapRedAndBlue(pixels.data(), batch.data(), pixelCount);
+	for (size_t i = 0; i < pixelCount; i++) { SwapRedAndBlue(pixels.data() + i * 4, single.data() + i * 4, 1); }
+	EXPECT_EQ(batch, single);
+
+	ExpandRGBToRGBA(pixels.data(), batch.data(), pixelCount);
+	for (size_t i = 0; i < pixelCount; i++) { ExpandRGBToRGBA(pixels.data() + i * 3, single.data() + i * 4, 1); }
+	EXPECT_EQ(batch, single);
+
+	PremultiplyAlpha(pixels.data(), batch.data(), pixelCount);
+	for (size_t i = 0; i < pixelCount; i++) { PremultiplyAlpha(pixels.data() + i * 4, single.data() + i * 4, 1); }
+	EXPECT_EQ(batch, single);
+
+	ConvertLinearToSRGB(linear.data(), batch.data(), pixelCount);
+	for (size_t i = 0; i < pixelCount; i++) { ConvertLinearToSRGB(linear.data() + i * 4, single.data() + i * 4, 1); }
+	EXPECT_EQ(batch, single);
+
+	std::vector<uint16_t> halves(linear.size()), singleHalves(linear.size());
+	ConvertFloatToHalf(linear, halves.data());
+	for (size_t i = 0; i < linear.size(); i++) { ConvertFloatToHalf(std::span<const float>(&linear[i], 1), &singleHalves[i]); }
+	EXPECT_EQ(halves, singleHalves);
+
+	std::vector<float> floats(halves.size()), singleFloats(halves.size());
+	ConvertHalfToFloat(halves, floats.data());
+	for (size_t i = 0; i < halves.size(); i++) { ConvertHalfToFloat(std::span<const uint16_t>(&halves[i], 1), &singleFloats[i]); }
+	EXPECT_EQ(std::memcmp(floats.data(), singleFloats.data(), floats.size() * sizeof(float)), 0);
 }
 
-TEST(ScopedEvent, Behaviour)
+TEST(TextureStreamer, GeneratesMipChainsInLinearSpace)
 {
-	Nexus::EventHandler<> eventHandler;
+	using namespace Nexus::Graphics;
 
-	EXPECT_EQ(eventHandler.GetDelegateCount(), 0);
+	// columns alternate between black and white, so every texel of the second mip averages one of each
+	Image image	 = {};
+	image.Width	 = 8;
+	image.Height = 4;
+	image.Format = PixelFormat::R8_G8_B8_A8_UNorm;
+	image.Pixels.resize(8 * 4 * 4);
+	for (size_t i = 0; i < image.Pixels.size(); i++) { image.Pixels[i] = (char)((i / 4) % 2 == 0 ? 0 : 255); }
+
+	std::vector<Image> mips = GenerateMipChain(image, 0, 3);
+	ASSERT_EQ(mips.size(), 3);
+	EXPECT_EQ(mips[0].Pixels, image.Pixels);
+	EXPECT_EQ(mips[1].Width, 4);
+	EXPECT_EQ(mips[1].Height, 2);
+	EXPECT_EQ(mips[2].Width, 2);
+	EXPECT_EQ(mips[2].Height, 1);
+	for (char value : mips[1].Pixels) { EXPECT_EQ((uint8_t)value, 128); }
 
+	// sRGB texels are averaged after decoding, so half of the light of white is brighter than the middle of the encoding
+	image.Format = PixelFormat::R8_G8_B8_A8_UNorm_SRGB;
+
+	std::vector<Image> srgbMips = GenerateMipChain(image, 1, 3);
+	ASSERT_EQ(srgbMips.size(), 2);
+	EXPECT_EQ(srgbMips[0].Format, PixelFormat::R8_G8_B8_A8_UNorm_SRGB);
+	for (size_t i = 0; i < srgbMips[0].Pixels.size(); i++)
 	{
-		Nexus::ScopedEvent<> event(&eventHandler, []() {});
-		EXPECT_EQ(eventHandler.GetDelegateCount(), 1);
+		// alpha is stored linearly
+		EXPECT_NEAR((uint8_t)srgbMips[0].Pixels[i], i % 4 == 3 ? 128 : 188, 1);
 	}
 
-	EXPECT_EQ(eventHandler.GetDelegateCount(), 0);
+	// skipping the first mips gives the same mips as the end of the full chain
+	std::vector<Image> tail = GenerateMipChain(image, 2, 3);
+	ASSERT_EQ(tail.size(), 1);
+	EXPECT_EQ(tail[0].Pixels, srgbMips[1].Pixels);
+
+	// sides that are odd are filtered with three texels, so every texel contributes and the average of the row is kept
+	Image odd  = {};
+	odd.Width  = 3;
+	odd.Height = 1;
+	odd.Format = PixelFormat::R32_G32_B32_A32_Float;
+	odd.Pixels.resize(3 * 4 * sizeof(float));
+	std::vector<float> values = {1, 1, 1, 1, 3, 3, 3, 3, 8, 8, 8, 8};
+	memcpy(odd.Pixels.data(), values.data(), odd.Pixels.size());
+
+	std::vector<Image> oddMips = GenerateMipChain(odd, 1, 2);
+	ASSERT_EQ(oddMips.size(), 1);
+	EXPECT_EQ(oddMips[0].Width, 1);
+	EXPECT_EQ(oddMips[0].Height, 1);
+	EXPECT_FLOAT_EQ(((const float *)oddMips[0].Pixels.data())[0], 4.0f);
+
+	// a side of five spreads its texels over two, weighting the middle texel equally between them
+	odd.Width = 5;
+	odd.Pixels.resize(5 * 4 * sizeof(float));
+	values = {0, 0, 0, 0, 5, 5, 5, 5, 10, 10, 10, 10, 15, 15, 15, 15, 20, 20, 20, 20};
+	memcpy(odd.Pixels.data(), values.data(), odd.Pixels.size());
+
+	oddMips = GenerateMipChain(odd, 1, 2);
+	ASSERT_EQ(oddMips.size(), 1);
+	ASSERT_EQ(oddMips[0].Width, 2);
+	EXPECT_FLOAT_EQ(((const float *)oddMips[0].Pixels.data())[0], (0.0f * 2.0f + 5.0f * 2.0f + 10.0f * 1.0f) / 5.0f);
+	EXPECT_FLOAT_EQ(((const float *)oddMips[0].Pixels.data())[4], (10.0f * 1.0f + 15.0f * 2.0f + 20.0f * 2.0f) / 5.0f);
+
+	EXPECT_THROW(GenerateMipChain({.Width = 1, .Height = 1, .Pixels = std::vector<char>(2), .Format = PixelFormat::R8_G8_UNorm}, 0, 1),
+				 std::runtime_error);
+}
+
+TEST(TextureStreamer, SelectsMipsFromTheSizeOnScreen)
+{
+	using namespace Nexus::Graphics;
+
+	EXPECT_EQ(SelectTextureMip(1024, 1024, 10, 1024.0f), 0);
+	EXPECT_EQ(SelectTextureMip(1024, 1024, 10, 2048.0f), 0);
+	EXPECT_EQ(SelectTextureMip(1024, 1024, 10, 512.0f), 1);
+	EXPECT_EQ(SelectTextureMip(1024, 512, 10, 100.0f), 3);
+	EXPECT_EQ(SelectTextureMip(1024, 1024, 10, 0.5f), 9);
+	EXPECT_EQ(SelectTextureMip(1024, 1024, 10, 0.0f), 9);
+
+	EXPECT_EQ(GetEvictionMip(1024, 512, 10, 64), 4);
+	EXPECT_EQ(GetEvictionMip(32, 32, 5, 64), 0);
+	EXPECT_EQ(GetEvictionMip(4096, 4096, 3, 64), 2);
+
+	EXPECT_EQ(GetResidentTextureSize(8, 4, 3, 0, PixelFormat::R8_G8_B8_A8_UNorm), (32 + 8 + 2) * 4);
+	EXPECT_EQ(GetResidentTextureSize(8, 4, 3, 1, PixelFormat::R32_G32_B32_A32_Float), (8 + 2) * 16);
+	EXPECT_EQ(GetResidentTextureSize(8, 4, 3, 3, PixelFormat::R8_G8_B8_A8_UNorm), 0);
+}
+
+TEST(TextureStreamer, PlansLoadsWithinTheBudgetByEvictingTheLeastRecentlyUsed)
+{
+	using namespace Nexus::Graphics;
+
+	auto createResidency = [](uint32_t residentMip, uint32_t desiredMip, uint64_t lastUsedFrame)
+	{
+		TextureResidency residency = {};
+		residency.Width			   = 256;
+		residency.Height		   = 256;
+		residency.MipCount		   = 8;
+		residency.ResidentMip	   = residentMip;
+		residency.EvictionMip	   = 2;
+		residency.DesiredMip	   = desiredMip;
+		residency.LastUsedFrame	   = lastUsedFrame;
+		return residency;
+	};
+
+	auto getSize = [](uint32_t mip) { return GetResidentTextureSize(256, 256, 8, mip, PixelFormat::R8_G8_B8_A8_UNorm); };
+
+	// the first texture is fully resident but has not been drawn for a while, the others were drawn this frame and need finer mips
+	std::vector<TextureResidency> textures = {createResidency(0, 0, 1), createResidency(2, 0, 5), createResidency(2, 1, 5)};
+	size_t						  budget   = getSize(0) + getSize(2) * 2;
+
+	TextureResidencyPlan plan = PlanTextureResidency(textures, budget, 5, 4);
+	ASSERT_EQ(plan.Evictions.size(), 1);
+	EXPECT_EQ(plan.Evictions[0].Texture, 0);
+	EXPECT_EQ(plan.Evictions[0].Mip, 2);
+
+	// the texture that is missing the most mips is loaded first, which leaves no room for the other
+	ASSERT_EQ(plan.Loads.size(), 1);
+	EXPECT_EQ(plan.Loads[0].Texture, 1);
+	EXPECT_EQ(plan.Loads[0].Mip, 0);
+
+	// with a little more room the other texture is given as many mips as fit
+	plan = PlanTextureResidency(textures, budget + getSize(1) - getSize(2), 5, 4);
+	ASSERT_EQ(plan.Loads.size(), 2);
+	EXPECT_EQ(plan.Loads[1].Texture, 2);
+	EXPECT_EQ(plan.Loads[1].Mip, 1);
+
+	plan = PlanTextureResidency(textures, budget * 2, 5, 1);
+	EXPECT_TRUE(plan.Evictions.empty());
+	ASSERT_EQ(plan.Loads.size(), 1);
+	EXPECT_EQ(plan.Loads[0].Texture, 1);
+
+	// when the budget shrinks, textures that are still drawn only lose the mips that they no longer need and loading textures are left alone
+	textures			= {createResidency(0, 0, 4), createResidency(0, 1, 5), createResidency(0, 0, 5), createResidency(0, 0, 3)};
+	textures[3].Loading = true;
+
+	plan = PlanTextureResidency(textures, 0, 5, 4);
+	ASSERT_EQ(plan.Evictions.size(), 2);
+	EXPECT_EQ(plan.Evictions[0].Texture, 0);
+	EXPECT_EQ(plan.Evictions[0].Mip, 2);
+	EXPECT_EQ(plan.Evictions[1].Texture, 1);
+	EXPECT_EQ(plan.Evictions[1].Mip, 1);
+	EXPECT_TRUE(plan.Loads.empty());
 }
 
 void CreateGraphicsAPIAndDevice(Nexus::Graphics::GraphicsAPI					  api,
@@ -252,4 +2831,209 @@ TEST(CopyTextureToBufferVulkan, Successful)
 {
 	EXPECT_TRUE(RunTextureCopyTest(Nexus::Graphics::GraphicsAPI::Vulkan));
 }
-#endif
\ No newline at end of file
+#endif
+
+bool RunTextureReadbackTest(Nexus::Graphics::GraphicsAPI api)
+{
+	std::unique_ptr<Nexus::Graphics::IGraphicsAPI>	 graphicsAPI = nullptr;
+	std::unique_ptr<Nexus::Graphics::GraphicsDevice> device		 = nullptr;
+	CreateGraphicsAPIAndDevice(api, graphicsAPI, device);
+
+	Nexus::Ref<Nexus::Graphics::ICommandQueue> commandQueue = device->CreateCommandQueue({});
+
+	Nexus::Graphics::TextureDescription textureSpec = {};
+	textureSpec.Width								= 4;
+	textureSpec.Height								= 4;
+	Nexus::Ref<Nexus::Graphics::Texture> texture	= device->CreateTexture(textureSpec);
+
+	std::vector<uint32_t> colours(16);
+	std::iota(colours.begin(), colours.end(), 0xFF000000);
+	device->WriteToTexture(texture, commandQueue, 0, 0, 0, 0, 0, 4, 4, colours.data(), colours.size() * sizeof(uint32_t));
+
+	// several reads in flight at once each get their own buffer, and the buffers are reused once the reads have been resolved
+	bool matches = true;
+	for (uint32_t frame = 0; frame < 4; frame++)
+	{
+		Nexus::Ref<Nexus::Graphics::TextureReadback> first	= device->ReadFromTextureAsync(texture, commandQueue, 0, 0, 0, 0, 0, 4, 4);
+		Nexus::Ref<Nexus::Graphics::TextureReadback> second = device->ReadFromTextureAsync(texture, commandQueue, 0, 0, 0, 0, 0, 2, 2);
+
+		matches &= memcmp(first->GetData().data(), colours.data(), colours.size() * sizeof(uint32_t)) == 0;
+
+		// the corner is read back tightly packed, so its second row follows straight after its first
+		const std::vector<char> &corner = second->GetData();
+		matches &= memcmp(corner.data(), &colours[0], 2 * sizeof(uint32_t)) == 0;
+		matches &= memcmp(corner.data() + 2 * sizeof(uint32_t), &colours[4], 2 * sizeof(uint32_t)) == 0;
+	}
+
+	Nexus::Graphics::ReadbackBufferPool &pool = device->GetReadbackBufferPool();
+	matches &= pool.GetBufferCount() == 2;
+
+	// a buffer that stops being reused is destroyed once enough other reads have been made
+	device->ReadFromTextureAsync(texture, commandQueue, 0, 0, 0, 0, 0, 4, 4)->GetData();
+	for (uint64_t i = 0; i <= Nexus::Graphics::ReadbackBufferPool::c_MaxIdleAcquisitions; i++)
+	{
+		device->ReadFromTextureAsync(texture, commandQueue, 0, 0, 0, 0, 0, 2, 2)->GetData();
+	}
+	matches &= pool.GetBufferCount() == 1;
+
+	pool.Trim();
+	matches &= pool.GetBufferCount() == 0;
+	return matches;
+}
+
+#if defined(NX_PLATFORM_OPENGL)
+TEST(ReadFromTextureAsyncOpenGL, Successful)
+{
+	EXPECT_TRUE(RunTextureReadbackTest(Nexus::Graphics::GraphicsAPI::OpenGL));
+}
+#endif
+
+#if defined(NX_PLATFORM_D3D12)
+TEST(ReadFromTextureAsyncD3D12, Successful)
+{
+	EXPECT_TRUE(RunTextureReadbackTest(Nexus::Graphics::GraphicsAPI::D3D12));
+}
+#endif
+
+#if defined(NX_PLATFORM_VULKAN)
+TEST(ReadFromTextureAsyncVulkan, Successful)
+{
+	EXPECT_TRUE(RunTextureReadbackTest(Nexus::Graphics::GraphicsAPI::Vulkan));
+}
+#endif
+
+bool RunTextureStreamerTest(Nexus::Graphics::GraphicsAPI api)
+{
+	using namespace Nexus::Graphics;
+
+	std::unique_ptr<IGraphicsAPI>	graphicsAPI = nullptr;
+	std::unique_ptr<GraphicsDevice> device		= nullptr;
+	CreateGraphicsAPIAndDevice(api, graphicsAPI, device);
+
+	Nexus::Ref<ICommandQueue> commandQueue = device->CreateCommandQueue({});
+
+	std::string			  filepath = (std::filesystem::temp_directory_path() / "NexusTextureStreamerTest.png").string();
+	std::vector<uint32_t> pixels(256 * 256, 0xFF336699);
+	stbi_write_png(filepath.c_str(), 256, 256, 4, pixels.data(), 256 * sizeof(uint32_t));
+
+	TextureStreamer				streamer(device.get(), commandQueue, {.MinimumResidentSize = 64});
+	Nexus::Ref<StreamedTexture> texture = streamer.Load(filepath, false);
+
+	// the textures are decoded on the workers, so frames are run until the streamer has applied what they loaded
+	auto runFramesUntil = [&](const std::function<bool()> &condition, float projectedSize)
+	{
+		auto start = std::chrono::steady_clock::now();
+		while (!condition() && std::chrono::steady_clock::now() - start < std::chrono::seconds(10))
+		{
+			device->GetFrameTracker().BeginFrame();
+			if (projectedSize > 0.0f)
+			{
+				streamer.RecordUsage(texture, projectedSize);
+			}
+
+			streamer.Update();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		return condition();
+	};
+
+	// only the mips that fit within the minimum resident size are loaded at first
+	bool succeeded = runFramesUntil([&]() { return texture->IsLoaded(); }, 0.0f);
+	succeeded &= !texture->HasFailed() && texture->GetTexture() != nullptr;
+
+	const TextureResidency &residency	= texture->GetResidency();
+	size_t					initialSize = GetResidentTextureSize(256, 256, residency.MipCount, residency.EvictionMip, residency.Format);
+	succeeded &= residency.EvictionMip == 2 && residency.ResidentMip == residency.EvictionMip;
+	succeeded &= streamer.GetResidentSize() == initialSize;
+
+	// drawing the texture at its full size streams in the rest of its mips
+	succeeded &= runFramesUntil([&]() { return residency.ResidentMip == 0 && !residency.Loading; }, 256.0f);
+	succeeded &= streamer.GetResidentSize() == GetResidentTextureSize(256, 256, residency.MipCount, 0, residency.Format);
+
+	// once it stops being drawn and the budget is lowered, it is evicted back down to the mips it was loaded with
+	streamer.SetSettings({.MemoryBudget = initialSize, .MinimumResidentSize = 64});
+	succeeded &= runFramesUntil([&]() { return residency.ResidentMip == residency.EvictionMip; }, 0.0f);
+	succeeded &= streamer.GetResidentSize() == initialSize;
+
+	texture = nullptr;
+	streamer.Update();
+	succeeded &= streamer.GetResidentSize() == 0;
+
+	std::filesystem::remove(filepath);
+	return succeeded;
+}
+
+#if defined(NX_PLATFORM_OPENGL)
+TEST(TextureStreamerOpenGL, Successful)
+{
+	EXPECT_TRUE(RunTextureStreamerTest(Nexus::Graphics::GraphicsAPI::OpenGL));
+}
+#endif
+
+#if defined(NX_PLATFORM_D3D12)
+TEST(TextureStreamerD3D12, Successful)
+{
+	EXPECT_TRUE(RunTextureStreamerTest(Nexus::Graphics::GraphicsAPI::D3D12));
+}
+#endif
+
+#if defined(NX_PLATFORM_VULKAN)
+TEST(TextureStreamerVulkan, Successful)
+{
+	EXPECT_TRUE(RunTextureStreamerTest(Nexus::Graphics::GraphicsAPI::Vulkan));
+}
+#endif
+
+bool RunComponentResourceLoadTest(Nexus::Graphics::GraphicsAPI api)
+{
+	std::unique_ptr<Nexus::Graphics::IGraphicsAPI>	 graphicsAPI = nullptr;
+	std::unique_ptr<Nexus::Graphics::GraphicsDevice> device		 = nullptr;
+	CreateGraphicsAPIAndDevice(api, graphicsAPI, device);
+
+	Nexus::Ref<Nexus::Graphics::ICommandQueue> commandQueue = device->CreateCommandQueue({});
+
+	std::string filepath = (std::filesystem::temp_directory_path() / "Nexus Component Test.obj").string();
+	std::ofstream(filepath) << "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n";
+
+	std::map<std::string, Nexus::ECS::ComponentStorage> &components = Nexus::ECS::ComponentRegistry::GetRegistry().GetRegisteredComponents();
+	const Nexus::ECS::ComponentStorage					&storage	= components.at(typeid(Nexus::ModelRenderer).name());
+
+	Nexus::ModelRenderer source = {.FilePath = filepath};
+	Nexus::ECS::Registry registry;
+	registry.AddEntity(Nexus::Entity(Nexus::GUID(1), "Model"));
+
+	// a component that is deserialized on its own loads its model once its resources are loaded, for both encodings
+	bool  loaded	 = true;
+	void *fromString = storage.StringDeserializer(Nexus::GUID(1), registry, storage.StringSerializer(&source), 0);
+	storage.LoadResources(fromString, device.get(), commandQueue);
+	loaded &= static_cast<Nexus::ModelRenderer *>(fromString)->Model != nullptr;
+
+	void *fromYaml = storage.YamlDeserializer(Nexus::GUID(1), registry, storage.YamlSerializer(&source), 1);
+	storage.LoadResources(fromYaml, device.get(), commandQueue);
+	loaded &= static_cast<Nexus::ModelRenderer *>(fromYaml)->Model != nullptr;
+
+	std::filesystem::remove(filepath);
+	return loaded;
+}
+
+#if defined(NX_PLATFORM_OPENGL)
+TEST(LoadComponentResourcesOpenGL, Successful)
+{
+	EXPECT_TRUE(RunComponentResourceLoadTest(Nexus::Graphics::GraphicsAPI::OpenGL));
+}
+#endif
+
+#if defined(NX_PLATFORM_D3D12)
+TEST(LoadComponentResourcesD3D12, Successful)
+{
+	EXPECT_TRUE(RunComponentResourceLoadTest(Nexus::Graphics::GraphicsAPI::D3D12));
+}
+#endif
+
+#if defined(NX_PLATFORM_VULKAN)
+TEST(LoadComponentResourcesVulkan, Successful)
+{
+	EXPECT_TRUE(RunComponentResourceLoadTest(Nexus::Graphics::GraphicsAPI::Vulkan));
+}
+#endif